@@ -0,0 +1,461 @@
+#include <linear_algebra.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace STD_LA;
+
+//==================================================================================================
+//  Benchmarks covering the arithmetic operators for each kind of operand: dynamic and fixed-size
+//  engines, and transpose, submatrix, row, and column views.  Each benchmark reports its
+//  throughput both as floating-point operations per second (FLOPS) and as bytes of operands and
+//  result moved per second (bytes_per_second), so that regressions in the dispatch performed by
+//  the arithmetic traits show up as a drop in either.
+//
+//  Dynamic operands sweep sizes from 2 to 4096 (matrix-matrix products stop at 2048, since a
+//  single product of order 4096 takes several seconds); fixed-size operands cover orders 2 to 32.
+//==================================================================================================
+//
+namespace {
+
+template<class MT>
+void
+fill_matrix(MT& m)
+{
+    using elem_t = typename MT::element_type;
+
+    for (typename MT::index_type i = 0;  i < m.rows();  ++i)
+    {
+        for (typename MT::index_type j = 0;  j < m.columns();  ++j)
+        {
+            m(i, j) = static_cast<elem_t>((i*7 + j*3) % 11 + 1) / static_cast<elem_t>(11);
+        }
+    }
+}
+
+template<class VT>
+void
+fill_vector(VT& v)
+{
+    using elem_t = typename VT::element_type;
+
+    for (typename VT::index_type i = 0;  i < v.size();  ++i)
+    {
+        v(i) = static_cast<elem_t>((i*5) % 7 + 1) / static_cast<elem_t>(7);
+    }
+}
+
+//- Records the work done per iteration: FLOPs performed, and elements read and written.
+//
+template<class T>
+void
+set_counters(benchmark::State& state, double flops, double elems)
+{
+    state.counters["FLOPS"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * elems * sizeof(T)));
+}
+
+void
+elementwise_sizes(benchmark::internal::Benchmark* b)
+{
+    b->RangeMultiplier(4)->Range(2, 4096);
+}
+
+void
+product_sizes(benchmark::internal::Benchmark* b)
+{
+    b->RangeMultiplier(4)->Range(2, 2048);
+}
+
+//- The element-wise operations, applied to two matrix or vector operands, or to one operand and
+//  a scalar.  Negation is materialized, since otherwise it would only create a view.
+//
+struct add_op
+{
+    template<class A, class B>
+    static auto     apply(A const& a, B const& b) { return a + b; }
+};
+
+struct sub_op
+{
+    template<class A, class B>
+    static auto     apply(A const& a, B const& b) { return a - b; }
+};
+
+struct scale_op
+{
+    template<class A, class S>
+    static auto     apply(A const& a, S s) { return a * s; }
+};
+
+struct div_op
+{
+    template<class A, class S>
+    static auto     apply(A const& a, S s) { return a / s; }
+};
+
+}   //- anonymous namespace
+
+
+//==================================================================================================
+//  Dynamic engines.
+//==================================================================================================
+//
+template<class T, class OP>
+static void
+BM_DynMatBinary(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = OP::apply(m1, m2);
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 1.0*n*n, 3.0*n*n);
+}
+
+template<class T, class OP>
+static void
+BM_DynMatScalar(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n);
+
+    fill_matrix(m1);
+
+    for (auto _ : state)
+    {
+        auto    m3 = OP::apply(m1, T{3});
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 1.0*n*n, 2.0*n*n);
+}
+
+template<class T>
+static void
+BM_DynMatNegate(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n);
+
+    fill_matrix(m1);
+
+    for (auto _ : state)
+    {
+        dyn_matrix<T>   m3 = -m1;
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 1.0*n*n, 2.0*n*n);
+}
+
+template<class T>
+static void
+BM_DynMatMul(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1 * m2;
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 2.0*n*n*n, 3.0*n*n);
+}
+
+template<class T>
+static void
+BM_DynMatVec(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n);
+    dyn_vector<T>       v1(n);
+
+    fill_matrix(m1);
+    fill_vector(v1);
+
+    for (auto _ : state)
+    {
+        auto    v2 = m1 * v1;
+        benchmark::DoNotOptimize(v2(0));
+    }
+    set_counters<T>(state, 2.0*n*n, 1.0*n*n + 2.0*n);
+}
+
+template<class T, class OP>
+static void
+BM_DynVecBinary(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_vector<T>       v1(n), v2(n);
+
+    fill_vector(v1);
+    fill_vector(v2);
+
+    for (auto _ : state)
+    {
+        auto    v3 = OP::apply(v1, v2);
+        benchmark::DoNotOptimize(v3(0));
+    }
+    set_counters<T>(state, 1.0*n, 3.0*n);
+}
+
+template<class T>
+static void
+BM_DynVecDot(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_vector<T>       v1(n), v2(n);
+
+    fill_vector(v1);
+    fill_vector(v2);
+
+    for (auto _ : state)
+    {
+        auto    s = v1 * v2;
+        benchmark::DoNotOptimize(s);
+    }
+    set_counters<T>(state, 2.0*n, 2.0*n);
+}
+
+BENCHMARK_TEMPLATE(BM_DynMatBinary, float, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatBinary, double, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatBinary, double, sub_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatBinary, complex<double>, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatScalar, double, scale_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatScalar, double, div_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatNegate, double)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatMul, float)->Apply(product_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatMul, double)->Apply(product_sizes);
+BENCHMARK_TEMPLATE(BM_DynMatVec, double)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_DynVecBinary, double, add_op)->RangeMultiplier(8)->Range(2, 1 << 20);
+BENCHMARK_TEMPLATE(BM_DynVecBinary, double, sub_op)->RangeMultiplier(8)->Range(2, 1 << 20);
+BENCHMARK_TEMPLATE(BM_DynVecDot, double)->RangeMultiplier(8)->Range(2, 1 << 20);
+
+
+//==================================================================================================
+//  Fixed-size engines.
+//==================================================================================================
+//
+template<class T, ptrdiff_t N, class OP>
+static void
+BM_FsMatBinary(benchmark::State& state)
+{
+    fs_matrix<T, N, N>  m1, m2;
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m1);
+        auto    m3 = OP::apply(m1, m2);
+        benchmark::DoNotOptimize(m3);
+    }
+    set_counters<T>(state, 1.0*N*N, 3.0*N*N);
+}
+
+template<class T, ptrdiff_t N>
+static void
+BM_FsMatMul(benchmark::State& state)
+{
+    fs_matrix<T, N, N>  m1, m2;
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m1);
+        auto    m3 = m1 * m2;
+        benchmark::DoNotOptimize(m3);
+    }
+    set_counters<T>(state, 2.0*N*N*N, 3.0*N*N);
+}
+
+template<class T, ptrdiff_t N>
+static void
+BM_FsMatVec(benchmark::State& state)
+{
+    fs_matrix<T, N, N>  m1;
+    fs_vector<T, N>     v1;
+
+    fill_matrix(m1);
+    fill_vector(v1);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v1);
+        auto    v2 = m1 * v1;
+        benchmark::DoNotOptimize(v2);
+    }
+    set_counters<T>(state, 2.0*N*N, 1.0*N*N + 2.0*N);
+}
+
+BENCHMARK_TEMPLATE(BM_FsMatBinary, float, 2, add_op);
+BENCHMARK_TEMPLATE(BM_FsMatBinary, float, 4, add_op);
+BENCHMARK_TEMPLATE(BM_FsMatBinary, double, 8, add_op);
+BENCHMARK_TEMPLATE(BM_FsMatBinary, double, 32, add_op);
+BENCHMARK_TEMPLATE(BM_FsMatBinary, double, 8, sub_op);
+BENCHMARK_TEMPLATE(BM_FsMatMul, float, 2);
+BENCHMARK_TEMPLATE(BM_FsMatMul, float, 4);
+BENCHMARK_TEMPLATE(BM_FsMatMul, double, 4);
+BENCHMARK_TEMPLATE(BM_FsMatMul, double, 8);
+BENCHMARK_TEMPLATE(BM_FsMatMul, double, 16);
+BENCHMARK_TEMPLATE(BM_FsMatMul, double, 32);
+BENCHMARK_TEMPLATE(BM_FsMatVec, float, 4);
+BENCHMARK_TEMPLATE(BM_FsMatVec, double, 4);
+BENCHMARK_TEMPLATE(BM_FsMatVec, double, 16);
+
+
+//==================================================================================================
+//  View engines.  Transposes and submatrices take part in element-wise operations and products
+//  with a dynamic operand; rows and columns take part in vector operations with a dynamic vector.
+//  A submatrix is the leading n x n block of an (n + 3) x (n + 3) matrix.
+//==================================================================================================
+//
+template<class T, class OP>
+static void
+BM_TransposeBinary(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = OP::apply(m1.t(), m2);
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 1.0*n*n, 3.0*n*n);
+}
+
+template<class T>
+static void
+BM_TransposeMul(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1.t() * m2;
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 2.0*n*n*n, 3.0*n*n);
+}
+
+//- Materializes a transpose, which copies between opposite storage orders.
+//
+template<class T>
+static void
+BM_TransposeCopy(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n);
+
+    fill_matrix(m1);
+
+    for (auto _ : state)
+    {
+        dyn_matrix<T>   m2 = m1.t();
+        benchmark::DoNotOptimize(m2(0, 0));
+    }
+    set_counters<T>(state, 0.0, 2.0*n*n);
+}
+
+template<class T, class OP>
+static void
+BM_SubmatrixBinary(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n + 3, n + 3), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = OP::apply(m1.submatrix(0, n, 0, n), m2);
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 1.0*n*n, 3.0*n*n);
+}
+
+template<class T>
+static void
+BM_SubmatrixMul(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n + 3, n + 3), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1.submatrix(0, n, 0, n) * m2;
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_counters<T>(state, 2.0*n*n*n, 3.0*n*n);
+}
+
+template<class T, class OP>
+static void
+BM_RowBinary(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(4, n);
+    dyn_vector<T>       v1(n);
+
+    fill_matrix(m1);
+    fill_vector(v1);
+
+    for (auto _ : state)
+    {
+        auto    v2 = OP::apply(m1.row(1), v1);
+        benchmark::DoNotOptimize(v2(0));
+    }
+    set_counters<T>(state, 1.0*n, 3.0*n);
+}
+
+template<class T, class OP>
+static void
+BM_ColumnBinary(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, 4);
+    dyn_vector<T>       v1(n);
+
+    fill_matrix(m1);
+    fill_vector(v1);
+
+    for (auto _ : state)
+    {
+        auto    v2 = OP::apply(m1.column(1), v1);
+        benchmark::DoNotOptimize(v2(0));
+    }
+    set_counters<T>(state, 1.0*n, 3.0*n);
+}
+
+BENCHMARK_TEMPLATE(BM_TransposeBinary, double, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_TransposeBinary, double, sub_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_TransposeMul, double)->Apply(product_sizes);
+BENCHMARK_TEMPLATE(BM_TransposeCopy, float)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_TransposeCopy, double)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_SubmatrixBinary, double, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_SubmatrixMul, double)->Apply(product_sizes);
+BENCHMARK_TEMPLATE(BM_RowBinary, double, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_ColumnBinary, double, add_op)->Apply(elementwise_sizes);
+BENCHMARK_TEMPLATE(BM_ColumnBinary, double, sub_op)->Apply(elementwise_sizes);
@@ -0,0 +1,221 @@
+#include <linear_algebra.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace STD_LA;
+
+//==================================================================================================
+//  Benchmarks comparing the blocked matrix-matrix multiplication kernel used by operator * for
+//  spannable engines against the simple triple loop used for all other engines, and against
+//  the Strassen-Winograd recursion used by matrix_strassen_operation_traits, and with transposed
+//  and hermitian operands.  Throughput is reported as floating-point operations per second
+//  (2*N^3 per product).
+//==================================================================================================
+//
+namespace {
+
+template<class MT>
+void
+fill_matrix(MT& m)
+{
+    using elem_t = typename MT::element_type;
+
+    for (typename MT::index_type i = 0;  i < m.rows();  ++i)
+    {
+        for (typename MT::index_type j = 0;  j < m.columns();  ++j)
+        {
+            m(i, j) = static_cast<elem_t>((i*7 + j*3) % 11) / static_cast<elem_t>(11);
+        }
+    }
+}
+
+//- This is the loop performed by matrix_multiplication_arithmetic_traits for engines that
+//  cannot use the blocked kernel.
+//
+template<class M1, class M2, class MR>
+void
+simple_multiply(M1 const& m1, M2 const& m2, MR& mr)
+{
+    using elem_t = typename MR::element_type;
+
+    for (ptrdiff_t i = 0;  i < mr.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < mr.columns();  ++j)
+        {
+            elem_t  er{};
+
+            for (ptrdiff_t k = 0;  k < m1.columns();  ++k)
+            {
+                er = er + m1(i, k) * m2(k, j);
+            }
+            mr(i, j) = er;
+        }
+    }
+}
+
+void
+set_flop_counter(benchmark::State& state, ptrdiff_t n)
+{
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n,
+                                                 benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}   //- anonymous namespace
+
+
+template<class T>
+static void
+BM_GemmBlocked(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1 * m2;
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_flop_counter(state, n);
+}
+
+template<class T>
+static void
+BM_GemmSimple(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        dyn_matrix<T>   m3(n, n);
+        simple_multiply(m1, m2, m3);
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_flop_counter(state, n);
+}
+
+BENCHMARK_TEMPLATE(BM_GemmBlocked, float)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK_TEMPLATE(BM_GemmSimple, float)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK_TEMPLATE(BM_GemmBlocked, double)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK_TEMPLATE(BM_GemmSimple, double)->RangeMultiplier(2)->Range(32, 1024);
+
+
+//- Square products computed by the Strassen-Winograd recursion, with the default crossover;
+//  compare with BM_GemmBlocked at the same sizes.
+//
+template<class T>
+static void
+BM_GemmStrassen(benchmark::State& state)
+{
+    using str_mat = matrix<dr_matrix_engine<T>, matrix_strassen_operation_traits>;
+
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    str_mat             m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1 * m2;
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_flop_counter(state, n);
+}
+
+BENCHMARK_TEMPLATE(BM_GemmStrassen, float)->Arg(1024)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_GemmStrassen, double)->Arg(1024)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_GemmBlocked, double)->Arg(2048);
+
+
+//- Products with a transposed or hermitian right-hand operand, which the blocked kernel reads
+//  through the span of the referent; compare with BM_GemmBlocked at the same sizes.  For
+//  complex elements the counter reports complex operations (2*N^3), not real ones.
+//
+template<class T>
+static void
+BM_GemmTransposed(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1 * m2.t();
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_flop_counter(state, n);
+}
+
+template<class T>
+static void
+BM_GemmHermitian(benchmark::State& state)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(state.range(0));
+    dyn_matrix<T>       m1(n, n), m2(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        auto    m3 = m1 * m2.h();
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_flop_counter(state, n);
+}
+
+BENCHMARK_TEMPLATE(BM_GemmTransposed, double)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_GemmBlocked, complex<double>)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_GemmHermitian, complex<double>)->RangeMultiplier(4)->Range(64, 1024);
+
+//- Small fixed-size products, computed by the unrolled kernels.
+//
+template<class T>
+static void
+BM_FsSmallMatMat4(benchmark::State& state)
+{
+    fs_matrix<T, 4, 4>  m1, m2;
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(m1);
+        auto    m3 = m1 * m2;
+        benchmark::DoNotOptimize(m3);
+    }
+    set_flop_counter(state, 4);
+}
+
+template<class T>
+static void
+BM_FsSmallMatVec4(benchmark::State& state)
+{
+    fs_matrix<T, 4, 4>  m1;
+    fs_vector<T, 4>     v1;
+
+    fill_matrix(m1);
+    for (ptrdiff_t i = 0;  i < 4;  ++i) v1(i) = static_cast<T>(i);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(v1);
+        auto    v2 = m1 * v1;
+        benchmark::DoNotOptimize(v2);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_FsSmallMatMat4, float);
+BENCHMARK_TEMPLATE(BM_FsSmallMatMat4, double);
+BENCHMARK_TEMPLATE(BM_FsSmallMatVec4, float);
+BENCHMARK_TEMPLATE(BM_FsSmallMatVec4, double);
@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+
+//==================================================================================================
+//  Entry point for la_bench.  It is benchmark_main with the settings la_bench was built with added
+//  to the context of every report, so that a JSON result file (and the baseline in particular)
+//  records how the code it timed was compiled.  The context's own library_build_type describes
+//  only the google-benchmark library, which distribution packages often build without NDEBUG.
+//==================================================================================================
+//
+int
+main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+    benchmark::AddCustomContext("la_build_type", LA_BENCH_BUILD_TYPE);
+    benchmark::AddCustomContext("la_cxx_compiler", LA_BENCH_CXX_COMPILER);
+    benchmark::AddCustomContext("la_cxx_flags", LA_BENCH_CXX_FLAGS);
+#ifdef LA_USE_CBLAS
+    benchmark::AddCustomContext("la_use_cblas", "ON");
+#else
+    benchmark::AddCustomContext("la_use_cblas", "OFF");
+#endif
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <linear_algebra.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace STD_LA;
+
+//==================================================================================================
+//  Benchmarks measuring the scaling of the parallel matrix-matrix product with the number of
+//  threads in the pool.  The first argument is the order N of the square operands, and the
+//  second is the number of threads (one thread is the serial blocked kernel).  Throughput is
+//  reported as floating-point operations per second (2*N^3 per product).
+//==================================================================================================
+//
+namespace {
+
+template<class MT>
+void
+fill_matrix(MT& m)
+{
+    using elem_t = typename MT::element_type;
+
+    for (typename MT::index_type i = 0;  i < m.rows();  ++i)
+    {
+        for (typename MT::index_type j = 0;  j < m.columns();  ++j)
+        {
+            m(i, j) = static_cast<elem_t>((i*7 + j*3) % 11) / static_cast<elem_t>(11);
+        }
+    }
+}
+
+void
+set_flop_counter(benchmark::State& state, ptrdiff_t n)
+{
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n,
+                                                 benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void
+thread_counts(benchmark::internal::Benchmark* b)
+{
+    for (int n = 256;  n <= 2048;  n *= 2)
+    {
+        for (int t = 1;  t <= 8;  t *= 2)
+        {
+            b->Args({n, t});
+        }
+    }
+}
+
+}   //- anonymous namespace
+
+
+template<class T>
+static void
+BM_GemmParallel(benchmark::State& state)
+{
+    ptrdiff_t const             n = static_cast<ptrdiff_t>(state.range(0));
+    detail::work_stealing_pool  pool(static_cast<size_t>(state.range(1)));
+    dyn_matrix<T>               m1(n, n), m2(n, n), m3(n, n);
+
+    fill_matrix(m1);
+    fill_matrix(m2);
+
+    for (auto _ : state)
+    {
+        detail::gemm_parallel(pool, T{1}, m1.span(), m2.span(), T{}, m3.span());
+        benchmark::DoNotOptimize(m3(0, 0));
+    }
+    set_flop_counter(state, n);
+}
+
+BENCHMARK_TEMPLATE(BM_GemmParallel, float)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_GemmParallel, double)->Apply(thread_counts)->UseRealTime();
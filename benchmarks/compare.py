@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#===================================================================================================
+#  File:       compare.py
+#
+#  Summary:    Compares two JSON result files written by la_bench (--benchmark_out=FILE
+#              --benchmark_out_format=json), and reports the change in time and throughput of each
+#              benchmark present in both.  Exits with status 1 if any benchmark's time increased by
+#              more than the threshold (10% by default).
+#
+#  Usage:      compare.py BASELINE.json CURRENT.json [--threshold 0.10] [--filter REGEX]
+#===================================================================================================
+#
+import argparse
+import json
+import re
+import sys
+
+TIME_SCALE = {'ns': 1.0, 'us': 1.0e3, 'ms': 1.0e6, 's': 1.0e9}
+
+#- Context entries written by la_bench (see bench_main.cpp) describing how it was built.
+#
+BUILD_KEYS = ('la_build_type', 'la_cxx_compiler', 'la_cxx_flags', 'la_use_cblas', 'num_cpus')
+
+
+def load_runs(path):
+    with open(path) as f:
+        data = json.load(f)
+
+    context = data.get('context', {})
+    runs = {}
+    for b in data.get('benchmarks', []):
+        #- Only plain iterations are compared; aggregates (mean, median, ...) are skipped.
+        #
+        if b.get('run_type', 'iteration') != 'iteration':
+            continue
+        scale = TIME_SCALE[b.get('time_unit', 'ns')]
+        runs[b['name']] = {
+            'time':  b['cpu_time'] * scale,
+            'flops': b.get('FLOPS'),
+            'bytes': b.get('bytes_per_second'),
+        }
+    return context, runs
+
+
+def format_rate(value, unit):
+    if value is None:
+        return '-'
+    for prefix in ('', 'k', 'M', 'G', 'T'):
+        if abs(value) < 1000.0:
+            return '%.2f %s%s' % (value, prefix, unit)
+        value /= 1000.0
+    return '%.2f P%s' % (value, unit)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two la_bench JSON result files.')
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    parser.add_argument('--threshold', type=float, default=0.10,
+                        help='relative slowdown reported as a regression (default 0.10)')
+    parser.add_argument('--filter', default=None,
+                        help='only compare benchmarks whose names match this regex')
+    args = parser.parse_args()
+
+    base_context, base = load_runs(args.baseline)
+    curr_context, curr = load_runs(args.current)
+
+    #- Timings from differently built binaries are not comparable, so differences in the build
+    #  settings are reported ahead of the results.
+    #
+    for key in BUILD_KEYS:
+        b, c = base_context.get(key), curr_context.get(key)
+        if b != c:
+            print('warning: %s differs (baseline: %s, current: %s)' % (key, b, c))
+    if curr_context.get('la_build_type', 'Release') != 'Release':
+        print('warning: the current results were not measured from a Release build')
+
+    pattern = re.compile(args.filter) if args.filter else None
+
+    names = [n for n in base if n in curr and (pattern is None or pattern.search(n))]
+    if not names:
+        print('no benchmarks in common')
+        return 0
+
+    width = max(len(n) for n in names)
+    print('%-*s  %12s  %12s  %8s  %14s  %14s' %
+          (width, 'Benchmark', 'Base (ns)', 'Curr (ns)', 'Change', 'FLOP/s', 'bytes/s'))
+
+    regressions = []
+    for n in names:
+        b, c = base[n], curr[n]
+        change = (c['time'] - b['time']) / b['time'] if b['time'] > 0 else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions.append(n)
+        elif change < -args.threshold:
+            flag = '  improved'
+        print('%-*s  %12.1f  %12.1f  %+7.1f%%  %14s  %14s%s' %
+              (width, n, b['time'], c['time'], 100.0 * change,
+               format_rate(c['flops'], 'FLOP/s'), format_rate(c['bytes'], 'B/s'), flag))
+
+    missing = sorted(set(base) - set(curr))
+    if missing:
+        print('\n%d baseline benchmark(s) not in the current results' % len(missing))
+
+    if regressions:
+        print('\n%d regression(s) greater than %.0f%%:' % (len(regressions), 100.0 * args.threshold))
+        for n in regressions:
+            print('  ' + n)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
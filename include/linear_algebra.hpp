@@ -22,13 +22,27 @@
 
 #define LA_NEGATION_AS_VIEW
 
+#include <algorithm>
 #include <cstdint>
 #include <array>
+#include <cmath>
+#include <atomic>
 #include <complex>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <initializer_list>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 //- Disable some unnecessary compiler warnings coming from mdspan.
 //
@@ -65,22 +79,39 @@ using std::experimental::dynamic_extent;
 #include "linear_algebra/fixed_size_matrix_engine.hpp"
 #include "linear_algebra/dynamic_vector_engine.hpp"
 #include "linear_algebra/dynamic_matrix_engine.hpp"
+#include "linear_algebra/mdspan_matrix_engine.hpp"
+#include "linear_algebra/mmap_matrix_engine.hpp"
 #include "linear_algebra/vector_view_engine.hpp"
 #include "linear_algebra/matrix_view_engine.hpp"
 #include "linear_algebra/vector_iterators.hpp"
 #include "linear_algebra/vector.hpp"
 #include "linear_algebra/matrix.hpp"
+#include "linear_algebra/binary_io.hpp"
 
 #include "linear_algebra/debug_helpers.hpp"     //- Helpers for debug/test -- not for production.
 
 #ifndef LA_NEGATION_AS_VIEW
     #include "linear_algebra/negation_traits.hpp"
 #endif
+#include "linear_algebra/elementwise_kernels.hpp"
+#include "linear_algebra/transpose_kernels.hpp"
 #include "linear_algebra/addition_traits.hpp"
 #include "linear_algebra/subtraction_traits.hpp"
+#include "linear_algebra/multiplication_kernels.hpp"
 #include "linear_algebra/multiplication_traits.hpp"
 #include "linear_algebra/division_traits.hpp"
+#include "linear_algebra/compound_assignment_traits.hpp"
+#include "linear_algebra/expression_traits.hpp"
+#include "linear_algebra/thread_pool.hpp"
+#include "linear_algebra/parallel_traits.hpp"
+#include "linear_algebra/strassen_traits.hpp"
+#include "linear_algebra/blas_traits.hpp"
 #include "linear_algebra/operation_traits.hpp"
 #include "linear_algebra/arithmetic_operators.hpp"
+#include "linear_algebra/lu_decomposition.hpp"
+#include "linear_algebra/cholesky_decomposition.hpp"
+#include "linear_algebra/qr_decomposition.hpp"
+#include "linear_algebra/eigen_decomposition.hpp"
+#include "linear_algebra/svd_decomposition.hpp"
 
 #endif  //- LINEAR_ALGEBRA_HPP_DEFINED
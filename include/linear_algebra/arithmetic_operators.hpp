@@ -235,6 +235,185 @@ operator /(matrix<ET1, OT1> const& m1, S2 const& s2)
 }
 
 
+//=================================================================================================
+//  Compound assignment operators, which employ the compound assignment traits to update the
+//  left-hand operand in place.  The left-hand operand may be any vector or matrix having a
+//  writable engine; the overloads taking it by rvalue reference allow the update of temporary
+//  views, as in m.row(i) += v.  Addition and subtraction require operands of the same size.
+//=================================================================================================
+//
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+vector<ET1, OT1>&
+operator +=(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2)
+{
+    using op_traits  = select_matrix_operation_traits_t<OT1, OT2>;
+    using op1_type   = vector<ET1, OT1>;
+    using op2_type   = vector<ET2, OT2>;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::add_assign(v1, v2);
+    return v1;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+vector<ET1, OT1>
+operator +=(vector<ET1, OT1>&& v1, vector<ET2, OT2> const& v2)
+{
+    v1 += v2;
+    return std::move(v1);
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+matrix<ET1, OT1>&
+operator +=(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2)
+{
+    using op_traits  = select_matrix_operation_traits_t<OT1, OT2>;
+    using op1_type   = matrix<ET1, OT1>;
+    using op2_type   = matrix<ET2, OT2>;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::add_assign(m1, m2);
+    return m1;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+matrix<ET1, OT1>
+operator +=(matrix<ET1, OT1>&& m1, matrix<ET2, OT2> const& m2)
+{
+    m1 += m2;
+    return std::move(m1);
+}
+
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+vector<ET1, OT1>&
+operator -=(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2)
+{
+    using op_traits  = select_matrix_operation_traits_t<OT1, OT2>;
+    using op1_type   = vector<ET1, OT1>;
+    using op2_type   = vector<ET2, OT2>;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::subtract_assign(v1, v2);
+    return v1;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+vector<ET1, OT1>
+operator -=(vector<ET1, OT1>&& v1, vector<ET2, OT2> const& v2)
+{
+    v1 -= v2;
+    return std::move(v1);
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+matrix<ET1, OT1>&
+operator -=(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2)
+{
+    using op_traits  = select_matrix_operation_traits_t<OT1, OT2>;
+    using op1_type   = matrix<ET1, OT1>;
+    using op2_type   = matrix<ET2, OT2>;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::subtract_assign(m1, m2);
+    return m1;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+matrix<ET1, OT1>
+operator -=(matrix<ET1, OT1>&& m1, matrix<ET2, OT2> const& m2)
+{
+    m1 -= m2;
+    return std::move(m1);
+}
+
+
+template<class ET1, class OT1, class S2> inline constexpr
+vector<ET1, OT1>&
+operator *=(vector<ET1, OT1>& v1, S2 const& s2)
+{
+    using op_traits  = OT1;
+    using op1_type   = vector<ET1, OT1>;
+    using op2_type   = S2;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::multiply_assign(v1, s2);
+    return v1;
+}
+
+template<class ET1, class OT1, class S2> inline constexpr
+vector<ET1, OT1>
+operator *=(vector<ET1, OT1>&& v1, S2 const& s2)
+{
+    v1 *= s2;
+    return std::move(v1);
+}
+
+template<class ET1, class OT1, class S2> inline constexpr
+matrix<ET1, OT1>&
+operator *=(matrix<ET1, OT1>& m1, S2 const& s2)
+{
+    using op_traits  = OT1;
+    using op1_type   = matrix<ET1, OT1>;
+    using op2_type   = S2;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::multiply_assign(m1, s2);
+    return m1;
+}
+
+template<class ET1, class OT1, class S2> inline constexpr
+matrix<ET1, OT1>
+operator *=(matrix<ET1, OT1>&& m1, S2 const& s2)
+{
+    m1 *= s2;
+    return std::move(m1);
+}
+
+
+template<class ET1, class OT1, class S2> inline constexpr
+vector<ET1, OT1>&
+operator /=(vector<ET1, OT1>& v1, S2 const& s2)
+{
+    using op_traits  = OT1;
+    using op1_type   = vector<ET1, OT1>;
+    using op2_type   = S2;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::divide_assign(v1, s2);
+    return v1;
+}
+
+template<class ET1, class OT1, class S2> inline constexpr
+vector<ET1, OT1>
+operator /=(vector<ET1, OT1>&& v1, S2 const& s2)
+{
+    v1 /= s2;
+    return std::move(v1);
+}
+
+template<class ET1, class OT1, class S2> inline constexpr
+matrix<ET1, OT1>&
+operator /=(matrix<ET1, OT1>& m1, S2 const& s2)
+{
+    using op_traits  = OT1;
+    using op1_type   = matrix<ET1, OT1>;
+    using op2_type   = S2;
+    using cas_traits = select_matrix_compound_assignment_t<op_traits, op1_type, op2_type>;
+
+    cas_traits::divide_assign(m1, s2);
+    return m1;
+}
+
+template<class ET1, class OT1, class S2> inline constexpr
+matrix<ET1, OT1>
+operator /=(matrix<ET1, OT1>&& m1, S2 const& s2)
+{
+    m1 /= s2;
+    return std::move(m1);
+}
+
+
 //------
 //
 template<class ET1, class OT1, class ET2, class OT2> inline constexpr
@@ -249,6 +428,34 @@ inner_product(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
     return mul_traits::multiply(v1, v2);
 }
 
+//=================================================================================================
+//  Fused multiply-add, which computes mr = alpha*(m1*m2) + beta*mr in place, using the
+//  multiply-add arithmetic traits.  The result may be any writable matrix, including a view;
+//  it must not share elements with either operand.  If beta is zero, the prior contents of
+//  the result are ignored.
+//=================================================================================================
+//
+template<class S1, class ET1, class OT1, class ET2, class OT2, class S2, class ETR, class OTR> inline constexpr
+void
+multiply_add(S1 const& alpha, matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2,
+             S2 const& beta, matrix<ETR, OTR>& mr)
+{
+    using op_traits  = select_matrix_operation_traits_t<OT1, OT2>;
+    using op1_type   = matrix<ET1, OT1>;
+    using op2_type   = matrix<ET2, OT2>;
+    using fma_traits = select_matrix_multiply_add_arithmetic_t<op_traits, op1_type, op2_type>;
+
+    fma_traits::multiply_add(alpha, m1, m2, beta, mr);
+}
+
+template<class S1, class ET1, class OT1, class ET2, class OT2, class S2, class ETR, class OTR> inline constexpr
+void
+multiply_add(S1 const& alpha, matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2,
+             S2 const& beta, matrix<ETR, OTR>&& mr)
+{
+    multiply_add(alpha, m1, m2, beta, mr);
+}
+
 template<class ET1, class OT1, class ET2, class OT2> inline constexpr
 auto
 outer_product(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
@@ -0,0 +1,613 @@
+//==================================================================================================
+//  File:       binary_io.hpp
+//
+//  Summary:    This header defines functions for saving vectors and matrices to, and loading
+//              them from, files in the library's binary format: the 64-byte header described by
+//              detail::la_file_header, followed by the elements in row-major or column-major
+//              order.  The same format is used by mmap_matrix_engine, so a saved matrix may be
+//              reopened as a memory-mapped matrix, and vice versa.
+//
+//              In addition to save() and load(), it defines:
+//               * mapped_file, which maps a file read-only and presents its contents as an
+//                 mdspan_matrix without copying them; and,
+//               * matrix_row_writer, which writes a row-major matrix one row at a time, for
+//                 matrices too large to hold in memory.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BINARY_IO_HPP_DEFINED
+#define LINEAR_ALGEBRA_BINARY_IO_HPP_DEFINED
+
+#include <fstream>
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//- These helper functions read and write the headers and elements of data files, throwing if
+//  the underlying stream operation fails.
+//
+inline void
+write_file_bytes(std::ofstream& os, void const* p, size_t n)
+{
+    os.write(static_cast<char const*>(p), static_cast<std::streamsize>(n));
+
+    if (!os)
+    {
+        throw runtime_error("unable to write data file");
+    }
+}
+
+inline void
+read_file_bytes(std::ifstream& is, void* p, size_t n)
+{
+    is.read(static_cast<char*>(p), static_cast<std::streamsize>(n));
+
+    if (!is)
+    {
+        throw runtime_error("unable to read data file");
+    }
+}
+
+inline std::ofstream
+open_data_file_for_writing(string const& path)
+{
+    std::ofstream   os(path, std::ios::binary | std::ios::trunc);
+
+    if (!os)
+    {
+        throw runtime_error("unable to create data file " + path);
+    }
+    return os;
+}
+
+//- Opens a data file and reads its header, which is checked against the given element type and
+//  rank.
+//
+template<class T>
+std::ifstream
+open_data_file_for_reading(string const& path, int64_t rank, la_file_header& hdr)
+{
+    std::ifstream   is(path, std::ios::binary | std::ios::ate);
+
+    if (!is)
+    {
+        throw runtime_error("unable to open data file " + path);
+    }
+
+    int64_t const   file_size = static_cast<int64_t>(is.tellg());
+
+    if (file_size < la_file_header_size)
+    {
+        throw runtime_error("not a linear algebra data file");
+    }
+
+    is.seekg(0);
+    read_file_bytes(is, &hdr, sizeof(hdr));
+    check_file_header<T>(hdr, rank, file_size);
+    is.seekg(la_file_header_size);
+    return is;
+}
+
+//- Writes the elements of matrix engine ET line by line (rows if LT is row_major, columns if it
+//  is column_major), through a buffer holding one line.
+//
+template<class T, class LT, class ET>
+void
+write_matrix_elements(std::ofstream& os, ET const& engine)
+{
+    using index_type = typename ET::index_type;
+
+    constexpr bool  by_column = is_same_v<LT, column_major>;
+
+    index_type const    lines  = (by_column) ? engine.columns() : engine.rows();
+    index_type const    length = (by_column) ? engine.rows() : engine.columns();
+    std::vector<T>      line(static_cast<size_t>(length));
+
+    for (index_type l = 0;  l < lines;  ++l)
+    {
+        for (index_type e = 0;  e < length;  ++e)
+        {
+            line[e] = static_cast<T>((by_column) ? engine(e, l) : engine(l, e));
+        }
+        write_file_bytes(os, line.data(), line.size()*sizeof(T));
+    }
+}
+
+//- Reads the elements described by a file header into matrix engine ET, whose size must already
+//  match.  Lines are read whole, capacity included, and their unused tails are discarded.
+//
+template<class T, class ET>
+void
+read_matrix_elements(std::ifstream& is, la_file_header const& hdr, ET& engine)
+{
+    using index_type = typename ET::index_type;
+
+    bool const          by_column = (hdr.layout == file_layout_code<column_major>());
+    index_type const    lines     = static_cast<index_type>((by_column) ? hdr.columns : hdr.rows);
+    index_type const    length    = static_cast<index_type>((by_column) ? hdr.rows : hdr.columns);
+    index_type const    ld        = static_cast<index_type>((by_column) ? hdr.row_capacity : hdr.column_capacity);
+    std::vector<T>      line(static_cast<size_t>(ld));
+
+    for (index_type l = 0;  l < lines;  ++l)
+    {
+        read_file_bytes(is, line.data(), line.size()*sizeof(T));
+
+        for (index_type e = 0;  e < length;  ++e)
+        {
+            if (by_column)
+                engine(e, l) = line[e];
+            else
+                engine(l, e) = line[e];
+        }
+    }
+}
+
+}       //- detail namespace
+
+//==================================================================================================
+//  Saves a vector or matrix to a file, replacing any existing contents.  Matrices are stored in
+//  the layout of their engines (row-major for engines without a fixed layout, such as views),
+//  with capacities equal to their sizes.
+//==================================================================================================
+//
+template<class ET, class OT>
+void
+save(string const& path, vector<ET, OT> const& v)
+{
+    using elem_t = remove_cv_t<typename ET::element_type>;
+    using index_type = typename vector<ET, OT>::index_type;
+
+    std::ofstream       os   = detail::open_data_file_for_writing(path);
+    auto const          hdr  = detail::make_file_header<elem_t, row_major>(1, 1, v.size(), 1, v.size());
+    std::vector<elem_t> elems(static_cast<size_t>(v.size()));
+
+    for (index_type i = 0;  i < v.size();  ++i)
+    {
+        elems[i] = v(i);
+    }
+    detail::write_file_bytes(os, &hdr, sizeof(hdr));
+    detail::write_file_bytes(os, elems.data(), elems.size()*sizeof(elem_t));
+}
+
+template<class ET, class OT>
+void
+save(string const& path, matrix<ET, OT> const& m)
+{
+    using elem_t   = remove_cv_t<typename ET::element_type>;
+    using layout_t = conditional_t<detail::is_column_major_v<ET>, column_major, row_major>;
+
+    std::ofstream   os  = detail::open_data_file_for_writing(path);
+    auto const      hdr = detail::make_file_header<elem_t, layout_t>(2, m.rows(), m.columns(),
+                                                                     m.rows(), m.columns());
+
+    detail::write_file_bytes(os, &hdr, sizeof(hdr));
+    detail::write_matrix_elements<elem_t, layout_t>(os, m.engine());
+}
+
+//==================================================================================================
+//  Loads a vector or matrix from a file.  The element type recorded in the file must be the
+//  element type of the destination; its layout need not match.  Resizable destinations are
+//  resized to the size recorded in the file; others must already have that size.  A file holding
+//  no elements, such as one from a matrix_row_writer that wrote no rows, is rejected, since no
+//  vector or matrix object has an extent of zero.
+//==================================================================================================
+//
+template<class ET, class OT>
+void
+load(string const& path, vector<ET, OT>& v)
+{
+    static_assert(detail::is_writable_engine_v<ET>);
+
+    using elem_t     = remove_cv_t<typename ET::element_type>;
+    using index_type = typename vector<ET, OT>::index_type;
+
+    detail::la_file_header  hdr;
+    std::ifstream           is = detail::open_data_file_for_reading<elem_t>(path, 1, hdr);
+    index_type const        n  = static_cast<index_type>(hdr.columns);
+
+    if (n == 0)
+    {
+        throw runtime_error("data file holds an empty vector");
+    }
+    if constexpr (detail::is_resizable_engine_v<ET>)
+    {
+        v.resize(n);
+    }
+    else if (v.size() != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    std::vector<elem_t>     elems(static_cast<size_t>(n));
+
+    detail::read_file_bytes(is, elems.data(), elems.size()*sizeof(elem_t));
+
+    for (index_type i = 0;  i < n;  ++i)
+    {
+        v(i) = elems[i];
+    }
+}
+
+template<class ET, class OT>
+void
+load(string const& path, matrix<ET, OT>& m)
+{
+    static_assert(detail::is_writable_engine_v<ET>);
+
+    using elem_t     = remove_cv_t<typename ET::element_type>;
+    using index_type = typename matrix<ET, OT>::index_type;
+
+    detail::la_file_header  hdr;
+    std::ifstream           is   = detail::open_data_file_for_reading<elem_t>(path, 2, hdr);
+    index_type const        rows = static_cast<index_type>(hdr.rows);
+    index_type const        cols = static_cast<index_type>(hdr.columns);
+
+    if (rows == 0  ||  cols == 0)
+    {
+        throw runtime_error("data file holds an empty matrix");
+    }
+    if constexpr (detail::is_resizable_engine_v<ET>)
+    {
+        m.resize(rows, cols);
+    }
+    else if (m.rows() != rows  ||  m.columns() != cols)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    detail::read_matrix_elements<elem_t>(is, hdr, m.engine());
+}
+
+//==================================================================================================
+//  Writes a row-major matrix with a given number of columns one row at a time.  The number of
+//  rows is recorded in the file's header when the writer is closed, explicitly, by its
+//  destructor, or by move-assigning another writer to it; until then the file is incomplete.
+//==================================================================================================
+//
+template<class T>
+class matrix_row_writer
+{
+    static_assert(is_trivially_copyable_v<T>);
+
+  public:
+    using element_type = T;
+    using index_type   = ptrdiff_t;
+
+    ~matrix_row_writer() noexcept;
+    matrix_row_writer(matrix_row_writer&&) noexcept = default;
+    matrix_row_writer(string const& path, index_type cols);
+
+    matrix_row_writer&  operator =(matrix_row_writer&& rhs) noexcept;
+
+    index_type  columns() const noexcept;
+    index_type  rows() const noexcept;
+    bool        is_open() const noexcept;
+
+    template<class ET, class OT>
+    void    write_row(vector<ET, OT> const& row);
+    void    write_row(T const* p_row);
+    void    close();
+
+  private:
+    std::ofstream       m_os;
+    std::vector<T>      m_line;
+    index_type          m_rows;
+    index_type          m_cols;
+
+    void    check_open() const;
+};
+
+template<class T>
+matrix_row_writer<T>::~matrix_row_writer() noexcept
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {}
+}
+
+template<class T>
+matrix_row_writer<T>::matrix_row_writer(string const& path, index_type cols)
+:   m_os()
+,   m_line()
+,   m_rows(0)
+,   m_cols(cols)
+{
+    if (cols < 1)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    m_os = detail::open_data_file_for_writing(path);
+    m_line.resize(static_cast<size_t>(cols));
+
+    auto const  hdr = detail::make_file_header<T, row_major>(2, 0, m_cols, 0, m_cols);
+
+    detail::write_file_bytes(m_os, &hdr, sizeof(hdr));
+}
+
+//- Move assignment first completes the file being written, as the destructor does.
+//
+template<class T>
+matrix_row_writer<T>&
+matrix_row_writer<T>::operator =(matrix_row_writer&& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {}
+
+        m_os   = std::move(rhs.m_os);
+        m_line = std::move(rhs.m_line);
+        m_rows = rhs.m_rows;
+        m_cols = rhs.m_cols;
+    }
+    return *this;
+}
+
+template<class T> inline
+typename matrix_row_writer<T>::index_type
+matrix_row_writer<T>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T> inline
+typename matrix_row_writer<T>::index_type
+matrix_row_writer<T>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T> inline
+bool
+matrix_row_writer<T>::is_open() const noexcept
+{
+    return m_os.is_open();
+}
+
+template<class T>
+template<class ET, class OT>
+void
+matrix_row_writer<T>::write_row(vector<ET, OT> const& row)
+{
+    check_open();
+
+    if (row.size() != m_cols)
+    {
+        throw runtime_error("invalid size");
+    }
+    for (index_type j = 0;  j < m_cols;  ++j)
+    {
+        m_line[j] = static_cast<T>(row(j));
+    }
+    write_row(m_line.data());
+}
+
+template<class T>
+void
+matrix_row_writer<T>::write_row(T const* p_row)
+{
+    check_open();
+    detail::write_file_bytes(m_os, p_row, static_cast<size_t>(m_cols)*sizeof(T));
+    ++m_rows;
+}
+
+template<class T>
+void
+matrix_row_writer<T>::close()
+{
+    if (m_os.is_open())
+    {
+        auto const  hdr = detail::make_file_header<T, row_major>(2, m_rows, m_cols, m_rows, m_cols);
+
+        m_os.seekp(0);
+        detail::write_file_bytes(m_os, &hdr, sizeof(hdr));
+        m_os.close();
+
+        if (!m_os)
+        {
+            throw runtime_error("unable to write data file");
+        }
+    }
+}
+
+template<class T>
+void
+matrix_row_writer<T>::check_open() const
+{
+    if (!m_os.is_open())
+    {
+        throw runtime_error("matrix row writer is closed");
+    }
+}
+
+#ifdef LA_HAS_MMAP
+//==================================================================================================
+//  A read-only mapping of a data file, whose contents are presented as a non-owning matrix
+//  without being copied.  A vector is presented as a matrix with one row.  The matrices
+//  returned by as_matrix() refer to the mapping, and must not outlive it.
+//==================================================================================================
+//
+class mapped_file
+{
+  public:
+    using index_type = ptrdiff_t;
+
+    ~mapped_file() noexcept;
+    mapped_file() noexcept;
+    mapped_file(mapped_file&& rhs) noexcept;
+    mapped_file(mapped_file const&) = delete;
+    explicit mapped_file(string const& path);
+
+    mapped_file&    operator =(mapped_file&& rhs) noexcept;
+    mapped_file&    operator =(mapped_file const&) = delete;
+
+    index_type  columns() const noexcept;
+    index_type  rows() const noexcept;
+    index_type  rank() const noexcept;
+    bool        is_column_major() const noexcept;
+
+    template<class T, class LT = row_major>
+    mdspan_matrix<T const, LT>  as_matrix() const;
+
+    void    swap(mapped_file& rhs) noexcept;
+
+  private:
+    void*       mp_map;
+    size_t      m_mapsize;
+
+    detail::la_file_header const&   header() const noexcept;
+};
+
+inline
+mapped_file::~mapped_file() noexcept
+{
+    if (mp_map != nullptr)
+    {
+        ::munmap(mp_map, m_mapsize);
+    }
+}
+
+inline
+mapped_file::mapped_file() noexcept
+:   mp_map(nullptr)
+,   m_mapsize(0)
+{}
+
+inline
+mapped_file::mapped_file(mapped_file&& rhs) noexcept
+:   mapped_file()
+{
+    swap(rhs);
+}
+
+inline
+mapped_file::mapped_file(string const& path)
+:   mapped_file()
+{
+    int     fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        throw runtime_error("unable to open data file " + path);
+    }
+
+    struct stat     st;
+
+    if (::fstat(fd, &st) != 0  ||  st.st_size < detail::la_file_header_size)
+    {
+        ::close(fd);
+        throw runtime_error("not a linear algebra data file");
+    }
+
+    void*   p_map = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+
+    ::close(fd);
+
+    if (p_map == MAP_FAILED)
+    {
+        throw runtime_error("unable to map data file " + path);
+    }
+
+    mp_map    = p_map;
+    m_mapsize = static_cast<size_t>(st.st_size);
+}
+
+inline mapped_file&
+mapped_file::operator =(mapped_file&& rhs) noexcept
+{
+    mapped_file     tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+inline mapped_file::index_type
+mapped_file::columns() const noexcept
+{
+    return (mp_map) ? static_cast<index_type>(header().columns) : 0;
+}
+
+inline mapped_file::index_type
+mapped_file::rows() const noexcept
+{
+    return (mp_map) ? static_cast<index_type>(header().rows) : 0;
+}
+
+inline mapped_file::index_type
+mapped_file::rank() const noexcept
+{
+    return (mp_map) ? static_cast<index_type>(header().rank) : 0;
+}
+
+inline bool
+mapped_file::is_column_major() const noexcept
+{
+    return (mp_map) ? header().layout == detail::file_layout_code<column_major>() : false;
+}
+
+//- Returns a matrix referring to the mapped elements, which must be of type T and stored in
+//  layout LT; no conversion is performed.  Capacity recorded in the file (e.g., by
+//  mmap_matrix_engine) becomes padding between rows or columns.
+//
+template<class T, class LT>
+mdspan_matrix<T const, LT>
+mapped_file::as_matrix() const
+{
+    static_assert(detail::is_matrix_layout_v<LT>);
+
+    using engine_type = mdspan_matrix_engine<T const, LT>;
+
+    if (mp_map == nullptr)
+    {
+        throw runtime_error("data file is not mapped");
+    }
+
+    detail::la_file_header const&   hdr = header();
+
+    detail::check_file_header<T>(hdr, static_cast<int64_t>(hdr.rank), static_cast<int64_t>(m_mapsize));
+
+    if (hdr.rank < 1  ||  hdr.rank > 2)
+    {
+        throw runtime_error("data file rank does not match");
+    }
+    if (hdr.layout != detail::file_layout_code<LT>())
+    {
+        throw runtime_error("data file layout does not match");
+    }
+
+    T const*    p_elems = reinterpret_cast<T const*>(static_cast<char const*>(mp_map) +
+                                                     detail::la_file_header_size);
+    index_type  rows    = static_cast<index_type>(hdr.rows);
+    index_type  cols    = static_cast<index_type>(hdr.columns);
+
+    if constexpr (is_same_v<LT, column_major>)
+        return mdspan_matrix<T const, LT>(engine_type(p_elems, rows, cols, 1,
+                                                      static_cast<index_type>(hdr.row_capacity)));
+    else
+        return mdspan_matrix<T const, LT>(engine_type(p_elems, rows, cols,
+                                                      static_cast<index_type>(hdr.column_capacity), 1));
+}
+
+inline void
+mapped_file::swap(mapped_file& rhs) noexcept
+{
+    detail::la_swap(mp_map, rhs.mp_map);
+    detail::la_swap(m_mapsize, rhs.m_mapsize);
+}
+
+inline detail::la_file_header const&
+mapped_file::header() const noexcept
+{
+    return *static_cast<detail::la_file_header const*>(mp_map);
+}
+
+#endif  //- LA_HAS_MMAP
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_BINARY_IO_HPP_DEFINED
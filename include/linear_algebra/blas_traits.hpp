@@ -0,0 +1,685 @@
+//==================================================================================================
+//  File:       blas_traits.hpp
+//
+//  Summary:    This header defines the private bindings to an external CBLAS library and the
+//              public arithmetic traits used by matrix_blas_operation_traits to hand products,
+//              fused multiply-adds, and vector/matrix updates of the BLAS element types (float,
+//              double, complex<float>, and complex<double>) to ?gemm, ?gemv, ?dot, and ?axpy.
+//
+//              An operand is passed to the BLAS when its engine exposes its memory through a
+//              span in which one of the strides is one, so that it can be described by a leading
+//              dimension and a transpose flag.  Transpose views have the swapped strides of their
+//              referents and are passed with CblasTrans, and hermitian views of column-contiguous
+//              spans with CblasConjTrans; neither is materialized.  Operands that cannot be
+//              described this way, and all other element types, are computed by the library's
+//              own kernels, exactly as by matrix_operation_traits.
+//
+//              The bindings are compiled only when LA_USE_CBLAS is defined (see the CMake option
+//              of the same name), in which case <cblas.h> must be on the include path and the
+//              program must be linked with a CBLAS library such as OpenBLAS.  Otherwise the
+//              traits are still available, and always use the built-in kernels.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BLAS_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_BLAS_TRAITS_HPP_DEFINED
+
+#if defined(LA_USE_CBLAS)
+    #define LA_HAS_CBLAS
+    #include <cblas.h>
+#endif
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  These traits report whether the operands of a product or an update may be passed to the BLAS:
+//  all of their engines must have the same BLAS element type and expose their memory through a
+//  span.  Matrix operands of products may also be hermitian views, as for the blocked kernel.
+//  Whether an operand's strides are acceptable can only be decided at run time.
+//==================================================================================================
+//
+#if defined(LA_HAS_CBLAS)
+    inline constexpr bool   has_cblas = true;
+#else
+    inline constexpr bool   has_cblas = false;
+#endif
+
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_blas_gemm_v = has_cblas  &&  use_gemm_update_v<ET1, ET2, ETR>;
+
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_blas_v = has_cblas  &&
+                     has_direct_span_v<ET1>  &&  has_direct_span_v<ET2>  &&  has_direct_span_v<ETR>  &&
+                     is_gemm_element_v<typename ETR::element_type>  &&
+                     is_same_v<typename ET1::element_type, typename ETR::element_type>  &&
+                     is_same_v<typename ET2::element_type, typename ETR::element_type>;
+
+#if defined(LA_HAS_CBLAS)
+//==================================================================================================
+//  The CBLAS interface takes its sizes, leading dimensions, and increments as int.
+//==================================================================================================
+//
+inline constexpr
+bool
+blas_fits(ptrdiff_t n) noexcept
+{
+    return 0 <= n  &&  n <= static_cast<ptrdiff_t>(numeric_limits<int>::max());
+}
+
+//- Describes an (m x n) operand having row stride RS and column stride CS to a row-major BLAS
+//  routine: the operand is either a row-major array with leading dimension RS, or the transpose
+//  of one with leading dimension CS.  A conjugated operand can only be passed in the second form.
+//  Returns false if the strides describe neither.
+//
+inline
+bool
+blas_matrix_operand(ptrdiff_t m, ptrdiff_t n, ptrdiff_t rs, ptrdiff_t cs, bool conj,
+                    CBLAS_TRANSPOSE& trans, ptrdiff_t& ld) noexcept
+{
+    if (cs == 1  &&  !conj  &&  rs >= max<ptrdiff_t>(n, 1))
+    {
+        trans = CblasNoTrans;
+        ld    = rs;
+    }
+    else if (rs == 1  &&  cs >= max<ptrdiff_t>(m, 1))
+    {
+        trans = (conj) ? CblasConjTrans : CblasTrans;
+        ld    = cs;
+    }
+    else
+    {
+        return false;
+    }
+    return blas_fits(ld);
+}
+
+//==================================================================================================
+//  Computes C = alpha*op(A)*op(B) + beta*C with ?gemm, where A is (m x k), B is (k x n), and C
+//  is (m x n), and op() conjugates the elements of an operand whose CONJ flag is set.  A column-
+//  contiguous C is computed as the transposed product C^T = op(B)^T * op(A)^T.  Returns false,
+//  having done nothing, if an operand's strides cannot be expressed to the BLAS.
+//==================================================================================================
+//
+template<class T>
+bool
+blas_gemm(ptrdiff_t m, ptrdiff_t n, ptrdiff_t k, T alpha,
+          T const* pa, ptrdiff_t rsa, ptrdiff_t csa, bool conj_a,
+          T const* pb, ptrdiff_t rsb, ptrdiff_t csb, bool conj_b,
+          T beta, T* pc, ptrdiff_t rsc, ptrdiff_t csc)
+{
+    if (m == 0  ||  n == 0  ||  k == 0) return false;
+
+    if (csc != 1  &&  rsc == 1)
+    {
+        return blas_gemm(n, m, k, alpha, pb, csb, rsb, conj_b, pa, csa, rsa, conj_a, beta, pc, csc, rsc);
+    }
+
+    CBLAS_TRANSPOSE     ta, tb;
+    ptrdiff_t           lda, ldb;
+
+    if (csc != 1  ||  rsc < n  ||  !blas_fits(rsc)  ||
+        !blas_fits(m)  ||  !blas_fits(n)  ||  !blas_fits(k)  ||
+        !blas_matrix_operand(m, k, rsa, csa, conj_a, ta, lda)  ||
+        !blas_matrix_operand(k, n, rsb, csb, conj_b, tb, ldb))
+    {
+        return false;
+    }
+
+    int const   im = static_cast<int>(m), in = static_cast<int>(n), ik = static_cast<int>(k);
+    int const   ilda = static_cast<int>(lda), ildb = static_cast<int>(ldb), ildc = static_cast<int>(rsc);
+
+    if constexpr (is_same_v<T, float>)
+        cblas_sgemm(CblasRowMajor, ta, tb, im, in, ik, alpha, pa, ilda, pb, ildb, beta, pc, ildc);
+    else if constexpr (is_same_v<T, double>)
+        cblas_dgemm(CblasRowMajor, ta, tb, im, in, ik, alpha, pa, ilda, pb, ildb, beta, pc, ildc);
+    else if constexpr (is_same_v<T, complex<float>>)
+        cblas_cgemm(CblasRowMajor, ta, tb, im, in, ik, &alpha, pa, ilda, pb, ildb, &beta, pc, ildc);
+    else
+        cblas_zgemm(CblasRowMajor, ta, tb, im, in, ik, &alpha, pa, ilda, pb, ildb, &beta, pc, ildc);
+
+    return true;
+}
+
+//==================================================================================================
+//  Computes y = alpha*op(A)*x + beta*y with ?gemv, where A is (m x n), x has n elements spaced
+//  INCX apart, and y has m elements spaced INCY apart.  Returns false, having done nothing, if
+//  the strides cannot be expressed to the BLAS.
+//==================================================================================================
+//
+template<class T>
+bool
+blas_gemv(ptrdiff_t m, ptrdiff_t n, T alpha, T const* pa, ptrdiff_t rsa, ptrdiff_t csa, bool conj_a,
+          T const* px, ptrdiff_t incx, T beta, T* py, ptrdiff_t incy)
+{
+    CBLAS_TRANSPOSE     ta;
+    ptrdiff_t           lda;
+
+    if (m == 0  ||  n == 0  ||  incx < 1  ||  incy < 1  ||
+        !blas_fits(m)  ||  !blas_fits(n)  ||  !blas_fits(incx)  ||  !blas_fits(incy)  ||
+        !blas_matrix_operand(m, n, rsa, csa, conj_a, ta, lda))
+    {
+        return false;
+    }
+
+    //- The dimensions passed to ?gemv are those of the stored array, not of op(A).
+    //
+    int const   rows = static_cast<int>((ta == CblasNoTrans) ? m : n);
+    int const   cols = static_cast<int>((ta == CblasNoTrans) ? n : m);
+    int const   ilda = static_cast<int>(lda), ix = static_cast<int>(incx), iy = static_cast<int>(incy);
+
+    if constexpr (is_same_v<T, float>)
+        cblas_sgemv(CblasRowMajor, ta, rows, cols, alpha, pa, ilda, px, ix, beta, py, iy);
+    else if constexpr (is_same_v<T, double>)
+        cblas_dgemv(CblasRowMajor, ta, rows, cols, alpha, pa, ilda, px, ix, beta, py, iy);
+    else if constexpr (is_same_v<T, complex<float>>)
+        cblas_cgemv(CblasRowMajor, ta, rows, cols, &alpha, pa, ilda, px, ix, &beta, py, iy);
+    else
+        cblas_zgemv(CblasRowMajor, ta, rows, cols, &alpha, pa, ilda, px, ix, &beta, py, iy);
+
+    return true;
+}
+
+//==================================================================================================
+//  Computes the unconjugated dot product of x and y with ?dot (?dotu for complex elements).
+//==================================================================================================
+//
+template<class T>
+bool
+blas_dot(ptrdiff_t n, T const* px, ptrdiff_t incx, T const* py, ptrdiff_t incy, T& result)
+{
+    if (n == 0  ||  incx < 1  ||  incy < 1  ||
+        !blas_fits(n)  ||  !blas_fits(incx)  ||  !blas_fits(incy))
+    {
+        return false;
+    }
+
+    int const   in = static_cast<int>(n), ix = static_cast<int>(incx), iy = static_cast<int>(incy);
+
+    if constexpr (is_same_v<T, float>)
+        result = cblas_sdot(in, px, ix, py, iy);
+    else if constexpr (is_same_v<T, double>)
+        result = cblas_ddot(in, px, ix, py, iy);
+    else if constexpr (is_same_v<T, complex<float>>)
+        cblas_cdotu_sub(in, px, ix, py, iy, &result);
+    else
+        cblas_zdotu_sub(in, px, ix, py, iy, &result);
+
+    return true;
+}
+
+//==================================================================================================
+//  Computes y = alpha*x + y with ?axpy.
+//==================================================================================================
+//
+template<class T>
+bool
+blas_axpy(ptrdiff_t n, T alpha, T const* px, ptrdiff_t incx, T* py, ptrdiff_t incy)
+{
+    if (n == 0  ||  incx < 1  ||  incy < 1  ||
+        !blas_fits(n)  ||  !blas_fits(incx)  ||  !blas_fits(incy))
+    {
+        return false;
+    }
+
+    int const   in = static_cast<int>(n), ix = static_cast<int>(incx), iy = static_cast<int>(incy);
+
+    if constexpr (is_same_v<T, float>)
+        cblas_saxpy(in, alpha, px, ix, py, iy);
+    else if constexpr (is_same_v<T, double>)
+        cblas_daxpy(in, alpha, px, ix, py, iy);
+    else if constexpr (is_same_v<T, complex<float>>)
+        cblas_caxpy(in, &alpha, px, ix, py, iy);
+    else
+        cblas_zaxpy(in, &alpha, px, ix, py, iy);
+
+    return true;
+}
+
+#else
+//- Without a CBLAS library, every request is declined, and the callers use the built-in kernels.
+//
+template<class T>
+bool
+blas_gemm(ptrdiff_t, ptrdiff_t, ptrdiff_t, T, T const*, ptrdiff_t, ptrdiff_t, bool,
+          T const*, ptrdiff_t, ptrdiff_t, bool, T, T*, ptrdiff_t, ptrdiff_t)
+{
+    return false;
+}
+
+template<class T>
+bool
+blas_gemv(ptrdiff_t, ptrdiff_t, T, T const*, ptrdiff_t, ptrdiff_t, bool, T const*, ptrdiff_t,
+          T, T*, ptrdiff_t)
+{
+    return false;
+}
+
+template<class T>
+bool
+blas_dot(ptrdiff_t, T const*, ptrdiff_t, T const*, ptrdiff_t, T&)
+{
+    return false;
+}
+
+template<class T>
+bool
+blas_axpy(ptrdiff_t, T, T const*, ptrdiff_t, T*, ptrdiff_t)
+{
+    return false;
+}
+#endif
+
+//==================================================================================================
+//  These helpers connect the bindings to the engine layer, taking the sizes, strides, and
+//  conjugation of each operand from its engine and span.
+//==================================================================================================
+//
+template<class ET1, class ET2, class T, class SA, class SB, class SC>
+bool
+blas_gemm(T alpha, SA const& a, SB const& b, T beta, SC const& c)
+{
+    return blas_gemm(static_cast<ptrdiff_t>(c.extent(0)), static_cast<ptrdiff_t>(c.extent(1)),
+                     static_cast<ptrdiff_t>(a.extent(1)), alpha,
+                     a.data(), static_cast<ptrdiff_t>(a.stride(0)), static_cast<ptrdiff_t>(a.stride(1)),
+                     is_conjugated_gemm_operand_v<ET1>,
+                     b.data(), static_cast<ptrdiff_t>(b.stride(0)), static_cast<ptrdiff_t>(b.stride(1)),
+                     is_conjugated_gemm_operand_v<ET2>,
+                     beta, c.data(), static_cast<ptrdiff_t>(c.stride(0)), static_cast<ptrdiff_t>(c.stride(1)));
+}
+
+//- Computes y = A*x (or y = x*A, if X_LEFT is true) on the spans of the operands.
+//
+template<bool X_LEFT, class T, class SA, class SX, class SY>
+bool
+blas_gemv(SA const& a, SX const& x, SY const& y)
+{
+    ptrdiff_t const     m   = static_cast<ptrdiff_t>(a.extent(0));
+    ptrdiff_t const     n   = static_cast<ptrdiff_t>(a.extent(1));
+    ptrdiff_t const     rsa = static_cast<ptrdiff_t>(a.stride(0));
+    ptrdiff_t const     csa = static_cast<ptrdiff_t>(a.stride(1));
+    ptrdiff_t const     ix  = static_cast<ptrdiff_t>(x.stride(0));
+    ptrdiff_t const     iy  = static_cast<ptrdiff_t>(y.stride(0));
+
+    if constexpr (X_LEFT)
+        return blas_gemv(n, m, T{1}, a.data(), csa, rsa, false, x.data(), ix, T{}, y.data(), iy);
+    else
+        return blas_gemv(m, n, T{1}, a.data(), rsa, csa, false, x.data(), ix, T{}, y.data(), iy);
+}
+
+//- Computes Y = alpha*X + Y on the spans of two vectors, or of two matrices of the same shape.
+//  Matrices are updated one line at a time, along the dimension that is contiguous in both.
+//
+template<class T, class SX, class SY>
+bool
+blas_axpy(T alpha, SX const& x, SY const& y)
+{
+    if constexpr (SY::rank() == 1)
+    {
+        return blas_axpy(static_cast<ptrdiff_t>(y.extent(0)), alpha,
+                         x.data(), static_cast<ptrdiff_t>(x.stride(0)),
+                         y.data(), static_cast<ptrdiff_t>(y.stride(0)));
+    }
+    else
+    {
+        ptrdiff_t const     rows = static_cast<ptrdiff_t>(y.extent(0));
+        ptrdiff_t const     cols = static_cast<ptrdiff_t>(y.extent(1));
+        ptrdiff_t const     rsx  = static_cast<ptrdiff_t>(x.stride(0));
+        ptrdiff_t const     csx  = static_cast<ptrdiff_t>(x.stride(1));
+        ptrdiff_t const     rsy  = static_cast<ptrdiff_t>(y.stride(0));
+        ptrdiff_t const     csy  = static_cast<ptrdiff_t>(y.stride(1));
+
+        if (rows == 0  ||  cols == 0) return false;
+
+        if (csx == 1  &&  csy == 1)
+        {
+            for (ptrdiff_t i = 0;  i < rows;  ++i)
+            {
+                if (!blas_axpy(cols, alpha, x.data() + i*rsx, 1, y.data() + i*rsy, 1)) return false;
+            }
+            return true;
+        }
+        if (rsx == 1  &&  rsy == 1)
+        {
+            for (ptrdiff_t j = 0;  j < cols;  ++j)
+            {
+                if (!blas_axpy(rows, alpha, x.data() + j*csx, 1, y.data() + j*csy, 1)) return false;
+            }
+            return true;
+        }
+        return false;
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//                            **** BLAS MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Products of matrices and vectors are handed to the BLAS; products with scalars are computed
+//  by the standard multiplication traits.  Small fixed-size products are left to the unrolled
+//  kernels, which are faster than a call into any library.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct matrix_blas_multiplication_traits
+:   public matrix_multiplication_arithmetic_traits<OT, OP1, OP2>
+{};
+
+//-------------------
+//- (vector * vector)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_arithmetic_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>;
+    using result_type = typename base_traits::result_type;
+
+    static constexpr result_type    multiply(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_blas_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::multiply
+(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
+{
+    if constexpr (detail::use_blas_v<ET1, ET2, ET1>  &&
+                  is_same_v<result_type, typename vector<ET1, OT1>::element_type>)
+    {
+        if (!is_constant_evaluated()  &&  v1.size() == v2.size())
+        {
+            auto const      s1 = v1.span();
+            auto const      s2 = v2.span();
+            result_type     er{};
+
+            if (detail::blas_dot(static_cast<ptrdiff_t>(s1.extent(0)),
+                                 s1.data(), static_cast<ptrdiff_t>(s1.stride(0)),
+                                 s2.data(), static_cast<ptrdiff_t>(s2.stride(0)), er))
+            {
+                return er;
+            }
+        }
+    }
+    return base_traits::multiply(v1, v2);
+}
+
+//-------------------
+//- (matrix * vector)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_arithmetic_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>;
+    using engine_type = typename base_traits::engine_type;
+    using result_type = typename base_traits::result_type;
+
+    static constexpr result_type    multiply(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_blas_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    using index_type_r = typename result_type::index_type;
+    using element_type = typename result_type::element_type;
+
+    if constexpr (detail::use_blas_v<ET1, ET2, engine_type>  &&  !detail::use_fs_small_v<ET1, ET2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&  m1.columns() == v2.size())
+        {
+            result_type     vr;
+
+            if constexpr (is_resizable_engine_v<engine_type>)
+            {
+                detail::resize_for_overwrite(vr, static_cast<index_type_r>(m1.rows()));
+            }
+            if (detail::blas_gemv<false, element_type>(m1.span(), v2.span(), vr.span()))
+            {
+                return vr;
+            }
+        }
+    }
+    return base_traits::multiply(m1, v2);
+}
+
+//-------------------
+//- (vector * matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_arithmetic_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>;
+    using engine_type = typename base_traits::engine_type;
+    using result_type = typename base_traits::result_type;
+
+    static constexpr result_type    multiply(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_blas_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using index_type_r = typename result_type::index_type;
+    using element_type = typename result_type::element_type;
+
+    if constexpr (detail::use_blas_v<ET1, ET2, engine_type>  &&  !detail::use_fs_small_v<ET1, ET2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&  v1.size() == m2.rows())
+        {
+            result_type     vr;
+
+            if constexpr (is_resizable_engine_v<engine_type>)
+            {
+                detail::resize_for_overwrite(vr, static_cast<index_type_r>(m2.columns()));
+            }
+            if (detail::blas_gemv<true, element_type>(m2.span(), v1.span(), vr.span()))
+            {
+                return vr;
+            }
+        }
+    }
+    return base_traits::multiply(v1, m2);
+}
+
+//-------------------
+//- (matrix * matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_arithmetic_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using engine_type = typename base_traits::engine_type;
+    using result_type = typename base_traits::result_type;
+
+    static constexpr result_type    multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_blas_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using index_type_r = typename result_type::index_type;
+    using element_type = typename result_type::element_type;
+
+    //- Transpose and hermitian views are passed as the spans of their referents, as they are
+    //  to the blocked kernel; the strides of the spans determine the transpose flags.
+    //
+    if constexpr (detail::use_blas_gemm_v<ET1, ET2, engine_type>  &&  !detail::use_fs_small_v<ET1, ET2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&  m1.columns() == m2.rows())
+        {
+            result_type     mr;
+
+            if constexpr (is_resizable_engine_v<engine_type>)
+            {
+                detail::resize_for_overwrite(mr, static_cast<index_type_r>(m1.rows()),
+                                             static_cast<index_type_r>(m2.columns()));
+            }
+            if (detail::blas_gemm<ET1, ET2>(element_type{1}, m1.engine().span(), m2.engine().span(),
+                                            element_type{}, mr.span()))
+            {
+                return mr;
+            }
+        }
+    }
+    return base_traits::multiply(m1, m2);
+}
+
+
+//==================================================================================================
+//                             **** BLAS MULTIPLY-ADD TRAITS ****
+//==================================================================================================
+//  The update R = alpha*(M1*M2) + beta*R is computed by ?gemm directly in the storage of R.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct matrix_blas_multiply_add_traits
+:   public matrix_multiply_add_traits<OT, OP1, OP2>
+{};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_multiply_add_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_multiply_add_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+
+    template<class S1, class S2, class ETR, class OTR>
+    static constexpr void   multiply_add(S1 const& alpha, matrix<ET1, OT1> const& m1,
+                                         matrix<ET2, OT2> const& m2, S2 const& beta,
+                                         matrix<ETR, OTR>& mr);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+template<class S1, class S2, class ETR, class OTR> constexpr
+void
+matrix_blas_multiply_add_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply_add
+(S1 const& alpha, matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2, S2 const& beta,
+ matrix<ETR, OTR>& mr)
+{
+    using element_type = typename matrix<ETR, OTR>::element_type;
+
+    if constexpr (detail::use_blas_gemm_v<ET1, ET2, ETR>)
+    {
+        if (!is_constant_evaluated()  &&
+            m1.columns() == m2.rows()  &&  m1.rows() == mr.rows()  &&  m2.columns() == mr.columns()  &&
+            detail::blas_gemm<ET1, ET2>(static_cast<element_type>(alpha), m1.engine().span(),
+                                        m2.engine().span(), static_cast<element_type>(beta), mr.span()))
+        {
+            return;
+        }
+    }
+    base_traits::multiply_add(alpha, m1, m2, beta, mr);
+}
+
+
+//==================================================================================================
+//                          **** BLAS COMPOUND ASSIGNMENT TRAITS ****
+//==================================================================================================
+//  The updates v1 += v2 and v1 -= v2 (and likewise for matrices) are computed by ?axpy; the
+//  updates by scalars are computed by the standard compound assignment traits.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct matrix_blas_compound_assignment_traits
+:   public matrix_compound_assignment_traits<OT, OP1, OP2>
+{};
+
+//-------------------
+//- (vector op= vector)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits = matrix_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>;
+
+    static constexpr void   add_assign(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2);
+    static constexpr void   subtract_assign(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_blas_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::add_assign
+(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2)
+{
+    using element_type = typename vector<ET1, OT1>::element_type;
+
+    if constexpr (detail::use_blas_v<ET2, ET1, ET1>)
+    {
+        if (!is_constant_evaluated()  &&  v1.size() == v2.size()  &&
+            detail::blas_axpy(element_type{1}, v2.span(), v1.span()))
+        {
+            return;
+        }
+    }
+    base_traits::add_assign(v1, v2);
+}
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_blas_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::subtract_assign
+(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2)
+{
+    using element_type = typename vector<ET1, OT1>::element_type;
+
+    if constexpr (detail::use_blas_v<ET2, ET1, ET1>)
+    {
+        if (!is_constant_evaluated()  &&  v1.size() == v2.size()  &&
+            detail::blas_axpy(element_type{-1}, v2.span(), v1.span()))
+        {
+            return;
+        }
+    }
+    base_traits::subtract_assign(v1, v2);
+}
+
+//-------------------
+//- (matrix op= matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_blas_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+
+    static constexpr void   add_assign(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2);
+    static constexpr void   subtract_assign(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_blas_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::add_assign
+(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2)
+{
+    using element_type = typename matrix<ET1, OT1>::element_type;
+
+    if constexpr (detail::use_blas_v<ET2, ET1, ET1>)
+    {
+        if (!is_constant_evaluated()  &&
+            m1.rows() == m2.rows()  &&  m1.columns() == m2.columns()  &&
+            detail::blas_axpy(element_type{1}, m2.span(), m1.span()))
+        {
+            return;
+        }
+    }
+    base_traits::add_assign(m1, m2);
+}
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_blas_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::subtract_assign
+(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2)
+{
+    using element_type = typename matrix<ET1, OT1>::element_type;
+
+    if constexpr (detail::use_blas_v<ET2, ET1, ET1>)
+    {
+        if (!is_constant_evaluated()  &&
+            m1.rows() == m2.rows()  &&  m1.columns() == m2.columns()  &&
+            detail::blas_axpy(element_type{-1}, m2.span(), m1.span()))
+        {
+            return;
+        }
+    }
+    base_traits::subtract_assign(m1, m2);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_BLAS_TRAITS_HPP_DEFINED
@@ -0,0 +1,729 @@
+//==================================================================================================
+//  File:       cholesky_decomposition.hpp
+//
+//  Summary:    This header defines the Cholesky (L*L^H) and LDL^H factorizations of hermitian
+//              (real symmetric) matrices, the triangular solves used with them, and the rank-1
+//              update and downdate of a Cholesky factor.
+//
+//              Both factorizations work in place, and read and write only the lower triangle of
+//              their operand; the strict upper triangle is neither referenced nor modified.  They
+//              are computed by a blocked, right-looking algorithm: each panel of columns is
+//              factored by simple loops, and the lower triangle of the trailing submatrix is then
+//              updated, a block row at a time, by the blocked GEMM kernel (for the blocks below
+//              the diagonal) and by simple loops (for the blocks on it).
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_CHOLESKY_DECOMPOSITION_HPP_DEFINED
+#define LINEAR_ALGEBRA_CHOLESKY_DECOMPOSITION_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Element helpers.  Unlike std::conj() and std::norm(), these return a real type when given a
+//  real argument.
+//==================================================================================================
+//
+template<class T> constexpr
+auto
+element_real(T const& t)
+{
+    if constexpr (is_complex_v<T>)
+        return t.real();
+    else
+        return t;
+}
+
+template<class T> constexpr
+T
+element_conj(T const& t)
+{
+    if constexpr (is_complex_v<T>)
+        return T(t.real(), -t.imag());
+    else
+        return t;
+}
+
+template<class T> constexpr
+auto
+element_norm(T const& t)
+{
+    if constexpr (is_complex_v<T>)
+        return t.real()*t.real() + t.imag()*t.imag();
+    else
+        return t*t;
+}
+
+template<class T>
+using element_real_t = decltype(element_real(declval<T>()));
+
+//- This adaptor presents a vector as a matrix having one column, so that the triangular solve
+//  kernels below serve both vector and matrix right-hand sides.
+//
+template<class VT>
+struct vector_as_column
+{
+    VT&     v;
+
+    constexpr decltype(auto)    operator ()(ptrdiff_t i, ptrdiff_t) const   { return v(i); }
+    constexpr ptrdiff_t         columns() const noexcept                    { return 1; }
+};
+
+//==================================================================================================
+//  The triangular solve kernels, which overwrite the (n x k) right-hand side X with the solution
+//  of T*X = X, where T is:
+//    lower   - the lower triangle of A (with a unit diagonal if UNIT is true)
+//    lower_h - the conjugate transpose of the lower triangle of A (likewise)
+//    upper   - the upper triangle of A
+//  Only the named triangle of A is referenced.  A zero on the diagonal causes an exception.
+//==================================================================================================
+//
+template<class AT> constexpr
+void
+check_triangular_diagonal(AT const& a)
+{
+    using value_type = typename AT::value_type;
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(a.rows());  ++i)
+    {
+        if (a(i, i) == value_type{})
+        {
+            throw runtime_error("matrix is singular");
+        }
+    }
+}
+
+template<bool UNIT, class AT, class XT> constexpr
+void
+trsm_lower(AT const& a, XT& x)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(x.columns());
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        for (ptrdiff_t l = 0;  l < i;  ++l)
+        {
+            auto const  ail = a(i, l);
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) - ail * x(l, j);
+            }
+        }
+        if constexpr (!UNIT)
+        {
+            auto const  aii = a(i, i);
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) / aii;
+            }
+        }
+    }
+}
+
+template<bool UNIT, class AT, class XT> constexpr
+void
+trsm_lower_h(AT const& a, XT& x)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(x.columns());
+
+    for (ptrdiff_t i = n - 1;  i >= 0;  --i)
+    {
+        for (ptrdiff_t l = i + 1;  l < n;  ++l)
+        {
+            auto const  ali = element_conj(a(l, i));
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) - ali * x(l, j);
+            }
+        }
+        if constexpr (!UNIT)
+        {
+            auto const  aii = element_conj(a(i, i));
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) / aii;
+            }
+        }
+    }
+}
+
+template<class AT, class XT> constexpr
+void
+trsm_upper(AT const& a, XT& x)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(x.columns());
+
+    for (ptrdiff_t i = n - 1;  i >= 0;  --i)
+    {
+        for (ptrdiff_t l = i + 1;  l < n;  ++l)
+        {
+            auto const  ail = a(i, l);
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) - ail * x(l, j);
+            }
+        }
+
+        auto const  aii = a(i, i);
+
+        for (ptrdiff_t j = 0;  j < k;  ++j)
+        {
+            x(i, j) = x(i, j) / aii;
+        }
+    }
+}
+
+//==================================================================================================
+//  The panel kernels.  Each factors columns [k0, k1) of the lower triangle of the (n x n) matrix
+//  whose elements are addressed by S, for rows [k0, n), assuming that the contributions of
+//  columns [0, k0) have already been subtracted from those rows.  Function ldlt_panel() stores
+//  the multipliers of L below the diagonal, and D on the diagonal.
+//==================================================================================================
+//
+template<class S>
+void
+cholesky_panel(S& s, ptrdiff_t k0, ptrdiff_t k1, ptrdiff_t n)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+    using real_type  = element_real_t<value_type>;
+
+    for (ptrdiff_t j = k0;  j < k1;  ++j)
+    {
+        real_type   d = element_real(s(j, j));
+
+        for (ptrdiff_t l = k0;  l < j;  ++l)
+        {
+            d = d - element_norm(s(j, l));
+        }
+        if (!(d > real_type{}))
+        {
+            throw runtime_error("matrix is not positive definite");
+        }
+
+        using std::sqrt;
+        real_type const     ljj = sqrt(d);
+
+        s(j, j) = value_type(ljj);
+
+        for (ptrdiff_t i = j + 1;  i < n;  ++i)
+        {
+            value_type  x = s(i, j);
+
+            for (ptrdiff_t l = k0;  l < j;  ++l)
+            {
+                x = x - s(i, l) * element_conj(s(j, l));
+            }
+            s(i, j) = x / ljj;
+        }
+    }
+}
+
+template<class S>
+void
+ldlt_panel(S& s, ptrdiff_t k0, ptrdiff_t k1, ptrdiff_t n)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+    using real_type  = element_real_t<value_type>;
+
+    for (ptrdiff_t j = k0;  j < k1;  ++j)
+    {
+        real_type   d = element_real(s(j, j));
+
+        for (ptrdiff_t l = k0;  l < j;  ++l)
+        {
+            d = d - element_real(s(l, l)) * element_norm(s(j, l));
+        }
+        s(j, j) = value_type(d);
+
+        for (ptrdiff_t i = j + 1;  i < n;  ++i)
+        {
+            value_type  x = s(i, j);
+
+            for (ptrdiff_t l = k0;  l < j;  ++l)
+            {
+                x = x - s(i, l) * element_real(s(l, l)) * element_conj(s(j, l));
+            }
+
+            if (d != real_type{})
+            {
+                s(i, j) = x / d;
+            }
+            else if (x == value_type{})
+            {
+                s(i, j) = value_type{};
+            }
+            else
+            {
+                throw runtime_error("matrix has no LDL^T factorization");
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The blocking parameter of the factorizations (the number of columns in a panel), and the
+//  trailing update C := C - X*L^H, computed on and below the diagonal of the (n x n) matrix C,
+//  where X and L are (n x k).  Each block row of C is updated by the GEMM kernel to the left of
+//  its diagonal block, and by simple loops within it, so no element above the diagonal is used.
+//==================================================================================================
+//
+struct cholesky_blocking
+{
+    static constexpr ptrdiff_t  nb = 48;
+};
+
+template<class T>
+void
+herk_lower_update(ptrdiff_t n, ptrdiff_t k,
+                  T const* px, ptrdiff_t rsx, ptrdiff_t csx,
+                  T const* pl, ptrdiff_t rsl, ptrdiff_t csl,
+                  T* pc, ptrdiff_t rsc, ptrdiff_t csc)
+{
+    constexpr ptrdiff_t     nb = cholesky_blocking::nb;
+
+    for (ptrdiff_t i0 = 0;  i0 < n;  i0 += nb)
+    {
+        ptrdiff_t const     i1 = (n - i0 < nb) ? n : (i0 + nb);
+
+        if (i0 > 0)
+        {
+            gemm_blocked<false, is_complex_v<T>>(i1 - i0, i0, k, T{-1},
+                                                 px + i0*rsx, rsx, csx,
+                                                 pl, csl, rsl,
+                                                 T{1}, pc + i0*rsc, rsc, csc);
+        }
+
+        for (ptrdiff_t i = i0;  i < i1;  ++i)
+        {
+            for (ptrdiff_t j = i0;  j <= i;  ++j)
+            {
+                T   cij = pc[i*rsc + j*csc];
+
+                for (ptrdiff_t l = 0;  l < k;  ++l)
+                {
+                    cij -= px[i*rsx + l*csx] * element_conj(pl[j*rsl + l*csl]);
+                }
+                pc[i*rsc + j*csc] = cij;
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The factorization drivers.  Span-backed operands having GEMM element types are factored by
+//  blocks of columns; all others are factored as a single panel, through A's own operator().
+//  The LDL^H driver forms W = L21*D1 for each panel in a scratch buffer, so that the trailing
+//  update is C := C - W*L21^H.
+//==================================================================================================
+//
+template<bool LDLT, class MT>
+void
+symmetric_factor_in_place(MT& a)
+{
+    using engine_type = typename MT::engine_type;
+    using value_type  = typename MT::value_type;
+
+    static_assert(is_decomposable_element_v<value_type>, "decompositions require floating-point elements");
+
+    constexpr ptrdiff_t     nb = cholesky_blocking::nb;
+
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+
+    if constexpr (has_direct_span_v<engine_type>  &&  is_gemm_element_v<value_type>)
+    {
+        if (n > nb)
+        {
+            auto                s  = a.span();
+            value_type* const   p  = s.data();
+            ptrdiff_t const     rs = static_cast<ptrdiff_t>(s.stride(0));
+            ptrdiff_t const     cs = static_cast<ptrdiff_t>(s.stride(1));
+
+            std::vector<value_type>     work;
+
+            for (ptrdiff_t k0 = 0;  k0 < n;  k0 += nb)
+            {
+                ptrdiff_t const     k1 = (n - k0 < nb) ? n : (k0 + nb);
+                ptrdiff_t const     n2 = n - k1;
+
+                if constexpr (LDLT)
+                {
+                    ldlt_panel(s, k0, k1, n);
+
+                    if (n2 > 0)
+                    {
+                        work.resize(static_cast<size_t>(n2 * (k1 - k0)));
+
+                        for (ptrdiff_t i = 0;  i < n2;  ++i)
+                        {
+                            for (ptrdiff_t l = 0;  l < k1 - k0;  ++l)
+                            {
+                                work[i*(k1 - k0) + l] = s(k1 + i, k0 + l) * element_real(s(k0 + l, k0 + l));
+                            }
+                        }
+                        herk_lower_update(n2, k1 - k0, work.data(), k1 - k0, 1,
+                                          p + k1*rs + k0*cs, rs, cs, p + k1*rs + k1*cs, rs, cs);
+                    }
+                }
+                else
+                {
+                    cholesky_panel(s, k0, k1, n);
+
+                    if (n2 > 0)
+                    {
+                        herk_lower_update(n2, k1 - k0, p + k1*rs + k0*cs, rs, cs,
+                                          p + k1*rs + k0*cs, rs, cs, p + k1*rs + k1*cs, rs, cs);
+                    }
+                }
+            }
+            return;
+        }
+    }
+
+    if constexpr (LDLT)
+        ldlt_panel(a, 0, n, n);
+    else
+        cholesky_panel(a, 0, n, n);
+}
+
+//==================================================================================================
+//  The rank-1 modification of a Cholesky factor L, computing the factor of L*L^H + x*x^H (if
+//  DOWN is false) or L*L^H - x*x^H (if DOWN is true).  Each column of L is combined with the
+//  work vector x by a (hyperbolic, for a downdate) rotation that annihilates the leading element
+//  of x.  Only the lower triangle of L is referenced.
+//==================================================================================================
+//
+template<bool DOWN, class MT, class VT>
+void
+cholesky_rank1_modify(MT& l, VT& x)
+{
+    using value_type = typename MT::value_type;
+    using real_type  = element_real_t<value_type>;
+
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(l.rows());
+
+    for (ptrdiff_t k = 0;  k < n;  ++k)
+    {
+        real_type const     lkk = element_real(l(k, k));
+        real_type const     r2  = DOWN ? (lkk*lkk - element_norm(x(k))) : (lkk*lkk + element_norm(x(k)));
+
+        if (!(r2 > real_type{}))
+        {
+            throw runtime_error("matrix is not positive definite");
+        }
+
+        using std::sqrt;
+        real_type const     r = sqrt(r2);
+        real_type const     c = r / lkk;
+        value_type const    s = x(k) / lkk;
+        value_type const    t = element_conj(s);
+
+        l(k, k) = value_type(r);
+
+        for (ptrdiff_t i = k + 1;  i < n;  ++i)
+        {
+            value_type const    lik = DOWN ? ((l(i, k) - t * x(i)) / c) : ((l(i, k) + t * x(i)) / c);
+
+            l(i, k) = lik;
+            x(i)    = c * x(i) - s * lik;
+        }
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Functions cholesky_factor() and ldlt_factor() overwrite the lower triangle of the hermitian
+//  matrix A, which may be any square matrix (or view of a matrix) having a writable engine, with
+//  the factors of A = L*L^H and A = L*D*L^H, respectively.  For the latter, L has a unit diagonal
+//  and D is stored on the diagonal of A.  Neither references the strict upper triangle of A.
+//  Function cholesky_factor() throws if A is not positive definite; ldlt_factor() accepts any
+//  positive semidefinite A, and throws only if a zero pivot has a non-zero column below it.
+//
+//  Functions cholesky_solve() and ldlt_solve() use those factors to solve A*x = b for a vector b,
+//  or A*X = B for a matrix B, returning the solution as a new object; lower_triangular_solve()
+//  and upper_triangular_solve() do the same for the lower or upper triangle of A.
+//
+//  Functions cholesky_update() and cholesky_downdate() replace the Cholesky factor L of A with
+//  the factor of A + x*x^H or A - x*x^H, respectively, in O(n^2) operations.  The downdate throws
+//  if the result is not positive definite, in which case L is unchanged.
+//
+//  All of these require floating-point elements, real or complex.
+//==================================================================================================
+//
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+void
+cholesky_factor(matrix<ET, OT>& a)
+{
+    detail::check_square(a);
+    detail::symmetric_factor_in_place<false>(a);
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+void
+cholesky_factor(matrix<ET, OT>&& a)
+{
+    cholesky_factor(a);
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+void
+ldlt_factor(matrix<ET, OT>& a)
+{
+    detail::check_square(a);
+    detail::symmetric_factor_in_place<true>(a);
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+void
+ldlt_factor(matrix<ET, OT>&& a)
+{
+    ldlt_factor(a);
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+lower_triangular_solve(matrix<ET1, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(a);
+    if (b.size() != a.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(a);
+
+    auto    x = types::make_vector(a.rows());
+    auto    c = detail::vector_as_column<decltype(x)>{x};
+
+    x = b;
+    detail::trsm_lower<false>(a, c);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+lower_triangular_solve(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET2, OT1>;
+
+    detail::check_square(a);
+    if (b.rows() != a.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(a);
+
+    auto    x = types::make_matrix(b.rows(), b.columns());
+
+    x = b;
+    detail::trsm_lower<false>(a, x);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+upper_triangular_solve(matrix<ET1, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(a);
+    if (b.size() != a.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(a);
+
+    auto    x = types::make_vector(a.rows());
+    auto    c = detail::vector_as_column<decltype(x)>{x};
+
+    x = b;
+    detail::trsm_upper(a, c);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+upper_triangular_solve(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET2, OT1>;
+
+    detail::check_square(a);
+    if (b.rows() != a.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(a);
+
+    auto    x = types::make_matrix(b.rows(), b.columns());
+
+    x = b;
+    detail::trsm_upper(a, x);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+cholesky_solve(matrix<ET1, OT1> const& l, vector<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(l);
+    if (b.size() != l.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(l);
+
+    auto    x = types::make_vector(l.rows());
+    auto    c = detail::vector_as_column<decltype(x)>{x};
+
+    x = b;
+    detail::trsm_lower<false>(l, c);
+    detail::trsm_lower_h<false>(l, c);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+cholesky_solve(matrix<ET1, OT1> const& l, matrix<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET2, OT1>;
+
+    detail::check_square(l);
+    if (b.rows() != l.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(l);
+
+    auto    x = types::make_matrix(b.rows(), b.columns());
+
+    x = b;
+    detail::trsm_lower<false>(l, x);
+    detail::trsm_lower_h<false>(l, x);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+ldlt_solve(matrix<ET1, OT1> const& ld, vector<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(ld);
+    if (b.size() != ld.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(ld);
+
+    auto    x = types::make_vector(ld.rows());
+    auto    c = detail::vector_as_column<decltype(x)>{x};
+
+    x = b;
+    detail::trsm_lower<true>(ld, c);
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(x.size());  ++i)
+    {
+        x(i) = x(i) / ld(i, i);
+    }
+    detail::trsm_lower_h<true>(ld, c);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+ldlt_solve(matrix<ET1, OT1> const& ld, matrix<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET2, OT1>;
+
+    detail::check_square(ld);
+    if (b.rows() != ld.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::check_triangular_diagonal(ld);
+
+    auto    x = types::make_matrix(b.rows(), b.columns());
+
+    x = b;
+    detail::trsm_lower<true>(ld, x);
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(x.rows());  ++i)
+    {
+        auto const  dii = ld(i, i);
+
+        for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(x.columns());  ++j)
+        {
+            x(i, j) = x(i, j) / dii;
+        }
+    }
+    detail::trsm_lower_h<true>(ld, x);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2, detail::enable_if_writable<ET1, ET1> = true> inline
+void
+cholesky_update(matrix<ET1, OT1>& l, vector<ET2, OT2> const& x)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(l);
+    if (x.size() != l.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto    w = types::make_vector(l.rows());
+
+    w = x;
+    detail::cholesky_rank1_modify<false>(l, w);
+}
+
+template<class ET1, class OT1, class ET2, class OT2, detail::enable_if_writable<ET1, ET1> = true> inline
+void
+cholesky_downdate(matrix<ET1, OT1>& l, vector<ET2, OT2> const& x)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(l);
+    if (x.size() != l.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    using real_type = detail::element_real_t<typename types::value_type>;
+
+    auto    w = types::make_vector(l.rows());
+    auto    c = detail::vector_as_column<decltype(w)>{w};
+
+    //- A - x*x^H is positive definite exactly when the solution p of L*p = x has a norm less
+    //  than one.  That is checked before L is modified, so that a rejected downdate leaves L as
+    //  it was.
+    //
+    w = x;
+    detail::check_triangular_diagonal(l);
+    detail::trsm_lower<false>(l, c);
+
+    real_type   pp{};
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(w.size());  ++i)
+    {
+        pp = pp + detail::element_norm(w(i));
+    }
+    if (!(pp < real_type{1}))
+    {
+        throw runtime_error("matrix is not positive definite");
+    }
+
+    w = x;
+    detail::cholesky_rank1_modify<true>(l, w);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_CHOLESKY_DECOMPOSITION_HPP_DEFINED
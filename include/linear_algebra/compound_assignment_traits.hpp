@@ -0,0 +1,382 @@
+//==================================================================================================
+//  File:       compound_assignment_traits.hpp
+//
+//  Summary:    This header defines the private and public traits types that are used to
+//              implement the compound assignment operators (+=, -=, *=, and /=).  Unlike the
+//              binary arithmetic traits, which compute a new vector or matrix, the compound
+//              assignment traits modify their left-hand operand in place; the operand may be
+//              any vector or matrix having a writable engine, including a row, column, or
+//              submatrix view.  No element storage is allocated, unless the right-hand
+//              operand shares elements with the left-hand operand other than element-for-element.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_COMPOUND_ASSIGNMENT_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_COMPOUND_ASSIGNMENT_TRAITS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//                       **** COMPOUND ASSIGNMENT TRAITS DETECTORS ****
+//==================================================================================================
+//  Operation traits types that do not provide nested compound assignment traits use the
+//  default traits.
+//
+template<typename OT, typename OP1, typename OP2>
+using cas_traits_f2_t = typename OT::template compound_assignment_traits<OT, OP1, OP2>;
+
+template<typename OT, typename OP1, typename OP2, typename = void>
+struct cas_traits_chooser
+{
+    using traits_type = matrix_compound_assignment_traits<OT, OP1, OP2>;
+};
+
+template<typename OT, typename OP1, typename OP2>
+struct cas_traits_chooser<OT, OP1, OP2, void_t<cas_traits_f2_t<OT, OP1, OP2>>>
+{
+    using traits_type = cas_traits_f2_t<OT, OP1, OP2>;
+};
+
+template<typename OT, typename OP1, typename OP2>
+using cas_traits_result_t = typename cas_traits_chooser<OT, OP1, OP2>::traits_type;
+
+
+//==================================================================================================
+//                         **** COMPOUND ASSIGNMENT IMPLEMENTATION ****
+//==================================================================================================
+//  Applies v1(i) = OP(v1(i), v2(i)) to every element.  When both engines expose their memory
+//  through a span, the SIMD element-wise kernel is run with the left-hand operand as both its
+//  first argument and its result; otherwise FN, which updates one element in place, is called
+//  in a simple loop.  A right-hand operand sharing elements with the left-hand operand other
+//  than element-for-element (as in v += v) is copied first, since its elements would otherwise
+//  be read after they have been updated.
+//
+template<class OP, class ET1, class OT1, class ET2, class OT2, class FN> constexpr
+void
+compound_assign(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2, FN fn)
+{
+    static_assert(is_writable_engine_v<ET1>);
+
+    using index_type_1 = typename vector<ET1, OT1>::index_type;
+    using index_type_2 = typename vector<ET2, OT2>::index_type;
+
+    if (v1.size() != static_cast<index_type_1>(v2.size()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    if (!is_constant_evaluated()  &&  engines_overlap_inexactly(v1.engine(), v2.engine()))
+    {
+        vector<dr_vector_engine<typename ET2::value_type>, OT2> const   c2(v2);
+
+        compound_assign<OP>(v1, c2, fn);
+        return;
+    }
+
+    if constexpr (use_simd_elementwise_v<ET1, ET2, ET1>)
+    {
+        if (!is_constant_evaluated()  &&  simd_elementwise<OP>(v1.span(), v2.span(), v1.span()))
+        {
+            return;
+        }
+    }
+
+    index_type_1    elems = v1.size();
+    index_type_1    i1 = 0;
+    index_type_2    i2 = 0;
+
+    for (;  i1 < elems;  ++i1, ++i2)
+    {
+        fn(v1(i1), v2(i2));
+    }
+}
+
+//- Applies m1(i, j) = OP(m1(i, j), m2(i, j)) to every element, traversing the elements in the
+//  order in which the left-hand operand stores them.
+//
+template<class OP, class ET1, class OT1, class ET2, class OT2, class FN> constexpr
+void
+compound_assign(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2, FN fn)
+{
+    static_assert(is_writable_engine_v<ET1>);
+
+    using index_type_1 = typename matrix<ET1, OT1>::index_type;
+    using index_type_2 = typename matrix<ET2, OT2>::index_type;
+
+    if (m1.rows() != static_cast<index_type_1>(m2.rows())  ||
+        m1.columns() != static_cast<index_type_1>(m2.columns()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    if (!is_constant_evaluated()  &&  engines_overlap_inexactly(m1.engine(), m2.engine()))
+    {
+        matrix<dr_matrix_engine<typename ET2::value_type>, OT2> const   c2(m2);
+
+        compound_assign<OP>(m1, c2, fn);
+        return;
+    }
+
+    if constexpr (use_simd_elementwise_v<ET1, ET2, ET1>)
+    {
+        if (!is_constant_evaluated()  &&  simd_elementwise<OP>(m1.span(), m2.span(), m1.span()))
+        {
+            return;
+        }
+    }
+
+    index_type_1    rows = m1.rows();
+    index_type_1    cols = m1.columns();
+
+    if constexpr (is_column_major_v<ET1>)
+    {
+        index_type_1    j1 = 0;
+        index_type_2    j2 = 0;
+
+        for (;  j1 < cols;  ++j1, ++j2)
+        {
+            index_type_1    i1 = 0;
+            index_type_2    i2 = 0;
+
+            for (;  i1 < rows;  ++i1, ++i2)
+            {
+                fn(m1(i1, j1), m2(i2, j2));
+            }
+        }
+    }
+    else
+    {
+        index_type_1    i1 = 0;
+        index_type_2    i2 = 0;
+
+        for (;  i1 < rows;  ++i1, ++i2)
+        {
+            index_type_1    j1 = 0;
+            index_type_2    j2 = 0;
+
+            for (;  j1 < cols;  ++j1, ++j2)
+            {
+                fn(m1(i1, j1), m2(i2, j2));
+            }
+        }
+    }
+}
+
+//- Applies v1(i) = OP(v1(i), s2) to every element.
+//
+template<class OP, class ET1, class OT1, class T2, class FN> constexpr
+void
+compound_assign_scalar(vector<ET1, OT1>& v1, T2 const& s2, FN fn)
+{
+    static_assert(is_writable_engine_v<ET1>);
+
+    using index_type_1 = typename vector<ET1, OT1>::index_type;
+
+    if constexpr (use_simd_scalar_v<ET1, T2, ET1>)
+    {
+        if (!is_constant_evaluated()  &&  simd_elementwise_scalar<OP>(v1.span(), s2, v1.span()))
+        {
+            return;
+        }
+    }
+
+    index_type_1    elems = v1.size();
+    index_type_1    i1 = 0;
+
+    for (;  i1 < elems;  ++i1)
+    {
+        fn(v1(i1), s2);
+    }
+}
+
+//- Applies m1(i, j) = OP(m1(i, j), s2) to every element.
+//
+template<class OP, class ET1, class OT1, class T2, class FN> constexpr
+void
+compound_assign_scalar(matrix<ET1, OT1>& m1, T2 const& s2, FN fn)
+{
+    static_assert(is_writable_engine_v<ET1>);
+
+    using index_type_1 = typename matrix<ET1, OT1>::index_type;
+
+    if constexpr (use_simd_scalar_v<ET1, T2, ET1>)
+    {
+        if (!is_constant_evaluated()  &&  simd_elementwise_scalar<OP>(m1.span(), s2, m1.span()))
+        {
+            return;
+        }
+    }
+
+    index_type_1    rows = m1.rows();
+    index_type_1    cols = m1.columns();
+
+    if constexpr (is_column_major_v<ET1>)
+    {
+        for (index_type_1 j = 0;  j < cols;  ++j)
+        {
+            for (index_type_1 i = 0;  i < rows;  ++i)
+            {
+                fn(m1(i, j), s2);
+            }
+        }
+    }
+    else
+    {
+        for (index_type_1 i = 0;  i < rows;  ++i)
+        {
+            for (index_type_1 j = 0;  j < cols;  ++j)
+            {
+                fn(m1(i, j), s2);
+            }
+        }
+    }
+}
+
+//- The element updates.
+//
+struct add_to
+{
+    template<class U1, class U2>
+    constexpr void  operator ()(U1&& u1, U2 const& u2) const    { u1 += u2; }
+};
+
+struct subtract_from
+{
+    template<class U1, class U2>
+    constexpr void  operator ()(U1&& u1, U2 const& u2) const    { u1 -= u2; }
+};
+
+struct multiply_by
+{
+    template<class U1, class U2>
+    constexpr void  operator ()(U1&& u1, U2 const& u2) const    { u1 *= u2; }
+};
+
+struct divide_by
+{
+    template<class U1, class U2>
+    constexpr void  operator ()(U1&& u1, U2 const& u2) const    { u1 /= u2; }
+};
+
+}       //- detail namespace
+//==================================================================================================
+//                              **** COMPOUND ASSIGNMENT TRAITS ****
+//==================================================================================================
+//
+//- Alias interface to detection meta-function that extracts the compound assignment traits type.
+//
+template<class OT, class OP1, class OP2>
+using select_matrix_compound_assignment_t = detail::cas_traits_result_t<OT, OP1, OP2>;
+
+
+//- The standard compound assignment traits type provides the default mechanism for updating
+//  a vector or matrix in place.
+//
+//-------------------
+//- (vector op= vector)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    static constexpr void   add_assign(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2);
+    static constexpr void   subtract_assign(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::add_assign
+(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2)
+{
+    detail::compound_assign<detail::simd_add>(v1, v2, detail::add_to());
+}
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::subtract_assign
+(vector<ET1, OT1>& v1, vector<ET2, OT2> const& v2)
+{
+    detail::compound_assign<detail::simd_subtract>(v1, v2, detail::subtract_from());
+}
+
+
+//-------------------
+//- (matrix op= matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    static constexpr void   add_assign(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2);
+    static constexpr void   subtract_assign(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::add_assign
+(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2)
+{
+    detail::compound_assign<detail::simd_add>(m1, m2, detail::add_to());
+}
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::subtract_assign
+(matrix<ET1, OT1>& m1, matrix<ET2, OT2> const& m2)
+{
+    detail::compound_assign<detail::simd_subtract>(m1, m2, detail::subtract_from());
+}
+
+
+//-------------------
+//- (vector op= scalar)
+//
+template<class OT, class ET1, class OT1, class T2>
+struct matrix_compound_assignment_traits<OT, vector<ET1, OT1>, T2>
+{
+    static constexpr void   multiply_assign(vector<ET1, OT1>& v1, T2 const& s2);
+    static constexpr void   divide_assign(vector<ET1, OT1>& v1, T2 const& s2);
+};
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, vector<ET1, OT1>, T2>::multiply_assign
+(vector<ET1, OT1>& v1, T2 const& s2)
+{
+    detail::compound_assign_scalar<detail::simd_multiply>(v1, s2, detail::multiply_by());
+}
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, vector<ET1, OT1>, T2>::divide_assign
+(vector<ET1, OT1>& v1, T2 const& s2)
+{
+    detail::compound_assign_scalar<detail::simd_divide>(v1, s2, detail::divide_by());
+}
+
+
+//-------------------
+//- (matrix op= scalar)
+//
+template<class OT, class ET1, class OT1, class T2>
+struct matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, T2>
+{
+    static constexpr void   multiply_assign(matrix<ET1, OT1>& m1, T2 const& s2);
+    static constexpr void   divide_assign(matrix<ET1, OT1>& m1, T2 const& s2);
+};
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, T2>::multiply_assign
+(matrix<ET1, OT1>& m1, T2 const& s2)
+{
+    detail::compound_assign_scalar<detail::simd_multiply>(m1, s2, detail::multiply_by());
+}
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+void
+matrix_compound_assignment_traits<OT, matrix<ET1, OT1>, T2>::divide_assign
+(matrix<ET1, OT1>& m1, T2 const& s2)
+{
+    detail::compound_assign_scalar<detail::simd_divide>(m1, s2, detail::divide_by());
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_COMPOUND_ASSIGNMENT_TRAITS_HPP_DEFINED
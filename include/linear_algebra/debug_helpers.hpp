@@ -183,11 +183,11 @@ PrintOperandTypes(string const& loc, O1 const& o1, O2 const& o2)
 #define PRINT_OP_TYPES(ET, MSG, ...)
 //#define PRINT_OP_TYPES(ET, MSG, ...)    STD_LA::PrintOperandTypes<ET>(MSG, __VA_ARGS__)
 
-template<class T, class A>
+template<class T, class A, class L>
 void
-Print(dr_matrix_engine<T, A> const& m, char const* pname = nullptr)
+Print(dr_matrix_engine<T, A, L> const& m, char const* pname = nullptr)
 {
-    using index_type = typename dr_matrix_engine<T, A>::index_type;
+    using index_type = typename dr_matrix_engine<T, A, L>::index_type;
 
     cout << endl << "matrix: " << ((pname) ? pname : "<anon>") << endl;
     cout << "  size: " << m.rows() << "x" << m.columns() << endl;
@@ -295,8 +295,9 @@ struct matrix_division_engine_traits
     using element_type_1 = typename ET1::element_type;
     using element_type_2 = typename ET2::element_type;
     using element_type   = select_matrix_division_element_t<OT, element_type_1, element_type_2>;
+    using layout_type    = detail::result_engine_layout_t<ET1, ET2>;
     using engine_type    = conditional_t<use_matrix_engine,
-                                         dr_matrix_engine<element_type, allocator<element_type>>,
+                                         dr_matrix_engine<element_type, allocator<element_type>, layout_type>,
                                          dr_vector_engine<element_type, allocator<element_type>>>;
 };
 
@@ -331,45 +332,45 @@ struct matrix_division_engine_traits<OT, fs_vector_engine<T1, N1>, scalar_engine
 //
 //- dr_matrix_engine / scalar.
 //
-template<class OT, class T1, class A1, class T2>
+template<class OT, class T1, class A1, class L1, class T2>
 struct matrix_division_engine_traits<OT,
-                                     dr_matrix_engine<T1, A1>,
+                                     dr_matrix_engine<T1, A1, L1>,
                                      scalar_engine<T2>>
 {
     using element_type = select_matrix_division_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, L1>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2>
 struct matrix_division_engine_traits<OT,
-                                     matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
+                                     matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
                                      scalar_engine<T2>>
 {
     using element_type = select_matrix_division_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, L1>;
 };
 
 //----------------------------
 //- fs_matrix_engine / scalar.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2>
 struct matrix_division_engine_traits<OT,
-                                     fs_matrix_engine<T1, R1, C1>,
+                                     fs_matrix_engine<T1, R1, C1, L1>,
                                      scalar_engine<T2>>
 {
     using element_type = select_matrix_division_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R1, C1>;
+    using engine_type  = fs_matrix_engine<element_type, R1, C1, L1>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2>
 struct matrix_division_engine_traits<OT,
-                                     matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
+                                     matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
                                      scalar_engine<T2>>
 {
     using element_type = select_matrix_division_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, C1, R1>;
+    using engine_type  = fs_matrix_engine<element_type, C1, R1, L1>;
 };
 
 
@@ -411,7 +412,16 @@ matrix_division_arithmetic_traits<OTR, vector<ET1, OT1>, T2>::divide
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
+    }
+
+    if constexpr (detail::use_simd_scalar_v<ET1, T2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&
+            detail::simd_elementwise_scalar<detail::simd_divide>(v1.span(), s2, vr.span()))
+        {
+            return vr;
+        }
     }
 
     index_type_r    ir = 0;
@@ -452,7 +462,16 @@ matrix_division_arithmetic_traits<OTR, matrix<ET1, OT1>, T2>::divide
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        mr.resize(rows, cols);
+        detail::resize_for_overwrite(mr, rows, cols);
+    }
+
+    if constexpr (detail::use_simd_scalar_v<ET1, T2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&
+            detail::simd_elementwise_scalar<detail::simd_divide>(m1.span(), s2, mr.span()))
+        {
+            return mr;
+        }
     }
 
     index_type_r    ir = 0;
@@ -4,6 +4,11 @@
 //  Summary:    This header defines a dynamically-resizable vector engine.  In this context,
 //              dynamically-resizable means that the row and column extents of such objects
 //              are determined at run-time.
+//
+//              The engine's elements are stored in the order given by its layout policy, LT,
+//              which is either row_major (the default) or column_major.  The leading dimension
+//              of the storage is the column capacity for row-major engines, and the row
+//              capacity for column-major engines.
 //==================================================================================================
 //
 #ifndef LINEAR_ALGEBRA_DYNAMIC_MATRIX_ENGINE_HPP_DEFINED
@@ -14,9 +19,11 @@ namespace STD_LA {
 //  Dynamically-resizable matrix engine.
 //==================================================================================================
 //
-template<class T, class AT>
+template<class T, class AT, class LT>
 class dr_matrix_engine
 {
+    static_assert(detail::is_matrix_layout_v<LT>);
+
   public:
     //- Types
     //
@@ -24,6 +31,7 @@ class dr_matrix_engine
     using element_type    = T;
     using value_type      = remove_cv_t<T>;
     using allocator_type  = AT;
+    using layout_type     = LT;
     using pointer         = typename allocator_traits<AT>::pointer;
     using const_pointer   = typename allocator_traits<AT>::const_pointer;
     using reference       = element_type&;
@@ -43,6 +51,7 @@ class dr_matrix_engine
     dr_matrix_engine(dr_matrix_engine const& rhs);
     dr_matrix_engine(index_type rows, index_type cols);
     dr_matrix_engine(index_type rows, index_type cols, index_type rowcap, index_type colcap);
+    dr_matrix_engine(index_type rows, index_type cols, for_overwrite_t);
     template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T> = true>
     dr_matrix_engine(ET2 const& rhs);
     template<class T2, detail::enable_if_convertible_element<T2,T> = true>
@@ -84,6 +93,7 @@ class dr_matrix_engine
     void    swap(dr_matrix_engine& other) noexcept;
     void    swap_columns(index_type c1, index_type c2) noexcept;
     void    swap_rows(index_type r1, index_type r2) noexcept;
+    void    transpose_in_place();
 
   private:
     pointer         mp_elems;
@@ -93,7 +103,11 @@ class dr_matrix_engine
     index_type      m_colcap;
     allocator_type  m_alloc;
 
-    void    alloc_new(index_type rows, index_type cols, index_type rowcap, index_type colcap);
+    static constexpr bool   is_column_major = is_same_v<LT, column_major>;
+
+    index_type  offset(index_type i, index_type j) const noexcept;
+    void    alloc_new(index_type rows, index_type cols, index_type rowcap, index_type colcap,
+                      bool value_init = true);
     void    assign(dr_matrix_engine const& rhs);
     template<class ET2>
     void    assign(ET2 const& rhs);
@@ -107,14 +121,14 @@ class dr_matrix_engine
 //------------------------
 //- Construct/copy/destroy
 //
-template<class T, class AT> inline
-dr_matrix_engine<T,AT>::~dr_matrix_engine() noexcept
+template<class T, class AT, class LT> inline
+dr_matrix_engine<T,AT,LT>::~dr_matrix_engine() noexcept
 {
     detail::deallocate(m_alloc, mp_elems, m_rowcap*m_colcap);
 }
 
-template<class T, class AT>
-dr_matrix_engine<T,AT>::dr_matrix_engine()
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine()
 :   mp_elems(nullptr)
 ,   m_rows(0)
 ,   m_cols(0)
@@ -123,54 +137,61 @@ dr_matrix_engine<T,AT>::dr_matrix_engine()
 ,   m_alloc()
 {}
 
-template<class T, class AT>
-dr_matrix_engine<T,AT>::dr_matrix_engine(dr_matrix_engine&& rhs) noexcept
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine(dr_matrix_engine&& rhs) noexcept
 :   dr_matrix_engine()
 {
     rhs.swap(*this);
 }
 
-template<class T, class AT>
-dr_matrix_engine<T,AT>::dr_matrix_engine(dr_matrix_engine const& rhs)
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine(dr_matrix_engine const& rhs)
 :   dr_matrix_engine()
 {
     assign(rhs);
 }
 
-template<class T, class AT>
-dr_matrix_engine<T,AT>::dr_matrix_engine(index_type rows, index_type cols)
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine(index_type rows, index_type cols)
 :   dr_matrix_engine()
 {
     alloc_new(rows, cols, rows, cols);
 }
 
-template<class T, class AT>
-dr_matrix_engine<T,AT>::dr_matrix_engine
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine
 (index_type rows, index_type cols, index_type rowcap, index_type colcap)
 :   dr_matrix_engine()
 {
     alloc_new(rows, cols, rowcap, colcap);
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine(index_type rows, index_type cols, for_overwrite_t)
+:   dr_matrix_engine()
+{
+    alloc_new(rows, cols, rows, cols, false);
+}
+
+template<class T, class AT, class LT>
 template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T>>
-dr_matrix_engine<T,AT>::dr_matrix_engine(ET2 const& rhs)
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine(ET2 const& rhs)
 :   dr_matrix_engine()
 {
     assign(rhs);
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 template<class T2, detail::enable_if_convertible_element<T2,T>> inline
-dr_matrix_engine<T,AT>::dr_matrix_engine(initializer_list<initializer_list<T2>> rhs)
+dr_matrix_engine<T,AT,LT>::dr_matrix_engine(initializer_list<initializer_list<T2>> rhs)
 :   dr_matrix_engine()
 {
     assign(rhs);
 }
 
-template<class T, class AT>
-dr_matrix_engine<T,AT>&
-dr_matrix_engine<T,AT>::operator =(dr_matrix_engine&& rhs) noexcept
+template<class T, class AT, class LT>
+dr_matrix_engine<T,AT,LT>&
+dr_matrix_engine<T,AT,LT>::operator =(dr_matrix_engine&& rhs) noexcept
 {
     dr_matrix_engine    tmp;
     tmp.swap(rhs);
@@ -178,27 +199,27 @@ dr_matrix_engine<T,AT>::operator =(dr_matrix_engine&& rhs) noexcept
     return *this;
 }
 
-template<class T, class AT> inline
-dr_matrix_engine<T,AT>&
-dr_matrix_engine<T,AT>::operator =(dr_matrix_engine const& rhs)
+template<class T, class AT, class LT> inline
+dr_matrix_engine<T,AT,LT>&
+dr_matrix_engine<T,AT,LT>::operator =(dr_matrix_engine const& rhs)
 {
     assign(rhs);
     return *this;
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T>> inline
-dr_matrix_engine<T,AT>&
-dr_matrix_engine<T,AT>::operator =(ET2 const& rhs)
+dr_matrix_engine<T,AT,LT>&
+dr_matrix_engine<T,AT,LT>::operator =(ET2 const& rhs)
 {
     assign(rhs);
     return *this;
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 template<class T2, detail::enable_if_convertible_element<T2,T>> inline
-dr_matrix_engine<T,AT>&
-dr_matrix_engine<T,AT>::operator =(initializer_list<initializer_list<T2>> rhs)
+dr_matrix_engine<T,AT,LT>&
+dr_matrix_engine<T,AT,LT>::operator =(initializer_list<initializer_list<T2>> rhs)
 {
     assign(rhs);
     return *this;
@@ -207,65 +228,65 @@ dr_matrix_engine<T,AT>::operator =(initializer_list<initializer_list<T2>> rhs)
 //----------
 //- Capacity
 //
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::index_type
-dr_matrix_engine<T,AT>::columns() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_type
+dr_matrix_engine<T,AT,LT>::columns() const noexcept
 {
     return m_cols;
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::index_type
-dr_matrix_engine<T,AT>::rows() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_type
+dr_matrix_engine<T,AT,LT>::rows() const noexcept
 {
     return m_rows;
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::index_tuple
-dr_matrix_engine<T,AT>::size() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_tuple
+dr_matrix_engine<T,AT,LT>::size() const noexcept
 {
     return index_tuple(m_rows, m_cols);
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::index_type
-dr_matrix_engine<T,AT>::column_capacity() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_type
+dr_matrix_engine<T,AT,LT>::column_capacity() const noexcept
 {
     return m_colcap;
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::index_type
-dr_matrix_engine<T,AT>::row_capacity() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_type
+dr_matrix_engine<T,AT,LT>::row_capacity() const noexcept
 {
     return m_rowcap;
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::index_tuple
-dr_matrix_engine<T,AT>::capacity() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_tuple
+dr_matrix_engine<T,AT,LT>::capacity() const noexcept
 {
     return index_tuple(m_rowcap, m_colcap);
 }
 
-template<class T, class AT> inline
+template<class T, class AT, class LT> inline
 void
-dr_matrix_engine<T,AT>::reserve(index_type rowcap, index_type colcap)
+dr_matrix_engine<T,AT,LT>::reserve(index_type rowcap, index_type colcap)
 {
     reshape(m_rows, m_cols, rowcap, colcap);
 }
 
-template<class T, class AT> inline
+template<class T, class AT, class LT> inline
 void
-dr_matrix_engine<T,AT>::resize(index_type rows, index_type cols)
+dr_matrix_engine<T,AT,LT>::resize(index_type rows, index_type cols)
 {
     reshape(rows, cols, m_rowcap, m_colcap);
 }
 
-template<class T, class AT> inline
+template<class T, class AT, class LT> inline
 void
-dr_matrix_engine<T,AT>::resize(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+dr_matrix_engine<T,AT,LT>::resize(index_type rows, index_type cols, index_type rowcap, index_type colcap)
 {
     reshape(rows, cols, rowcap, colcap);
 }
@@ -273,43 +294,51 @@ dr_matrix_engine<T,AT>::resize(index_type rows, index_type cols, index_type rowc
 //----------------
 //- Element access
 //
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::reference
-dr_matrix_engine<T,AT>::operator ()(index_type i, index_type j)
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::reference
+dr_matrix_engine<T,AT,LT>::operator ()(index_type i, index_type j)
 {
-    return mp_elems[i*m_colcap + j];
+    return mp_elems[offset(i, j)];
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::const_reference
-dr_matrix_engine<T,AT>::operator ()(index_type i, index_type j) const
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::const_reference
+dr_matrix_engine<T,AT,LT>::operator ()(index_type i, index_type j) const
 {
-    return mp_elems[i*m_colcap + j];
+    return mp_elems[offset(i, j)];
 }
 
 //-------------
 //- Data access
 //
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::span_type
-dr_matrix_engine<T,AT>::span() noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::span_type
+dr_matrix_engine<T,AT,LT>::span() noexcept
 {
-    return detail::make_dyn_span(static_cast<element_type*>(mp_elems), m_rows, m_cols, m_colcap);
+    if constexpr (is_column_major)
+        return detail::make_dyn_span(static_cast<element_type*>(mp_elems), m_rows, m_cols,
+                                     index_type(1), m_rowcap);
+    else
+        return detail::make_dyn_span(static_cast<element_type*>(mp_elems), m_rows, m_cols, m_colcap);
 }
 
-template<class T, class AT> inline
-typename dr_matrix_engine<T,AT>::const_span_type
-dr_matrix_engine<T,AT>::span() const noexcept
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::const_span_type
+dr_matrix_engine<T,AT,LT>::span() const noexcept
 {
-    return detail::make_dyn_span(static_cast<element_type const*>(mp_elems), m_rows, m_cols, m_colcap);
+    if constexpr (is_column_major)
+        return detail::make_dyn_span(static_cast<element_type const*>(mp_elems), m_rows, m_cols,
+                                     index_type(1), m_rowcap);
+    else
+        return detail::make_dyn_span(static_cast<element_type const*>(mp_elems), m_rows, m_cols, m_colcap);
 }
 
 //-----------
 //- Modifiers
 //
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::swap(dr_matrix_engine& other) noexcept
+dr_matrix_engine<T,AT,LT>::swap(dr_matrix_engine& other) noexcept
 {
     if (&other != this)
     {
@@ -322,54 +351,109 @@ dr_matrix_engine<T,AT>::swap(dr_matrix_engine& other) noexcept
     }
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::swap_columns(index_type c1, index_type c2) noexcept
+dr_matrix_engine<T,AT,LT>::swap_columns(index_type c1, index_type c2) noexcept
 {
     if (c1 != c2)
     {
         for (index_type i = 0;  i < m_rows;  ++i)
         {
-            detail::la_swap(mp_elems[i*m_colcap + c1], mp_elems[i*m_colcap + c2]);
+            detail::la_swap(mp_elems[offset(i, c1)], mp_elems[offset(i, c2)]);
         }
     }
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::swap_rows(index_type r1, index_type r2) noexcept
+dr_matrix_engine<T,AT,LT>::swap_rows(index_type r1, index_type r2) noexcept
 {
     if (r1 != r2)
     {
         for (index_type j = 0;  j < m_cols;  ++j)
         {
-            detail::la_swap(mp_elems[r1*m_colcap + j], mp_elems[r2*m_colcap + j]);
+            detail::la_swap(mp_elems[offset(r1, j)], mp_elems[offset(r2, j)]);
         }
     }
 }
 
+//- Transposing in place uses the existing buffer: if it has the capacity for a square of the
+//  larger extent, the elements are swapped across its diagonal; otherwise they are permuted
+//  along the cycles of the transposition, and the row and column capacities are exchanged.
+//
+template<class T, class AT, class LT>
+void
+dr_matrix_engine<T,AT,LT>::transpose_in_place()
+{
+    index_type const    lines  = (is_column_major) ? m_cols : m_rows;
+    index_type const    length = (is_column_major) ? m_rows : m_cols;
+    index_type const    ld     = (is_column_major) ? m_rowcap : m_colcap;
+    index_type const    cap    = (is_column_major) ? m_colcap : m_rowcap;
+
+    if (lines > 0  &&  length > 0  &&
+        detail::transpose_storage_in_place(static_cast<element_type*>(mp_elems), lines, length, ld, cap))
+    {
+        detail::la_swap(m_rowcap, m_colcap);
+    }
+    detail::la_swap(m_rows, m_cols);
+}
+
 //------------------------
 //- Private implementation
 //
-template<class T, class AT>
+template<class T, class AT, class LT> inline
+typename dr_matrix_engine<T,AT,LT>::index_type
+dr_matrix_engine<T,AT,LT>::offset(index_type i, index_type j) const noexcept
+{
+    if constexpr (is_column_major)
+        return i + j*m_rowcap;
+    else
+        return i*m_colcap + j;
+}
+
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::alloc_new(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+dr_matrix_engine<T,AT,LT>::alloc_new
+(index_type rows, index_type cols, index_type rowcap, index_type colcap, bool value_init)
 {
     check_sizes(rows, cols);
     check_capacities(rowcap, colcap);
-    rowcap = max(rows, rowcap);
-    colcap = max(cols, colcap);
+    //- Only the leading dimension (the capacity of the other extent in each row or column
+    //  of storage) is padded.
+    //
+    if constexpr (is_column_major)
+    {
+        colcap = max(cols, colcap);
+        rowcap = detail::padded_leading_dimension<T, AT>(colcap, max(rows, rowcap));
+    }
+    else
+    {
+        rowcap = max(rows, rowcap);
+        colcap = detail::padded_leading_dimension<T, AT>(rowcap, max(cols, colcap));
+    }
+
+    mp_elems = (value_init) ? detail::allocate(m_alloc, (size_t)(rowcap*colcap))
+                            : detail::allocate_for_overwrite(m_alloc, (size_t)(rowcap*colcap));
 
-    mp_elems = detail::allocate(m_alloc, (size_t)(rowcap*colcap));
+    //- Elements outside the logical extent, in unused capacity and padding, are always value-
+    //  initialized, even when those inside it are left for the caller to overwrite.
+    //
+    if (!value_init  ||  detail::is_default_init_allocator_v<AT>)
+    {
+        if constexpr (is_column_major)
+            detail::reset_storage(static_cast<element_type*>(mp_elems), rowcap, cols, rows, colcap, rowcap);
+        else
+            detail::reset_storage(static_cast<element_type*>(mp_elems), colcap, rows, cols, rowcap, colcap);
+    }
     m_rows   = rows;
     m_cols   = cols;
     m_rowcap = rowcap;
     m_colcap = colcap;
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::assign(dr_matrix_engine const& rhs)
+dr_matrix_engine<T,AT,LT>::assign(dr_matrix_engine const& rhs)
 {
     if (&rhs == this) return;
 
@@ -385,39 +469,39 @@ dr_matrix_engine<T,AT>::assign(dr_matrix_engine const& rhs)
     m_colcap = rhs.m_colcap;
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 template<class ET2>
 void
-dr_matrix_engine<T,AT>::assign(ET2 const& rhs)
+dr_matrix_engine<T,AT,LT>::assign(ET2 const& rhs)
 {
     static_assert(is_matrix_engine_v<ET2>);
 
     typename ET2::index_type    rows = static_cast<index_type>(rhs.rows());
     typename ET2::index_type    cols = static_cast<index_type>(rhs.columns());
-    dr_matrix_engine            tmp(rows, cols);
+    dr_matrix_engine            tmp(rows, cols, for_overwrite);
 
     detail::assign_from_matrix_engine(tmp, rhs);
     tmp.swap(*this);
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 template<class T2>
 void
-dr_matrix_engine<T,AT>::assign(initializer_list<initializer_list<T2>> rhs)
+dr_matrix_engine<T,AT,LT>::assign(initializer_list<initializer_list<T2>> rhs)
 {
     detail::check_source_init_list(rhs);
 
     index_type const    rows = static_cast<index_type>(rhs.size());
     index_type const    cols = static_cast<index_type>(rhs.begin()->size());
-    dr_matrix_engine    tmp(rows, cols);
+    dr_matrix_engine    tmp(rows, cols, for_overwrite);
 
     detail::assign_from_matrix_initlist(tmp, rhs);
     tmp.swap(*this);
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::check_capacities(index_type rowcap, index_type colcap)
+dr_matrix_engine<T,AT,LT>::check_capacities(index_type rowcap, index_type colcap)
 {
     if (rowcap < 0  || colcap < 0)
     {
@@ -425,9 +509,9 @@ dr_matrix_engine<T,AT>::check_capacities(index_type rowcap, index_type colcap)
     }
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::check_sizes(index_type rows, index_type cols)
+dr_matrix_engine<T,AT,LT>::check_sizes(index_type rows, index_type cols)
 {
     if (rows < 1  || cols < 1)
     {
@@ -435,21 +519,44 @@ dr_matrix_engine<T,AT>::check_sizes(index_type rows, index_type cols)
     }
 }
 
-template<class T, class AT>
+template<class T, class AT, class LT>
 void
-dr_matrix_engine<T,AT>::reshape(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+dr_matrix_engine<T,AT,LT>::reshape(index_type rows, index_type cols, index_type rowcap, index_type colcap)
 {
     if (rows > m_rowcap  ||  cols > m_colcap   ||  rowcap > m_rowcap  ||  colcap > m_colcap)
     {
+        //- When rows are added beyond the current row capacity, grow the row capacity by at
+        //  least a factor of two, so that adding rows one at a time takes amortized constant
+        //  time per row.
+        //
+        if (rows > m_rowcap)
+        {
+            rowcap = max(rowcap, 2*m_rowcap);
+        }
+
         dr_matrix_engine   tmp(rows, cols, rowcap, colcap);
         index_type const   dst_rows = min(rows, m_rows);
         index_type const   dst_cols = min(cols, m_cols);
 
-        for (index_type i = 0;  i < dst_rows;  ++i)
+        //- Move the surviving elements a row (or column) at a time, or all at once if neither
+        //  engine has padding between the surviving rows (or columns).
+        //
+        index_type const    lines   = (is_column_major) ? dst_cols : dst_rows;
+        index_type const    length  = (is_column_major) ? dst_rows : dst_cols;
+        index_type const    src_ld  = (is_column_major) ? m_rowcap : m_colcap;
+        index_type const    dst_ld  = (is_column_major) ? tmp.m_rowcap : tmp.m_colcap;
+
+        if (length == src_ld  &&  length == dst_ld)
         {
-            for (index_type j = 0;  j < dst_cols;  ++j)
+            std::move(mp_elems, mp_elems + lines*length, tmp.mp_elems);
+        }
+        else
+        {
+            for (index_type i = 0;  i < lines;  ++i)
             {
-                tmp(i, j) = (*this)(i, j);
+                pointer     p_src = mp_elems + i*src_ld;
+
+                std::move(p_src, p_src + length, tmp.mp_elems + i*dst_ld);
             }
         }
         tmp.swap(*this);
@@ -458,6 +565,14 @@ dr_matrix_engine<T,AT>::reshape(index_type rows, index_type cols, index_type row
     {
         check_sizes(rows, cols);
         check_capacities(rowcap, colcap);
+
+        //- Elements leaving the logical extent are reset, so that growing it again within the
+        //  existing capacity exposes only value-initialized elements.
+        //
+        if constexpr (is_column_major)
+            detail::reset_storage(static_cast<element_type*>(mp_elems), m_rowcap, cols, rows, m_cols, m_rows);
+        else
+            detail::reset_storage(static_cast<element_type*>(mp_elems), m_colcap, rows, cols, m_rows, m_cols);
         m_rows = rows;
         m_cols = cols;
     }
@@ -42,6 +42,7 @@ class dr_vector_engine
     dr_vector_engine(dr_vector_engine const& rhs);
     explicit dr_vector_engine(index_type elems);
     dr_vector_engine(index_type elems, index_type elem_cap);
+    dr_vector_engine(index_type elems, for_overwrite_t);
     template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T> = true>
     dr_vector_engine(ET2 const& rhs);
     template<class T2, detail::enable_if_convertible_element<T2,T> = true>
@@ -84,7 +85,7 @@ class dr_vector_engine
     index_type      m_elemcap;
     allocator_type  m_alloc;
 
-    void    alloc_new(index_type elems, index_type cap);
+    void    alloc_new(index_type elems, index_type cap, bool value_init = true);
     void    assign(dr_vector_engine const& rhs);
     template<class ET2>
     void    assign(ET2 const& rhs);
@@ -140,6 +141,13 @@ dr_vector_engine<T,AT>::dr_vector_engine(index_type elems, index_type cap)
     alloc_new(elems, cap);
 }
 
+template<class T, class AT> inline
+dr_vector_engine<T,AT>::dr_vector_engine(index_type elems, for_overwrite_t)
+:   dr_vector_engine()
+{
+    alloc_new(elems, elems, false);
+}
+
 template<class T, class AT>
 template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T>> inline
 dr_vector_engine<T,AT>::dr_vector_engine(ET2 const& rhs)
@@ -293,13 +301,22 @@ dr_vector_engine<T,AT>::swap_elements(index_type i, index_type j) noexcept
 //
 template<class T, class AT>
 void
-dr_vector_engine<T,AT>::alloc_new(index_type new_size, index_type new_cap)
+dr_vector_engine<T,AT>::alloc_new(index_type new_size, index_type new_cap, bool value_init)
 {
     check_size(new_size);
     check_capacity(new_cap);
 
     new_cap   = max(new_size, new_cap);
-    mp_elems  = detail::allocate(m_alloc, new_cap);
+    mp_elems  = (value_init) ? detail::allocate(m_alloc, new_cap)
+                             : detail::allocate_for_overwrite(m_alloc, new_cap);
+
+    //- Elements in unused capacity are always value-initialized, even when those inside the
+    //  logical extent are left for the caller to overwrite.
+    //
+    if (!value_init  ||  detail::is_default_init_allocator_v<AT>)
+    {
+        std::fill(mp_elems + new_size, mp_elems + new_cap, T{});
+    }
     m_elems   = new_size;
     m_elemcap = new_cap;
 }
@@ -327,7 +344,7 @@ dr_vector_engine<T,AT>::assign(ET2 const& rhs)
 {
     static_assert(is_vector_engine_v<ET2>);
 
-    dr_vector_engine    tmp(static_cast<index_type>(rhs.size()));
+    dr_vector_engine    tmp(static_cast<index_type>(rhs.size()), for_overwrite);
 
     detail::assign_from_vector_engine(tmp, rhs);
     tmp.swap(*this);
@@ -338,7 +355,7 @@ template<class T2>
 void
 dr_vector_engine<T,AT>::assign(initializer_list<T2> rhs)
 {
-    dr_vector_engine    tmp(static_cast<index_type>(rhs.size()));
+    dr_vector_engine    tmp(static_cast<index_type>(rhs.size()), for_overwrite);
 
     detail::assign_from_vector_initlist(tmp, rhs);
     tmp.swap(*this);
@@ -382,6 +399,14 @@ dr_vector_engine<T,AT>::reshape(index_type elems, index_type cap)
     else
     {
         check_size(elems);
+
+        //- Elements leaving the logical extent are reset, so that growing it again within the
+        //  existing capacity exposes only value-initialized elements.
+        //
+        if (elems < m_elems)
+        {
+            std::fill(mp_elems + elems, mp_elems + m_elems, T{});
+        }
         m_elems = elems;
     }
 }
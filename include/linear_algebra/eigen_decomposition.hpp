@@ -0,0 +1,787 @@
+//==================================================================================================
+//  File:       eigen_decomposition.hpp
+//
+//  Summary:    This header defines the eigensolvers for real symmetric matrices, which compute
+//              the eigenvalues, and optionally the orthonormal eigenvectors, of the matrix formed
+//              from the lower triangle of their operand.
+//
+//              The operand is first reduced to a symmetric tridiagonal matrix T = Q^T*A*Q, where
+//              Q = H(0)*H(1)*...*H(n-2) is a product of Householder reflectors.  For large
+//              operands the reduction is blocked: the reflectors of each panel of columns are
+//              accumulated into two (n x nb) matrices V and W, and the trailing matrix receives
+//              the rank-2nb update A = A - V*W^T - W*V^T through the blocked GEMM kernel.  The
+//              eigenvalues of T are then found by the implicit QL algorithm with Wilkinson
+//              shifts; when eigenvectors are wanted, the plane rotations of each QL sweep are
+//              accumulated into a matrix Z, and the eigenvectors are formed as Q*Z by applying
+//              the reflectors in compact WY form.
+//
+//              Symmetric 3x3 matrices having fixed-size engines take a fast path: their
+//              eigenvalues are computed in closed form, and their eigenvectors by cyclic Jacobi
+//              rotations.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_EIGEN_DECOMPOSITION_HPP_DEFINED
+#define LINEAR_ALGEBRA_EIGEN_DECOMPOSITION_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The types of the objects created by the eigensolvers.  These are those of the decompositions,
+//  except that the matrix Z, into which the QL rotations are accumulated, is always column-major,
+//  so that each rotation combines two contiguous columns.
+//==================================================================================================
+//
+template<class ET, class OT>
+struct eig_types : public decomposition_types<ET, OT>
+{
+    using value_type   = typename decomposition_types<ET, OT>::value_type;
+    using vectors_type = matrix<dr_matrix_engine<value_type, allocator<value_type>, column_major>, OT>;
+
+    static constexpr vectors_type   make_vectors(ptrdiff_t n)   { return vectors_type(n, n); }
+};
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT, class OT>
+struct eig_types<fs_matrix_engine<T, R, C, LT>, OT>
+:   public decomposition_types<fs_matrix_engine<T, R, C, LT>, OT>
+{
+    using value_type   = T;
+    using vectors_type = matrix<fs_matrix_engine<T, R, C, column_major>, OT>;
+
+    static constexpr vectors_type   make_vectors(ptrdiff_t)     { return vectors_type(); }
+};
+
+//==================================================================================================
+//  The tridiagonal reduction kernels.  Function eig_reflector() generates the reflector H(k)
+//  that annihilates elements (k+2, n) of column k of the matrix addressed by S, storing v(k) in
+//  those elements, with its unit leading element in element k+1, and the resulting subdiagonal
+//  element of T in E(k).  Functions eig_symv() and eig_syr2() compute y = y + A*x and
+//  A = A - v*w^T - w*v^T on the trailing submatrix A = S(j0:n, j0:n), referencing only its lower
+//  triangle.  If COL_MAJOR is true they sweep down the columns; otherwise, along the rows.
+//==================================================================================================
+//
+template<class S, class VT>
+auto
+eig_reflector(S& s, ptrdiff_t k, ptrdiff_t n, VT& e, VT& tau)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+
+    value_type const    alpha = s(k + 1, k);
+    value_type          xnorm = value_type{};
+
+    for (ptrdiff_t i = k + 2;  i < n;  ++i)
+    {
+        xnorm += s(i, k) * s(i, k);
+    }
+
+    s(k + 1, k) = value_type{1};
+
+    if (xnorm == value_type{})
+    {
+        e(k)   = alpha;
+        tau(k) = value_type{};
+        return value_type{};
+    }
+
+    using std::sqrt;
+    value_type const    mag  = sqrt(alpha*alpha + xnorm);
+    value_type const    beta = (alpha < value_type{}) ? mag : -mag;
+    value_type const    scl  = value_type{1} / (alpha - beta);
+
+    for (ptrdiff_t i = k + 2;  i < n;  ++i)
+    {
+        s(i, k) *= scl;
+    }
+    e(k)   = beta;
+    tau(k) = (beta - alpha) / beta;
+    return value_type(tau(k));
+}
+
+template<bool COL_MAJOR, class S, class T>
+void
+eig_symv(S const& s, ptrdiff_t j0, ptrdiff_t n, T const* x, T* y)
+{
+    if constexpr (COL_MAJOR)
+    {
+        for (ptrdiff_t j = j0;  j < n;  ++j)
+        {
+            T const     xj = x[j];
+            T           yj = s(j, j) * xj;
+
+            for (ptrdiff_t i = j + 1;  i < n;  ++i)
+            {
+                T const     aij = s(i, j);
+
+                y[i] += aij * xj;
+                yj   += aij * x[i];
+            }
+            y[j] += yj;
+        }
+    }
+    else
+    {
+        for (ptrdiff_t i = j0;  i < n;  ++i)
+        {
+            T const     xi = x[i];
+            T           yi = s(i, i) * xi;
+
+            for (ptrdiff_t j = j0;  j < i;  ++j)
+            {
+                T const     aij = s(i, j);
+
+                yi   += aij * x[j];
+                y[j] += aij * xi;
+            }
+            y[i] += yi;
+        }
+    }
+}
+
+template<bool COL_MAJOR, class S, class T>
+void
+eig_syr2(S& s, ptrdiff_t j0, ptrdiff_t n, T const* v, T const* w)
+{
+    if constexpr (COL_MAJOR)
+    {
+        for (ptrdiff_t j = j0;  j < n;  ++j)
+        {
+            T const     vj = v[j];
+            T const     wj = w[j];
+
+            for (ptrdiff_t i = j;  i < n;  ++i)
+            {
+                s(i, j) -= v[i] * wj + w[i] * vj;
+            }
+        }
+    }
+    else
+    {
+        for (ptrdiff_t i = j0;  i < n;  ++i)
+        {
+            T const     vi = v[i];
+            T const     wi = w[i];
+
+            for (ptrdiff_t j = j0;  j <= i;  ++j)
+            {
+                s(i, j) -= vi * w[j] + wi * v[j];
+            }
+        }
+    }
+}
+
+//- Function eig_tridiagonalize_panel() reduces columns [k0, n) of S by simple loops, applying
+//  each reflector to the trailing submatrix as w = tau*A*v - (tau^2/2)*(v^T*A*v)*v, followed by
+//  A = A - v*w^T - w*v^T.  It stores the diagonal of T in D.
+//
+template<bool COL_MAJOR, class S, class VT>
+void
+eig_tridiagonalize_panel(S& s, ptrdiff_t k0, ptrdiff_t n, VT& d, VT& e, VT& tau)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+
+    std::vector<value_type>     v(static_cast<size_t>(n)), w(static_cast<size_t>(n));
+
+    for (ptrdiff_t k = k0;  k < n - 1;  ++k)
+    {
+        value_type const    tk = eig_reflector(s, k, n, e, tau);
+
+        if (tk != value_type{})
+        {
+            for (ptrdiff_t i = k + 1;  i < n;  ++i)
+            {
+                v[i] = s(i, k);
+                w[i] = value_type{};
+            }
+            eig_symv<COL_MAJOR>(s, k + 1, n, v.data(), w.data());
+
+            value_type  vw = value_type{};
+
+            for (ptrdiff_t i = k + 1;  i < n;  ++i)
+            {
+                w[i] *= tk;
+                vw   += w[i] * v[i];
+            }
+
+            value_type const    alpha = -tk * vw / value_type{2};
+
+            for (ptrdiff_t i = k + 1;  i < n;  ++i)
+            {
+                w[i] += alpha * v[i];
+            }
+            eig_syr2<COL_MAJOR>(s, k + 1, n, v.data(), w.data());
+        }
+        s(k + 1, k) = e(k);
+        d(k)        = s(k, k);
+    }
+    if (k0 < n)
+    {
+        d(n - 1) = s(n - 1, n - 1);
+    }
+}
+
+//- Function eig_tridiagonalize_block() reduces the nb columns [k0, k0+nb) of the span S without
+//  updating the trailing submatrix, forming the (n x nb) matrix W (stored by rows at PW) such
+//  that the trailing submatrix is reduced by A = A - V*W^T - W*V^T, where column j of V is the
+//  reflector stored in column k0+j of S.  Each column of the panel is first brought up to date
+//  with the reflectors before it; the product of the trailing submatrix with each new reflector
+//  is then corrected for the updates that have been deferred.  PX and PY each point to a work
+//  area of n elements.
+//
+template<bool COL_MAJOR, class S, class VT, class T>
+void
+eig_tridiagonalize_block(S& s, ptrdiff_t k0, ptrdiff_t nb, ptrdiff_t n,
+                         VT& d, VT& e, VT& tau, T* pw, T* px, T* py)
+{
+    std::vector<T>  t1(static_cast<size_t>(nb)), t2(static_cast<size_t>(nb));
+
+    for (ptrdiff_t j = 0;  j < nb;  ++j)
+    {
+        ptrdiff_t const     c = k0 + j;
+
+        for (ptrdiff_t l = 0;  l < j;  ++l)
+        {
+            T const     wcl = pw[c*nb + l];
+            T const     vcl = s(c, k0 + l);
+
+            for (ptrdiff_t i = c;  i < n;  ++i)
+            {
+                s(i, c) -= s(i, k0 + l) * wcl + pw[i*nb + l] * vcl;
+            }
+        }
+        d(c) = s(c, c);
+
+        T const     tc = eig_reflector(s, c, n, e, tau);
+
+        for (ptrdiff_t i = c + 1;  i < n;  ++i)
+        {
+            px[i] = s(i, c);
+            py[i] = T{};
+        }
+        if (tc != T{})
+        {
+            eig_symv<COL_MAJOR>(s, c + 1, n, px, py);
+
+            for (ptrdiff_t l = 0;  l < j;  ++l)
+            {
+                T   wx = T{};
+                T   vx = T{};
+
+                for (ptrdiff_t i = c + 1;  i < n;  ++i)
+                {
+                    wx += pw[i*nb + l] * px[i];
+                    vx += s(i, k0 + l) * px[i];
+                }
+                t1[l] = wx;
+                t2[l] = vx;
+            }
+            for (ptrdiff_t i = c + 1;  i < n;  ++i)
+            {
+                T   yi = py[i];
+
+                for (ptrdiff_t l = 0;  l < j;  ++l)
+                {
+                    yi -= s(i, k0 + l) * t1[l] + pw[i*nb + l] * t2[l];
+                }
+                py[i] = yi;
+            }
+
+            T   vy = T{};
+
+            for (ptrdiff_t i = c + 1;  i < n;  ++i)
+            {
+                py[i] *= tc;
+                vy    += py[i] * px[i];
+            }
+
+            T const     alpha = -tc * vy / T{2};
+
+            for (ptrdiff_t i = c + 1;  i < n;  ++i)
+            {
+                py[i] += alpha * px[i];
+            }
+        }
+        for (ptrdiff_t i = c + 1;  i < n;  ++i)
+        {
+            pw[i*nb + j] = py[i];
+        }
+    }
+}
+
+//==================================================================================================
+//  The blocking parameter of the reduction (the number of columns in a panel), and the reduction
+//  driver.  Span-backed operands having GEMM element types are reduced by panels at run time,
+//  until the trailing submatrix has no more than 2*nb columns; the rest of the reduction, and
+//  that of all other operands, is done by simple loops through A's own operator().
+//==================================================================================================
+//
+struct eig_blocking
+{
+    static constexpr ptrdiff_t  nb = 32;
+};
+
+template<class MT, class VT>
+void
+eig_tridiagonalize(MT& a, VT& d, VT& e, VT& tau)
+{
+    using engine_type = typename MT::engine_type;
+    using value_type  = typename MT::value_type;
+
+    constexpr bool          col_major = is_column_major_v<engine_type>;
+    constexpr ptrdiff_t     nb        = eig_blocking::nb;
+
+    ptrdiff_t const     n  = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t           k0 = 0;
+
+    if (n > 0)
+    {
+        e(n - 1)   = value_type{};
+        tau(n - 1) = value_type{};
+    }
+
+    if constexpr (has_direct_span_v<engine_type>  &&  is_gemm_element_v<value_type>)
+    {
+        if (n > 2*nb)
+        {
+            auto                s  = a.span();
+            value_type* const   p  = s.data();
+            ptrdiff_t const     rs = static_cast<ptrdiff_t>(s.stride(0));
+            ptrdiff_t const     cs = static_cast<ptrdiff_t>(s.stride(1));
+
+            std::vector<value_type>     w(static_cast<size_t>(n * nb));
+            std::vector<value_type>     x(static_cast<size_t>(n)), y(static_cast<size_t>(n));
+
+            for (;  n - k0 > 2*nb;  k0 += nb)
+            {
+                ptrdiff_t const     k1 = k0 + nb;
+
+                eig_tridiagonalize_block<col_major>(s, k0, nb, n, d, e, tau, w.data(), x.data(), y.data());
+
+                //- The lower triangle of the trailing submatrix is updated by block columns;
+                //  the upper triangles of the diagonal blocks are updated too, but never read.
+                //
+                for (ptrdiff_t j0 = k1;  j0 < n;  j0 += nb)
+                {
+                    ptrdiff_t const     jb = (n - j0 < nb) ? (n - j0) : nb;
+
+                    gemm_blocked(n - j0, jb, nb, value_type{-1},
+                                 p + j0*rs + k0*cs, rs, cs,
+                                 w.data() + j0*nb, 1, nb,
+                                 value_type{1}, p + j0*rs + j0*cs, rs, cs);
+                    gemm_blocked(n - j0, jb, nb, value_type{-1},
+                                 w.data() + j0*nb, nb, 1,
+                                 p + j0*rs + k0*cs, cs, rs,
+                                 value_type{1}, p + j0*rs + j0*cs, rs, cs);
+                }
+                for (ptrdiff_t c = k0;  c < k1;  ++c)
+                {
+                    s(c + 1, c) = e(c);
+                }
+            }
+        }
+    }
+
+    eig_tridiagonalize_panel<col_major>(a, k0, n, d, e, tau);
+}
+
+//==================================================================================================
+//  The tridiagonal eigensolver.  Function eig_tridiagonal_ql() overwrites the diagonal D of the
+//  symmetric tridiagonal matrix T with its eigenvalues, destroying the subdiagonal E, by the
+//  implicit QL algorithm.  If VECTORS is true, the plane rotations of each QL sweep are also
+//  applied to the columns of the column-major matrix Z; they are recorded as the sweep proceeds,
+//  and then applied together, each to a pair of contiguous columns.
+//==================================================================================================
+//
+template<class ZT, class T>
+void
+eig_rotate(ZT& z, ptrdiff_t i0, ptrdiff_t m, T const* pc, T const* ps)
+{
+    auto                zs = z.span();
+    T* const            p  = zs.data();
+    ptrdiff_t const     nr = static_cast<ptrdiff_t>(zs.extent(0));
+    ptrdiff_t const     cs = static_cast<ptrdiff_t>(zs.stride(1));
+
+    for (ptrdiff_t i = m - 1;  i >= i0;  --i)
+    {
+        T* const    z0 = p + i*cs;
+        T* const    z1 = z0 + cs;
+        T const     c  = pc[i];
+        T const     s  = ps[i];
+
+        for (ptrdiff_t k = 0;  k < nr;  ++k)
+        {
+            T const     f = z1[k];
+
+            z1[k] = s * z0[k] + c * f;
+            z0[k] = c * z0[k] - s * f;
+        }
+    }
+}
+
+template<bool VECTORS, class VT, class ZT>
+void
+eig_tridiagonal_ql(VT& d, VT& e, ptrdiff_t n, ZT& z)
+{
+    using value_type = remove_cvref_t<decltype(d(0))>;
+
+    constexpr ptrdiff_t     max_iter = 30;
+    value_type const        eps      = numeric_limits<value_type>::epsilon();
+
+    std::vector<value_type>     rc(VECTORS ? static_cast<size_t>(n) : 0u);
+    std::vector<value_type>     rs(VECTORS ? static_cast<size_t>(n) : 0u);
+
+    using std::abs;
+    using std::hypot;
+
+    for (ptrdiff_t l = 0;  l < n;  ++l)
+    {
+        for (ptrdiff_t iter = 0;  ;  ++iter)
+        {
+            ptrdiff_t   m = l;
+
+            for (;  m < n - 1;  ++m)
+            {
+                if (abs(e(m)) <= eps * (abs(d(m)) + abs(d(m + 1)))) break;
+            }
+            if (m == l) break;
+
+            if (iter == max_iter)
+            {
+                throw runtime_error("eigenvalue iteration did not converge");
+            }
+
+            //- Form the Wilkinson shift, and chase the bulge from the bottom of the unreduced
+            //  block [l, m] up to its top.
+            //
+            value_type  g = (d(l + 1) - d(l)) / (value_type{2} * e(l));
+            value_type  r = hypot(g, value_type{1});
+
+            g = d(m) - d(l) + e(l) / (g + ((g < value_type{}) ? -r : r));
+
+            value_type  s = value_type{1};
+            value_type  c = value_type{1};
+            value_type  p = value_type{};
+            ptrdiff_t   i = m - 1;
+
+            for (;  i >= l;  --i)
+            {
+                value_type const    f = s * e(i);
+                value_type const    b = c * e(i);
+
+                r = hypot(f, g);
+                e(i + 1) = r;
+
+                if (r == value_type{})
+                {
+                    d(i + 1) -= p;
+                    e(m)      = value_type{};
+                    break;
+                }
+
+                s = f / r;
+                c = g / r;
+                g = d(i + 1) - p;
+                r = (d(i) - g) * s + value_type{2} * c * b;
+                p = s * r;
+                d(i + 1) = g + p;
+                g = c * r - b;
+
+                if constexpr (VECTORS)
+                {
+                    rc[i] = c;
+                    rs[i] = s;
+                }
+            }
+
+            if constexpr (VECTORS)
+            {
+                eig_rotate(z, i + 1, m, rc.data(), rs.data());
+            }
+            if (r == value_type{}  &&  i >= l) continue;
+
+            d(l) -= p;
+            e(l)  = g;
+            e(m)  = value_type{};
+        }
+    }
+}
+
+//- Function eig_sort() sorts the eigenvalues D into ascending order, along with the columns of Z
+//  if VECTORS is true.
+//
+template<bool VECTORS, class VT, class ZT>
+void
+eig_sort(VT& d, ptrdiff_t n, ZT& z)
+{
+    for (ptrdiff_t i = 0;  i < n - 1;  ++i)
+    {
+        ptrdiff_t   k = i;
+
+        for (ptrdiff_t j = i + 1;  j < n;  ++j)
+        {
+            if (d(j) < d(k)) k = j;
+        }
+        if (k != i)
+        {
+            la_swap(d(i), d(k));
+
+            if constexpr (VECTORS)
+            {
+                for (ptrdiff_t r = 0;  r < static_cast<ptrdiff_t>(z.rows());  ++r)
+                {
+                    la_swap(z(r, i), z(r, k));
+                }
+            }
+        }
+    }
+}
+
+//- Function eig_apply_q() overwrites Z with Q*Z, where Q is the product of the reflectors stored
+//  in A by the reduction.  Reflector k acts on rows [k+1, n), so that the reflectors form the
+//  lower trapezoid of the submatrix A(1:n, 0:n-1) in the layout of a QR factorization.
+//
+template<class MT, class VT, class ZT>
+void
+eig_apply_q(MT& a, VT const& tau, ZT& z)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+
+    if (n < 2) return;
+
+    auto    x = z.submatrix(1, n - 1, 0, n);
+
+    qr_apply_q(a.submatrix(1, n - 1, 0, n - 1), tau, x);
+}
+
+//==================================================================================================
+//  The fixed-size 3x3 fast path.  Function sym3_eigenvalues() computes the eigenvalues of a
+//  symmetric 3x3 matrix by the trigonometric solution of its characteristic equation, after
+//  shifting by the mean eigenvalue and scaling so that the equation is well conditioned.
+//  Function sym3_jacobi() diagonalizes the matrix by sweeps of Jacobi rotations over the three
+//  off-diagonal elements, accumulating the rotations into the eigenvectors V.
+//==================================================================================================
+//
+template<class ET> inline constexpr
+bool    use_fs_sym3_v = false;
+
+template<class T, class LT> inline constexpr
+bool    use_fs_sym3_v<fs_matrix_engine<T, 3, 3, LT>> = true;
+
+template<class MT, class VT>
+void
+sym3_eigenvalues(MT const& a, VT& d)
+{
+    using value_type = typename MT::value_type;
+
+    using std::sqrt;
+    using std::acos;
+    using std::cos;
+
+    value_type const    p1 = a(1, 0)*a(1, 0) + a(2, 0)*a(2, 0) + a(2, 1)*a(2, 1);
+    value_type const    q  = (a(0, 0) + a(1, 1) + a(2, 2)) / value_type{3};
+
+    if (p1 == value_type{})
+    {
+        d(0) = a(0, 0);
+        d(1) = a(1, 1);
+        d(2) = a(2, 2);
+        eig_sort<false>(d, 3, a);
+        return;
+    }
+
+    value_type const    b00 = a(0, 0) - q;
+    value_type const    b11 = a(1, 1) - q;
+    value_type const    b22 = a(2, 2) - q;
+    value_type const    p   = sqrt((b00*b00 + b11*b11 + b22*b22 + value_type{2}*p1) / value_type{6});
+    value_type const    b10 = a(1, 0) / p;
+    value_type const    b20 = a(2, 0) / p;
+    value_type const    b21 = a(2, 1) / p;
+    value_type const    c00 = b00 / p;
+    value_type const    c11 = b11 / p;
+    value_type const    c22 = b22 / p;
+    value_type const    r   = (c00*(c11*c22 - b21*b21) - b10*(b10*c22 - b21*b20) + b20*(b10*b21 - c11*b20))
+                            / value_type{2};
+
+    value_type const    pi  = value_type(3.14159265358979323846L);
+    value_type const    phi = (r <= value_type{-1}) ? pi / value_type{3}
+                            : (r >= value_type{1})  ? value_type{}
+                            : acos(r) / value_type{3};
+
+    value_type const    e1 = q + value_type{2} * p * cos(phi);
+    value_type const    e3 = q + value_type{2} * p * cos(phi + value_type{2} * pi / value_type{3});
+
+    d(0) = e3;
+    d(1) = value_type{3} * q - e1 - e3;
+    d(2) = e1;
+}
+
+template<class T>
+void
+sym3_rotate(T (&a)[3][3], T (&v)[3][3], int p, int q)
+{
+    if (a[q][p] == T{}) return;
+
+    using std::abs;
+    using std::sqrt;
+
+    T const     theta = (a[q][q] - a[p][p]) / (T{2} * a[q][p]);
+    T const     t     = ((theta < T{}) ? T{-1} : T{1}) / (abs(theta) + sqrt(theta*theta + T{1}));
+    T const     c     = T{1} / sqrt(t*t + T{1});
+    T const     s     = t * c;
+    int const   r     = 3 - p - q;
+
+    a[p][p] -= t * a[q][p];
+    a[q][q] += t * a[q][p];
+    a[q][p]  = a[p][q] = T{};
+
+    T const     arp = a[r][p];
+    T const     arq = a[r][q];
+
+    a[r][p] = a[p][r] = c * arp - s * arq;
+    a[r][q] = a[q][r] = s * arp + c * arq;
+
+    for (int k = 0;  k < 3;  ++k)
+    {
+        T const     vkp = v[k][p];
+        T const     vkq = v[k][q];
+
+        v[k][p] = c * vkp - s * vkq;
+        v[k][q] = s * vkp + c * vkq;
+    }
+}
+
+template<class MT, class VT>
+void
+sym3_jacobi(MT& m, VT& d)
+{
+    using value_type = typename MT::value_type;
+
+    constexpr int       max_sweeps = 50;
+    value_type const    eps        = numeric_limits<value_type>::epsilon();
+
+    value_type  a[3][3] = {{m(0, 0), m(1, 0), m(2, 0)},
+                           {m(1, 0), m(1, 1), m(2, 1)},
+                           {m(2, 0), m(2, 1), m(2, 2)}};
+    value_type  v[3][3] = {{value_type{1}, value_type{}, value_type{}},
+                           {value_type{}, value_type{1}, value_type{}},
+                           {value_type{}, value_type{}, value_type{1}}};
+
+    for (int sweep = 0;  sweep < max_sweeps;  ++sweep)
+    {
+        value_type const    off  = a[1][0]*a[1][0] + a[2][0]*a[2][0] + a[2][1]*a[2][1];
+        value_type const    diag = a[0][0]*a[0][0] + a[1][1]*a[1][1] + a[2][2]*a[2][2];
+
+        if (off <= eps * eps * diag) break;
+
+        sym3_rotate(a, v, 0, 1);
+        sym3_rotate(a, v, 0, 2);
+        sym3_rotate(a, v, 1, 2);
+    }
+
+    for (int i = 0;  i < 3;  ++i)
+    {
+        d(i) = a[i][i];
+
+        for (int k = 0;  k < 3;  ++k)
+        {
+            m(k, i) = v[k][i];
+        }
+    }
+    eig_sort<true>(d, 3, m);
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Function symmetric_eigenvalues() returns the eigenvalues, in ascending order, of the real
+//  symmetric matrix whose lower triangle is that of A.  Function symmetric_eigen() returns those
+//  eigenvalues too, and overwrites A, which may be any square matrix (or view of a matrix) having
+//  a writable engine, with the corresponding orthonormal eigenvectors, as its columns.  Both
+//  require real floating-point elements, and throw if the iteration fails to converge.
+//==================================================================================================
+//
+template<class ET, class OT> inline
+auto
+symmetric_eigenvalues(matrix<ET, OT> const& a)
+{
+    using types      = detail::decomposition_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    static_assert(is_floating_point_v<value_type>, "symmetric eigensolvers require real floating-point elements");
+
+    detail::check_square(a);
+
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+    auto                d = types::make_vector(n);
+
+    if constexpr (detail::use_fs_sym3_v<ET>)
+    {
+        detail::sym3_eigenvalues(a, d);
+    }
+    else
+    {
+        typename types::matrix_type     w(a);
+        auto                            e   = types::make_vector(n);
+        auto                            tau = types::make_vector(n);
+
+        detail::eig_tridiagonalize(w, d, e, tau);
+        detail::eig_tridiagonal_ql<false>(d, e, n, w);
+        detail::eig_sort<false>(d, n, w);
+    }
+    return d;
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+auto
+symmetric_eigen(matrix<ET, OT>& a)
+{
+    using types      = detail::eig_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    static_assert(is_floating_point_v<value_type>, "symmetric eigensolvers require real floating-point elements");
+
+    detail::check_square(a);
+
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.rows());
+    auto                d = types::make_vector(n);
+
+    if constexpr (detail::use_fs_sym3_v<ET>)
+    {
+        detail::sym3_jacobi(a, d);
+    }
+    else
+    {
+        auto    e   = types::make_vector(n);
+        auto    tau = types::make_vector(n);
+        auto    z   = types::make_vectors(n);
+
+        for (ptrdiff_t i = 0;  i < n;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < n;  ++j)
+            {
+                z(i, j) = (i == j) ? value_type{1} : value_type{};
+            }
+        }
+
+        detail::eig_tridiagonalize(a, d, e, tau);
+        detail::eig_tridiagonal_ql<true>(d, e, n, z);
+        detail::eig_sort<true>(d, n, z);
+        detail::eig_apply_q(a, tau, z);
+
+        for (ptrdiff_t i = 0;  i < n;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < n;  ++j)
+            {
+                a(i, j) = z(i, j);
+            }
+        }
+    }
+    return d;
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+auto
+symmetric_eigen(matrix<ET, OT>&& a)
+{
+    return symmetric_eigen(a);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_EIGEN_DECOMPOSITION_HPP_DEFINED
@@ -0,0 +1,804 @@
+//==================================================================================================
+//  File:       elementwise_kernels.hpp
+//
+//  Summary:    This header defines the private computational kernels used by the addition,
+//              subtraction, and division arithmetic traits, and by the compound assignment
+//              traits, when both operands, and the result, are backed by row-contiguous memory
+//              that can be addressed through a span (see detail::has_direct_span_v).  On x86
+//              targets the kernels are compiled for SSE2, AVX, and AVX-512, and the widest
+//              instruction set supported by the executing CPU is selected at run time, so no
+//              -march (or /arch) option is needed to use it; each row is finished with a scalar
+//              loop.  When all three spans have no padding between rows, the whole buffer is
+//              processed as a single flat array; otherwise, when the rows of all three spans are
+//              aligned (see aligned_allocator), aligned loads are used.
+//
+//              The header also selects, at compile time, the widest instruction set that the
+//              compiler has been told it may use (LA_SIMD_AVX512, LA_SIMD_AVX, or LA_SIMD_SSE2),
+//              for the small kernels of the other headers, which are too short to be worth a
+//              run-time choice.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_ELEMENTWISE_KERNELS_HPP_DEFINED
+#define LINEAR_ALGEBRA_ELEMENTWISE_KERNELS_HPP_DEFINED
+
+//- Select the widest instruction set that the compiler has been told it may use, and whether the
+//  run-time selection of the element-wise kernels is available.  Defining LA_NO_SIMD disables
+//  all of the intrinsic kernels, leaving only the scalar loops.
+//
+#if !defined(LA_NO_SIMD)
+    #if defined(__AVX512F__)
+        #define LA_SIMD_AVX512
+    #elif defined(__AVX__)
+        #define LA_SIMD_AVX
+    #elif defined(__SSE2__)  ||  defined(_M_X64)  ||  (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define LA_SIMD_SSE2
+    #endif
+
+    #if defined(__x86_64__)  ||  defined(__i386__)  ||  defined(_M_X64)  ||  defined(_M_IX86)
+        #define LA_SIMD_DISPATCH
+    #endif
+#endif
+
+#if defined(LA_SIMD_AVX512) || defined(LA_SIMD_AVX) || defined(LA_SIMD_SSE2) || defined(LA_SIMD_DISPATCH)
+    #include <immintrin.h>
+#endif
+
+//- Functions compiled for an instruction set wider than the compiler's target are marked with
+//  LA_SIMD_TARGET; the kernel entry points are also marked with LA_SIMD_FLATTEN, so that the
+//  generic loops and the register operations are inlined into them, and so compiled for the
+//  same instruction set.  MSVC accepts the intrinsics of every instruction set in any function.
+//
+#if defined(LA_SIMD_DISPATCH)
+    #if defined(_MSC_VER)  &&  !defined(__clang__)
+        #include <intrin.h>
+        #define LA_SIMD_TARGET(ISA)
+        #define LA_SIMD_FLATTEN
+    #else
+        #define LA_SIMD_TARGET(ISA)     __attribute__((target(ISA)))
+        #define LA_SIMD_FLATTEN         __attribute__((flatten))
+    #endif
+#endif
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Run-time selection of the instruction set.  Function simd_detect_isa() queries the CPU (and
+//  the operating system's support for the wider registers); function simd_active_isa() returns
+//  the instruction set used by the kernels, which is the detected one unless a narrower one has
+//  been requested with simd_limit_isa().  The limit exists so that every kernel can be tested on
+//  a CPU that supports the widest instruction set.
+//==================================================================================================
+//
+enum class simd_isa : int
+{
+    none   = 0,
+    sse2   = 1,
+    avx    = 2,
+    avx512 = 3
+};
+
+inline simd_isa
+simd_detect_isa() noexcept
+{
+#if !defined(LA_SIMD_DISPATCH)
+    return simd_isa::none;
+#elif defined(_MSC_VER)  &&  !defined(__clang__)
+    int     regs[4];
+
+    __cpuid(regs, 0);
+    int const   max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    bool const  has_sse2    = (regs[3] & (1 << 26)) != 0;
+    bool const  has_osxsave = (regs[2] & (1 << 27)) != 0;
+    bool const  has_avx     = (regs[2] & (1 << 28)) != 0;
+    bool        has_avx512  = false;
+
+    if (max_leaf >= 7)
+    {
+        __cpuidex(regs, 7, 0);
+        has_avx512 = (regs[1] & (1 << 16)) != 0;
+    }
+
+    //- The OS must save the YMM registers (XCR0 bits 1-2) for AVX, and also the opmask and ZMM
+    //  registers (XCR0 bits 5-7) for AVX-512.
+    //
+    unsigned long long const    xcr0 = has_osxsave ? _xgetbv(0) : 0;
+
+    if (has_avx  &&  has_avx512  &&  (xcr0 & 0xE6) == 0xE6) return simd_isa::avx512;
+    if (has_avx  &&  (xcr0 & 0x06) == 0x06) return simd_isa::avx;
+    if (has_sse2) return simd_isa::sse2;
+    return simd_isa::none;
+#else
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) return simd_isa::avx512;
+    if (__builtin_cpu_supports("avx")) return simd_isa::avx;
+    if (__builtin_cpu_supports("sse2")) return simd_isa::sse2;
+    return simd_isa::none;
+#endif
+}
+
+inline atomic<int>&
+simd_isa_limit() noexcept
+{
+    static atomic<int>  limit{static_cast<int>(simd_isa::avx512)};
+    return limit;
+}
+
+inline simd_isa
+simd_active_isa() noexcept
+{
+    static simd_isa const   detected = simd_detect_isa();
+    int const               limit    = simd_isa_limit().load(memory_order_relaxed);
+
+    return (static_cast<int>(detected) < limit) ? detected : static_cast<simd_isa>(limit);
+}
+
+inline void
+simd_limit_isa(simd_isa isa) noexcept
+{
+    simd_isa_limit().store(static_cast<int>(isa), memory_order_relaxed);
+}
+
+//- Returns the size, in bytes, of the registers of an instruction set.
+//
+inline constexpr size_t
+simd_register_size(simd_isa isa) noexcept
+{
+    return (isa == simd_isa::avx512) ? 64 :
+           (isa == simd_isa::avx)    ? 32 :
+           (isa == simd_isa::sse2)   ? 16 : 0;
+}
+
+//==================================================================================================
+//  Traits type simd_pack<R, ISA> wraps the vector register type, and the load/store/arithmetic
+//  intrinsics, for real element type R and instruction set ISA.  The primary template describes
+//  the absence of vector support (width == 0).  Registers are passed by reference, so that the
+//  generic loops, which are not themselves compiled for any instruction set, never pass or
+//  return them by value.  Complex elements are handled as interleaved arrays of their real and
+//  imaginary parts, which is valid for element-wise addition, subtraction, and multiplication
+//  or division by a real scalar.
+//==================================================================================================
+//
+template<class R, simd_isa ISA>
+struct simd_pack
+{
+    static constexpr ptrdiff_t  width = 0;
+};
+
+#if defined(LA_SIMD_DISPATCH)
+
+template<>
+struct simd_pack<float, simd_isa::avx512>
+{
+    using type = __m512;
+    static constexpr ptrdiff_t  width = 16;
+
+    LA_SIMD_TARGET("avx512f")
+    static void     load(type& v, float const* p) noexcept               { v = _mm512_loadu_ps(p); }
+    LA_SIMD_TARGET("avx512f")
+    static void     store(float* p, type const& v) noexcept              { _mm512_storeu_ps(p, v); }
+    LA_SIMD_TARGET("avx512f")
+    static void     load_aligned(type& v, float const* p) noexcept       { v = _mm512_load_ps(p); }
+    LA_SIMD_TARGET("avx512f")
+    static void     store_aligned(float* p, type const& v) noexcept      { _mm512_store_ps(p, v); }
+    LA_SIMD_TARGET("avx512f")
+    static void     broadcast(type& v, float s) noexcept                 { v = _mm512_set1_ps(s); }
+    LA_SIMD_TARGET("avx512f")
+    static void     add(type& r, type const& a, type const& b) noexcept  { r = _mm512_add_ps(a, b); }
+    LA_SIMD_TARGET("avx512f")
+    static void     sub(type& r, type const& a, type const& b) noexcept  { r = _mm512_sub_ps(a, b); }
+    LA_SIMD_TARGET("avx512f")
+    static void     mul(type& r, type const& a, type const& b) noexcept  { r = _mm512_mul_ps(a, b); }
+    LA_SIMD_TARGET("avx512f")
+    static void     div(type& r, type const& a, type const& b) noexcept  { r = _mm512_div_ps(a, b); }
+};
+
+template<>
+struct simd_pack<double, simd_isa::avx512>
+{
+    using type = __m512d;
+    static constexpr ptrdiff_t  width = 8;
+
+    LA_SIMD_TARGET("avx512f")
+    static void     load(type& v, double const* p) noexcept              { v = _mm512_loadu_pd(p); }
+    LA_SIMD_TARGET("avx512f")
+    static void     store(double* p, type const& v) noexcept             { _mm512_storeu_pd(p, v); }
+    LA_SIMD_TARGET("avx512f")
+    static void     load_aligned(type& v, double const* p) noexcept      { v = _mm512_load_pd(p); }
+    LA_SIMD_TARGET("avx512f")
+    static void     store_aligned(double* p, type const& v) noexcept     { _mm512_store_pd(p, v); }
+    LA_SIMD_TARGET("avx512f")
+    static void     broadcast(type& v, double s) noexcept                { v = _mm512_set1_pd(s); }
+    LA_SIMD_TARGET("avx512f")
+    static void     add(type& r, type const& a, type const& b) noexcept  { r = _mm512_add_pd(a, b); }
+    LA_SIMD_TARGET("avx512f")
+    static void     sub(type& r, type const& a, type const& b) noexcept  { r = _mm512_sub_pd(a, b); }
+    LA_SIMD_TARGET("avx512f")
+    static void     mul(type& r, type const& a, type const& b) noexcept  { r = _mm512_mul_pd(a, b); }
+    LA_SIMD_TARGET("avx512f")
+    static void     div(type& r, type const& a, type const& b) noexcept  { r = _mm512_div_pd(a, b); }
+};
+
+template<>
+struct simd_pack<float, simd_isa::avx>
+{
+    using type = __m256;
+    static constexpr ptrdiff_t  width = 8;
+
+    LA_SIMD_TARGET("avx")
+    static void     load(type& v, float const* p) noexcept               { v = _mm256_loadu_ps(p); }
+    LA_SIMD_TARGET("avx")
+    static void     store(float* p, type const& v) noexcept              { _mm256_storeu_ps(p, v); }
+    LA_SIMD_TARGET("avx")
+    static void     load_aligned(type& v, float const* p) noexcept       { v = _mm256_load_ps(p); }
+    LA_SIMD_TARGET("avx")
+    static void     store_aligned(float* p, type const& v) noexcept      { _mm256_store_ps(p, v); }
+    LA_SIMD_TARGET("avx")
+    static void     broadcast(type& v, float s) noexcept                 { v = _mm256_set1_ps(s); }
+    LA_SIMD_TARGET("avx")
+    static void     add(type& r, type const& a, type const& b) noexcept  { r = _mm256_add_ps(a, b); }
+    LA_SIMD_TARGET("avx")
+    static void     sub(type& r, type const& a, type const& b) noexcept  { r = _mm256_sub_ps(a, b); }
+    LA_SIMD_TARGET("avx")
+    static void     mul(type& r, type const& a, type const& b) noexcept  { r = _mm256_mul_ps(a, b); }
+    LA_SIMD_TARGET("avx")
+    static void     div(type& r, type const& a, type const& b) noexcept  { r = _mm256_div_ps(a, b); }
+};
+
+template<>
+struct simd_pack<double, simd_isa::avx>
+{
+    using type = __m256d;
+    static constexpr ptrdiff_t  width = 4;
+
+    LA_SIMD_TARGET("avx")
+    static void     load(type& v, double const* p) noexcept              { v = _mm256_loadu_pd(p); }
+    LA_SIMD_TARGET("avx")
+    static void     store(double* p, type const& v) noexcept             { _mm256_storeu_pd(p, v); }
+    LA_SIMD_TARGET("avx")
+    static void     load_aligned(type& v, double const* p) noexcept      { v = _mm256_load_pd(p); }
+    LA_SIMD_TARGET("avx")
+    static void     store_aligned(double* p, type const& v) noexcept     { _mm256_store_pd(p, v); }
+    LA_SIMD_TARGET("avx")
+    static void     broadcast(type& v, double s) noexcept                { v = _mm256_set1_pd(s); }
+    LA_SIMD_TARGET("avx")
+    static void     add(type& r, type const& a, type const& b) noexcept  { r = _mm256_add_pd(a, b); }
+    LA_SIMD_TARGET("avx")
+    static void     sub(type& r, type const& a, type const& b) noexcept  { r = _mm256_sub_pd(a, b); }
+    LA_SIMD_TARGET("avx")
+    static void     mul(type& r, type const& a, type const& b) noexcept  { r = _mm256_mul_pd(a, b); }
+    LA_SIMD_TARGET("avx")
+    static void     div(type& r, type const& a, type const& b) noexcept  { r = _mm256_div_pd(a, b); }
+};
+
+template<>
+struct simd_pack<float, simd_isa::sse2>
+{
+    using type = __m128;
+    static constexpr ptrdiff_t  width = 4;
+
+    LA_SIMD_TARGET("sse2")
+    static void     load(type& v, float const* p) noexcept               { v = _mm_loadu_ps(p); }
+    LA_SIMD_TARGET("sse2")
+    static void     store(float* p, type const& v) noexcept              { _mm_storeu_ps(p, v); }
+    LA_SIMD_TARGET("sse2")
+    static void     load_aligned(type& v, float const* p) noexcept       { v = _mm_load_ps(p); }
+    LA_SIMD_TARGET("sse2")
+    static void     store_aligned(float* p, type const& v) noexcept      { _mm_store_ps(p, v); }
+    LA_SIMD_TARGET("sse2")
+    static void     broadcast(type& v, float s) noexcept                 { v = _mm_set1_ps(s); }
+    LA_SIMD_TARGET("sse2")
+    static void     add(type& r, type const& a, type const& b) noexcept  { r = _mm_add_ps(a, b); }
+    LA_SIMD_TARGET("sse2")
+    static void     sub(type& r, type const& a, type const& b) noexcept  { r = _mm_sub_ps(a, b); }
+    LA_SIMD_TARGET("sse2")
+    static void     mul(type& r, type const& a, type const& b) noexcept  { r = _mm_mul_ps(a, b); }
+    LA_SIMD_TARGET("sse2")
+    static void     div(type& r, type const& a, type const& b) noexcept  { r = _mm_div_ps(a, b); }
+};
+
+template<>
+struct simd_pack<double, simd_isa::sse2>
+{
+    using type = __m128d;
+    static constexpr ptrdiff_t  width = 2;
+
+    LA_SIMD_TARGET("sse2")
+    static void     load(type& v, double const* p) noexcept              { v = _mm_loadu_pd(p); }
+    LA_SIMD_TARGET("sse2")
+    static void     store(double* p, type const& v) noexcept             { _mm_storeu_pd(p, v); }
+    LA_SIMD_TARGET("sse2")
+    static void     load_aligned(type& v, double const* p) noexcept      { v = _mm_load_pd(p); }
+    LA_SIMD_TARGET("sse2")
+    static void     store_aligned(double* p, type const& v) noexcept     { _mm_store_pd(p, v); }
+    LA_SIMD_TARGET("sse2")
+    static void     broadcast(type& v, double s) noexcept                { v = _mm_set1_pd(s); }
+    LA_SIMD_TARGET("sse2")
+    static void     add(type& r, type const& a, type const& b) noexcept  { r = _mm_add_pd(a, b); }
+    LA_SIMD_TARGET("sse2")
+    static void     sub(type& r, type const& a, type const& b) noexcept  { r = _mm_sub_pd(a, b); }
+    LA_SIMD_TARGET("sse2")
+    static void     mul(type& r, type const& a, type const& b) noexcept  { r = _mm_mul_pd(a, b); }
+    LA_SIMD_TARGET("sse2")
+    static void     div(type& r, type const& a, type const& b) noexcept  { r = _mm_div_pd(a, b); }
+};
+
+#endif
+
+//- The element-wise operations, each providing a vector form (for simd_pack P) and a scalar form.
+//
+struct simd_add
+{
+    template<class P, class V>
+    static void     vec(V& r, V const& a, V const& b) noexcept  { P::add(r, a, b); }
+
+    template<class R>
+    static R    elem(R a, R b) noexcept { return a + b; }
+};
+
+struct simd_subtract
+{
+    template<class P, class V>
+    static void     vec(V& r, V const& a, V const& b) noexcept  { P::sub(r, a, b); }
+
+    template<class R>
+    static R    elem(R a, R b) noexcept { return a - b; }
+};
+
+struct simd_multiply
+{
+    template<class P, class V>
+    static void     vec(V& r, V const& a, V const& b) noexcept  { P::mul(r, a, b); }
+
+    template<class R>
+    static R    elem(R a, R b) noexcept { return a * b; }
+};
+
+struct simd_divide
+{
+    template<class P, class V>
+    static void     vec(V& r, V const& a, V const& b) noexcept  { P::div(r, a, b); }
+
+    template<class R>
+    static R    elem(R a, R b) noexcept { return a / b; }
+};
+
+//- Loads and stores, aligned to the width of the pack or not.
+//
+template<class P, bool ALIGNED, class V, class R>
+inline void
+simd_load(V& v, R const* p) noexcept
+{
+    if constexpr (ALIGNED)
+        P::load_aligned(v, p);
+    else
+        P::load(v, p);
+}
+
+template<class P, bool ALIGNED, class R, class V>
+inline void
+simd_store(R* p, V const& v) noexcept
+{
+    if constexpr (ALIGNED)
+        P::store_aligned(p, v);
+    else
+        P::store(p, v);
+}
+
+//==================================================================================================
+//  Kernels over flat arrays of N real elements.  The generic loops, for pack P, are unrolled by
+//  two to hide the latency of the arithmetic; the remaining elements are handled one at a time.
+//  If ALIGNED is true, every array must begin on a boundary that is a multiple of the pack's
+//  size in bytes.  Each loop is instantiated in an entry point compiled for the instruction set
+//  of its pack, and functions simd_binary() and simd_binary_scalar() call the entry point of
+//  the active instruction set.
+//==================================================================================================
+//
+template<class P, class OP, bool ALIGNED, class R>
+inline void
+simd_binary_loop(R const* p1, R const* p2, R* pr, ptrdiff_t n) noexcept
+{
+    ptrdiff_t   i = 0;
+
+    if constexpr (P::width > 0)
+    {
+        constexpr ptrdiff_t     W = P::width;
+
+        typename P::type    a0, a1, b0, b1;
+
+        for (;  i + 2*W <= n;  i += 2*W)
+        {
+            simd_load<P, ALIGNED>(a0, p1 + i);
+            simd_load<P, ALIGNED>(a1, p1 + i + W);
+            simd_load<P, ALIGNED>(b0, p2 + i);
+            simd_load<P, ALIGNED>(b1, p2 + i + W);
+            OP::template vec<P>(a0, a0, b0);
+            OP::template vec<P>(a1, a1, b1);
+            simd_store<P, ALIGNED>(pr + i,     a0);
+            simd_store<P, ALIGNED>(pr + i + W, a1);
+        }
+        for (;  i + W <= n;  i += W)
+        {
+            simd_load<P, ALIGNED>(a0, p1 + i);
+            simd_load<P, ALIGNED>(b0, p2 + i);
+            OP::template vec<P>(a0, a0, b0);
+            simd_store<P, ALIGNED>(pr + i, a0);
+        }
+    }
+    for (;  i < n;  ++i)
+    {
+        pr[i] = OP::elem(p1[i], p2[i]);
+    }
+}
+
+template<class P, class OP, bool ALIGNED, class R>
+inline void
+simd_binary_scalar_loop(R const* p1, R s2, R* pr, ptrdiff_t n) noexcept
+{
+    ptrdiff_t   i = 0;
+
+    if constexpr (P::width > 0)
+    {
+        constexpr ptrdiff_t     W = P::width;
+
+        typename P::type    a0, a1, b;
+
+        P::broadcast(b, s2);
+
+        for (;  i + 2*W <= n;  i += 2*W)
+        {
+            simd_load<P, ALIGNED>(a0, p1 + i);
+            simd_load<P, ALIGNED>(a1, p1 + i + W);
+            OP::template vec<P>(a0, a0, b);
+            OP::template vec<P>(a1, a1, b);
+            simd_store<P, ALIGNED>(pr + i,     a0);
+            simd_store<P, ALIGNED>(pr + i + W, a1);
+        }
+        for (;  i + W <= n;  i += W)
+        {
+            simd_load<P, ALIGNED>(a0, p1 + i);
+            OP::template vec<P>(a0, a0, b);
+            simd_store<P, ALIGNED>(pr + i, a0);
+        }
+    }
+    for (;  i < n;  ++i)
+    {
+        pr[i] = OP::elem(p1[i], s2);
+    }
+}
+
+#if defined(LA_SIMD_DISPATCH)
+
+template<class OP, bool ALIGNED, class R>
+LA_SIMD_TARGET("avx512f") LA_SIMD_FLATTEN void
+simd_binary_avx512(R const* p1, R const* p2, R* pr, ptrdiff_t n) noexcept
+{
+    simd_binary_loop<simd_pack<R, simd_isa::avx512>, OP, ALIGNED>(p1, p2, pr, n);
+}
+
+template<class OP, bool ALIGNED, class R>
+LA_SIMD_TARGET("avx") LA_SIMD_FLATTEN void
+simd_binary_avx(R const* p1, R const* p2, R* pr, ptrdiff_t n) noexcept
+{
+    simd_binary_loop<simd_pack<R, simd_isa::avx>, OP, ALIGNED>(p1, p2, pr, n);
+}
+
+template<class OP, bool ALIGNED, class R>
+LA_SIMD_TARGET("sse2") LA_SIMD_FLATTEN void
+simd_binary_sse2(R const* p1, R const* p2, R* pr, ptrdiff_t n) noexcept
+{
+    simd_binary_loop<simd_pack<R, simd_isa::sse2>, OP, ALIGNED>(p1, p2, pr, n);
+}
+
+template<class OP, bool ALIGNED, class R>
+LA_SIMD_TARGET("avx512f") LA_SIMD_FLATTEN void
+simd_binary_scalar_avx512(R const* p1, R s2, R* pr, ptrdiff_t n) noexcept
+{
+    simd_binary_scalar_loop<simd_pack<R, simd_isa::avx512>, OP, ALIGNED>(p1, s2, pr, n);
+}
+
+template<class OP, bool ALIGNED, class R>
+LA_SIMD_TARGET("avx") LA_SIMD_FLATTEN void
+simd_binary_scalar_avx(R const* p1, R s2, R* pr, ptrdiff_t n) noexcept
+{
+    simd_binary_scalar_loop<simd_pack<R, simd_isa::avx>, OP, ALIGNED>(p1, s2, pr, n);
+}
+
+template<class OP, bool ALIGNED, class R>
+LA_SIMD_TARGET("sse2") LA_SIMD_FLATTEN void
+simd_binary_scalar_sse2(R const* p1, R s2, R* pr, ptrdiff_t n) noexcept
+{
+    simd_binary_scalar_loop<simd_pack<R, simd_isa::sse2>, OP, ALIGNED>(p1, s2, pr, n);
+}
+
+#endif
+
+template<class OP, bool ALIGNED = false, class R>
+void
+simd_binary(R const* p1, R const* p2, R* pr, ptrdiff_t n) noexcept
+{
+#if defined(LA_SIMD_DISPATCH)
+    switch (simd_active_isa())
+    {
+        case simd_isa::avx512:  simd_binary_avx512<OP, ALIGNED>(p1, p2, pr, n);  return;
+        case simd_isa::avx:     simd_binary_avx<OP, ALIGNED>(p1, p2, pr, n);     return;
+        case simd_isa::sse2:    simd_binary_sse2<OP, ALIGNED>(p1, p2, pr, n);    return;
+        default:                break;
+    }
+#endif
+    simd_binary_loop<simd_pack<R, simd_isa::none>, OP, false>(p1, p2, pr, n);
+}
+
+template<class OP, bool ALIGNED = false, class R>
+void
+simd_binary_scalar(R const* p1, R s2, R* pr, ptrdiff_t n) noexcept
+{
+#if defined(LA_SIMD_DISPATCH)
+    switch (simd_active_isa())
+    {
+        case simd_isa::avx512:  simd_binary_scalar_avx512<OP, ALIGNED>(p1, s2, pr, n);  return;
+        case simd_isa::avx:     simd_binary_scalar_avx<OP, ALIGNED>(p1, s2, pr, n);     return;
+        case simd_isa::sse2:    simd_binary_scalar_sse2<OP, ALIGNED>(p1, s2, pr, n);    return;
+        default:                break;
+    }
+#endif
+    simd_binary_scalar_loop<simd_pack<R, simd_isa::none>, OP, false>(p1, s2, pr, n);
+}
+
+//==================================================================================================
+//  These helpers connect the kernels to the engine layer.  The variable templates report whether
+//  the kernels may be used for an operation on engines ET1 and ET2 (or engine ET1 and scalar type
+//  T2) into an engine ETR; the functions run the kernels on the spans of those engines, and
+//  return false, without doing anything, if the spans are neither all row-contiguous nor all
+//  column-contiguous.  Column-contiguous spans (of column-major engines) are processed as
+//  their transposes.
+//==================================================================================================
+//
+template<class T> inline constexpr
+bool    is_simd_element_v = is_same_v<T, float>            ||  is_same_v<T, double>  ||
+                            is_same_v<T, complex<float>>   ||  is_same_v<T, complex<double>>;
+
+template<class T>
+struct simd_real
+{
+    using type = T;
+};
+
+template<class T>
+struct simd_real<complex<T>>
+{
+    using type = T;
+};
+
+template<class T>
+using simd_real_t = typename simd_real<T>::type;
+
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_simd_elementwise_v = has_direct_span_v<ET1>  &&  has_direct_span_v<ET2>  &&
+                                 has_direct_span_v<ETR>  &&
+                                 is_simd_element_v<typename ETR::element_type>  &&
+                                 is_same_v<typename ET1::element_type, typename ETR::element_type>  &&
+                                 is_same_v<typename ET2::element_type, typename ETR::element_type>;
+
+//- A scalar divisor is usable if it is a real arithmetic type, and dividing a complex element by
+//  it divides the real and imaginary parts by the same value (which requires an exact match of
+//  the complex element's value type).
+//
+template<class ET1, class T2, class ETR> inline constexpr
+bool    use_simd_scalar_v = has_direct_span_v<ET1>  &&  has_direct_span_v<ETR>  &&
+                            is_simd_element_v<typename ETR::element_type>  &&
+                            is_same_v<typename ET1::element_type, typename ETR::element_type>  &&
+                            is_arithmetic_v<T2>  &&
+                            (!is_complex_v<typename ETR::element_type>  ||
+                             is_same_v<T2, simd_real_t<typename ETR::element_type>>);
+
+template<class ST> inline constexpr
+bool
+is_row_contiguous(ST const& s) noexcept
+{
+    if constexpr (ST::rank() == 1)
+        return s.stride(0) == 1;
+    else
+        return s.stride(1) == 1;
+}
+
+template<class ST> inline constexpr
+bool
+is_column_contiguous(ST const& s) noexcept
+{
+    return s.stride(0) == 1;
+}
+
+template<class ST> inline constexpr
+bool
+has_packed_rows(ST const& s) noexcept
+{
+    if constexpr (ST::rank() == 1)
+        return true;
+    else
+        return s.stride(0) == s.extent(1)  ||  s.extent(0) <= 1;
+}
+
+//- Report whether the data of a span of real type R, or each of its rows, begins on a boundary
+//  that is a multiple of the register size of the active instruction set; this is the case for
+//  engines using aligned_allocator.
+//
+template<class R, class ST> inline
+bool
+has_aligned_data(ST const& s) noexcept
+{
+    size_t const    bytes = simd_register_size(simd_active_isa());
+
+    return bytes != 0  &&  reinterpret_cast<uintptr_t>(s.data()) % bytes == 0;
+}
+
+template<class R, class ST> inline
+bool
+has_aligned_rows(ST const& s) noexcept
+{
+    if constexpr (ST::rank() == 1)
+        return has_aligned_data<R>(s);
+    else
+        return has_aligned_data<R>(s)  &&
+               (static_cast<size_t>(s.stride(0)) * sizeof(typename ST::value_type)) %
+                   simd_register_size(simd_active_isa()) == 0;
+}
+
+//- Runs kernel FN on flat arrays, using aligned loads and stores if ALIGNED is true.
+//
+template<class FN> inline
+void
+simd_dispatch(bool aligned, FN const& fn) noexcept
+{
+    if (aligned)
+        fn(true_type{});
+    else
+        fn(false_type{});
+}
+
+template<class OP, class S1, class S2, class SR>
+bool
+simd_elementwise(S1 const& s1, S2 const& s2, SR const& sr) noexcept
+{
+    using real_type = simd_real_t<typename SR::value_type>;
+    constexpr ptrdiff_t     K = is_complex_v<typename SR::value_type> ? 2 : 1;
+
+    if (!is_row_contiguous(s1)  ||  !is_row_contiguous(s2)  ||  !is_row_contiguous(sr))
+    {
+        if constexpr (SR::rank() == 2)
+        {
+            if (is_column_contiguous(s1)  &&  is_column_contiguous(s2)  &&  is_column_contiguous(sr))
+            {
+                return simd_elementwise<OP>(noe_mdspan_transpose(s1), noe_mdspan_transpose(s2),
+                                            noe_mdspan_transpose(sr));
+            }
+        }
+        return false;
+    }
+
+    real_type const*    p1 = reinterpret_cast<real_type const*>(s1.data());
+    real_type const*    p2 = reinterpret_cast<real_type const*>(s2.data());
+    real_type*          pr = reinterpret_cast<real_type*>(sr.data());
+
+    if constexpr (SR::rank() == 1)
+    {
+        ptrdiff_t const     n = K * static_cast<ptrdiff_t>(sr.extent(0));
+        bool const          a = has_aligned_data<real_type>(s1)  &&
+                                has_aligned_data<real_type>(s2)  &&
+                                has_aligned_data<real_type>(sr);
+
+        simd_dispatch(a, [&](auto al)
+        {
+            simd_binary<OP, decltype(al)::value>(p1, p2, pr, n);
+        });
+    }
+    else
+    {
+        ptrdiff_t const     rows = static_cast<ptrdiff_t>(sr.extent(0));
+        ptrdiff_t const     cols = static_cast<ptrdiff_t>(sr.extent(1));
+
+        if (has_packed_rows(s1)  &&  has_packed_rows(s2)  &&  has_packed_rows(sr))
+        {
+            bool const  a = has_aligned_data<real_type>(s1)  &&
+                            has_aligned_data<real_type>(s2)  &&
+                            has_aligned_data<real_type>(sr);
+
+            simd_dispatch(a, [&](auto al)
+            {
+                simd_binary<OP, decltype(al)::value>(p1, p2, pr, K * rows * cols);
+            });
+        }
+        else
+        {
+            ptrdiff_t const     rs1 = K * static_cast<ptrdiff_t>(s1.stride(0));
+            ptrdiff_t const     rs2 = K * static_cast<ptrdiff_t>(s2.stride(0));
+            ptrdiff_t const     rsr = K * static_cast<ptrdiff_t>(sr.stride(0));
+            bool const          a   = has_aligned_rows<real_type>(s1)  &&
+                                      has_aligned_rows<real_type>(s2)  &&
+                                      has_aligned_rows<real_type>(sr);
+
+            simd_dispatch(a, [&](auto al)
+            {
+                for (ptrdiff_t i = 0;  i < rows;  ++i)
+                {
+                    simd_binary<OP, decltype(al)::value>(p1 + i*rs1, p2 + i*rs2, pr + i*rsr, K * cols);
+                }
+            });
+        }
+    }
+    return true;
+}
+
+template<class OP, class S1, class T2, class SR>
+bool
+simd_elementwise_scalar(S1 const& s1, T2 const& t2, SR const& sr) noexcept
+{
+    using real_type = simd_real_t<typename SR::value_type>;
+    constexpr ptrdiff_t     K = is_complex_v<typename SR::value_type> ? 2 : 1;
+
+    if (!is_row_contiguous(s1)  ||  !is_row_contiguous(sr))
+    {
+        if constexpr (SR::rank() == 2)
+        {
+            if (is_column_contiguous(s1)  &&  is_column_contiguous(sr))
+            {
+                return simd_elementwise_scalar<OP>(noe_mdspan_transpose(s1), t2,
+                                                   noe_mdspan_transpose(sr));
+            }
+        }
+        return false;
+    }
+
+    real_type const*    p1 = reinterpret_cast<real_type const*>(s1.data());
+    real_type           v2 = static_cast<real_type>(t2);
+    real_type*          pr = reinterpret_cast<real_type*>(sr.data());
+
+    if constexpr (SR::rank() == 1)
+    {
+        ptrdiff_t const     n = K * static_cast<ptrdiff_t>(sr.extent(0));
+        bool const          a = has_aligned_data<real_type>(s1)  &&
+                                has_aligned_data<real_type>(sr);
+
+        simd_dispatch(a, [&](auto al)
+        {
+            simd_binary_scalar<OP, decltype(al)::value>(p1, v2, pr, n);
+        });
+    }
+    else
+    {
+        ptrdiff_t const     rows = static_cast<ptrdiff_t>(sr.extent(0));
+        ptrdiff_t const     cols = static_cast<ptrdiff_t>(sr.extent(1));
+
+        if (has_packed_rows(s1)  &&  has_packed_rows(sr))
+        {
+            bool const  a = has_aligned_data<real_type>(s1)  &&  has_aligned_data<real_type>(sr);
+
+            simd_dispatch(a, [&](auto al)
+            {
+                simd_binary_scalar<OP, decltype(al)::value>(p1, v2, pr, K * rows * cols);
+            });
+        }
+        else
+        {
+            ptrdiff_t const     rs1 = K * static_cast<ptrdiff_t>(s1.stride(0));
+            ptrdiff_t const     rsr = K * static_cast<ptrdiff_t>(sr.stride(0));
+            bool const          a   = has_aligned_rows<real_type>(s1)  &&
+                                      has_aligned_rows<real_type>(sr);
+
+            simd_dispatch(a, [&](auto al)
+            {
+                for (ptrdiff_t i = 0;  i < rows;  ++i)
+                {
+                    simd_binary_scalar<OP, decltype(al)::value>(p1 + i*rs1, v2, pr + i*rsr, K * cols);
+                }
+            });
+        }
+    }
+    return true;
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_ELEMENTWISE_KERNELS_HPP_DEFINED
@@ -0,0 +1,540 @@
+//==================================================================================================
+//  File:       expression_traits.hpp
+//
+//  Summary:    This header defines the private expression types and the public arithmetic traits
+//              used by matrix_expression_operation_traits to defer element-wise operations.
+//              Instead of computing a result, the arithmetic traits defined here return a vector
+//              or matrix whose engine is an expression view (see vector_expression_engine and
+//              matrix_expression_engine).  The pending operation is performed element by element
+//              when the expression is assigned to an owning engine, so that a compound expression
+//              such as (A + B - 2.0*C) is evaluated in a single loop with no temporaries.
+//
+//              Note that an expression refers to (rather than copies) its owning-engine operands,
+//              and so must not outlive them; an expression is meant to be assigned to an owning
+//              vector or matrix in the same full-expression that creates it.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_EXPRESSION_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_EXPRESSION_TRAITS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//                               **** EXPRESSION OPERANDS ****
+//==================================================================================================
+//  A scalar operand of an expression, expressed as a pseudo-engine whose every element is the
+//  scalar's value.
+//==================================================================================================
+//
+template<class T>
+struct scalar_operand
+{
+    T   value{};
+
+    template<class... IDX>
+    constexpr T const&  operator ()(IDX...) const noexcept { return value; }
+};
+
+template<class T>
+struct is_scalar_operand : public false_type
+{};
+
+template<class T>
+struct is_scalar_operand<scalar_operand<T>> : public true_type
+{};
+
+template<class T> inline constexpr
+bool    is_scalar_operand_v = is_scalar_operand<T>::value;
+
+//- These traits are used to decide how an expression holds each of its operands.  Owning
+//  engines are held by pointer; views (including nested expressions) and scalars are small,
+//  and are held by value, so that an expression built from temporary views remains valid.
+//
+template<class ET>
+struct is_view_engine : public false_type
+{};
+
+template<class ET, class VCT, class VFT>
+struct is_view_engine<vector_view_engine<ET, VCT, VFT>> : public true_type
+{};
+
+template<class ET, class MCT, class VFT>
+struct is_view_engine<matrix_view_engine<ET, MCT, VFT>> : public true_type
+{};
+
+template<class ET> inline constexpr
+bool    is_held_by_value_v = is_view_engine<ET>::value || is_scalar_operand_v<ET>;
+
+template<class ET>
+using expression_operand_t = conditional_t<is_held_by_value_v<ET>, ET, ET const*>;
+
+template<class ET> inline constexpr
+expression_operand_t<ET>
+hold_operand(ET const& opnd) noexcept
+{
+    if constexpr (is_held_by_value_v<ET>)
+        return opnd;
+    else
+        return &opnd;
+}
+
+template<class ET> inline constexpr
+ET const&
+operand_ref(expression_operand_t<ET> const& opnd) noexcept
+{
+    if constexpr (is_held_by_value_v<ET>)
+        return opnd;
+    else
+        return *opnd;
+}
+
+//- This traits type provides the index_tuple alias of a matrix engine (vector engines have none).
+//
+template<class ET, bool = is_matrix_engine_v<ET>>
+struct expression_index_tuple
+{
+    using type = void;
+};
+
+template<class ET>
+struct expression_index_tuple<ET, true>
+{
+    using type = typename ET::index_tuple;
+};
+
+//==================================================================================================
+//                               **** EXPRESSION OPERATIONS ****
+//==================================================================================================
+//
+struct expression_add
+{
+    template<class T1, class T2>
+    constexpr auto  operator ()(T1 const& t1, T2 const& t2) const { return t1 + t2; }
+};
+
+struct expression_subtract
+{
+    template<class T1, class T2>
+    constexpr auto  operator ()(T1 const& t1, T2 const& t2) const { return t1 - t2; }
+};
+
+struct expression_multiply
+{
+    template<class T1, class T2>
+    constexpr auto  operator ()(T1 const& t1, T2 const& t2) const { return t1 * t2; }
+};
+
+struct expression_divide
+{
+    template<class T1, class T2>
+    constexpr auto  operator ()(T1 const& t1, T2 const& t2) const { return t1 / t2; }
+};
+
+//==================================================================================================
+//                                **** EXPRESSION TYPE ****
+//==================================================================================================
+//  An element-wise binary operation OP, producing elements of type T, on two operands that are
+//  either engines of the same shape, or an engine and a scalar_operand.  The shape of the
+//  expression is that of its engine operand(s).
+//==================================================================================================
+//
+template<class OP, class T, class ET1, class ET2>
+class elementwise_expression
+{
+    static_assert(!(is_scalar_operand_v<ET1> && is_scalar_operand_v<ET2>));
+
+    using shape_engine = conditional_t<is_scalar_operand_v<ET1>, ET2, ET1>;
+
+  public:
+    //- Types
+    //
+    using element_type    = T;
+    using difference_type = typename shape_engine::difference_type;
+    using index_type      = typename shape_engine::index_type;
+    using index_tuple     = typename expression_index_tuple<shape_engine>::type;
+
+    //- Construct/copy/destroy
+    //
+    constexpr elementwise_expression() = default;
+    constexpr elementwise_expression(ET1 const& e1, ET2 const& e2);
+
+    //- Capacity
+    //
+    constexpr index_type    columns() const noexcept;
+    constexpr index_type    rows() const noexcept;
+    constexpr auto          size() const noexcept;
+
+    //- Element access
+    //
+    constexpr element_type  operator ()(index_type i) const;
+    constexpr element_type  operator ()(index_type i, index_type j) const;
+
+  private:
+    expression_operand_t<ET1>   m_opnd1{};
+    expression_operand_t<ET2>   m_opnd2{};
+
+    constexpr shape_engine const&   shape() const noexcept;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class OP, class T, class ET1, class ET2> constexpr
+elementwise_expression<OP, T, ET1, ET2>::elementwise_expression(ET1 const& e1, ET2 const& e2)
+:   m_opnd1(hold_operand(e1))
+,   m_opnd2(hold_operand(e2))
+{}
+
+//----------
+//- Capacity
+//
+template<class OP, class T, class ET1, class ET2> constexpr
+typename elementwise_expression<OP, T, ET1, ET2>::index_type
+elementwise_expression<OP, T, ET1, ET2>::columns() const noexcept
+{
+    return shape().columns();
+}
+
+template<class OP, class T, class ET1, class ET2> constexpr
+typename elementwise_expression<OP, T, ET1, ET2>::index_type
+elementwise_expression<OP, T, ET1, ET2>::rows() const noexcept
+{
+    return shape().rows();
+}
+
+template<class OP, class T, class ET1, class ET2> constexpr
+auto
+elementwise_expression<OP, T, ET1, ET2>::size() const noexcept
+{
+    return shape().size();
+}
+
+//----------------
+//- Element access
+//
+template<class OP, class T, class ET1, class ET2> constexpr
+typename elementwise_expression<OP, T, ET1, ET2>::element_type
+elementwise_expression<OP, T, ET1, ET2>::operator ()(index_type i) const
+{
+    return static_cast<element_type>(OP()(operand_ref<ET1>(m_opnd1)(i), operand_ref<ET2>(m_opnd2)(i)));
+}
+
+template<class OP, class T, class ET1, class ET2> constexpr
+typename elementwise_expression<OP, T, ET1, ET2>::element_type
+elementwise_expression<OP, T, ET1, ET2>::operator ()(index_type i, index_type j) const
+{
+    return static_cast<element_type>(OP()(operand_ref<ET1>(m_opnd1)(i, j),
+                                          operand_ref<ET2>(m_opnd2)(i, j)));
+}
+
+//------------------------
+//- Private implementation
+//
+template<class OP, class T, class ET1, class ET2> constexpr
+typename elementwise_expression<OP, T, ET1, ET2>::shape_engine const&
+elementwise_expression<OP, T, ET1, ET2>::shape() const noexcept
+{
+    if constexpr (is_scalar_operand_v<ET1>)
+        return operand_ref<ET2>(m_opnd2);
+    else
+        return operand_ref<ET1>(m_opnd1);
+}
+
+//- This helper function builds the vector or matrix object of type RT whose engine is an
+//  expression view of EXPR.
+//
+template<class RT, class EXPR> inline constexpr
+RT
+make_expression(EXPR const& expr)
+{
+    RT  r;
+
+    r.engine() = typename RT::engine_type(expr);
+    return r;
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//                           **** EXPRESSION ADDITION TRAITS ****
+//==================================================================================================
+//
+//- (vector + vector)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_addition_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    using element_type    = select_matrix_addition_element_t<OT, typename ET1::element_type,
+                                                                 typename ET2::element_type>;
+    using expression_type = detail::elementwise_expression<detail::expression_add, element_type, ET1, ET2>;
+    using engine_type     = vector_expression_engine<expression_type>;
+    using result_type     = vector<engine_type, OT>;
+
+    static constexpr result_type    add(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_expression_addition_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::add
+(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(v1.engine(), v2.engine()));
+}
+
+//-------------------
+//- (matrix + matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_addition_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using element_type    = select_matrix_addition_element_t<OT, typename ET1::element_type,
+                                                                 typename ET2::element_type>;
+    using expression_type = detail::elementwise_expression<detail::expression_add, element_type, ET1, ET2>;
+    using engine_type     = matrix_expression_engine<expression_type>;
+    using result_type     = matrix<engine_type, OT>;
+
+    static constexpr result_type    add(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_expression_addition_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::add
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(m1.engine(), m2.engine()));
+}
+
+
+//==================================================================================================
+//                          **** EXPRESSION SUBTRACTION TRAITS ****
+//==================================================================================================
+//
+//- (vector - vector)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_subtraction_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    using element_type    = select_matrix_subtraction_element_t<OT, typename ET1::element_type,
+                                                                    typename ET2::element_type>;
+    using expression_type = detail::elementwise_expression<detail::expression_subtract, element_type, ET1, ET2>;
+    using engine_type     = vector_expression_engine<expression_type>;
+    using result_type     = vector<engine_type, OT>;
+
+    static constexpr result_type    subtract(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_expression_subtraction_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::subtract
+(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(v1.engine(), v2.engine()));
+}
+
+//-------------------
+//- (matrix - matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_subtraction_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using element_type    = select_matrix_subtraction_element_t<OT, typename ET1::element_type,
+                                                                    typename ET2::element_type>;
+    using expression_type = detail::elementwise_expression<detail::expression_subtract, element_type, ET1, ET2>;
+    using engine_type     = matrix_expression_engine<expression_type>;
+    using result_type     = matrix<engine_type, OT>;
+
+    static constexpr result_type    subtract(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_expression_subtraction_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::subtract
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(m1.engine(), m2.engine()));
+}
+
+
+//==================================================================================================
+//                         **** EXPRESSION MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Only scaling by a scalar is deferred; products of vectors and matrices are computed by the
+//  standard multiplication traits.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct matrix_expression_multiplication_traits
+:   public matrix_multiplication_arithmetic_traits<OT, OP1, OP2>
+{};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+:   public matrix_multiplication_arithmetic_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
+:   public matrix_multiplication_arithmetic_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_multiplication_arithmetic_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
+{};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_expression_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_multiplication_arithmetic_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{};
+
+//-------------------
+//- (vector * scalar)
+//
+template<class OT, class ET1, class OT1, class T2>
+struct matrix_expression_multiplication_traits<OT, vector<ET1, OT1>, T2>
+{
+    using element_type    = select_matrix_multiplication_element_t<OT, typename ET1::element_type, T2>;
+    using scalar_type     = detail::scalar_operand<T2>;
+    using expression_type = detail::elementwise_expression<detail::expression_multiply, element_type,
+                                                           ET1, scalar_type>;
+    using engine_type     = vector_expression_engine<expression_type>;
+    using result_type     = vector<engine_type, OT>;
+
+    static constexpr result_type    multiply(vector<ET1, OT1> const& v1, T2 const& s2);
+};
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+auto
+matrix_expression_multiplication_traits<OT, vector<ET1, OT1>, T2>::multiply
+(vector<ET1, OT1> const& v1, T2 const& s2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(v1.engine(), scalar_type{s2}));
+}
+
+//-------------------
+//- (scalar * vector)
+//
+template<class OT, class T1, class ET2, class OT2>
+struct matrix_expression_multiplication_traits<OT, T1, vector<ET2, OT2>>
+{
+    using element_type    = select_matrix_multiplication_element_t<OT, T1, typename ET2::element_type>;
+    using scalar_type     = detail::scalar_operand<T1>;
+    using expression_type = detail::elementwise_expression<detail::expression_multiply, element_type,
+                                                           scalar_type, ET2>;
+    using engine_type     = vector_expression_engine<expression_type>;
+    using result_type     = vector<engine_type, OT>;
+
+    static constexpr result_type    multiply(T1 const& s1, vector<ET2, OT2> const& v2);
+};
+
+template<class OT, class T1, class ET2, class OT2> inline constexpr
+auto
+matrix_expression_multiplication_traits<OT, T1, vector<ET2, OT2>>::multiply
+(T1 const& s1, vector<ET2, OT2> const& v2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(scalar_type{s1}, v2.engine()));
+}
+
+//-------------------
+//- (matrix * scalar)
+//
+template<class OT, class ET1, class OT1, class T2>
+struct matrix_expression_multiplication_traits<OT, matrix<ET1, OT1>, T2>
+{
+    using element_type    = select_matrix_multiplication_element_t<OT, typename ET1::element_type, T2>;
+    using scalar_type     = detail::scalar_operand<T2>;
+    using expression_type = detail::elementwise_expression<detail::expression_multiply, element_type,
+                                                           ET1, scalar_type>;
+    using engine_type     = matrix_expression_engine<expression_type>;
+    using result_type     = matrix<engine_type, OT>;
+
+    static constexpr result_type    multiply(matrix<ET1, OT1> const& m1, T2 const& s2);
+};
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+auto
+matrix_expression_multiplication_traits<OT, matrix<ET1, OT1>, T2>::multiply
+(matrix<ET1, OT1> const& m1, T2 const& s2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(m1.engine(), scalar_type{s2}));
+}
+
+//-------------------
+//- (scalar * matrix)
+//
+template<class OT, class T1, class ET2, class OT2>
+struct matrix_expression_multiplication_traits<OT, T1, matrix<ET2, OT2>>
+{
+    using element_type    = select_matrix_multiplication_element_t<OT, T1, typename ET2::element_type>;
+    using scalar_type     = detail::scalar_operand<T1>;
+    using expression_type = detail::elementwise_expression<detail::expression_multiply, element_type,
+                                                           scalar_type, ET2>;
+    using engine_type     = matrix_expression_engine<expression_type>;
+    using result_type     = matrix<engine_type, OT>;
+
+    static constexpr result_type    multiply(T1 const& s1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class T1, class ET2, class OT2> inline constexpr
+auto
+matrix_expression_multiplication_traits<OT, T1, matrix<ET2, OT2>>::multiply
+(T1 const& s1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(scalar_type{s1}, m2.engine()));
+}
+
+
+//==================================================================================================
+//                            **** EXPRESSION DIVISION TRAITS ****
+//==================================================================================================
+//
+//- (vector / scalar)
+//
+template<class OT, class ET1, class OT1, class T2>
+struct matrix_expression_division_traits<OT, vector<ET1, OT1>, T2>
+{
+    using element_type    = select_matrix_division_element_t<OT, typename ET1::element_type, T2>;
+    using scalar_type     = detail::scalar_operand<T2>;
+    using expression_type = detail::elementwise_expression<detail::expression_divide, element_type,
+                                                           ET1, scalar_type>;
+    using engine_type     = vector_expression_engine<expression_type>;
+    using result_type     = vector<engine_type, OT>;
+
+    static constexpr result_type    divide(vector<ET1, OT1> const& v1, T2 const& s2);
+};
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+auto
+matrix_expression_division_traits<OT, vector<ET1, OT1>, T2>::divide
+(vector<ET1, OT1> const& v1, T2 const& s2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(v1.engine(), scalar_type{s2}));
+}
+
+//-------------------
+//- (matrix / scalar)
+//
+template<class OT, class ET1, class OT1, class T2>
+struct matrix_expression_division_traits<OT, matrix<ET1, OT1>, T2>
+{
+    using element_type    = select_matrix_division_element_t<OT, typename ET1::element_type, T2>;
+    using scalar_type     = detail::scalar_operand<T2>;
+    using expression_type = detail::elementwise_expression<detail::expression_divide, element_type,
+                                                           ET1, scalar_type>;
+    using engine_type     = matrix_expression_engine<expression_type>;
+    using result_type     = matrix<engine_type, OT>;
+
+    static constexpr result_type    divide(matrix<ET1, OT1> const& m1, T2 const& s2);
+};
+
+template<class OT, class ET1, class OT1, class T2> inline constexpr
+auto
+matrix_expression_division_traits<OT, matrix<ET1, OT1>, T2>::divide
+(matrix<ET1, OT1> const& m1, T2 const& s2) -> result_type
+{
+    return detail::make_expression<result_type>(expression_type(m1.engine(), scalar_type{s2}));
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_EXPRESSION_TRAITS_HPP_DEFINED
@@ -3,6 +3,9 @@
 //
 //  Summary:    This header defines a fixed-size matrix engine.  In this context, fixed-size
 //              means that the row and column extents of such objects are known at compile-time.
+//
+//              The engine's elements are stored in the order given by its layout policy, LT,
+//              which is either row_major (the default) or column_major.
 //==================================================================================================
 //
 #ifndef LINEAR_ALGEBRA_FIXED_SIZE_MATRIX_ENGINE_HPP_DEFINED
@@ -13,11 +16,12 @@ namespace STD_LA {
 //  Fixed-size, fixed-capacity matrix engine.
 //==================================================================================================
 //
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 class fs_matrix_engine
 {
     static_assert(R >= 1);
     static_assert(C >= 1);
+    static_assert(detail::is_matrix_layout_v<LT>);
 
   public:
     //- Types
@@ -25,6 +29,7 @@ class fs_matrix_engine
     using engine_category = initable_matrix_engine_tag;
     using element_type    = T;
     using value_type      = remove_cv_t<T>;
+    using layout_type     = LT;
     using pointer         = element_type*;
     using const_pointer   = element_type const*;
     using reference       = element_type&;
@@ -32,8 +37,8 @@ class fs_matrix_engine
     using difference_type = ptrdiff_t;
     using index_type      = ptrdiff_t;
     using index_tuple     = extents<R, C>;
-    using span_type       = mdspan<element_type, R, C>;
-    using const_span_type = mdspan<element_type const, R, C>;
+    using span_type       = basic_mdspan<element_type, extents<R, C>, LT>;
+    using const_span_type = basic_mdspan<element_type const, extents<R, C>, LT>;
 
     //- Construct/copy/destroy
     //
@@ -43,7 +48,7 @@ class fs_matrix_engine
     constexpr fs_matrix_engine(fs_matrix_engine&&) noexcept = default;
     constexpr fs_matrix_engine(fs_matrix_engine const&) = default;
     template<class T2, ptrdiff_t R2, ptrdiff_t C2>
-    constexpr fs_matrix_engine(fs_matrix_engine<T2, R2, C2> const& rhs);
+    constexpr fs_matrix_engine(fs_matrix_engine<T2, R2, C2, LT> const& rhs);
     template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T> = true>
     constexpr fs_matrix_engine(ET2 const& rhs);
     template<class T2, detail::enable_if_convertible_element<T2,T> = true>
@@ -52,7 +57,7 @@ class fs_matrix_engine
     constexpr fs_matrix_engine&     operator =(fs_matrix_engine&&) noexcept = default;
     constexpr fs_matrix_engine&     operator =(fs_matrix_engine const&) = default;
     template<class T2, ptrdiff_t R2, ptrdiff_t C2>
-    constexpr fs_matrix_engine&     operator =(fs_matrix_engine<T2, R2, C2> const& rhs);
+    constexpr fs_matrix_engine&     operator =(fs_matrix_engine<T2, R2, C2, LT> const& rhs);
     template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T> = true>
     constexpr fs_matrix_engine&     operator =(ET2 const& rhs);
     template<class T2, detail::enable_if_convertible_element<T2,T> = true>
@@ -85,12 +90,16 @@ class fs_matrix_engine
     constexpr void      swap_rows(index_type i1, index_type i2) noexcept;
 
   private:
-    template<class T2, ptrdiff_t R2, ptrdiff_t C2> friend class fs_matrix_engine;
+    template<class T2, ptrdiff_t R2, ptrdiff_t C2, class LT2> friend class fs_matrix_engine;
+
+    static constexpr bool   is_column_major = is_same_v<LT, column_major>;
 
     array<T, R*C>   ma_elems;
 
+    static constexpr index_type     offset(index_type i, index_type j) noexcept;
+
     template<class T2, ptrdiff_t R2, ptrdiff_t C2>
-    constexpr void  assign(fs_matrix_engine<T2, R2, C2> const& rhs);
+    constexpr void  assign(fs_matrix_engine<T2, R2, C2, LT> const& rhs);
     template<class ET2>
     constexpr void  assign(ET2 const& rhs);
     template<class T2>
@@ -100,57 +109,57 @@ class fs_matrix_engine
 //------------------------
 //- Construct/copy/destroy
 //
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-fs_matrix_engine<T,R,C>::fs_matrix_engine()
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+fs_matrix_engine<T,R,C,LT>::fs_matrix_engine()
 :   ma_elems()
 {}
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class T2, ptrdiff_t R2, ptrdiff_t C2> constexpr
-fs_matrix_engine<T,R,C>::fs_matrix_engine(fs_matrix_engine<T2,R2,C2> const& rhs)
+fs_matrix_engine<T,R,C,LT>::fs_matrix_engine(fs_matrix_engine<T2,R2,C2,LT> const& rhs)
 :   ma_elems()
 {
     assign(rhs);
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T>> constexpr
-fs_matrix_engine<T,R,C>::fs_matrix_engine(ET2 const& rhs)
+fs_matrix_engine<T,R,C,LT>::fs_matrix_engine(ET2 const& rhs)
 :   ma_elems()
 {
     assign(rhs);
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class T2, detail::enable_if_convertible_element<T2,T>> constexpr
-fs_matrix_engine<T,R,C>::fs_matrix_engine(initializer_list<initializer_list<T2>> rhs)
+fs_matrix_engine<T,R,C,LT>::fs_matrix_engine(initializer_list<initializer_list<T2>> rhs)
 :   ma_elems()
 {
     assign(rhs);
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class T2, ptrdiff_t R2, ptrdiff_t C2> constexpr
-fs_matrix_engine<T,R,C>&
-fs_matrix_engine<T,R,C>::operator =(fs_matrix_engine<T2,R2,C2> const& rhs)
+fs_matrix_engine<T,R,C,LT>&
+fs_matrix_engine<T,R,C,LT>::operator =(fs_matrix_engine<T2,R2,C2,LT> const& rhs)
 {
     assign(rhs);
     return *this;
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T>> constexpr
-fs_matrix_engine<T,R,C>&
-fs_matrix_engine<T,R,C>::operator =(ET2 const& rhs)
+fs_matrix_engine<T,R,C,LT>&
+fs_matrix_engine<T,R,C,LT>::operator =(ET2 const& rhs)
 {
     assign(rhs);
     return *this;
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class T2, detail::enable_if_convertible_element<T2,T>> constexpr
-fs_matrix_engine<T,R,C>&
-fs_matrix_engine<T,R,C>::operator =(initializer_list<initializer_list<T2>> rhs)
+fs_matrix_engine<T,R,C,LT>&
+fs_matrix_engine<T,R,C,LT>::operator =(initializer_list<initializer_list<T2>> rhs)
 {
     assign(rhs);
     return *this;
@@ -159,44 +168,44 @@ fs_matrix_engine<T,R,C>::operator =(initializer_list<initializer_list<T2>> rhs)
 //----------
 //- Capacity
 //
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::index_type
-fs_matrix_engine<T,R,C>::columns() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_type
+fs_matrix_engine<T,R,C,LT>::columns() const noexcept
 {
     return C;
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::index_type
-fs_matrix_engine<T,R,C>::rows() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_type
+fs_matrix_engine<T,R,C,LT>::rows() const noexcept
 {
     return R;
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::index_tuple
-fs_matrix_engine<T,R,C>::size() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_tuple
+fs_matrix_engine<T,R,C,LT>::size() const noexcept
 {
     return index_tuple{};
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::index_type
-fs_matrix_engine<T,R,C>::column_capacity() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_type
+fs_matrix_engine<T,R,C,LT>::column_capacity() const noexcept
 {
     return C;
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::index_type
-fs_matrix_engine<T,R,C>::row_capacity() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_type
+fs_matrix_engine<T,R,C,LT>::row_capacity() const noexcept
 {
     return R;
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::index_tuple
-fs_matrix_engine<T,R,C>::capacity() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_tuple
+fs_matrix_engine<T,R,C,LT>::capacity() const noexcept
 {
     return index_tuple{};
 }
@@ -204,33 +213,33 @@ fs_matrix_engine<T,R,C>::capacity() const noexcept
 //----------------
 //- Element access
 //
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::reference
-fs_matrix_engine<T,R,C>::operator ()(index_type i, index_type j)
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::reference
+fs_matrix_engine<T,R,C,LT>::operator ()(index_type i, index_type j)
 {
-    return ma_elems[i*C + j];
+    return ma_elems[offset(i, j)];
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::const_reference
-fs_matrix_engine<T,R,C>::operator ()(index_type i, index_type j) const
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::const_reference
+fs_matrix_engine<T,R,C,LT>::operator ()(index_type i, index_type j) const
 {
-    return ma_elems[i*C + j];
+    return ma_elems[offset(i, j)];
 }
 
 //-------------
 //- Data access
 //
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::span_type
-fs_matrix_engine<T,R,C>::span() noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::span_type
+fs_matrix_engine<T,R,C,LT>::span() noexcept
 {
     return span_type(ma_elems.data());
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
-typename fs_matrix_engine<T,R,C>::const_span_type
-fs_matrix_engine<T,R,C>::span() const noexcept
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::const_span_type
+fs_matrix_engine<T,R,C,LT>::span() const noexcept
 {
     return const_span_type(ma_elems.data());
 }
@@ -238,9 +247,9 @@ fs_matrix_engine<T,R,C>::span() const noexcept
 //-----------
 //- Modifiers
 //
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
 void
-fs_matrix_engine<T,R,C>::swap(fs_matrix_engine& rhs) noexcept
+fs_matrix_engine<T,R,C,LT>::swap(fs_matrix_engine& rhs) noexcept
 {
     if (&rhs != this)
     {
@@ -251,28 +260,28 @@ fs_matrix_engine<T,R,C>::swap(fs_matrix_engine& rhs) noexcept
     }
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
 void
-fs_matrix_engine<T,R,C>::swap_columns(index_type j1, index_type j2) noexcept
+fs_matrix_engine<T,R,C,LT>::swap_columns(index_type j1, index_type j2) noexcept
 {
     if (j1 != j2)
     {
         for (ptrdiff_t i = 0;  i < R;  ++i)
         {
-            detail::la_swap(ma_elems[i*C + j1], ma_elems[i*C + j2]);
+            detail::la_swap(ma_elems[offset(i, j1)], ma_elems[offset(i, j2)]);
         }
     }
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C> constexpr
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
 void
-fs_matrix_engine<T,R,C>::swap_rows(index_type i1, index_type i2) noexcept
+fs_matrix_engine<T,R,C,LT>::swap_rows(index_type i1, index_type i2) noexcept
 {
     if (i1 != i2)
     {
         for (ptrdiff_t j = 0;  j < C;  ++j)
         {
-            detail::la_swap(ma_elems[i1*C + j], ma_elems[i2*C + j]);
+            detail::la_swap(ma_elems[offset(i1, j)], ma_elems[offset(i2, j)]);
         }
     }
 }
@@ -280,10 +289,20 @@ fs_matrix_engine<T,R,C>::swap_rows(index_type i1, index_type i2) noexcept
 //------------------------
 //- Private implementation
 //
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT> constexpr
+typename fs_matrix_engine<T,R,C,LT>::index_type
+fs_matrix_engine<T,R,C,LT>::offset(index_type i, index_type j) noexcept
+{
+    if constexpr (is_column_major)
+        return i + j*R;
+    else
+        return i*C + j;
+}
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class T2, ptrdiff_t R2, ptrdiff_t C2> constexpr
 void
-fs_matrix_engine<T,R,C>::assign(fs_matrix_engine<T2,R2,C2> const& rhs)
+fs_matrix_engine<T,R,C,LT>::assign(fs_matrix_engine<T2,R2,C2,LT> const& rhs)
 {
     static_assert(R2 == R  &&  C2 == C);
 
@@ -293,20 +312,20 @@ fs_matrix_engine<T,R,C>::assign(fs_matrix_engine<T2,R2,C2> const& rhs)
     }
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class ET2> constexpr
 void
-fs_matrix_engine<T,R,C>::assign(ET2 const& rhs)
+fs_matrix_engine<T,R,C,LT>::assign(ET2 const& rhs)
 {
     static_assert(is_matrix_engine_v<ET2>);
     detail::check_source_engine_size(rhs, R, C);
     detail::assign_from_matrix_engine(*this, rhs);
 }
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
 template<class T2> constexpr
 void
-fs_matrix_engine<T,R,C>::assign(initializer_list<initializer_list<T2>> rhs)
+fs_matrix_engine<T,R,C,LT>::assign(initializer_list<initializer_list<T2>> rhs)
 {
     detail::check_source_init_list(rhs, R, C);
     detail::assign_from_matrix_initlist(*this, rhs);
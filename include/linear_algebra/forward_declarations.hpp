@@ -30,21 +30,61 @@ struct resizable_matrix_engine_tag : public integral_constant<int, 17> {};
 //
 template<class T>   struct scalar_engine;
 
+//- Layout policies for the owning matrix engines, which store their elements in row-major order
+//  (the default) or in column-major order.  These are the corresponding mdspan layouts, so
+//  either name may be used.
+//
+using row_major    = layout_right;
+using column_major = layout_left;
+
+//- Layout policy for engines that adopt external buffers having arbitrary strides.
+//
+using strided      = layout_stride<dynamic_extent, dynamic_extent>;
+
 //- Owning engines with dynamically-allocated external storage.
 //
-template<class T, class AT = allocator<T>>  class dr_vector_engine;
-template<class T, class AT = allocator<T>>  class dr_matrix_engine;
+template<class T, class AT = allocator<T>>                       class dr_vector_engine;
+template<class T, class AT = allocator<T>, class LT = row_major>  class dr_matrix_engine;
+
+//- Tag type (and object) used to request that a dynamic engine's elements be allocated without
+//  being value-initialized, because the caller is about to overwrite all of them.
+//
+struct for_overwrite_t
+{
+    explicit for_overwrite_t() = default;
+};
+
+inline constexpr for_overwrite_t    for_overwrite{};
+
+//- An allocator adaptor that default-initializes (rather than value-initializes) the elements
+//  of dynamic engines that use it.
+//
+template<class T, class A = allocator<T>>   class default_init_allocator;
+
+//- An allocator that aligns the memory of dynamic engines that use it, and which causes
+//  dr_matrix_engine to pad each row to a whole number of alignment units.
+//
+template<class T, size_t ALIGN = 64>        class aligned_allocator;
 
 //- Owning engines with fixed-size internal storage.
 //
-template<class T, ptrdiff_t N>              class fs_vector_engine;
-template<class T, ptrdiff_t R, ptrdiff_t C> class fs_matrix_engine;
+template<class T, ptrdiff_t N>                                   class fs_vector_engine;
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT = row_major>  class fs_matrix_engine;
 
 //- Non-owning, view-style engines (NOEs).
 //
 template<class ET, class VCT, class VFT>   class vector_view_engine;
 template<class ET, class MCT, class VFT>   class matrix_view_engine;
 
+//- Non-owning engine that adopts an external buffer, described by an mdspan or by a pointer,
+//  extents, and strides.
+//
+template<class T, class LT = row_major>    class mdspan_matrix_engine;
+
+//- Owning, resizable engine whose elements are stored in a memory-mapped file.
+//
+template<class T, class LT = row_major>    class mmap_matrix_engine;
+
 //- Non-owning view engine functionality tag types, used to specify the functionality of a view.
 //
 struct column_view_tag {};
@@ -53,6 +93,7 @@ struct subset_view_tag {};
 struct negation_view_tag {};
 struct transpose_view_tag {};
 struct hermitian_view_tag {};
+struct expression_view_tag {};
 
 //- These are some convenience aliases, to make it easier for user-created operation traits.
 //
@@ -81,11 +122,37 @@ using matrix_subset_engine = matrix_view_engine<ET, MCT, subset_view_tag>;
 template<class ET, class MCT>
 using matrix_transpose_engine = matrix_view_engine<ET, MCT, transpose_view_tag>;
 
+template<class EXPR>
+using vector_expression_engine = vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>;
+
+template<class EXPR>
+using matrix_expression_engine = matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>;
+
 //- The default element promotion, engine promotion, and arithmetic operation traits for
 //  the four basic arithmetic operations.
 //
 struct matrix_operation_traits;
 
+//- An alternative set of operation traits, which defers element-wise addition, subtraction,
+//  and scaling by returning expression views instead of computed results.
+//
+struct matrix_expression_operation_traits;
+
+//- An alternative set of operation traits, which computes large matrix-matrix products on a
+//  shared thread pool.
+//
+struct matrix_parallel_operation_traits;
+
+//- An alternative set of operation traits, which computes large matrix-matrix products by
+//  the Strassen-Winograd recursion.
+//
+struct matrix_strassen_operation_traits;
+
+//- An alternative set of operation traits, which hands products and updates of the BLAS element
+//  types to an external CBLAS library, when one is configured.
+//
+struct matrix_blas_operation_traits;
+
 //- Primary math object types.
 //
 template<class ET, class OT=matrix_operation_traits> class vector;
@@ -96,16 +163,26 @@ template<class ET, class OT=matrix_operation_traits> class matrix;
 template<class T, class A = allocator<T>>
 using dyn_vector = vector<dr_vector_engine<T, A>>;
 
-template<class T, class A = allocator<T>>
-using dyn_matrix = matrix<dr_matrix_engine<T, A>>;
+template<class T, class A = allocator<T>, class L = row_major>
+using dyn_matrix = matrix<dr_matrix_engine<T, A, L>>;
 
 //- Aliases for vector and matrix objects based on fixed-size engines.
 //
 template<class T, ptrdiff_t N>
 using fs_vector = vector<fs_vector_engine<T, N>>;
 
-template<class T, ptrdiff_t R, ptrdiff_t C>
-using fs_matrix = matrix<fs_matrix_engine<T, R, C>>;
+template<class T, ptrdiff_t R, ptrdiff_t C, class L = row_major>
+using fs_matrix = matrix<fs_matrix_engine<T, R, C, L>>;
+
+//- Alias for matrix objects that operate directly on an external buffer.
+//
+template<class T, class L = row_major>
+using mdspan_matrix = matrix<mdspan_matrix_engine<T, L>>;
+
+//- Alias for matrix objects whose elements are stored in a memory-mapped file.
+//
+template<class T, class L = row_major>
+using mmap_matrix = matrix<mmap_matrix_engine<T, L>>;
 
 #ifndef LA_NEGATION_AS_VIEW
 //- Traits pertaining to negation.
@@ -132,6 +209,7 @@ template<class OT, class OP1, class OP2>    struct matrix_subtraction_arithmetic
 template<class T1, class T2>                struct matrix_multiplication_element_traits;
 template<class OT, class ET1, class ET2>    struct matrix_multiplication_engine_traits;
 template<class OT, class OP1, class OP2>    struct matrix_multiplication_arithmetic_traits;
+template<class OT, class OP1, class OP2>    struct matrix_multiply_add_traits;
 
 //- Traits pertaining to scalar division.
 //
@@ -139,6 +217,33 @@ template<class T1, class T2>                struct matrix_division_element_trait
 template<class OT, class ET1, class ET2>    struct matrix_division_engine_traits;
 template<class OT, class OP1, class OP2>    struct matrix_division_arithmetic_traits;
 
+//- Traits pertaining to the compound assignment operators.
+//
+template<class OT, class OP1, class OP2>    struct matrix_compound_assignment_traits;
+
+//- Arithmetic traits that produce expression views (used by matrix_expression_operation_traits).
+//
+template<class OT, class OP1, class OP2>    struct matrix_expression_addition_traits;
+template<class OT, class OP1, class OP2>    struct matrix_expression_subtraction_traits;
+template<class OT, class OP1, class OP2>    struct matrix_expression_multiplication_traits;
+template<class OT, class OP1, class OP2>    struct matrix_expression_division_traits;
+
+//- Arithmetic traits that compute large products in parallel (used by
+//  matrix_parallel_operation_traits).
+//
+template<class OT, class OP1, class OP2>    struct matrix_parallel_multiplication_traits;
+
+//- Arithmetic traits that compute large products by the Strassen-Winograd recursion (used by
+//  matrix_strassen_operation_traits).
+//
+template<class OT, class OP1, class OP2>    struct matrix_strassen_multiplication_traits;
+
+//- Arithmetic traits that call an external CBLAS library (used by matrix_blas_operation_traits).
+//
+template<class OT, class OP1, class OP2>    struct matrix_blas_multiplication_traits;
+template<class OT, class OP1, class OP2>    struct matrix_blas_multiply_add_traits;
+template<class OT, class OP1, class OP2>    struct matrix_blas_compound_assignment_traits;
+
 //- A traits type that chooses between two operation traits types in the binary arithmetic
 //  operators and free functions that act like binary operators (e.g., outer_product()).
 //  Note that this traits class is a customization point.
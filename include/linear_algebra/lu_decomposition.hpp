@@ -0,0 +1,644 @@
+//==================================================================================================
+//  File:       lu_decomposition.hpp
+//
+//  Summary:    This header defines the LU factorization with partial (row) pivoting, and the
+//              linear solve, inverse, and determinant that are computed from it.
+//
+//              The factorization overwrites its operand with L (below the diagonal, with an
+//              implied unit diagonal) and U (on and above the diagonal), and returns the row
+//              permutation P such that P*A = L*U.  It is computed by a blocked, right-looking
+//              algorithm: each panel of columns is factored by simple loops, exchanging whole
+//              rows by swap_rows(), and the trailing submatrix is then updated by the blocked
+//              GEMM kernel (see multiplication_kernels.hpp), when the operand's elements can be
+//              addressed through a span.  Square fixed-size matrices of order 4 or less are
+//              factored by fully unrolled code, which remains usable in constant expressions.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_LU_DECOMPOSITION_HPP_DEFINED
+#define LINEAR_ALGEBRA_LU_DECOMPOSITION_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The decompositions divide, and take square roots, in the element type, so they require
+//  floating-point elements, real or complex; integral elements would give truncated results.
+//==================================================================================================
+//
+template<class T>
+struct is_decomposable_element : public bool_constant<is_floating_point_v<T>>
+{};
+
+template<class T>
+struct is_decomposable_element<complex<T>> : public bool_constant<is_floating_point_v<T>>
+{};
+
+template<class T> inline constexpr
+bool    is_decomposable_element_v = is_decomposable_element<remove_cv_t<T>>::value;
+
+//==================================================================================================
+//  The types of the objects created by the decompositions.  Decomposing a matrix having a
+//  fixed-size engine gives rise to fixed-size matrices and vectors; decomposing any other matrix
+//  gives rise to dynamic ones, whose layout is that of the source engine, if it has one.
+//==================================================================================================
+//
+template<class ET, class OT>
+struct decomposition_types
+{
+    static_assert(is_decomposable_element_v<typename ET::element_type>,
+                  "decompositions require floating-point elements");
+
+    using value_type       = remove_cv_t<typename ET::element_type>;
+    using layout_type      = conditional_t<is_column_major_v<ET>, column_major, row_major>;
+    using matrix_type      = matrix<dr_matrix_engine<value_type, allocator<value_type>, layout_type>, OT>;
+    using vector_type      = vector<dr_vector_engine<value_type>, OT>;
+    using permutation_type = vector<dr_vector_engine<ptrdiff_t>, OT>;
+
+    static constexpr matrix_type        make_matrix(ptrdiff_t rows, ptrdiff_t cols)
+                                            { return matrix_type(rows, cols); }
+    static constexpr vector_type        make_vector(ptrdiff_t elems)
+                                            { return vector_type(elems); }
+    static constexpr permutation_type   make_permutation(ptrdiff_t elems)
+                                            { return permutation_type(elems); }
+};
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT, class OT>
+struct decomposition_types<fs_matrix_engine<T, R, C, LT>, OT>
+{
+    static_assert(is_decomposable_element_v<T>, "decompositions require floating-point elements");
+
+    using value_type       = T;
+    using layout_type      = LT;
+    using matrix_type      = matrix<fs_matrix_engine<T, R, C, LT>, OT>;
+    using vector_type      = vector<fs_vector_engine<T, R>, OT>;
+    using permutation_type = vector<fs_vector_engine<ptrdiff_t, R>, OT>;
+
+    static constexpr matrix_type        make_matrix(ptrdiff_t, ptrdiff_t)   { return matrix_type(); }
+    static constexpr vector_type        make_vector(ptrdiff_t)              { return vector_type(); }
+    static constexpr permutation_type   make_permutation(ptrdiff_t)         { return permutation_type(); }
+};
+
+//- The magnitude used to choose pivots.  Complex elements are compared by the sum of the
+//  magnitudes of their real and imaginary parts, which is cheaper than abs() and serves as well.
+//
+template<class T> constexpr
+auto
+pivot_magnitude(T const& t)
+{
+    if constexpr (is_complex_v<T>)
+    {
+        return pivot_magnitude(t.real()) + pivot_magnitude(t.imag());
+    }
+    else
+    {
+        return (t < T{}) ? -t : t;
+    }
+}
+
+//- Rows are exchanged by the engine's swap_rows() member, if it has one, and otherwise (e.g.,
+//  for a submatrix view) element by element.
+//
+template<class ET, class = void>
+struct has_swap_rows : public false_type
+{};
+
+template<class ET>
+struct has_swap_rows<ET, void_t<decltype(declval<ET&>().swap_rows(ptrdiff_t{}, ptrdiff_t{}))>>
+:   public true_type
+{};
+
+template<class MT> constexpr
+void
+lu_swap_rows(MT& a, ptrdiff_t r1, ptrdiff_t r2)
+{
+    if constexpr (has_swap_rows<typename MT::engine_type>::value)
+    {
+        a.swap_rows(r1, r2);
+    }
+    else
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            la_swap(a(r1, j), a(r2, j));
+        }
+    }
+}
+
+//==================================================================================================
+//  The blocking parameter of the factorization: the number of columns in a panel.  Matrices
+//  having no more than this many rows or columns are factored as a single panel.
+//==================================================================================================
+//
+struct lu_blocking
+{
+    static constexpr ptrdiff_t  nb = 32;
+};
+
+//==================================================================================================
+//  The unblocked kernels.  Function lu_factor_panel() factors columns [k0, k1) of the (m x n)
+//  matrix whose elements are addressed by S, exchanging whole rows of the matrix object A as it
+//  chooses each pivot, and applying the resulting rank-1 updates to columns [k1, ue).  Function
+//  lu_solve_panel() then overwrites rows [k0, k1) of the columns to the right of the panel with
+//  the solution of L11*X = A12.  If COL_MAJOR is true, the updates are made column by column.
+//  A zero pivot (i.e., a column that is zero on and below the diagonal) is skipped.
+//==================================================================================================
+//
+template<bool COL_MAJOR, class MT, class S, class PV> constexpr
+ptrdiff_t
+lu_factor_panel(MT& a, S& s, ptrdiff_t k0, ptrdiff_t k1, ptrdiff_t ue, PV& pv)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+
+    ptrdiff_t const     m     = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t           swaps = 0;
+
+    for (ptrdiff_t k = k0;  k < k1;  ++k)
+    {
+        ptrdiff_t   ip  = k;
+        auto        big = pivot_magnitude(s(k, k));
+
+        for (ptrdiff_t i = k + 1;  i < m;  ++i)
+        {
+            auto const  mag = pivot_magnitude(s(i, k));
+
+            if (big < mag)
+            {
+                ip  = i;
+                big = mag;
+            }
+        }
+
+        if (ip != k)
+        {
+            lu_swap_rows(a, k, ip);
+            la_swap(pv(k), pv(ip));
+            ++swaps;
+        }
+
+        value_type const    piv = s(k, k);
+
+        if (piv == value_type{}) continue;
+
+        for (ptrdiff_t i = k + 1;  i < m;  ++i)
+        {
+            s(i, k) = s(i, k) / piv;
+        }
+
+        if constexpr (COL_MAJOR)
+        {
+            for (ptrdiff_t j = k + 1;  j < ue;  ++j)
+            {
+                value_type const    ukj = s(k, j);
+
+                for (ptrdiff_t i = k + 1;  i < m;  ++i)
+                {
+                    s(i, j) = s(i, j) - s(i, k) * ukj;
+                }
+            }
+        }
+        else
+        {
+            for (ptrdiff_t i = k + 1;  i < m;  ++i)
+            {
+                value_type const    lik = s(i, k);
+
+                for (ptrdiff_t j = k + 1;  j < ue;  ++j)
+                {
+                    s(i, j) = s(i, j) - lik * s(k, j);
+                }
+            }
+        }
+    }
+    return swaps;
+}
+
+template<bool COL_MAJOR, class S>
+void
+lu_solve_panel(S& s, ptrdiff_t k0, ptrdiff_t k1, ptrdiff_t n)
+{
+    if constexpr (COL_MAJOR)
+    {
+        for (ptrdiff_t j = k1;  j < n;  ++j)
+        {
+            for (ptrdiff_t l = k0;  l < k1;  ++l)
+            {
+                auto const  xlj = s(l, j);
+
+                for (ptrdiff_t i = l + 1;  i < k1;  ++i)
+                {
+                    s(i, j) = s(i, j) - s(i, l) * xlj;
+                }
+            }
+        }
+    }
+    else
+    {
+        for (ptrdiff_t i = k0 + 1;  i < k1;  ++i)
+        {
+            for (ptrdiff_t l = k0;  l < i;  ++l)
+            {
+                auto const  lil = s(i, l);
+
+                for (ptrdiff_t j = k1;  j < n;  ++j)
+                {
+                    s(i, j) = s(i, j) - lil * s(l, j);
+                }
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The unrolled kernel for square fixed-size matrices of order N <= 4.  Each step K chooses a
+//  pivot, exchanges rows, and updates the trailing (N-K-1 x N-K-1) block, with every loop
+//  expanded by a fold over a compile-time index sequence.
+//==================================================================================================
+//
+template<ptrdiff_t K, ptrdiff_t N, class MT, class PV> constexpr
+ptrdiff_t
+fs_small_lu_step(MT& a, PV& pv)
+{
+    using value_type = typename MT::value_type;
+    using trailing   = make_integer_sequence<ptrdiff_t, N - K - 1>;
+
+    ptrdiff_t   ip  = K;
+    auto        big = pivot_magnitude(a(K, K));
+
+    auto    choose = [&]<ptrdiff_t... I>(integer_sequence<ptrdiff_t, I...>)
+    {
+        ((big < pivot_magnitude(a(K + 1 + I, K))
+            ? (void) (ip = K + 1 + I, big = pivot_magnitude(a(K + 1 + I, K)))
+            : (void) 0), ...);
+    };
+    choose(trailing{});
+
+    if (ip != K)
+    {
+        a.swap_rows(K, ip);
+        la_swap(pv(K), pv(ip));
+    }
+
+    value_type const    piv = a(K, K);
+
+    if (piv != value_type{})
+    {
+        auto    row = [&]<ptrdiff_t... J>(ptrdiff_t i, integer_sequence<ptrdiff_t, J...>)
+        {
+            value_type const    lik = a(i, K) / piv;
+
+            a(i, K) = lik;
+            ((a(i, K + 1 + J) = a(i, K + 1 + J) - lik * a(K, K + 1 + J)), ...);
+        };
+        auto    rows = [&]<ptrdiff_t... I>(integer_sequence<ptrdiff_t, I...>)
+        {
+            (row(K + 1 + I, trailing{}), ...);
+        };
+        rows(trailing{});
+    }
+    return (ip != K) ? 1 : 0;
+}
+
+template<ptrdiff_t N, class MT, class PV, ptrdiff_t... K> constexpr
+ptrdiff_t
+fs_small_lu(MT& a, PV& pv, integer_sequence<ptrdiff_t, K...>)
+{
+    ptrdiff_t   swaps = 0;
+
+    ((swaps += fs_small_lu_step<K, N>(a, pv)), ...);
+    return swaps;
+}
+
+template<class ET>
+constexpr bool
+fs_small_square()
+{
+    if constexpr (!fs_small_traits<ET>::value  ||  !is_matrix_engine_v<ET>)
+        return false;
+    else
+        return fs_small_traits<ET>::rows == fs_small_traits<ET>::cols;
+}
+
+template<class ET> inline constexpr
+bool    use_fs_small_lu_v = fs_small_square<ET>();
+
+//==================================================================================================
+//  The factorization driver.  It initializes the permutation PV to the identity, factors the
+//  matrix A in place, and returns the number of row exchanges made, whose parity is the sign of
+//  the permutation.  Span-backed operands having GEMM element types are factored by blocks of
+//  columns at run time; all others are factored as a single panel, through A's own operator().
+//==================================================================================================
+//
+template<class MT, class PV> constexpr
+ptrdiff_t
+lu_factor_in_place(MT& a, PV& pv)
+{
+    using engine_type = typename MT::engine_type;
+    using value_type  = typename MT::value_type;
+
+    constexpr bool      col_major = is_column_major_v<engine_type>;
+
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n  = static_cast<ptrdiff_t>(a.columns());
+    ptrdiff_t const     kn = (m < n) ? m : n;
+
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        pv(i) = i;
+    }
+
+    if constexpr (use_fs_small_lu_v<engine_type>)
+    {
+        constexpr ptrdiff_t     N = fs_small_traits<engine_type>::rows;
+
+        return fs_small_lu<N>(a, pv, make_integer_sequence<ptrdiff_t, N>{});
+    }
+    else
+    {
+        if constexpr (has_direct_span_v<engine_type>  &&  is_gemm_element_v<value_type>)
+        {
+            if (!is_constant_evaluated()  &&  kn > lu_blocking::nb)
+            {
+                auto                s     = a.span();
+                value_type* const   p     = s.data();
+                ptrdiff_t const     rs    = static_cast<ptrdiff_t>(s.stride(0));
+                ptrdiff_t const     cs    = static_cast<ptrdiff_t>(s.stride(1));
+                ptrdiff_t           swaps = 0;
+
+                for (ptrdiff_t k0 = 0;  k0 < kn;  k0 += lu_blocking::nb)
+                {
+                    ptrdiff_t const     k1 = (kn - k0 < lu_blocking::nb) ? kn : (k0 + lu_blocking::nb);
+
+                    swaps += lu_factor_panel<col_major>(a, s, k0, k1, k1, pv);
+
+                    if (k1 < n)
+                    {
+                        lu_solve_panel<col_major>(s, k0, k1, n);
+                        gemm_blocked(m - k1, n - k1, k1 - k0, value_type{-1},
+                                     p + k1*rs + k0*cs, rs, cs,
+                                     p + k0*rs + k1*cs, rs, cs,
+                                     value_type{1}, p + k1*rs + k1*cs, rs, cs);
+                    }
+                }
+                return swaps;
+            }
+        }
+        return lu_factor_panel<col_major>(a, a, 0, kn, n, pv);
+    }
+}
+
+//==================================================================================================
+//  The substitution kernels, which overwrite X (a vector or a matrix, already permuted by P)
+//  with the solution of L*U*X = X, given the factors LU of a square matrix.  A zero on the
+//  diagonal of U means that the matrix is singular, and causes an exception to be thrown.
+//==================================================================================================
+//
+template<class LU> constexpr
+void
+lu_check_nonsingular(LU const& lu)
+{
+    using value_type = typename LU::value_type;
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(lu.rows());  ++i)
+    {
+        if (lu(i, i) == value_type{})
+        {
+            throw runtime_error("matrix is singular");
+        }
+    }
+}
+
+template<class LU, class VT> constexpr
+void
+lu_substitute_vector(LU const& lu, VT& x)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(lu.rows());
+
+    for (ptrdiff_t i = 1;  i < n;  ++i)
+    {
+        auto    xi = x(i);
+
+        for (ptrdiff_t l = 0;  l < i;  ++l)
+        {
+            xi = xi - lu(i, l) * x(l);
+        }
+        x(i) = xi;
+    }
+    for (ptrdiff_t i = n - 1;  i >= 0;  --i)
+    {
+        auto    xi = x(i);
+
+        for (ptrdiff_t l = i + 1;  l < n;  ++l)
+        {
+            xi = xi - lu(i, l) * x(l);
+        }
+        x(i) = xi / lu(i, i);
+    }
+}
+
+template<class LU, class MT> constexpr
+void
+lu_substitute_matrix(LU const& lu, MT& x)
+{
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(lu.rows());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(x.columns());
+
+    for (ptrdiff_t i = 1;  i < n;  ++i)
+    {
+        for (ptrdiff_t l = 0;  l < i;  ++l)
+        {
+            auto const  lil = lu(i, l);
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) - lil * x(l, j);
+            }
+        }
+    }
+    for (ptrdiff_t i = n - 1;  i >= 0;  --i)
+    {
+        for (ptrdiff_t l = i + 1;  l < n;  ++l)
+        {
+            auto const  uil = lu(i, l);
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                x(i, j) = x(i, j) - uil * x(l, j);
+            }
+        }
+
+        auto const  uii = lu(i, i);
+
+        for (ptrdiff_t j = 0;  j < k;  ++j)
+        {
+            x(i, j) = x(i, j) / uii;
+        }
+    }
+}
+
+template<class MT> constexpr
+void
+check_square(MT const& m)
+{
+    if (m.rows() != m.columns())
+    {
+        throw runtime_error("matrix is not square");
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Function lu_factor() overwrites the matrix A, which may be any matrix (or view of a matrix)
+//  having a writable engine, with the factors L and U of P*A = L*U, and returns the row
+//  permutation P as a vector p of row indices: row i of P*A is row p(i) of A.  A need not be
+//  square; if it is singular, U has a zero on its diagonal.
+//
+//  Function lu_solve() uses the factors and the permutation returned by lu_factor() to solve
+//  A*x = b for a vector b, or A*X = B for a matrix B, returning the solution as a new object.
+//  Functions solve(), inverse(), and determinant() factor a copy of the square matrix A.
+//  Solving with (or inverting) a singular matrix causes an exception to be thrown.
+//==================================================================================================
+//
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline constexpr
+auto
+lu_factor(matrix<ET, OT>& a)
+{
+    using types = detail::decomposition_types<ET, OT>;
+
+    auto    p = types::make_permutation(a.rows());
+
+    detail::lu_factor_in_place(a, p);
+    return p;
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline constexpr
+auto
+lu_factor(matrix<ET, OT>&& a)
+{
+    return lu_factor(a);
+}
+
+template<class ET1, class OT1, class ET2, class OT2, class ET3, class OT3> inline constexpr
+auto
+lu_solve(matrix<ET1, OT1> const& lu, vector<ET2, OT2> const& p, vector<ET3, OT3> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(lu);
+    if (b.size() != lu.rows()  ||  p.size() != lu.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::lu_check_nonsingular(lu);
+
+    auto    x = types::make_vector(lu.rows());
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(x.size());  ++i)
+    {
+        x(i) = b(p(i));
+    }
+    detail::lu_substitute_vector(lu, x);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2, class ET3, class OT3> inline constexpr
+auto
+lu_solve(matrix<ET1, OT1> const& lu, vector<ET2, OT2> const& p, matrix<ET3, OT3> const& b)
+{
+    using types = detail::decomposition_types<ET3, OT1>;
+
+    detail::check_square(lu);
+    if (b.rows() != lu.rows()  ||  p.size() != lu.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+    detail::lu_check_nonsingular(lu);
+
+    auto    x = types::make_matrix(b.rows(), b.columns());
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(x.rows());  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(x.columns());  ++j)
+        {
+            x(i, j) = b(p(i), j);
+        }
+    }
+    detail::lu_substitute_matrix(lu, x);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+solve(matrix<ET1, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(a);
+
+    typename types::matrix_type     lu(a);
+    auto const                      p = lu_factor(lu);
+
+    return lu_solve(lu, p, b);
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+solve(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using types = detail::decomposition_types<ET1, OT1>;
+
+    detail::check_square(a);
+
+    typename types::matrix_type     lu(a);
+    auto const                      p = lu_factor(lu);
+
+    return lu_solve(lu, p, b);
+}
+
+template<class ET, class OT> inline constexpr
+auto
+inverse(matrix<ET, OT> const& a)
+{
+    using types      = detail::decomposition_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    detail::check_square(a);
+
+    typename types::matrix_type     lu(a);
+    auto const                      p = lu_factor(lu);
+    auto                            x = types::make_matrix(a.rows(), a.columns());
+
+    detail::lu_check_nonsingular(lu);
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(x.rows());  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(x.columns());  ++j)
+        {
+            x(i, j) = (p(i) == j) ? value_type{1} : value_type{};
+        }
+    }
+    detail::lu_substitute_matrix(lu, x);
+    return x;
+}
+
+template<class ET, class OT> inline constexpr
+auto
+determinant(matrix<ET, OT> const& a)
+{
+    using types      = detail::decomposition_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    detail::check_square(a);
+
+    typename types::matrix_type     lu(a);
+    auto                            p     = types::make_permutation(a.rows());
+    ptrdiff_t const                 swaps = detail::lu_factor_in_place(lu, p);
+    value_type                      det   = (swaps % 2 == 0) ? value_type{1} : value_type{-1};
+
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(lu.rows());  ++i)
+    {
+        det = det * lu(i, i);
+    }
+    return det;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_LU_DECOMPOSITION_HPP_DEFINED
@@ -46,8 +46,8 @@ class matrix
     using const_submatrix_type = matrix<matrix_subset_engine<engine_type, readable_matrix_engine_tag>, OT>;
     using transpose_type       = matrix<matrix_transpose_engine<engine_type, possibly_writable_matrix_tag>, OT>;
     using const_transpose_type = matrix<matrix_transpose_engine<engine_type, readable_matrix_engine_tag>, OT>;
-    using hermitian_type       = conditional_t<has_cx_elem, matrix, const_transpose_type>;
-    using const_hermitian_type = conditional_t<has_cx_elem, matrix, const_transpose_type>;
+    using hermitian_type       = conditional_t<has_cx_elem, matrix<matrix_hermitian_engine<engine_type, readable_matrix_engine_tag>, OT>, const_transpose_type>;
+    using const_hermitian_type = conditional_t<has_cx_elem, matrix<matrix_hermitian_engine<engine_type, readable_matrix_engine_tag>, OT>, const_transpose_type>;
     using span_type            = detail::engine_span_t<ET>;
     using const_span_type      = detail::engine_const_span_t<ET>;
 
@@ -64,6 +64,8 @@ class matrix
     constexpr matrix(matrix&&) noexcept = default;
     constexpr matrix(matrix const&) = default;
 
+    explicit constexpr matrix(engine_type const& eng);
+    explicit constexpr matrix(engine_type&& eng);
     template<class ET2, class OT2>
     constexpr matrix(matrix<ET2, OT2> const& src);
     template<class U, class ET2 = ET, detail::enable_if_initable<ET, ET2, U> = true>
@@ -146,6 +148,13 @@ class matrix
     constexpr void      swap_columns(index_type c1, index_type c2) noexcept;
     template<class ET2 = ET, detail::enable_if_writable<ET, ET2> = true>
     constexpr void      swap_rows(index_type r1, index_type r2) noexcept;
+    template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
+    constexpr void      transpose_in_place();
+
+    template<class ET2, class OT2, class ET3 = ET, detail::enable_if_resizable<ET, ET3> = true>
+    constexpr void      append_row(vector<ET2, OT2> const& v);
+    template<class ET2, class OT2, class ET3 = ET, detail::enable_if_resizable<ET, ET3> = true>
+    constexpr void      append_rows(matrix<ET2, OT2> const& m);
 
   private:
     template<class ET2, class OT2> friend class matrix;
@@ -155,11 +164,24 @@ class matrix
 
     template<class ET2, class... ARGS>
     constexpr matrix(detail::special_ctor_tag, ET2&& eng, ARGS&&... args);
+
+    template<class ET2, class FN>
+    constexpr void      append_rows_from(ET2 const& eng, index_type more, index_type cols, FN const& src);
 };
 
 //------------------------
 //- Construct/copy/destroy
 //
+template<class ET, class OT> constexpr
+matrix<ET,OT>::matrix(engine_type const& eng)
+:   m_engine(eng)
+{}
+
+template<class ET, class OT> constexpr
+matrix<ET,OT>::matrix(engine_type&& eng)
+:   m_engine(std::move(eng))
+{}
+
 template<class ET, class OT>
 template<class ET2, class OT2> constexpr
 matrix<ET,OT>::matrix(matrix<ET2, OT2> const& rhs)
@@ -399,14 +421,7 @@ template<class ET, class OT> inline constexpr
 typename matrix<ET,OT>::const_hermitian_type
 matrix<ET,OT>::h() const
 {
-    if constexpr (detail::is_complex_v<element_type>)
-    {
-        return const_hermitian_type();
-    }
-    else
-    {
-        return const_hermitian_type(detail::special_ctor_tag(), m_engine);
-    }
+    return const_hermitian_type(detail::special_ctor_tag(), m_engine);
 }
 
 //-------------
@@ -468,6 +483,108 @@ matrix<ET,OT>::swap_rows(index_type r1, index_type r2) noexcept
     m_engine.swap_rows(r1, r2);
 }
 
+//- Transposing in place exchanges the extents of the matrix, reusing its engine's storage.
+//
+template<class ET, class OT>
+template<class ET2, detail::enable_if_resizable<ET, ET2>> constexpr
+void
+matrix<ET,OT>::transpose_in_place()
+{
+    m_engine.transpose_in_place();
+}
+
+//- Appending rows grows the matrix by the number of rows appended; the row capacity of the
+//  engine grows geometrically, so that appending rows one at a time takes amortized constant
+//  time per row.  If the matrix is empty, the appended rows also determine its column count.
+//  The appended elements may refer to elements of this matrix, for example m.append_row(m.row(0)).
+//
+template<class ET, class OT>
+template<class ET2, class OT2, class ET3, detail::enable_if_resizable<ET, ET3>> constexpr
+void
+matrix<ET,OT>::append_row(vector<ET2, OT2> const& v)
+{
+    using src_index_type = typename ET2::index_type;
+
+    append_rows_from(v.engine(), 1, static_cast<index_type>(v.size()),
+                     [&v](index_type, index_type j) { return v(static_cast<src_index_type>(j)); });
+}
+
+template<class ET, class OT>
+template<class ET2, class OT2, class ET3, detail::enable_if_resizable<ET, ET3>> constexpr
+void
+matrix<ET,OT>::append_rows(matrix<ET2, OT2> const& m)
+{
+    using src_index_type = typename ET2::index_type;
+
+    append_rows_from(m.engine(), static_cast<index_type>(m.rows()), static_cast<index_type>(m.columns()),
+                     [&m](index_type i, index_type j)
+                     { return m(static_cast<src_index_type>(i), static_cast<src_index_type>(j)); });
+}
+
+//------------------------
+//- Private implementation
+//
+//- The engine is resized to hold the appended rows, growing its storage geometrically and
+//  moving the existing rows as it sees fit, and the new rows are then copied in.  Growing the
+//  storage may move the elements of this matrix, so a source that may refer to them (as a view
+//  of this matrix does) is first copied to a temporary; sources whose memory cannot be located
+//  are assumed to refer to them.
+//
+template<class ET, class OT>
+template<class ET2, class FN> constexpr
+void
+matrix<ET,OT>::append_rows_from(ET2 const& eng, index_type more, index_type cols, FN const& src)
+{
+    index_type const    rows = m_engine.rows();
+
+    if (rows != 0  &&  cols != m_engine.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+    if (more == 0) return;
+
+    bool    copy_first = rows + more > m_engine.row_capacity()  ||  cols > m_engine.column_capacity();
+
+    if constexpr (detail::has_memory_span<ET>::value  &&  detail::has_memory_span<ET2>::value)
+    {
+        copy_first = copy_first  &&  detail::engines_may_overlap(m_engine, eng);
+    }
+
+    if (copy_first)
+    {
+        dr_matrix_engine<element_type>  tmp(more, cols);
+
+        for (index_type i = 0;  i < more;  ++i)
+        {
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                tmp(i, j) = static_cast<element_type>(src(i, j));
+            }
+        }
+
+        m_engine.resize(rows + more, cols);
+
+        for (index_type i = 0;  i < more;  ++i)
+        {
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                m_engine(rows + i, j) = std::move(tmp(i, j));
+            }
+        }
+        return;
+    }
+
+    m_engine.resize(rows + more, cols);
+
+    for (index_type i = 0;  i < more;  ++i)
+    {
+        for (index_type j = 0;  j < cols;  ++j)
+        {
+            m_engine(rows + i, j) = static_cast<element_type>(src(i, j));
+        }
+    }
+}
+
 //------------
 //- Comparison
 //
@@ -565,7 +565,10 @@ matrix_view_engine<ET, MCT, transpose_view_tag>::matrix_view_engine(referent_typ
 
 //==================================================================================================
 //  Matrix hermitian engine, meant to act as a "view" of a matrix conjugate transpose in
-//  expressions, to help avoid unnecessary allocation and/or element copying.
+//  expressions, to help avoid unnecessary allocation and/or element copying.  Its elements are
+//  computed on access, and so are returned by value.  Its span is the transposed span of its
+//  referent, which does not express the conjugation; kernels that use it must conjugate the
+//  elements themselves.
 //==================================================================================================
 //
 template<class ET>
@@ -581,8 +584,8 @@ class matrix_view_engine<ET, readable_matrix_engine_tag, hermitian_view_tag>
     using value_type      = typename ET::value_type;
     using pointer         = detail::noe_pointer_t<ET, readable_matrix_engine_tag>;
     using const_pointer   = typename ET::const_pointer;
-    using reference       = detail::noe_reference_t<ET, readable_matrix_engine_tag>;
-    using const_reference = typename ET::const_reference;
+    using reference       = value_type;
+    using const_reference = value_type;
     using difference_type = typename ET::difference_type;
     using index_type      = typename ET::index_type;
     using index_tuple     = extents<dynamic_extent, dynamic_extent>;
@@ -723,5 +726,138 @@ matrix_view_engine<ET, readable_matrix_engine_tag, hermitian_view_tag>::matrix_v
 :   mp_other(&eng)
 {}
 
+//==================================================================================================
+//  Matrix expression engine, meant to act as a "view" of a pending element-wise operation (sum,
+//  difference, or scaling) on one or two operands.  The operation is described by the expression
+//  type EXPR (see detail::elementwise_expression), which the engine holds by value; elements are
+//  computed on demand, so that assigning a compound expression to an owning engine evaluates the
+//  whole expression in a single loop, without creating intermediate results.
+//==================================================================================================
+//
+template<class EXPR>
+class matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = typename EXPR::element_type;
+    using value_type      = remove_cv_t<element_type>;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type;
+    using const_reference = element_type;
+    using difference_type = typename EXPR::difference_type;
+    using index_type      = typename EXPR::index_type;
+    using index_tuple     = typename EXPR::index_tuple;
+
+    //- Construct/copy/destroy
+    //
+    ~matrix_view_engine() noexcept = default;
+
+    constexpr matrix_view_engine() = default;
+    constexpr matrix_view_engine(matrix_view_engine&&) noexcept = default;
+    constexpr matrix_view_engine(matrix_view_engine const&) = default;
+    explicit constexpr matrix_view_engine(EXPR const& expr);
+
+    constexpr matrix_view_engine&    operator =(matrix_view_engine&&) noexcept = default;
+    constexpr matrix_view_engine&    operator =(matrix_view_engine const&) = default;
+
+    //- Capacity
+    //
+    constexpr index_type    columns() const noexcept;
+    constexpr index_type    rows() const noexcept;
+    constexpr index_tuple   size() const noexcept;
+
+    constexpr index_type    column_capacity() const noexcept;
+    constexpr index_type    row_capacity() const noexcept;
+    constexpr index_tuple   capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(index_type i, index_type j) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(matrix_view_engine& rhs) noexcept;
+
+  private:
+    EXPR    m_expr;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class EXPR> constexpr
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::matrix_view_engine(EXPR const& expr)
+:   m_expr(expr)
+{}
+
+//----------
+//- Capacity
+//
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::index_type
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::columns() const noexcept
+{
+    return m_expr.columns();
+}
+
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::index_type
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::rows() const noexcept
+{
+    return m_expr.rows();
+}
+
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::index_tuple
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::size() const noexcept
+{
+    return m_expr.size();
+}
+
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::index_type
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::column_capacity() const noexcept
+{
+    return m_expr.columns();
+}
+
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::index_type
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::row_capacity() const noexcept
+{
+    return m_expr.rows();
+}
+
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::index_tuple
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::capacity() const noexcept
+{
+    return m_expr.size();
+}
+
+//----------------
+//- Element access
+//
+template<class EXPR> constexpr
+typename matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::reference
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::operator ()
+(index_type i, index_type j) const
+{
+    return m_expr(i, j);
+}
+
+//-----------
+//- Modifiers
+//
+template<class EXPR> constexpr
+void
+matrix_view_engine<EXPR, readable_matrix_engine_tag, expression_view_tag>::swap(matrix_view_engine& rhs) noexcept
+{
+    detail::la_swap(m_expr, rhs.m_expr);
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_SUBMATRIX_ENGINE_HPP_DEFINED
@@ -0,0 +1,358 @@
+//==================================================================================================
+//  File:       mdspan_matrix_engine.hpp
+//
+//  Summary:    This header defines a non-owning matrix engine that adopts an existing buffer,
+//              described either by a 2-D basic_mdspan or by a pointer, extents, and strides.
+//              Matrices using this engine operate directly on the buffer's memory, so data that
+//              arrives in large pre-allocated buffers (memory-mapped files, shared memory
+//              segments, etc.) can take part in arithmetic expressions without being copied.
+//
+//              The layout policy, LT, states which of the buffer's strides is one: row_major
+//              (the default) for buffers whose rows are contiguous, column_major for buffers
+//              whose columns are contiguous, or strided for buffers with arbitrary strides.  The
+//              stride of the other extent (the leading dimension) may exceed the extent, so
+//              padded buffers can also be adopted.
+//
+//              If T is const-qualified, the engine is readable; otherwise, it is writable.  In
+//              either case, copying or copy-assigning the engine copies the reference to the
+//              buffer, not its elements, as with the other non-owning engines.  Assigning an
+//              engine of a different type copies elements into the buffer.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MDSPAN_MATRIX_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_MDSPAN_MATRIX_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Non-owning matrix engine over external storage.
+//==================================================================================================
+//
+template<class T, class LT>
+class mdspan_matrix_engine
+{
+    static_assert(detail::is_matrix_layout_v<LT>  ||  is_same_v<LT, strided>);
+
+    using writable_tag = conditional_t<is_const_v<T>, readable_matrix_engine_tag,
+                                                      writable_matrix_engine_tag>;
+
+  public:
+    //- Types
+    //
+    using engine_category = writable_tag;
+    using element_type    = remove_cv_t<T>;
+    using value_type      = remove_cv_t<T>;
+    using layout_type     = LT;
+    using pointer         = T*;
+    using const_pointer   = element_type const*;
+    using reference       = T&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using index_type      = ptrdiff_t;
+    using index_tuple     = extents<dynamic_extent, dynamic_extent>;
+    using span_type       = basic_mdspan<T, detail::dyn_mat_extents, detail::dyn_mat_layout>;
+    using const_span_type = basic_mdspan<element_type const, detail::dyn_mat_extents, detail::dyn_mat_layout>;
+
+    //- Construct/copy/destroy
+    //
+    ~mdspan_matrix_engine() noexcept = default;
+
+    constexpr mdspan_matrix_engine() noexcept;
+    constexpr mdspan_matrix_engine(mdspan_matrix_engine&&) noexcept = default;
+    constexpr mdspan_matrix_engine(mdspan_matrix_engine const&) noexcept = default;
+    constexpr mdspan_matrix_engine(pointer p, index_type rows, index_type cols);
+    constexpr mdspan_matrix_engine(pointer p, index_type rows, index_type cols,
+                                   index_type row_stride, index_type col_stride);
+    template<class T2, ptrdiff_t X0, ptrdiff_t X1, class L2, class A2,
+             detail::enable_if_adoptable_span<basic_mdspan<T2, extents<X0, X1>, L2, A2>, T> = true>
+    constexpr mdspan_matrix_engine(basic_mdspan<T2, extents<X0, X1>, L2, A2> const& s);
+
+    constexpr mdspan_matrix_engine&     operator =(mdspan_matrix_engine&&) noexcept = default;
+    constexpr mdspan_matrix_engine&     operator =(mdspan_matrix_engine const&) noexcept = default;
+    template<class ET2, detail::enable_if_engine_has_convertible_element<ET2, T> = true>
+    constexpr mdspan_matrix_engine&     operator =(ET2 const& rhs);
+    template<class T2, detail::enable_if_convertible_element<T2, T> = true>
+    constexpr mdspan_matrix_engine&     operator =(initializer_list<initializer_list<T2>> rhs);
+
+    //- Capacity
+    //
+    constexpr index_type    columns() const noexcept;
+    constexpr index_type    rows() const noexcept;
+    constexpr index_tuple   size() const noexcept;
+
+    constexpr index_type    column_capacity() const noexcept;
+    constexpr index_type    row_capacity() const noexcept;
+    constexpr index_tuple   capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(index_type i, index_type j) const;
+
+    //- Data access
+    //
+    constexpr pointer       data() const noexcept;
+    constexpr span_type     span() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(mdspan_matrix_engine& rhs) noexcept;
+    constexpr void      swap_columns(index_type j1, index_type j2) noexcept;
+    constexpr void      swap_rows(index_type i1, index_type i2) noexcept;
+
+  private:
+    pointer         mp_elems;
+    index_type      m_rows;
+    index_type      m_cols;
+    index_type      m_rowstride;
+    index_type      m_colstride;
+
+    constexpr index_type    offset(index_type i, index_type j) const noexcept;
+    constexpr void          check_strides();
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class LT> constexpr
+mdspan_matrix_engine<T,LT>::mdspan_matrix_engine() noexcept
+:   mp_elems(nullptr)
+,   m_rows(0)
+,   m_cols(0)
+,   m_rowstride(0)
+,   m_colstride(1)
+{}
+
+template<class T, class LT> constexpr
+mdspan_matrix_engine<T,LT>::mdspan_matrix_engine(pointer p, index_type rows, index_type cols)
+:   mp_elems(p)
+,   m_rows(rows)
+,   m_cols(cols)
+,   m_rowstride(is_same_v<LT, column_major> ? 1 : max<index_type>(cols, 1))
+,   m_colstride(is_same_v<LT, column_major> ? max<index_type>(rows, 1) : 1)
+{
+    check_strides();
+}
+
+template<class T, class LT> constexpr
+mdspan_matrix_engine<T,LT>::mdspan_matrix_engine
+(pointer p, index_type rows, index_type cols, index_type row_stride, index_type col_stride)
+:   mp_elems(p)
+,   m_rows(rows)
+,   m_cols(cols)
+,   m_rowstride(row_stride)
+,   m_colstride(col_stride)
+{
+    check_strides();
+}
+
+template<class T, class LT>
+template<class T2, ptrdiff_t X0, ptrdiff_t X1, class L2, class A2,
+         detail::enable_if_adoptable_span<basic_mdspan<T2, extents<X0, X1>, L2, A2>, T>> constexpr
+mdspan_matrix_engine<T,LT>::mdspan_matrix_engine(basic_mdspan<T2, extents<X0, X1>, L2, A2> const& s)
+:   mp_elems(s.data())
+,   m_rows(static_cast<index_type>(s.extent(0)))
+,   m_cols(static_cast<index_type>(s.extent(1)))
+,   m_rowstride(static_cast<index_type>(s.stride(0)))
+,   m_colstride(static_cast<index_type>(s.stride(1)))
+{
+    check_strides();
+}
+
+template<class T, class LT>
+template<class ET2, detail::enable_if_engine_has_convertible_element<ET2, T>> constexpr
+mdspan_matrix_engine<T,LT>&
+mdspan_matrix_engine<T,LT>::operator =(ET2 const& rhs)
+{
+    static_assert(is_writable_engine_v<mdspan_matrix_engine>);
+    static_assert(is_matrix_engine_v<ET2>);
+    detail::check_source_engine_size(rhs, m_rows, m_cols);
+    detail::assign_from_matrix_engine(*this, rhs);
+    return *this;
+}
+
+template<class T, class LT>
+template<class T2, detail::enable_if_convertible_element<T2, T>> constexpr
+mdspan_matrix_engine<T,LT>&
+mdspan_matrix_engine<T,LT>::operator =(initializer_list<initializer_list<T2>> rhs)
+{
+    static_assert(is_writable_engine_v<mdspan_matrix_engine>);
+    detail::check_source_init_list(rhs, m_rows, m_cols);
+    detail::assign_from_matrix_initlist(*this, rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_type
+mdspan_matrix_engine<T,LT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_type
+mdspan_matrix_engine<T,LT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_tuple
+mdspan_matrix_engine<T,LT>::size() const noexcept
+{
+    return index_tuple(m_rows, m_cols);
+}
+
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_type
+mdspan_matrix_engine<T,LT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_type
+mdspan_matrix_engine<T,LT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_tuple
+mdspan_matrix_engine<T,LT>::capacity() const noexcept
+{
+    return index_tuple(m_rows, m_cols);
+}
+
+//----------------
+//- Element access
+//
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::reference
+mdspan_matrix_engine<T,LT>::operator ()(index_type i, index_type j) const
+{
+    return mp_elems[offset(i, j)];
+}
+
+//-------------
+//- Data access
+//
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::pointer
+mdspan_matrix_engine<T,LT>::data() const noexcept
+{
+    return mp_elems;
+}
+
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::span_type
+mdspan_matrix_engine<T,LT>::span() const noexcept
+{
+    return detail::make_dyn_span(mp_elems, m_rows, m_cols, m_rowstride, m_colstride);
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class LT> constexpr
+void
+mdspan_matrix_engine<T,LT>::swap(mdspan_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(mp_elems,    rhs.mp_elems);
+        detail::la_swap(m_rows,      rhs.m_rows);
+        detail::la_swap(m_cols,      rhs.m_cols);
+        detail::la_swap(m_rowstride, rhs.m_rowstride);
+        detail::la_swap(m_colstride, rhs.m_colstride);
+    }
+}
+
+template<class T, class LT> constexpr
+void
+mdspan_matrix_engine<T,LT>::swap_columns(index_type j1, index_type j2) noexcept
+{
+    static_assert(is_writable_engine_v<mdspan_matrix_engine>);
+
+    if (j1 != j2)
+    {
+        for (index_type i = 0;  i < m_rows;  ++i)
+        {
+            detail::la_swap(mp_elems[offset(i, j1)], mp_elems[offset(i, j2)]);
+        }
+    }
+}
+
+template<class T, class LT> constexpr
+void
+mdspan_matrix_engine<T,LT>::swap_rows(index_type i1, index_type i2) noexcept
+{
+    static_assert(is_writable_engine_v<mdspan_matrix_engine>);
+
+    if (i1 != i2)
+    {
+        for (index_type j = 0;  j < m_cols;  ++j)
+        {
+            detail::la_swap(mp_elems[offset(i1, j)], mp_elems[offset(i2, j)]);
+        }
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class LT> constexpr
+typename mdspan_matrix_engine<T,LT>::index_type
+mdspan_matrix_engine<T,LT>::offset(index_type i, index_type j) const noexcept
+{
+    //- The unit stride is known at compile time for the row- and column-major layouts.
+    //
+    if constexpr (is_same_v<LT, row_major>)
+        return i*m_rowstride + j;
+    else if constexpr (is_same_v<LT, column_major>)
+        return i + j*m_colstride;
+    else
+        return i*m_rowstride + j*m_colstride;
+}
+
+template<class T, class LT> constexpr
+void
+mdspan_matrix_engine<T,LT>::check_strides()
+{
+    if (m_rows < 0  ||  m_cols < 0)
+    {
+        throw runtime_error("invalid size");
+    }
+    if (mp_elems == nullptr  &&  m_rows*m_cols != 0)
+    {
+        throw runtime_error("null buffer for non-empty mdspan_matrix_engine");
+    }
+
+    //- The leading dimension may be padded, but rows (or columns) of the buffer must not overlap.
+    //
+    if constexpr (is_same_v<LT, row_major>)
+    {
+        if (m_colstride != 1  ||  m_rowstride < m_cols)
+        {
+            throw runtime_error("strides do not describe a row-major buffer");
+        }
+    }
+    else if constexpr (is_same_v<LT, column_major>)
+    {
+        if (m_rowstride != 1  ||  m_colstride < m_rows)
+        {
+            throw runtime_error("strides do not describe a column-major buffer");
+        }
+    }
+    else
+    {
+        if (m_rowstride < 1  ||  m_colstride < 1)
+        {
+            throw runtime_error("invalid strides");
+        }
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_MDSPAN_MATRIX_ENGINE_HPP_DEFINED
@@ -0,0 +1,965 @@
+//==================================================================================================
+//  File:       mmap_matrix_engine.hpp
+//
+//  Summary:    This header defines a resizable matrix engine whose elements are stored in a
+//              memory-mapped file, for matrices too large to hold in memory.  The file begins
+//              with a small header (see detail::la_file_header) recording the element type,
+//              layout, size, and capacity of the matrix, followed by the elements, stored in the
+//              order given by the layout policy LT, exactly as dr_matrix_engine stores them.
+//
+//              A file may be opened for reading and writing, in which case changes to elements
+//              and resizing are written to the file; or for reading only, in which case the file
+//              is never modified: element changes are private to the process (copy-on-write), and
+//              the capacity cannot be increased.  An engine constructed without a file uses an
+//              anonymous mapping.  Because it owns its mapping, the engine is move-only.
+//
+//              The member functions advise() and advise_rows() pass access-pattern hints (e.g.,
+//              sequential traversal of rows) on to the operating system.
+//
+//              This engine requires POSIX mmap(); defining LA_NO_MMAP disables it.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MMAP_MATRIX_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_MMAP_MATRIX_ENGINE_HPP_DEFINED
+
+#if !defined(LA_NO_MMAP)  &&  (defined(__unix__)  ||  defined(__APPLE__))
+    #define LA_HAS_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The header at the start of the files used by the library to store vectors and matrices.  It
+//  occupies 64 bytes, and the elements follow at offset header_size, so that they are aligned
+//  for SIMD access in a mapping of the file.  Extents and capacities are stored in elements;
+//  a vector has one row.
+//==================================================================================================
+//
+struct la_file_header
+{
+    char        magic[8];           //- "P1385LA" followed by a null byte
+    uint32_t    version;            //- Format version, currently 1
+    uint32_t    byte_order;         //- 0x01020304, written in the byte order of the writer
+    uint32_t    element_code;       //- See element_code_v below
+    uint32_t    element_size;       //- sizeof(element_type)
+    uint32_t    rank;               //- 1 for vectors, 2 for matrices
+    uint32_t    layout;             //- 0 for row-major, 1 for column-major
+    int64_t     rows;
+    int64_t     columns;
+    int64_t     row_capacity;
+    int64_t     column_capacity;
+};
+
+static_assert(sizeof(la_file_header) == 64);
+
+inline constexpr char       la_file_magic[8]      = {'P', '1', '3', '8', '5', 'L', 'A', '\0'};
+inline constexpr uint32_t   la_file_version       = 1;
+inline constexpr uint32_t   la_file_byte_order    = 0x01020304u;
+inline constexpr int64_t    la_file_header_size   = 64;
+
+//- These traits give the code recorded in a file header for an element type.  Types not listed
+//  have code zero, and are identified by their size alone.
+//
+template<class T> struct element_code                  : public integral_constant<uint32_t, 0> {};
+template<> struct element_code<float>                  : public integral_constant<uint32_t, 1> {};
+template<> struct element_code<double>                 : public integral_constant<uint32_t, 2> {};
+template<> struct element_code<long double>            : public integral_constant<uint32_t, 3> {};
+template<> struct element_code<int8_t>                 : public integral_constant<uint32_t, 4> {};
+template<> struct element_code<int16_t>                : public integral_constant<uint32_t, 5> {};
+template<> struct element_code<int32_t>                : public integral_constant<uint32_t, 6> {};
+template<> struct element_code<int64_t>                : public integral_constant<uint32_t, 7> {};
+template<> struct element_code<uint8_t>                : public integral_constant<uint32_t, 8> {};
+template<> struct element_code<uint16_t>               : public integral_constant<uint32_t, 9> {};
+template<> struct element_code<uint32_t>               : public integral_constant<uint32_t, 10> {};
+template<> struct element_code<uint64_t>               : public integral_constant<uint32_t, 11> {};
+template<> struct element_code<complex<float>>         : public integral_constant<uint32_t, 12> {};
+template<> struct element_code<complex<double>>        : public integral_constant<uint32_t, 13> {};
+template<> struct element_code<complex<long double>>   : public integral_constant<uint32_t, 14> {};
+
+template<class T> inline constexpr
+uint32_t    element_code_v = element_code<T>::value;
+
+template<class LT> inline constexpr
+uint32_t
+file_layout_code() noexcept
+{
+    return is_same_v<LT, column_major> ? 1u : 0u;
+}
+
+template<class T, class LT>
+la_file_header
+make_file_header(int64_t rank, int64_t rows, int64_t cols, int64_t rowcap, int64_t colcap)
+{
+    la_file_header  hdr{};
+
+    std::copy(la_file_magic, la_file_magic + 8, hdr.magic);
+    hdr.version         = la_file_version;
+    hdr.byte_order      = la_file_byte_order;
+    hdr.element_code    = element_code_v<T>;
+    hdr.element_size    = static_cast<uint32_t>(sizeof(T));
+    hdr.rank            = static_cast<uint32_t>(rank);
+    hdr.layout          = file_layout_code<LT>();
+    hdr.rows            = rows;
+    hdr.columns         = cols;
+    hdr.row_capacity    = rowcap;
+    hdr.column_capacity = colcap;
+    return hdr;
+}
+
+//- Throws if a file header does not describe a valid object of rank RANK and element type T,
+//  stored in a file of the given size.
+//
+template<class T>
+void
+check_file_header(la_file_header const& hdr, int64_t rank, int64_t file_size)
+{
+    if (!std::equal(la_file_magic, la_file_magic + 8, hdr.magic))
+    {
+        throw runtime_error("not a linear algebra data file");
+    }
+    if (hdr.byte_order != la_file_byte_order)
+    {
+        throw runtime_error("data file has a different byte order");
+    }
+    if (hdr.version != la_file_version)
+    {
+        throw runtime_error("unsupported data file version");
+    }
+    if (hdr.element_size != sizeof(T)  ||  hdr.element_code != element_code_v<T>)
+    {
+        throw runtime_error("data file element type does not match");
+    }
+    if (static_cast<int64_t>(hdr.rank) != rank)
+    {
+        throw runtime_error("data file rank does not match");
+    }
+    if (hdr.layout > 1u)
+    {
+        throw runtime_error("data file has invalid layout");
+    }
+    if (hdr.rows < 0  ||  hdr.columns < 0  ||  hdr.rows > hdr.row_capacity  ||
+        hdr.columns > hdr.column_capacity)
+    {
+        throw runtime_error("data file has invalid size");
+    }
+
+
+    //- The capacities come from the file, so their product may overflow; they are checked
+    //  against the number of elements the file can hold by division instead.
+    //
+    if (file_size < la_file_header_size)
+    {
+        throw runtime_error("data file is truncated");
+    }
+
+    int64_t const   elems = (file_size - la_file_header_size) / static_cast<int64_t>(sizeof(T));
+
+    if (hdr.row_capacity > elems / max<int64_t>(hdr.column_capacity, 1))
+    {
+        throw runtime_error("data file is truncated");
+    }
+}
+
+}       //- detail namespace
+
+#ifdef LA_HAS_MMAP
+//- Modes in which a file may be mapped by mmap_matrix_engine.
+//
+enum class mmap_mode
+{
+    read_only,
+    read_write
+};
+
+//- Access-pattern hints for mmap_matrix_engine, corresponding to those of madvise().
+//
+enum class mmap_advice
+{
+    normal,
+    sequential,
+    random,
+    will_need,
+    dont_need
+};
+
+//==================================================================================================
+//  Memory-mapped, file-backed, resizable matrix engine.
+//==================================================================================================
+//
+template<class T, class LT>
+class mmap_matrix_engine
+{
+    static_assert(is_trivially_copyable_v<T>);
+    static_assert(detail::is_matrix_layout_v<LT>);
+
+  public:
+    //- Types
+    //
+    using engine_category = resizable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using layout_type     = LT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using index_type      = ptrdiff_t;
+    using index_tuple     = extents<dynamic_extent, dynamic_extent>;
+    using span_type       = basic_mdspan<T, detail::dyn_mat_extents, detail::dyn_mat_layout>;
+    using const_span_type = basic_mdspan<T const, detail::dyn_mat_extents, detail::dyn_mat_layout>;
+
+    //- Construct/copy/destroy
+    //
+    ~mmap_matrix_engine() noexcept;
+
+    mmap_matrix_engine() noexcept;
+    mmap_matrix_engine(mmap_matrix_engine&& rhs) noexcept;
+    mmap_matrix_engine(mmap_matrix_engine const&) = delete;
+    mmap_matrix_engine(index_type rows, index_type cols);
+    mmap_matrix_engine(index_type rows, index_type cols, index_type rowcap, index_type colcap);
+    mmap_matrix_engine(string const& path, mmap_mode mode);
+    mmap_matrix_engine(string const& path, index_type rows, index_type cols);
+    mmap_matrix_engine(string const& path, index_type rows, index_type cols,
+                       index_type rowcap, index_type colcap);
+
+    mmap_matrix_engine&     operator =(mmap_matrix_engine&& rhs) noexcept;
+    mmap_matrix_engine&     operator =(mmap_matrix_engine const&) = delete;
+    template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T> = true>
+    mmap_matrix_engine&     operator =(ET2 const& rhs);
+    template<class T2, detail::enable_if_convertible_element<T2,T> = true>
+    mmap_matrix_engine&     operator =(initializer_list<initializer_list<T2>> rhs);
+
+    //- Capacity
+    //
+    index_type  columns() const noexcept;
+    index_type  rows() const noexcept;
+    index_tuple size() const noexcept;
+
+    index_type  column_capacity() const noexcept;
+    index_type  row_capacity() const noexcept;
+    index_tuple capacity() const noexcept;
+
+    void        reserve(index_type rowcap, index_type colcap);
+    void        resize(index_type rows, index_type cols);
+    void        resize(index_type rows, index_type cols, index_type rowcap, index_type colcap);
+
+    //- Element access
+    //
+    reference       operator ()(index_type i, index_type j);
+    const_reference operator ()(index_type i, index_type j) const;
+
+    //- Data access
+    //
+    span_type       span() noexcept;
+    const_span_type span() const noexcept;
+
+    //- Mapping
+    //
+    bool        is_file_backed() const noexcept;
+    mmap_mode   mode() const noexcept;
+    void        advise(mmap_advice advice) const;
+    void        advise_rows(mmap_advice advice, index_type i, index_type n) const;
+    void        flush() const;
+
+    //- Modifiers
+    //
+    void    swap(mmap_matrix_engine& other) noexcept;
+    void    swap_columns(index_type c1, index_type c2) noexcept;
+    void    swap_rows(index_type r1, index_type r2) noexcept;
+    void    transpose_in_place();
+
+  private:
+    void*           mp_map;
+    size_t          m_mapsize;
+    int             m_fd;
+    mmap_mode       m_mode;
+    pointer         mp_elems;
+    index_type      m_rows;
+    index_type      m_cols;
+    index_type      m_rowcap;
+    index_type      m_colcap;
+
+    static constexpr bool   is_column_major = is_same_v<LT, column_major>;
+
+    index_type          offset(index_type i, index_type j) const noexcept;
+    detail::la_file_header*     header() const noexcept;
+    void    create(index_type rows, index_type cols, index_type rowcap, index_type colcap);
+    void    map(size_t bytes);
+    void    unmap() noexcept;
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+    template<class T2>
+    void    assign(initializer_list<initializer_list<T2>> rhs);
+    void    check_capacities(index_type rowcap, index_type colcap);
+    void    check_sizes(index_type rows, index_type cols);
+    void    reshape(index_type rows, index_type cols, index_type rowcap, index_type colcap);
+    void    update_header() noexcept;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class LT> inline
+mmap_matrix_engine<T,LT>::~mmap_matrix_engine() noexcept
+{
+    unmap();
+}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine() noexcept
+:   mp_map(nullptr)
+,   m_mapsize(0)
+,   m_fd(-1)
+,   m_mode(mmap_mode::read_write)
+,   mp_elems(nullptr)
+,   m_rows(0)
+,   m_cols(0)
+,   m_rowcap(0)
+,   m_colcap(0)
+{}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine(mmap_matrix_engine&& rhs) noexcept
+:   mmap_matrix_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine(index_type rows, index_type cols)
+:   mmap_matrix_engine()
+{
+    create(rows, cols, rows, cols);
+}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine
+(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+:   mmap_matrix_engine()
+{
+    create(rows, cols, rowcap, colcap);
+}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine(string const& path, mmap_mode mode)
+:   mmap_matrix_engine()
+{
+    m_mode = mode;
+    m_fd   = ::open(path.c_str(), (mode == mmap_mode::read_only) ? O_RDONLY : O_RDWR);
+
+    if (m_fd < 0)
+    {
+        throw runtime_error("unable to open mapped matrix file " + path);
+    }
+
+    struct stat     st;
+
+    if (::fstat(m_fd, &st) != 0  ||  st.st_size < detail::la_file_header_size)
+    {
+        unmap();
+        throw runtime_error("invalid mapped matrix file " + path);
+    }
+
+    try
+    {
+        map(static_cast<size_t>(st.st_size));
+        detail::check_file_header<T>(*header(), 2, static_cast<int64_t>(st.st_size));
+
+        if (header()->layout != detail::file_layout_code<LT>())
+        {
+            throw runtime_error("data file layout does not match");
+        }
+    }
+    catch (...)
+    {
+        unmap();
+        throw;
+    }
+
+    m_rows   = static_cast<index_type>(header()->rows);
+    m_cols   = static_cast<index_type>(header()->columns);
+    m_rowcap = static_cast<index_type>(header()->row_capacity);
+    m_colcap = static_cast<index_type>(header()->column_capacity);
+}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine(string const& path, index_type rows, index_type cols)
+:   mmap_matrix_engine(path, rows, cols, rows, cols)
+{}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>::mmap_matrix_engine
+(string const& path, index_type rows, index_type cols, index_type rowcap, index_type colcap)
+:   mmap_matrix_engine()
+{
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (m_fd < 0)
+    {
+        throw runtime_error("unable to create mapped matrix file " + path);
+    }
+
+    try
+    {
+        create(rows, cols, rowcap, colcap);
+    }
+    catch (...)
+    {
+        unmap();
+        throw;
+    }
+}
+
+template<class T, class LT>
+mmap_matrix_engine<T,LT>&
+mmap_matrix_engine<T,LT>::operator =(mmap_matrix_engine&& rhs) noexcept
+{
+    mmap_matrix_engine  tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class LT>
+template<class ET2, detail::enable_if_engine_has_convertible_element<ET2,T>> inline
+mmap_matrix_engine<T,LT>&
+mmap_matrix_engine<T,LT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+template<class T, class LT>
+template<class T2, detail::enable_if_convertible_element<T2,T>> inline
+mmap_matrix_engine<T,LT>&
+mmap_matrix_engine<T,LT>::operator =(initializer_list<initializer_list<T2>> rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_type
+mmap_matrix_engine<T,LT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_type
+mmap_matrix_engine<T,LT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_tuple
+mmap_matrix_engine<T,LT>::size() const noexcept
+{
+    return index_tuple(m_rows, m_cols);
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_type
+mmap_matrix_engine<T,LT>::column_capacity() const noexcept
+{
+    return m_colcap;
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_type
+mmap_matrix_engine<T,LT>::row_capacity() const noexcept
+{
+    return m_rowcap;
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_tuple
+mmap_matrix_engine<T,LT>::capacity() const noexcept
+{
+    return index_tuple(m_rowcap, m_colcap);
+}
+
+template<class T, class LT> inline
+void
+mmap_matrix_engine<T,LT>::reserve(index_type rowcap, index_type colcap)
+{
+    reshape(m_rows, m_cols, rowcap, colcap);
+}
+
+template<class T, class LT> inline
+void
+mmap_matrix_engine<T,LT>::resize(index_type rows, index_type cols)
+{
+    reshape(rows, cols, m_rowcap, m_colcap);
+}
+
+template<class T, class LT> inline
+void
+mmap_matrix_engine<T,LT>::resize(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+{
+    reshape(rows, cols, rowcap, colcap);
+}
+
+//----------------
+//- Element access
+//
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::reference
+mmap_matrix_engine<T,LT>::operator ()(index_type i, index_type j)
+{
+    return mp_elems[offset(i, j)];
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::const_reference
+mmap_matrix_engine<T,LT>::operator ()(index_type i, index_type j) const
+{
+    return mp_elems[offset(i, j)];
+}
+
+//-------------
+//- Data access
+//
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::span_type
+mmap_matrix_engine<T,LT>::span() noexcept
+{
+    if constexpr (is_column_major)
+        return detail::make_dyn_span(mp_elems, m_rows, m_cols, index_type(1), m_rowcap);
+    else
+        return detail::make_dyn_span(mp_elems, m_rows, m_cols, m_colcap);
+}
+
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::const_span_type
+mmap_matrix_engine<T,LT>::span() const noexcept
+{
+    if constexpr (is_column_major)
+        return detail::make_dyn_span(static_cast<T const*>(mp_elems), m_rows, m_cols, index_type(1), m_rowcap);
+    else
+        return detail::make_dyn_span(static_cast<T const*>(mp_elems), m_rows, m_cols, m_colcap);
+}
+
+//---------
+//- Mapping
+//
+template<class T, class LT> inline
+bool
+mmap_matrix_engine<T,LT>::is_file_backed() const noexcept
+{
+    return m_fd >= 0;
+}
+
+template<class T, class LT> inline
+mmap_mode
+mmap_matrix_engine<T,LT>::mode() const noexcept
+{
+    return m_mode;
+}
+
+//- Advice applies to whole pages of the mapping lying within the given rows, and never to the
+//  page holding the header.  MADV_DONTNEED discards the pages of a private mapping, so the
+//  dont_need hint is passed on only for a file opened for reading and writing, whose shared
+//  mapping is repopulated from the file; for other engines it is ignored.
+//
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::advise(mmap_advice advice) const
+{
+    advise_rows(advice, 0, m_rowcap);
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::advise_rows(mmap_advice advice, index_type i, index_type n) const
+{
+    if (mp_map == nullptr  ||  n <= 0)
+        return;
+
+    int     adv = MADV_NORMAL;
+
+    switch (advice)
+    {
+        case mmap_advice::normal:       adv = MADV_NORMAL;      break;
+        case mmap_advice::sequential:   adv = MADV_SEQUENTIAL;  break;
+        case mmap_advice::random:       adv = MADV_RANDOM;      break;
+        case mmap_advice::will_need:    adv = MADV_WILLNEED;    break;
+        case mmap_advice::dont_need:
+            if (m_fd < 0  ||  m_mode != mmap_mode::read_write)
+                return;
+            adv = MADV_DONTNEED;
+            break;
+    }
+
+    //- The rows of a row-major engine occupy a contiguous range of the file, which is narrowed
+    //  to the whole pages inside it, so that neighbouring rows are unaffected; the end of the
+    //  mapping counts as a page boundary.  For a column-major engine, every column holds part
+    //  of each row, so the hint applies to the whole mapping.
+    //
+    size_t const    page  = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t          start = static_cast<size_t>(detail::la_file_header_size);
+    size_t          end   = m_mapsize;
+
+    if constexpr (!is_column_major)
+    {
+        start += static_cast<size_t>(i * m_colcap) * sizeof(T);
+        end    = min(end, start + static_cast<size_t>(n * m_colcap) * sizeof(T));
+    }
+
+    size_t const    first = (start + page - 1) / page * page;
+    size_t const    last  = (end == m_mapsize) ? end : end / page * page;
+
+    if (first < last)
+    {
+        ::madvise(static_cast<char*>(mp_map) + first, last - first, adv);
+    }
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::flush() const
+{
+    if (m_fd >= 0  &&  m_mode == mmap_mode::read_write  &&  mp_map != nullptr)
+    {
+        if (::msync(mp_map, m_mapsize, MS_SYNC) != 0)
+        {
+            throw runtime_error("unable to flush mapped matrix file");
+        }
+    }
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::swap(mmap_matrix_engine& other) noexcept
+{
+    if (&other != this)
+    {
+        detail::la_swap(mp_map,    other.mp_map);
+        detail::la_swap(m_mapsize, other.m_mapsize);
+        detail::la_swap(m_fd,      other.m_fd);
+        detail::la_swap(m_mode,    other.m_mode);
+        detail::la_swap(mp_elems,  other.mp_elems);
+        detail::la_swap(m_rows,    other.m_rows);
+        detail::la_swap(m_cols,    other.m_cols);
+        detail::la_swap(m_rowcap,  other.m_rowcap);
+        detail::la_swap(m_colcap,  other.m_colcap);
+    }
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::swap_columns(index_type c1, index_type c2) noexcept
+{
+    if (c1 != c2)
+    {
+        for (index_type i = 0;  i < m_rows;  ++i)
+        {
+            detail::la_swap(mp_elems[offset(i, c1)], mp_elems[offset(i, c2)]);
+        }
+    }
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::swap_rows(index_type r1, index_type r2) noexcept
+{
+    if (r1 != r2)
+    {
+        for (index_type j = 0;  j < m_cols;  ++j)
+        {
+            detail::la_swap(mp_elems[offset(r1, j)], mp_elems[offset(r2, j)]);
+        }
+    }
+}
+
+//- As with dr_matrix_engine, the elements are transposed within the existing mapping, and the
+//  new extents and capacities are written to the header (of the private copy, if the mapping is
+//  read-only).
+//
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::transpose_in_place()
+{
+    index_type const    lines  = (is_column_major) ? m_cols : m_rows;
+    index_type const    length = (is_column_major) ? m_rows : m_cols;
+    index_type const    ld     = (is_column_major) ? m_rowcap : m_colcap;
+    index_type const    cap    = (is_column_major) ? m_colcap : m_rowcap;
+
+    if (lines > 0  &&  length > 0  &&
+        detail::transpose_storage_in_place(mp_elems, lines, length, ld, cap))
+    {
+        detail::la_swap(m_rowcap, m_colcap);
+    }
+    detail::la_swap(m_rows, m_cols);
+    update_header();
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class LT> inline
+typename mmap_matrix_engine<T,LT>::index_type
+mmap_matrix_engine<T,LT>::offset(index_type i, index_type j) const noexcept
+{
+    if constexpr (is_column_major)
+        return i + j*m_rowcap;
+    else
+        return i*m_colcap + j;
+}
+
+template<class T, class LT> inline
+detail::la_file_header*
+mmap_matrix_engine<T,LT>::header() const noexcept
+{
+    return static_cast<detail::la_file_header*>(mp_map);
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::create(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+{
+    check_sizes(rows, cols);
+    check_capacities(rowcap, colcap);
+
+    rowcap = max(rows, rowcap);
+    colcap = max(cols, colcap);
+
+    map(static_cast<size_t>(detail::la_file_header_size) + static_cast<size_t>(rowcap*colcap) * sizeof(T));
+    *header() = detail::make_file_header<T, LT>(2, rows, cols, rowcap, colcap);
+
+    m_rows   = rows;
+    m_cols   = cols;
+    m_rowcap = rowcap;
+    m_colcap = colcap;
+}
+
+//- Maps the first BYTES bytes of the engine's file (extending the file if necessary), or an
+//  anonymous region of that size if there is no file, replacing any current mapping.  The
+//  contents of an anonymous mapping are carried over to the new one.  New memory reads as
+//  zeros, which is the value-initialized state of the trivially-copyable element types.
+//
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::map(size_t bytes)
+{
+    void*   p_new;
+
+    if (m_fd >= 0)
+    {
+        bool const  ro = (m_mode == mmap_mode::read_only);
+
+        if (!ro)
+        {
+            struct stat     st;
+
+            if (::fstat(m_fd, &st) != 0)
+            {
+                throw runtime_error("unable to query mapped matrix file");
+            }
+            if (static_cast<size_t>(st.st_size) < bytes  &&
+                ::ftruncate(m_fd, static_cast<off_t>(bytes)) != 0)
+            {
+                throw runtime_error("unable to extend mapped matrix file");
+            }
+        }
+        if (mp_map != nullptr)
+        {
+            ::munmap(mp_map, m_mapsize);
+            mp_map = nullptr;
+        }
+        p_new = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, (ro) ? MAP_PRIVATE : MAP_SHARED, m_fd, 0);
+    }
+    else
+    {
+        p_new = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (p_new != MAP_FAILED  &&  mp_map != nullptr)
+        {
+            std::memcpy(p_new, mp_map, min(bytes, m_mapsize));
+            ::munmap(mp_map, m_mapsize);
+            mp_map = nullptr;
+        }
+    }
+
+    if (p_new == MAP_FAILED)
+    {
+        throw runtime_error("unable to map matrix storage");
+    }
+
+    mp_map    = p_new;
+    m_mapsize = bytes;
+    mp_elems  = reinterpret_cast<pointer>(static_cast<char*>(mp_map) + detail::la_file_header_size);
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::unmap() noexcept
+{
+    if (mp_map != nullptr)
+    {
+        ::munmap(mp_map, m_mapsize);
+    }
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+    }
+    mp_map    = nullptr;
+    m_mapsize = 0;
+    m_fd      = -1;
+    mp_elems  = nullptr;
+}
+
+template<class T, class LT>
+template<class ET2>
+void
+mmap_matrix_engine<T,LT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+
+    if (mp_map == nullptr)
+    {
+        create(rhs.rows(), rhs.columns(), rhs.rows(), rhs.columns());
+    }
+    else
+    {
+        reshape(rhs.rows(), rhs.columns(), m_rowcap, m_colcap);
+    }
+    detail::assign_from_matrix_engine(*this, rhs);
+}
+
+template<class T, class LT>
+template<class T2>
+void
+mmap_matrix_engine<T,LT>::assign(initializer_list<initializer_list<T2>> rhs)
+{
+    detail::check_source_init_list(rhs);
+
+    index_type  rows = static_cast<index_type>(rhs.size());
+    index_type  cols = static_cast<index_type>(rhs.begin()->size());
+
+    if (mp_map == nullptr)
+    {
+        create(rows, cols, rows, cols);
+    }
+    else
+    {
+        reshape(rows, cols, m_rowcap, m_colcap);
+    }
+    detail::assign_from_matrix_initlist(*this, rhs);
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::check_capacities(index_type rowcap, index_type colcap)
+{
+    if (rowcap < 0  || colcap < 0)
+    {
+        throw runtime_error("invalid capacity");
+    }
+}
+
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::check_sizes(index_type rows, index_type cols)
+{
+    if (rows < 1  || cols < 1)
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+//- Unlike dr_matrix_engine, this engine grows its storage in place: the file is extended and
+//  remapped, and then the surviving rows (or columns) are moved to their new positions, last
+//  first, so that no element is overwritten before it has been moved.
+//
+template<class T, class LT>
+void
+mmap_matrix_engine<T,LT>::reshape(index_type rows, index_type cols, index_type rowcap, index_type colcap)
+{
+    check_sizes(rows, cols);
+    check_capacities(rowcap, colcap);
+
+    if (mp_map == nullptr)
+    {
+        create(rows, cols, rowcap, colcap);
+        return;
+    }
+
+    if (rows > m_rowcap  ||  cols > m_colcap   ||  rowcap > m_rowcap  ||  colcap > m_colcap)
+    {
+        if (m_fd >= 0  &&  m_mode == mmap_mode::read_only)
+        {
+            throw runtime_error("capacity of a read-only mapped matrix cannot be increased");
+        }
+
+        //- As with dr_matrix_engine, the row capacity at least doubles when rows are added
+        //  beyond it, so that appending rows takes amortized constant time per row.
+        //
+        if (rows > m_rowcap)
+        {
+            rowcap = max(rowcap, 2*m_rowcap);
+        }
+        rowcap = max({rows, rowcap, m_rowcap});
+        colcap = max({cols, colcap, m_colcap});
+
+        index_type const    lines   = (is_column_major) ? min(cols, m_cols) : min(rows, m_rows);
+        index_type const    length  = (is_column_major) ? min(rows, m_rows) : min(cols, m_cols);
+        index_type const    src_ld  = (is_column_major) ? m_rowcap : m_colcap;
+        index_type const    dst_ld  = (is_column_major) ? rowcap : colcap;
+        index_type const    used    = m_rowcap*m_colcap;
+
+        map(static_cast<size_t>(detail::la_file_header_size) + static_cast<size_t>(rowcap*colcap) * sizeof(T));
+
+        if (dst_ld != src_ld)
+        {
+            for (index_type i = lines - 1;  i >= 0;  --i)
+            {
+                pointer     p_dst = mp_elems + i*dst_ld;
+
+                std::memmove(static_cast<void*>(p_dst), mp_elems + i*src_ld, static_cast<size_t>(length)*sizeof(T));
+                std::fill(p_dst + length, p_dst + dst_ld, T{});
+            }
+        }
+
+        //- As in a newly-allocated dr_matrix_engine, elements outside the surviving lines read
+        //  as T{}; the storage beyond the old capacity is already zero-filled.
+        //
+        if (lines*dst_ld < used)
+        {
+            std::fill(mp_elems + lines*dst_ld, mp_elems + used, T{});
+        }
+
+        m_rowcap = rowcap;
+        m_colcap = colcap;
+    }
+
+    m_rows = rows;
+    m_cols = cols;
+    update_header();
+}
+
+template<class T, class LT> inline
+void
+mmap_matrix_engine<T,LT>::update_header() noexcept
+{
+    header()->rows            = m_rows;
+    header()->columns         = m_cols;
+    header()->row_capacity    = m_rowcap;
+    header()->column_capacity = m_colcap;
+}
+
+#endif  //- LA_HAS_MMAP
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_MMAP_MATRIX_ENGINE_HPP_DEFINED
@@ -0,0 +1,1002 @@
+//==================================================================================================
+//  File:       multiplication_kernels.hpp
+//
+//  Summary:    This header defines the private computational kernels used by the multiplication
+//              arithmetic traits when both operands, and the result, are backed by memory that
+//              can be addressed through a span (see detail::has_direct_span_v).  The primary
+//              kernel is a cache-blocked, register-tiled matrix-matrix product (GEMM) that packs
+//              panels of its operands into contiguous buffers before handing them to a small
+//              fixed-size micro-kernel.
+//
+//              Products of small fixed-size engines (up to 4 x 4) are instead computed by fully
+//              unrolled kernels, which remain usable in constant expressions and which use SSE
+//              (float) or AVX (double) intrinsics, one register per row, at run time.
+//
+//              All other products are computed by simple loops, ordered according to the storage
+//              orders (row-major or column-major) of the operands and the result.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MULTIPLICATION_KERNELS_HPP_DEFINED
+#define LINEAR_ALGEBRA_MULTIPLICATION_KERNELS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The following define the element types for which the blocked kernels are used, and the
+//  blocking parameters of the GEMM kernel for element type T:
+//    MR x NR - the shape of the register tile computed by the micro-kernel
+//    MC x KC - the shape of a packed block of the left-hand operand (sized for the L2 cache)
+//    KC x NC - the shape of a packed panel of the right-hand operand (sized for the L3 cache)
+//
+//  The micro-kernel is written in plain C++ and relies upon the compiler to vectorize it; a
+//  4 x 8 tile of real elements is the shape that current compilers reliably keep in vector
+//  registers.  Products whose volume (rows * columns * inner) is less than min_volume are not
+//  worth the cost of packing, and are computed by the simple loops in the arithmetic traits.
+//==================================================================================================
+//
+template<class T> inline constexpr
+bool    is_gemm_element_v = is_same_v<T, float>            ||  is_same_v<T, double>  ||
+                            is_same_v<T, complex<float>>   ||  is_same_v<T, complex<double>>;
+
+template<class T>
+struct gemm_blocking
+{
+    static constexpr ptrdiff_t  mr         = 4;
+    static constexpr ptrdiff_t  nr         = is_complex_v<T> ? 4 : 8;
+    static constexpr ptrdiff_t  kc         = 2048 / static_cast<ptrdiff_t>(sizeof(T));
+    static constexpr ptrdiff_t  mc         = 24 * mr;
+    static constexpr ptrdiff_t  nc         = 512 * nr;
+    static constexpr ptrdiff_t  min_volume = 24 * 24 * 24;
+};
+
+//==================================================================================================
+//  The packing buffers.  Each thread keeps one pair of buffers per element type, which grows to
+//  the largest size requested and is then reused, so that once a thread has computed a product
+//  of a given shape, computing another of the same or smaller shape allocates no memory.
+//==================================================================================================
+//
+template<class T>
+class gemm_workspace
+{
+  public:
+    static gemm_workspace&  local();
+
+    T*      a_buffer(ptrdiff_t n);
+    T*      b_buffer(ptrdiff_t n);
+
+  private:
+    unique_ptr<T[]>     mp_abuf;
+    unique_ptr<T[]>     mp_bbuf;
+    ptrdiff_t           m_acap = 0;
+    ptrdiff_t           m_bcap = 0;
+
+    static T*   reserve(unique_ptr<T[]>& p_buf, ptrdiff_t& cap, ptrdiff_t n);
+};
+
+template<class T> inline
+gemm_workspace<T>&
+gemm_workspace<T>::local()
+{
+    static thread_local gemm_workspace  ws;
+    return ws;
+}
+
+template<class T> inline
+T*
+gemm_workspace<T>::a_buffer(ptrdiff_t n)
+{
+    return reserve(mp_abuf, m_acap, n);
+}
+
+template<class T> inline
+T*
+gemm_workspace<T>::b_buffer(ptrdiff_t n)
+{
+    return reserve(mp_bbuf, m_bcap, n);
+}
+
+template<class T>
+T*
+gemm_workspace<T>::reserve(unique_ptr<T[]>& p_buf, ptrdiff_t& cap, ptrdiff_t n)
+{
+    if (n > cap)
+    {
+        p_buf.reset(new T[static_cast<size_t>(n)]);
+        cap = n;
+    }
+    return p_buf.get();
+}
+
+//==================================================================================================
+//  Packing routines.  A block of the left-hand operand is copied into a sequence of MR-row
+//  slivers, each stored column by column; a panel of the right-hand operand is copied into a
+//  sequence of NR-column slivers, each stored row by row.  Slivers at the bottom/right edges
+//  are padded with zeros, so that the micro-kernel never has to deal with partial tiles.  When
+//  CONJ is true the elements are conjugated as they are copied, which is how the kernel
+//  multiplies by hermitian views without forming them.
+//
+//  A sliver is copied in whichever order reads its source with unit stride: an operand whose
+//  elements are adjacent along the inner dimension (a row-major A, or a column-major B, which
+//  is what a transpose or hermitian view of a row-major matrix looks like) is read one row of A,
+//  or one column of B, at a time; any other operand is read one inner index at a time.
+//==================================================================================================
+//
+template<bool CONJ, class T, class U> inline
+T
+gemm_load(U const& u)
+{
+    if constexpr (CONJ  &&  is_complex_v<U>)
+        return static_cast<T>(conj(u));
+    else
+        return static_cast<T>(u);
+}
+
+template<bool CONJ = false, class T, class U>
+void
+gemm_pack_a(ptrdiff_t m, ptrdiff_t k, U const* pa, ptrdiff_t rsa, ptrdiff_t csa, T* pbuf)
+{
+    constexpr ptrdiff_t     MR = gemm_blocking<T>::mr;
+
+    for (ptrdiff_t i0 = 0;  i0 < m;  i0 += MR, pbuf += MR*k)
+    {
+        ptrdiff_t const     mi = (m - i0 < MR) ? (m - i0) : MR;
+        U const* const      ps = pa + i0*rsa;
+
+        if (csa == 1  &&  rsa != 1)
+        {
+            for (ptrdiff_t i = 0;  i < mi;  ++i)
+            {
+                U const* const  psi = ps + i*rsa;
+
+                for (ptrdiff_t p = 0;  p < k;  ++p)
+                {
+                    pbuf[p*MR + i] = gemm_load<CONJ, T>(psi[p]);
+                }
+            }
+        }
+        else
+        {
+            for (ptrdiff_t p = 0;  p < k;  ++p)
+            {
+                for (ptrdiff_t i = 0;  i < mi;  ++i)
+                {
+                    pbuf[p*MR + i] = gemm_load<CONJ, T>(ps[i*rsa + p*csa]);
+                }
+            }
+        }
+        for (ptrdiff_t p = 0;  p < k;  ++p)
+        {
+            for (ptrdiff_t i = mi;  i < MR;  ++i)
+            {
+                pbuf[p*MR + i] = T{};
+            }
+        }
+    }
+}
+
+template<bool CONJ = false, class T, class U>
+void
+gemm_pack_b(ptrdiff_t k, ptrdiff_t n, U const* pb, ptrdiff_t rsb, ptrdiff_t csb, T* pbuf)
+{
+    constexpr ptrdiff_t     NR = gemm_blocking<T>::nr;
+
+    for (ptrdiff_t j0 = 0;  j0 < n;  j0 += NR, pbuf += NR*k)
+    {
+        ptrdiff_t const     nj = (n - j0 < NR) ? (n - j0) : NR;
+        U const* const      ps = pb + j0*csb;
+
+        if (rsb == 1  &&  csb != 1)
+        {
+            for (ptrdiff_t j = 0;  j < nj;  ++j)
+            {
+                U const* const  psj = ps + j*csb;
+
+                for (ptrdiff_t p = 0;  p < k;  ++p)
+                {
+                    pbuf[p*NR + j] = gemm_load<CONJ, T>(psj[p]);
+                }
+            }
+        }
+        else
+        {
+            for (ptrdiff_t p = 0;  p < k;  ++p)
+            {
+                for (ptrdiff_t j = 0;  j < nj;  ++j)
+                {
+                    pbuf[p*NR + j] = gemm_load<CONJ, T>(ps[p*rsb + j*csb]);
+                }
+            }
+        }
+        for (ptrdiff_t p = 0;  p < k;  ++p)
+        {
+            for (ptrdiff_t j = nj;  j < NR;  ++j)
+            {
+                pbuf[p*NR + j] = T{};
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The micro-kernel.  It computes the MR x NR product of one packed sliver of A with one packed
+//  sliver of B, holding the tile of partial sums in local storage (which the compiler is able to
+//  keep in vector registers), and then merges the valid (m x n) portion of the tile into C as
+//  C = alpha*AB + beta*C.  When beta is zero C is not read, so it may be uninitialized.
+//==================================================================================================
+//
+template<class T>
+void
+gemm_micro_kernel(ptrdiff_t k, T const* pa, T const* pb, T alpha, T beta,
+                  T* pc, ptrdiff_t rsc, ptrdiff_t csc, ptrdiff_t m, ptrdiff_t n)
+{
+    constexpr ptrdiff_t     MR = gemm_blocking<T>::mr;
+    constexpr ptrdiff_t     NR = gemm_blocking<T>::nr;
+
+    T   acc[MR][NR] = {};
+
+    if constexpr (is_complex_v<T>)
+    {
+        //- The real and imaginary parts are accumulated separately, since the library's
+        //  complex multiplication checks for infinities and NaNs, which defeats vectorization.
+        //
+        using R = typename T::value_type;
+
+        R   acc_re[MR][NR] = {};
+        R   acc_im[MR][NR] = {};
+
+        for (ptrdiff_t p = 0;  p < k;  ++p, pa += MR, pb += NR)
+        {
+            for (ptrdiff_t i = 0;  i < MR;  ++i)
+            {
+                R const     a_re = pa[i].real();
+                R const     a_im = pa[i].imag();
+
+                for (ptrdiff_t j = 0;  j < NR;  ++j)
+                {
+                    R const     b_re = pb[j].real();
+                    R const     b_im = pb[j].imag();
+
+                    acc_re[i][j] += a_re*b_re - a_im*b_im;
+                    acc_im[i][j] += a_re*b_im + a_im*b_re;
+                }
+            }
+        }
+        for (ptrdiff_t i = 0;  i < MR;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < NR;  ++j)
+            {
+                acc[i][j] = T(acc_re[i][j], acc_im[i][j]);
+            }
+        }
+    }
+    else
+    {
+        for (ptrdiff_t p = 0;  p < k;  ++p, pa += MR, pb += NR)
+        {
+            for (ptrdiff_t i = 0;  i < MR;  ++i)
+            {
+                T const     ai = pa[i];
+
+                for (ptrdiff_t j = 0;  j < NR;  ++j)
+                {
+                    acc[i][j] += ai * pb[j];
+                }
+            }
+        }
+    }
+
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        T* const    pci = pc + i*rsc;
+
+        if (beta == T{})
+        {
+            for (ptrdiff_t j = 0;  j < n;  ++j)
+            {
+                pci[j*csc] = alpha * acc[i][j];
+            }
+        }
+        else
+        {
+            for (ptrdiff_t j = 0;  j < n;  ++j)
+            {
+                pci[j*csc] = alpha * acc[i][j] + beta * pci[j*csc];
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The blocked GEMM driver, computing C = alpha*A*B + beta*C, where A is (m x k), B is (k x n),
+//  and C is (m x n).  Each operand is described by a pointer to its (0, 0) element and a pair of
+//  row/column strides, so any strided layout (including transposed ones) is acceptable; the
+//  packing step is what turns the operands into unit-stride streams for the micro-kernel.  If
+//  CONJ_A or CONJ_B is true, the elements of A or B are conjugated.
+//==================================================================================================
+//
+template<bool CONJ_A = false, bool CONJ_B = false, class T, class U1, class U2>
+void
+gemm_blocked(ptrdiff_t m, ptrdiff_t n, ptrdiff_t k, T alpha,
+             U1 const* pa, ptrdiff_t rsa, ptrdiff_t csa,
+             U2 const* pb, ptrdiff_t rsb, ptrdiff_t csb,
+             T beta, T* pc, ptrdiff_t rsc, ptrdiff_t csc)
+{
+    using blk = gemm_blocking<T>;
+
+    constexpr ptrdiff_t     MR = blk::mr;
+    constexpr ptrdiff_t     NR = blk::nr;
+
+    if (m <= 0  ||  n <= 0) return;
+
+    if (k <= 0)
+    {
+        for (ptrdiff_t i = 0;  i < m;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < n;  ++j)
+            {
+                pc[i*rsc + j*csc] = (beta == T{}) ? T{} : beta * pc[i*rsc + j*csc];
+            }
+        }
+        return;
+    }
+
+    ptrdiff_t const     kc_max = (k < blk::kc) ? k : blk::kc;
+    ptrdiff_t const     mc_max = (m < blk::mc) ? ((m + MR - 1) / MR * MR) : blk::mc;
+    ptrdiff_t const     nc_max = (n < blk::nc) ? ((n + NR - 1) / NR * NR) : blk::nc;
+
+    gemm_workspace<T>&  ws     = gemm_workspace<T>::local();
+    T* const            p_abuf = ws.a_buffer(mc_max * kc_max);
+    T* const            p_bbuf = ws.b_buffer(kc_max * nc_max);
+
+    for (ptrdiff_t jc = 0;  jc < n;  jc += blk::nc)
+    {
+        ptrdiff_t const     nc = (n - jc < blk::nc) ? (n - jc) : blk::nc;
+
+        for (ptrdiff_t pc0 = 0;  pc0 < k;  pc0 += blk::kc)
+        {
+            ptrdiff_t const     kc   = (k - pc0 < blk::kc) ? (k - pc0) : blk::kc;
+            T const             bpc  = (pc0 == 0) ? beta : T{1};
+
+            gemm_pack_b<CONJ_B>(kc, nc, pb + pc0*rsb + jc*csb, rsb, csb, p_bbuf);
+
+            for (ptrdiff_t ic = 0;  ic < m;  ic += blk::mc)
+            {
+                ptrdiff_t const     mc = (m - ic < blk::mc) ? (m - ic) : blk::mc;
+
+                gemm_pack_a<CONJ_A>(mc, kc, pa + ic*rsa + pc0*csa, rsa, csa, p_abuf);
+
+                for (ptrdiff_t jr = 0;  jr < nc;  jr += NR)
+                {
+                    ptrdiff_t const     nr = (nc - jr < NR) ? (nc - jr) : NR;
+
+                    for (ptrdiff_t ir = 0;  ir < mc;  ir += MR)
+                    {
+                        ptrdiff_t const     mr = (mc - ir < MR) ? (mc - ir) : MR;
+
+                        gemm_micro_kernel(kc, p_abuf + ir*kc, p_bbuf + jr*kc,
+                                          alpha, bpc,
+                                          pc + (ic + ir)*rsc + (jc + jr)*csc, rsc, csc, mr, nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  These helpers connect the kernels to the engine layer.  The variable template use_gemm_v
+//  reports whether the blocked kernel may be used for a product of engines ET1 and ET2 into an
+//  engine ETR; the function gemm() runs the kernel on the spans of those engines.
+//==================================================================================================
+//
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_gemm_v = has_direct_span_v<ET1>  &&  has_direct_span_v<ET2>  &&
+                     has_direct_span_v<ETR>  &&
+                     is_gemm_element_v<typename ETR::element_type>  &&
+                     is_same_v<typename ET1::element_type, typename ETR::element_type>  &&
+                     is_same_v<typename ET2::element_type, typename ETR::element_type>;
+
+template<class T> inline constexpr
+bool
+use_gemm(ptrdiff_t rows, ptrdiff_t cols, ptrdiff_t inner)
+{
+    return rows * cols * inner >= gemm_blocking<T>::min_volume;
+}
+
+template<bool CONJ_A = false, bool CONJ_B = false, class T, class SA, class SB, class SC>
+void
+gemm(T alpha, SA const& a, SB const& b, T beta, SC const& c)
+{
+    gemm_blocked<CONJ_A, CONJ_B>(static_cast<ptrdiff_t>(c.extent(0)), static_cast<ptrdiff_t>(c.extent(1)),
+                 static_cast<ptrdiff_t>(a.extent(1)), alpha,
+                 a.data(), static_cast<ptrdiff_t>(a.stride(0)), static_cast<ptrdiff_t>(a.stride(1)),
+                 b.data(), static_cast<ptrdiff_t>(b.stride(0)), static_cast<ptrdiff_t>(b.stride(1)),
+                 beta,
+                 c.data(), static_cast<ptrdiff_t>(c.stride(0)), static_cast<ptrdiff_t>(c.stride(1)));
+}
+
+//- The fused multiply-add also accepts hermitian views of span-backed engines as operands: the
+//  span of such a view is the transposed span of its referent, and the kernel conjugates the
+//  elements as it packs them.
+//
+template<class ET>
+struct is_conjugated_gemm_operand : public false_type
+{};
+
+template<class ET, class MCT>
+struct is_conjugated_gemm_operand<matrix_view_engine<ET, MCT, hermitian_view_tag>>
+:   public bool_constant<has_direct_span_v<ET>>
+{};
+
+template<class ET> inline constexpr
+bool    is_conjugated_gemm_operand_v = is_conjugated_gemm_operand<ET>::value;
+
+template<class ET> inline constexpr
+bool    is_gemm_operand_v = has_direct_span_v<ET>  ||  is_conjugated_gemm_operand_v<ET>;
+
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_gemm_update_v = is_gemm_operand_v<ET1>  &&  is_gemm_operand_v<ET2>  &&
+                            has_direct_span_v<ETR>  &&
+                            is_gemm_element_v<typename ETR::element_type>  &&
+                            is_same_v<typename ET1::element_type, typename ETR::element_type>  &&
+                            is_same_v<typename ET2::element_type, typename ETR::element_type>;
+
+//==================================================================================================
+//  Small fixed-size kernels.  The traits type fs_small_traits<ET> reports whether ET is a
+//  fixed-size engine whose extents are at most 4, and if so, what those extents are.  The
+//  variable template use_fs_small_v reports whether a product of engines ET1 and ET2 into an
+//  engine ETR may be computed by the unrolled kernels below; it also requires the extents of
+//  the result engine to match those of the product.
+//==================================================================================================
+//
+template<class ET>
+struct fs_small_traits
+{
+    static constexpr bool   value = false;
+};
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
+struct fs_small_traits<fs_matrix_engine<T, R, C, LT>>
+{
+    static constexpr bool       value = (R <= 4  &&  C <= 4);
+    static constexpr ptrdiff_t  rows  = R;
+    static constexpr ptrdiff_t  cols  = C;
+};
+
+template<class T, ptrdiff_t N>
+struct fs_small_traits<fs_vector_engine<T, N>>
+{
+    static constexpr bool       value = (N <= 4);
+    static constexpr ptrdiff_t  size  = N;
+};
+
+template<class ET1, class ET2, class ETR>
+constexpr bool
+fs_small_shapes_match()
+{
+    using tr_1 = fs_small_traits<ET1>;
+    using tr_2 = fs_small_traits<ET2>;
+    using tr_r = fs_small_traits<ETR>;
+
+    if constexpr (!tr_1::value  ||  !tr_2::value  ||  !tr_r::value)
+        return false;
+    else if constexpr (is_matrix_engine_v<ET1>  &&  is_matrix_engine_v<ET2>)
+        return tr_1::cols == tr_2::rows  &&  tr_r::rows == tr_1::rows  &&  tr_r::cols == tr_2::cols;
+    else if constexpr (is_matrix_engine_v<ET1>)
+        return tr_1::cols == tr_2::size  &&  tr_r::size == tr_1::rows;
+    else
+        return tr_1::size == tr_2::rows  &&  tr_r::size == tr_2::cols;
+}
+
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_fs_small_v = fs_small_shapes_match<ET1, ET2, ETR>();
+
+//==================================================================================================
+//  Row registers for the run-time kernels.  Traits type fs_row_pack<T> describes a vector
+//  register holding one four-element row of element type T, if the target supports one; the
+//  primary template describes the absence of such a register (width == 0).
+//==================================================================================================
+//
+template<class T>
+struct fs_row_pack
+{
+    static constexpr ptrdiff_t  width = 0;
+};
+
+#if defined(LA_SIMD_AVX512) || defined(LA_SIMD_AVX) || defined(LA_SIMD_SSE2)
+
+template<>
+struct fs_row_pack<float>
+{
+    using type = __m128;
+    static constexpr ptrdiff_t  width = 4;
+
+    static type     zero() noexcept                     { return _mm_setzero_ps(); }
+    static type     load(float const* p) noexcept       { return _mm_loadu_ps(p); }
+    static void     store(float* p, type v) noexcept    { _mm_storeu_ps(p, v); }
+    static type     broadcast(float s) noexcept         { return _mm_set1_ps(s); }
+    static type     add(type a, type b) noexcept        { return _mm_add_ps(a, b); }
+    static type     mul(type a, type b) noexcept        { return _mm_mul_ps(a, b); }
+};
+
+#endif
+
+#if defined(LA_SIMD_AVX512) || defined(LA_SIMD_AVX)
+
+template<>
+struct fs_row_pack<double>
+{
+    using type = __m256d;
+    static constexpr ptrdiff_t  width = 4;
+
+    static type     zero() noexcept                     { return _mm256_setzero_pd(); }
+    static type     load(double const* p) noexcept      { return _mm256_loadu_pd(p); }
+    static void     store(double* p, type v) noexcept   { _mm256_storeu_pd(p, v); }
+    static type     broadcast(double s) noexcept        { return _mm256_set1_pd(s); }
+    static type     add(type a, type b) noexcept        { return _mm256_add_pd(a, b); }
+    static type     mul(type a, type b) noexcept        { return _mm256_mul_pd(a, b); }
+};
+
+#endif
+
+//- The run-time kernels apply when all three engines have the same element type, that type
+//  has a row register, each row of the result is exactly one register wide, and no engine
+//  stores its elements column by column.
+//
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_fs_row_pack_v = is_same_v<typename ET1::element_type, typename ETR::element_type>  &&
+                            is_same_v<typename ET2::element_type, typename ETR::element_type>  &&
+                            fs_row_pack<typename ETR::element_type>::width == 4  &&
+                            !is_column_major_v<ET1>  &&  !is_column_major_v<ET2>  &&
+                            !is_column_major_v<ETR>;
+
+//- Computes C = A * B, where A is R x K, B is K x 4, and C is R x 4, all stored row by row.
+//  Each row of C accumulates the rows of B scaled by the elements of the corresponding row
+//  of A, in the same order as the scalar kernels, so the results of the two are identical.
+//
+template<ptrdiff_t R, ptrdiff_t K, class T>
+inline void
+fs_row_pack_mm(T const* pa, T const* pb, T* pc) noexcept
+{
+    using pack = fs_row_pack<T>;
+
+    typename pack::type     rows_b[K];
+
+    for (ptrdiff_t k = 0;  k < K;  ++k)
+    {
+        rows_b[k] = pack::load(pb + 4*k);
+    }
+
+    for (ptrdiff_t i = 0;  i < R;  ++i)
+    {
+        typename pack::type     acc = pack::zero();
+
+        for (ptrdiff_t k = 0;  k < K;  ++k)
+        {
+            acc = pack::add(acc, pack::mul(pack::broadcast(pa[i*K + k]), rows_b[k]));
+        }
+        pack::store(pc + 4*i, acc);
+    }
+}
+
+//- Computes r = A * v for a 4 x 4 float matrix A, by transposing A so that each register
+//  holds one of its columns.
+//
+#if defined(LA_SIMD_AVX512) || defined(LA_SIMD_AVX) || defined(LA_SIMD_SSE2)
+
+inline void
+fs_row_pack_mv4(float const* pa, float const* pv, float* pr) noexcept
+{
+    __m128  c0 = _mm_loadu_ps(pa);
+    __m128  c1 = _mm_loadu_ps(pa + 4);
+    __m128  c2 = _mm_loadu_ps(pa + 8);
+    __m128  c3 = _mm_loadu_ps(pa + 12);
+
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    __m128  acc = _mm_setzero_ps();
+
+    acc = _mm_add_ps(acc, _mm_mul_ps(c0, _mm_set1_ps(pv[0])));
+    acc = _mm_add_ps(acc, _mm_mul_ps(c1, _mm_set1_ps(pv[1])));
+    acc = _mm_add_ps(acc, _mm_mul_ps(c2, _mm_set1_ps(pv[2])));
+    acc = _mm_add_ps(acc, _mm_mul_ps(c3, _mm_set1_ps(pv[3])));
+    _mm_storeu_ps(pr, acc);
+}
+
+#endif
+
+//==================================================================================================
+//  The unrolled scalar kernels.  Each element of the result is an inner product computed by a
+//  fold over a compile-time index sequence, accumulating in the same order as the general loops
+//  in the multiplication traits; rows and columns of the result are likewise expanded by folds.
+//  These are used in constant expressions, and at run time when no row register applies.
+//==================================================================================================
+//
+template<ptrdiff_t I, ptrdiff_t J, class MR, class M1, class M2, ptrdiff_t... K>
+constexpr void
+fs_small_mm_element(MR& mr, M1 const& m1, M2 const& m2, integer_sequence<ptrdiff_t, K...>)
+{
+    typename MR::element_type   er{};
+
+    ((er = er + (m1(I, K) * m2(K, J))), ...);
+    mr(I, J) = er;
+}
+
+template<ptrdiff_t I, ptrdiff_t N, class MR, class M1, class M2, ptrdiff_t... J>
+constexpr void
+fs_small_mm_row(MR& mr, M1 const& m1, M2 const& m2, integer_sequence<ptrdiff_t, J...>)
+{
+    (fs_small_mm_element<I, J>(mr, m1, m2, make_integer_sequence<ptrdiff_t, N>{}), ...);
+}
+
+template<ptrdiff_t C, ptrdiff_t N, class MR, class M1, class M2, ptrdiff_t... I>
+constexpr void
+fs_small_mm_rows(MR& mr, M1 const& m1, M2 const& m2, integer_sequence<ptrdiff_t, I...>)
+{
+    (fs_small_mm_row<I, N>(mr, m1, m2, make_integer_sequence<ptrdiff_t, C>{}), ...);
+}
+
+template<class VR, class M1, class V2, ptrdiff_t N, ptrdiff_t... I>
+constexpr void
+fs_small_mv_elements(VR& vr, M1 const& m1, V2 const& v2, integer_sequence<ptrdiff_t, I...>)
+{
+    auto    element = [&]<ptrdiff_t... K>(ptrdiff_t i, integer_sequence<ptrdiff_t, K...>)
+    {
+        typename VR::element_type   er{};
+
+        ((er = er + (m1(i, K) * v2(K))), ...);
+        vr(i) = er;
+    };
+
+    (element(I, make_integer_sequence<ptrdiff_t, N>{}), ...);
+}
+
+template<class VR, class V1, class M2, ptrdiff_t N, ptrdiff_t... J>
+constexpr void
+fs_small_vm_elements(VR& vr, V1 const& v1, M2 const& m2, integer_sequence<ptrdiff_t, J...>)
+{
+    auto    element = [&]<ptrdiff_t... K>(ptrdiff_t j, integer_sequence<ptrdiff_t, K...>)
+    {
+        typename VR::element_type   er{};
+
+        ((er = er + (v1(K) * m2(K, j))), ...);
+        vr(j) = er;
+    };
+
+    (element(J, make_integer_sequence<ptrdiff_t, N>{}), ...);
+}
+
+//==================================================================================================
+//  These helpers connect the small kernels to the engine layer.  Each computes a product of
+//  two small fixed-size operands into a result object of the appropriate fixed-size type.
+//==================================================================================================
+//
+template<class MR, class M1, class M2>
+constexpr void
+fs_small_multiply_mm(MR& mr, M1 const& m1, M2 const& m2)
+{
+    using et_1 = typename M1::engine_type;
+    using et_2 = typename M2::engine_type;
+    using et_r = typename MR::engine_type;
+
+    constexpr ptrdiff_t     R = fs_small_traits<et_1>::rows;
+    constexpr ptrdiff_t     K = fs_small_traits<et_1>::cols;
+    constexpr ptrdiff_t     C = fs_small_traits<et_2>::cols;
+
+    if constexpr (C == 4  &&  use_fs_row_pack_v<et_1, et_2, et_r>)
+    {
+        if (!is_constant_evaluated())
+        {
+            fs_row_pack_mm<R, K>(m1.span().data(), m2.span().data(), mr.span().data());
+            return;
+        }
+    }
+
+    fs_small_mm_rows<C, K>(mr, m1, m2, make_integer_sequence<ptrdiff_t, R>{});
+}
+
+template<class VR, class M1, class V2>
+constexpr void
+fs_small_multiply_mv(VR& vr, M1 const& m1, V2 const& v2)
+{
+    using et_1 = typename M1::engine_type;
+
+    constexpr ptrdiff_t     R = fs_small_traits<et_1>::rows;
+    constexpr ptrdiff_t     K = fs_small_traits<et_1>::cols;
+
+#if defined(LA_SIMD_AVX512) || defined(LA_SIMD_AVX) || defined(LA_SIMD_SSE2)
+    using et_2 = typename V2::engine_type;
+    using et_r = typename VR::engine_type;
+
+    if constexpr (R == 4  &&  K == 4  &&  is_same_v<typename et_r::element_type, float>  &&
+                  use_fs_row_pack_v<et_1, et_2, et_r>)
+    {
+        if (!is_constant_evaluated())
+        {
+            fs_row_pack_mv4(m1.span().data(), v2.span().data(), vr.span().data());
+            return;
+        }
+    }
+#endif
+
+    fs_small_mv_elements<VR, M1, V2, K>(vr, m1, v2, make_integer_sequence<ptrdiff_t, R>{});
+}
+
+template<class VR, class V1, class M2>
+constexpr void
+fs_small_multiply_vm(VR& vr, V1 const& v1, M2 const& m2)
+{
+    using et_1 = typename V1::engine_type;
+    using et_2 = typename M2::engine_type;
+    using et_r = typename VR::engine_type;
+
+    constexpr ptrdiff_t     K = fs_small_traits<et_2>::rows;
+    constexpr ptrdiff_t     C = fs_small_traits<et_2>::cols;
+
+    if constexpr (C == 4  &&  use_fs_row_pack_v<et_1, et_2, et_r>)
+    {
+        if (!is_constant_evaluated())
+        {
+            fs_row_pack_mm<1, K>(v1.span().data(), m2.span().data(), vr.span().data());
+            return;
+        }
+    }
+
+    fs_small_vm_elements<VR, V1, M2, K>(vr, v1, m2, make_integer_sequence<ptrdiff_t, C>{});
+}
+
+
+//==================================================================================================
+//  Loop-ordered kernels, used for the products that are not computed by the blocked or small
+//  kernels.  The order of the loops is chosen from the storage orders of the engines (see
+//  engine_layout) so that, wherever possible, the innermost loop visits adjacent elements:
+//    inner   - R(i,j) = sum A(i,k)*B(k,j) over k;  for row-major A and column-major B
+//    rows    - R(i,:) += A(i,k)*B(k,:) for each k;  for row-major B and R
+//    columns - R(:,j) += A(:,k)*B(k,j) for each k;  for column-major A and R
+//  Each element of the result is accumulated over k in ascending order starting from a value-
+//  initialized element, whatever the loop order, so the three orders give identical results.
+//==================================================================================================
+//
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_row_update_v = is_row_major_v<ET2>  &&  is_row_major_v<ETR>;
+
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    use_column_update_v = !use_row_update_v<ET1, ET2, ETR>  &&
+                              is_column_major_v<ET1>  &&  is_column_major_v<ETR>;
+
+template<class MR, class M1, class M2>
+constexpr void
+ordered_multiply_mm(MR& mr, M1 const& m1, M2 const& m2)
+{
+    using et_1         = typename M1::engine_type;
+    using et_2         = typename M2::engine_type;
+    using et_r         = typename MR::engine_type;
+    using index_type   = typename MR::index_type;
+    using element_type = typename MR::element_type;
+
+    index_type const    rows  = static_cast<index_type>(m1.rows());
+    index_type const    cols  = static_cast<index_type>(m2.columns());
+    index_type const    inner = static_cast<index_type>(m1.columns());
+
+    if constexpr (use_row_update_v<et_1, et_2, et_r>)
+    {
+        for (index_type i = 0;  i < rows;  ++i)
+        {
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                mr(i, j) = element_type{};
+            }
+            for (index_type k = 0;  k < inner;  ++k)
+            {
+                auto const  a = m1(i, k);
+
+                for (index_type j = 0;  j < cols;  ++j)
+                {
+                    mr(i, j) = mr(i, j) + (a * m2(k, j));
+                }
+            }
+        }
+    }
+    else if constexpr (use_column_update_v<et_1, et_2, et_r>)
+    {
+        for (index_type j = 0;  j < cols;  ++j)
+        {
+            for (index_type i = 0;  i < rows;  ++i)
+            {
+                mr(i, j) = element_type{};
+            }
+            for (index_type k = 0;  k < inner;  ++k)
+            {
+                auto const  b = m2(k, j);
+
+                for (index_type i = 0;  i < rows;  ++i)
+                {
+                    mr(i, j) = mr(i, j) + (m1(i, k) * b);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (index_type i = 0;  i < rows;  ++i)
+        {
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                element_type    er{};
+
+                for (index_type k = 0;  k < inner;  ++k)
+                {
+                    er = er + (m1(i, k) * m2(k, j));
+                }
+                mr(i, j) = er;
+            }
+        }
+    }
+}
+
+//- Computes R = alpha*(M1*M2) + beta*R in place, choosing the loop order as above.  The row and
+//  column orders first scale R by beta, and then accumulate the scaled products into it; the
+//  inner order forms each inner product and then combines it with R.  When beta is zero R is
+//  not read, so it may hold anything (including NaNs) beforehand.  R must not share elements
+//  with M1 or M2.
+//
+template<class T, class MR, class M1, class M2>
+constexpr void
+ordered_multiply_add_mm(T const& alpha, M1 const& m1, M2 const& m2, T const& beta, MR& mr)
+{
+    using et_1         = typename M1::engine_type;
+    using et_2         = typename M2::engine_type;
+    using et_r         = typename MR::engine_type;
+    using index_type   = typename MR::index_type;
+    using element_type = typename MR::element_type;
+
+    index_type const    rows  = static_cast<index_type>(m1.rows());
+    index_type const    cols  = static_cast<index_type>(m2.columns());
+    index_type const    inner = static_cast<index_type>(m1.columns());
+    bool const          zero  = (beta == T{});
+
+    if constexpr (use_row_update_v<et_1, et_2, et_r>)
+    {
+        for (index_type i = 0;  i < rows;  ++i)
+        {
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                mr(i, j) = (zero) ? element_type{} : beta * mr(i, j);
+            }
+            for (index_type k = 0;  k < inner;  ++k)
+            {
+                auto const  a = alpha * m1(i, k);
+
+                for (index_type j = 0;  j < cols;  ++j)
+                {
+                    mr(i, j) = mr(i, j) + (a * m2(k, j));
+                }
+            }
+        }
+    }
+    else if constexpr (use_column_update_v<et_1, et_2, et_r>)
+    {
+        for (index_type j = 0;  j < cols;  ++j)
+        {
+            for (index_type i = 0;  i < rows;  ++i)
+            {
+                mr(i, j) = (zero) ? element_type{} : beta * mr(i, j);
+            }
+            for (index_type k = 0;  k < inner;  ++k)
+            {
+                auto const  b = alpha * m2(k, j);
+
+                for (index_type i = 0;  i < rows;  ++i)
+                {
+                    mr(i, j) = mr(i, j) + (m1(i, k) * b);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (index_type i = 0;  i < rows;  ++i)
+        {
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                element_type    er{};
+
+                for (index_type k = 0;  k < inner;  ++k)
+                {
+                    er = er + (m1(i, k) * m2(k, j));
+                }
+                mr(i, j) = (zero) ? alpha * er : alpha * er + beta * mr(i, j);
+            }
+        }
+    }
+}
+
+//- Matrix-vector products use column updates for column-major matrices, and inner products
+//  otherwise; vector-matrix products use row updates for row-major matrices, and inner
+//  products otherwise.
+//
+template<class VR, class M1, class V2>
+constexpr void
+ordered_multiply_mv(VR& vr, M1 const& m1, V2 const& v2)
+{
+    using index_type   = typename VR::index_type;
+    using element_type = typename VR::element_type;
+
+    index_type const    rows  = static_cast<index_type>(m1.rows());
+    index_type const    inner = static_cast<index_type>(m1.columns());
+
+    if constexpr (is_column_major_v<typename M1::engine_type>)
+    {
+        for (index_type i = 0;  i < rows;  ++i)
+        {
+            vr(i) = element_type{};
+        }
+        for (index_type k = 0;  k < inner;  ++k)
+        {
+            auto const  b = v2(k);
+
+            for (index_type i = 0;  i < rows;  ++i)
+            {
+                vr(i) = vr(i) + (m1(i, k) * b);
+            }
+        }
+    }
+    else
+    {
+        for (index_type i = 0;  i < rows;  ++i)
+        {
+            element_type    er{};
+
+            for (index_type k = 0;  k < inner;  ++k)
+            {
+                er = er + (m1(i, k) * v2(k));
+            }
+            vr(i) = er;
+        }
+    }
+}
+
+template<class VR, class V1, class M2>
+constexpr void
+ordered_multiply_vm(VR& vr, V1 const& v1, M2 const& m2)
+{
+    using index_type   = typename VR::index_type;
+    using element_type = typename VR::element_type;
+
+    index_type const    cols  = static_cast<index_type>(m2.columns());
+    index_type const    inner = static_cast<index_type>(m2.rows());
+
+    if constexpr (is_row_major_v<typename M2::engine_type>)
+    {
+        for (index_type j = 0;  j < cols;  ++j)
+        {
+            vr(j) = element_type{};
+        }
+        for (index_type k = 0;  k < inner;  ++k)
+        {
+            auto const  a = v1(k);
+
+            for (index_type j = 0;  j < cols;  ++j)
+            {
+                vr(j) = vr(j) + (a * m2(k, j));
+            }
+        }
+    }
+    else
+    {
+        for (index_type j = 0;  j < cols;  ++j)
+        {
+            element_type    er{};
+
+            for (index_type k = 0;  k < inner;  ++k)
+            {
+                er = er + (v1(k) * m2(k, j));
+            }
+            vr(j) = er;
+        }
+    }
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_MULTIPLICATION_KERNELS_HPP_DEFINED
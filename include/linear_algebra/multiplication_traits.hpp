@@ -249,6 +249,28 @@ struct mul_traits_chooser
 template<typename OT, typename OP1, typename OP2>
 using mul_traits_result_t = typename mul_traits_chooser<OT, OP1, OP2>::traits_type;
 
+//------------------------------------------------------------
+//- Fused multiply-add arithmetic traits type determination.  Operation traits types that do
+//  not provide nested multiply-add traits use the default traits.
+//
+template<typename OT, typename OP1, typename OP2>
+using fma_traits_f2_t = typename OT::template multiply_add_arithmetic_traits<OT, OP1, OP2>;
+
+template<typename OT, typename OP1, typename OP2, typename = void>
+struct fma_traits_chooser
+{
+    using traits_type = matrix_multiply_add_traits<OT, OP1, OP2>;
+};
+
+template<typename OT, typename OP1, typename OP2>
+struct fma_traits_chooser<OT, OP1, OP2, void_t<fma_traits_f2_t<OT, OP1, OP2>>>
+{
+    using traits_type = fma_traits_f2_t<OT, OP1, OP2>;
+};
+
+template<typename OT, typename OP1, typename OP2>
+using fma_traits_result_t = typename fma_traits_chooser<OT, OP1, OP2>::traits_type;
+
 
 }       //- detail namespace
 //==================================================================================================
@@ -295,8 +317,9 @@ struct matrix_multiplication_engine_traits
     using element_type_1 = typename ET1::element_type;
     using element_type_2 = typename ET2::element_type;
     using element_type   = select_matrix_multiplication_element_t<OT, element_type_1, element_type_2>;
+    using layout_type    = detail::result_engine_layout_t<ET1, ET2>;
     using engine_type    = conditional_t<use_matrix_engine,
-                                         dr_matrix_engine<element_type, allocator<element_type>>,
+                                         dr_matrix_engine<element_type, allocator<element_type>, layout_type>,
                                          dr_vector_engine<element_type, allocator<element_type>>>;
 };
 
@@ -363,45 +386,45 @@ struct matrix_multiplication_engine_traits<OT, scalar_engine<T1>, fs_vector_engi
 //
 //- dr_matrix_engine * scalar.
 //
-template<class OT, class T1, class A1, class T2>
+template<class OT, class T1, class A1, class L1, class T2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
+                                           dr_matrix_engine<T1, A1, L1>,
                                            scalar_engine<T2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, L1>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
                                            scalar_engine<T2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, L1>;
 };
 
 //----------------------------
 //- fs_matrix_engine * scalar.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
+                                           fs_matrix_engine<T1, R1, C1, L1>,
                                            scalar_engine<T2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R1, C1>;
+    using engine_type  = fs_matrix_engine<element_type, R1, C1, L1>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
                                            scalar_engine<T2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, C1, R1>;
+    using engine_type  = fs_matrix_engine<element_type, C1, R1, L1>;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -409,45 +432,45 @@ struct matrix_multiplication_engine_traits<OT,
 //
 //- scalar * dr_matrix_engine.
 //
-template<class OT, class T1, class T2, class A2>
+template<class OT, class T1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
                                            scalar_engine<T1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, L2>;
 };
 
-template<class OT, class T1, class T2, class A2, class MCT2>
+template<class OT, class T1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
                                            scalar_engine<T1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, L2>;
 };
 
 //----------------------------
 //- scalar * fs_matrix_engine.
 //
-template<class OT, class T1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
                                            scalar_engine<T1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R2, C2>;
+    using engine_type  = fs_matrix_engine<element_type, R2, C2, L2>;
 };
 
-template<class OT, class T1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
                                            scalar_engine<T1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, C2, R2>;
+    using engine_type  = fs_matrix_engine<element_type, C2, R2, L2>;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -456,9 +479,9 @@ struct matrix_multiplication_engine_traits<OT,
 //
 //- dr_matrix_engine * dr_vector_engine.
 //
-template<class OT, class T1, class A1, class T2, class A2>
+template<class OT, class T1, class A1, class L1, class T2, class A2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
+                                           dr_matrix_engine<T1, A1, L1>,
                                            dr_vector_engine<T2, A2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -466,9 +489,9 @@ struct matrix_multiplication_engine_traits<OT,
     using engine_type  = dr_vector_engine<element_type, alloc_type>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, class A2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, class A2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
                                            dr_vector_engine<T2, A2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -479,9 +502,9 @@ struct matrix_multiplication_engine_traits<OT,
 //--------------------------------------
 //- dr_matrix_engine * fs_vector_engine.
 //
-template<class OT, class T1, class A1, class T2, ptrdiff_t N2>
+template<class OT, class T1, class A1, class L1, class T2, ptrdiff_t N2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
+                                           dr_matrix_engine<T1, A1, L1>,
                                            fs_vector_engine<T2, N2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -489,9 +512,9 @@ struct matrix_multiplication_engine_traits<OT,
     using engine_type  = dr_vector_engine<element_type, alloc_type>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, ptrdiff_t N2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, ptrdiff_t N2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
                                            fs_vector_engine<T2, N2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -502,9 +525,9 @@ struct matrix_multiplication_engine_traits<OT,
 //--------------------------------------
 //- fs_matrix_engine * dr_vector_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, class A2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
+                                           fs_matrix_engine<T1, R1, C1, L1>,
                                            dr_vector_engine<T2, A2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -512,9 +535,9 @@ struct matrix_multiplication_engine_traits<OT,
     using engine_type  = dr_vector_engine<element_type, alloc_type>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, class A2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
                                            dr_vector_engine<T2, A2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -525,9 +548,9 @@ struct matrix_multiplication_engine_traits<OT,
 //--------------------------------------
 //- fs_matrix_engine * fs_vector_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, ptrdiff_t N2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, ptrdiff_t N2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
+                                           fs_matrix_engine<T1, R1, C1, L1>,
                                            fs_vector_engine<T2, N2>>
 {
     static_assert(C1 == N2);
@@ -535,9 +558,9 @@ struct matrix_multiplication_engine_traits<OT,
     using engine_type  = fs_vector_engine<element_type, N2>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, ptrdiff_t N2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, ptrdiff_t N2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
                                            fs_vector_engine<T2, N2>>
 {
     static_assert(R1 == N2);
@@ -552,20 +575,20 @@ struct matrix_multiplication_engine_traits<OT,
 //
 //- dr_vector_engine * dr_matrix_engine.
 //
-template<class OT, class T1, class A1, class T2, class A2>
+template<class OT, class T1, class A1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
                                            dr_vector_engine<T1, A1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
     using engine_type  = dr_vector_engine<element_type, alloc_type>;
 };
 
-template<class OT, class T1, class A1, class T2, class A2, class MCT2>
+template<class OT, class T1, class A1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
                                            dr_vector_engine<T1, A1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
@@ -575,20 +598,20 @@ struct matrix_multiplication_engine_traits<OT,
 //--------------------------------------
 //- dr_vector_engine * fs_matrix_engine.
 //
-template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
                                            dr_vector_engine<T1, A1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
     using engine_type  = dr_vector_engine<element_type, alloc_type>;
 };
 
-template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
                                            dr_vector_engine<T1, A1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
@@ -598,20 +621,20 @@ struct matrix_multiplication_engine_traits<OT,
 //--------------------------------------
 //- fs_vector_engine * dr_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t N1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t N1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
                                            fs_vector_engine<T1, N1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
     using engine_type  = dr_vector_engine<element_type, alloc_type>;
 };
 
-template<class OT, class T1, ptrdiff_t N1, class T2, class A2, class MCT2>
+template<class OT, class T1, ptrdiff_t N1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
                                            fs_vector_engine<T1, N1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
@@ -621,20 +644,20 @@ struct matrix_multiplication_engine_traits<OT,
 //--------------------------------------
 //- fs_vector_engine * fs_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t N1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, ptrdiff_t N1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
                                            fs_vector_engine<T1, N1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     static_assert(N1 == R2);
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using engine_type  = fs_vector_engine<element_type, N1>;
 };
 
-template<class OT, class T1, ptrdiff_t N1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, ptrdiff_t N1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
                                            fs_vector_engine<T1, N1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     static_assert(N1 == C2);
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
@@ -648,173 +671,173 @@ struct matrix_multiplication_engine_traits<OT,
 //
 //- dr_matrix_engine * dr_matrix_engine.
 //
-template<class OT, class T1, class A1, class T2, class A2>
+template<class OT, class T1, class A1, class L1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           dr_matrix_engine<T1, A1, L1>,
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class T2, class A2, class MCT2>
+template<class OT, class T1, class A1, class L1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           dr_matrix_engine<T1, A1, L1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, class A2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, class A2, class MCT2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
 //--------------------------------------
 //- dr_matrix_engine * fs_matrix_engine.
 //
-template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, class A1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           dr_matrix_engine<T1, A1, L1>,
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, class A1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           dr_matrix_engine<T1, A1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           dr_matrix_engine<T1, A1, L1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
 //--------------------------------------
 //- fs_matrix_engine * dr_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           fs_matrix_engine<T1, R1, C1, L1>,
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, class A2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           fs_matrix_engine<T1, R1, C1, L1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, class A2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                           dr_matrix_engine<T2, A2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                           dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, class A2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, class A2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                           matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                           matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
 //--------------------------------------
 //- fs_matrix_engine * fs_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           fs_matrix_engine<T1, R1, C1, L1>,
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     static_assert(C1 == R2);
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R1, C2>;
+    using engine_type  = fs_matrix_engine<element_type, R1, C2, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           fs_matrix_engine<T1, R1, C1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           fs_matrix_engine<T1, R1, C1, L1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     static_assert(C1 == C2);
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R1, R2>;
+    using engine_type  = fs_matrix_engine<element_type, R1, R2, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                           fs_matrix_engine<T2, R2, C2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                           fs_matrix_engine<T2, R2, C2, L2>>
 {
     static_assert(R1 == R2);
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, C1, C2>;
+    using engine_type  = fs_matrix_engine<element_type, C1, C2, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_multiplication_engine_traits<OT,
-                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                           matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                           matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     static_assert(R1 == C2);
     using element_type = select_matrix_multiplication_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, C1, R2>;
+    using engine_type  = fs_matrix_engine<element_type, C1, R2, detail::result_layout_t<L1, L2>>;
 };
 
 
@@ -856,7 +879,7 @@ matrix_multiplication_arithmetic_traits<OTR, vector<ET1, OT1>, T2>::multiply
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
     }
 
     index_type_r    ir = 0;
@@ -896,7 +919,7 @@ matrix_multiplication_arithmetic_traits<OTR, T1, vector<ET2, OT2>>::multiply
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
     }
 
     index_type_r    ir = 0;
@@ -937,7 +960,7 @@ matrix_multiplication_arithmetic_traits<OTR, matrix<ET1, OT1>, T2>::multiply
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        mr.resize(rows, cols);
+        detail::resize_for_overwrite(mr, rows, cols);
     }
 
     index_type_r    ir = 0;
@@ -984,7 +1007,7 @@ matrix_multiplication_arithmetic_traits<OTR, T1, matrix<ET2, OT2>>::multiply
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        mr.resize(rows, cols);
+        detail::resize_for_overwrite(mr, rows, cols);
     }
 
     index_type_r    ir = 0;
@@ -1063,37 +1086,27 @@ auto
 matrix_multiplication_arithmetic_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
 (matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
 {
-    using index_type_1 = typename matrix<ET1, OT1>::index_type;
-    using index_type_2 = typename vector<ET2, OT2>::index_type;
     using index_type_r = typename result_type::index_type;
-    using element_type = typename result_type::element_type;
 
     index_type_r    elems = static_cast<index_type_r>(m1.rows());
-    index_type_1    inner = static_cast<index_type_1>(m1.columns());
     result_type		vr;
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
     }
 
-    index_type_r    ir = 0;
-    index_type_1    i1 = 0;
-
-    for (;  ir < elems;  ++ir, ++i1)
+    //- Small fixed-size operands are handled by the unrolled kernels.
+    //
+    if constexpr (detail::use_fs_small_v<ET1, ET2, engine_type>)
     {
-        element_type	er{};
-        index_type_1    k1 = 0;
-        index_type_2    k2 = 0;
-
-        for (;  k1 < inner;  ++k1, ++k2)
-        {
-            er = er + (m1(i1, k1) * v2(k2));
-        }
-
-        vr(ir) = er;
+        detail::fs_small_multiply_mv(vr, m1, v2);
+        return vr;
     }
 
+    //- Otherwise, loop in the order that suits the matrix's layout.
+    //
+    detail::ordered_multiply_mv(vr, m1, v2);
     return vr;
 }
 
@@ -1115,37 +1128,27 @@ auto
 matrix_multiplication_arithmetic_traits<OTR, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
 (vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2) -> result_type
 {
-    using index_type_1 = typename vector<ET1, OT1>::index_type;
-    using index_type_2 = typename matrix<ET2, OT2>::index_type;
     using index_type_r = typename result_type::index_type;
-    using element_type = typename result_type::element_type;
 
     index_type_r    elems = static_cast<index_type_r>(m2.columns());
-    index_type_2    inner = static_cast<index_type_2>(m2.rows());
     result_type		vr;
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
     }
 
-    index_type_r    jr = 0;
-    index_type_2    j2 = 0;
-
-    for (;  jr < elems;  ++jr, ++j2)
+    //- Small fixed-size operands are handled by the unrolled kernels.
+    //
+    if constexpr (detail::use_fs_small_v<ET1, ET2, engine_type>)
     {
-        element_type	er{};
-        index_type_1    k1 = 0;
-        index_type_2    k2 = 0;
-
-        for (;  k2 < inner;  ++k1, ++k2)
-        {
-            er = er + (v1(k1) * m2(k2, j2));
-        }
-
-        vr(jr) = er;
+        detail::fs_small_multiply_vm(vr, v1, m2);
+        return vr;
     }
 
+    //- Otherwise, loop in the order that suits the matrix's layout.
+    //
+    detail::ordered_multiply_vm(vr, v1, m2);
     return vr;
 }
 
@@ -1168,7 +1171,6 @@ matrix_multiplication_arithmetic_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>
 (matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
 {
     using index_type_1 = typename matrix<ET1, OT1>::index_type;
-    using index_type_2 = typename matrix<ET2, OT2>::index_type;
     using index_type_r = typename result_type::index_type;
     using element_type = typename result_type::element_type;
 
@@ -1179,33 +1181,136 @@ matrix_multiplication_arithmetic_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        mr.resize(rows, cols);
+        detail::resize_for_overwrite(mr, rows, cols);
     }
 
-    index_type_r    ir = 0;
-    index_type_1    i1 = 0;
+    //- Small fixed-size operands are handled by the unrolled kernels.
+    //
+    if constexpr (detail::use_fs_small_v<ET1, ET2, engine_type>)
+    {
+        detail::fs_small_multiply_mm(mr, m1, m2);
+        return mr;
+    }
 
-    for (;  ir < rows;  ++ir, ++i1)
+    //- When all three engines expose their memory through a span, and the product is large
+    //  enough to be worth it, hand off to the cache-blocked kernel.  Transpose and hermitian
+    //  views are passed as the (strided) spans of their referents; the kernel's packing step
+    //  reads them along their contiguous dimension and applies any conjugation.
+    //
+    if constexpr (detail::use_gemm_update_v<ET1, ET2, engine_type>)
     {
-        index_type_r    jr = 0;
-        index_type_2    j2 = 0;
+        if (!is_constant_evaluated()  &&  detail::use_gemm<element_type>(rows, cols, inner))
+        {
+            constexpr bool  conj_1 = detail::is_conjugated_gemm_operand_v<ET1>;
+            constexpr bool  conj_2 = detail::is_conjugated_gemm_operand_v<ET2>;
 
-        for (;  jr < cols;  ++jr, ++j2)
+            detail::gemm<conj_1, conj_2>(element_type{1}, m1.engine().span(), m2.engine().span(),
+                                         element_type{}, mr.span());
+            return mr;
+        }
+    }
+
+    //- Otherwise, loop in the order that suits the layouts of the operands and the result.
+    //
+    detail::ordered_multiply_mm(mr, m1, m2);
+    return mr;
+}
+
+
+//==================================================================================================
+//                            **** FUSED MULTIPLY-ADD TRAITS ****
+//==================================================================================================
+//
+//- Alias interface to detection meta-function that extracts the multiply-add traits type.
+//
+template<class OT, class OP1, class OP2>
+using select_matrix_multiply_add_arithmetic_t = detail::fma_traits_result_t<OT, OP1, OP2>;
+
+
+//- The standard multiply-add traits type computes R = alpha*(M1*M2) + beta*R directly into the
+//  storage of R, which must be writable and of the correct size; no temporaries are created,
+//  and no memory is allocated (other than the blocked kernel's per-thread packing buffers,
+//  the first time a thread needs them).  Transpose and hermitian views are multiplied through
+//  their spans, without being materialized.
+//
+//  R may share memory with M1 or M2 (for example, A = A*B); when the operands expose their
+//  memory through spans, this is detected, and each operand overlapping R is first copied to a
+//  temporary.  Operands whose memory cannot be compared (such as those of engines without
+//  spans) must not share elements with R.
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_multiply_add_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    template<class S1, class S2, class ETR, class OTR>
+    static constexpr void   multiply_add(S1 const& alpha, matrix<ET1, OT1> const& m1,
+                                         matrix<ET2, OT2> const& m2, S2 const& beta,
+                                         matrix<ETR, OTR>& mr);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+template<class S1, class S2, class ETR, class OTR> constexpr
+void
+matrix_multiply_add_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply_add
+(S1 const& alpha, matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2, S2 const& beta,
+ matrix<ETR, OTR>& mr)
+{
+    static_assert(is_writable_engine_v<ETR>);
+
+    using element_type = typename matrix<ETR, OTR>::element_type;
+
+    if (m1.columns() != m2.rows()  ||  m1.rows() != mr.rows()  ||  m2.columns() != mr.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    //- An operand sharing memory with the result is copied, since the result is updated as the
+    //  operands are read.
+    //
+    if (!is_constant_evaluated())
+    {
+        using traits_1 = matrix_multiply_add_traits<OT, matrix<dr_matrix_engine<typename ET1::value_type>, OT1>,
+                                                    matrix<ET2, OT2>>;
+        using traits_2 = matrix_multiply_add_traits<OT, matrix<ET1, OT1>,
+                                                    matrix<dr_matrix_engine<typename ET2::value_type>, OT2>>;
+
+        if (detail::engines_may_overlap(m1.engine(), mr.engine()))
         {
-            element_type    er{};
-            index_type_1    k1 = 0;
-            index_type_2    k2 = 0;
+            matrix<dr_matrix_engine<typename ET1::value_type>, OT1> const   c1(m1);
 
-            for (k1 = 0, k2 = 0;  k1 < inner;  ++k1, ++k2)
-            {
-                er = er + (m1(i1, k1) * m2(k2, j2));
-            }
+            traits_1::multiply_add(alpha, c1, m2, beta, mr);
+            return;
+        }
+        if (detail::engines_may_overlap(m2.engine(), mr.engine()))
+        {
+            matrix<dr_matrix_engine<typename ET2::value_type>, OT2> const   c2(m2);
 
-            mr(ir, jr) = er;
+            traits_2::multiply_add(alpha, m1, c2, beta, mr);
+            return;
         }
     }
 
-    return mr;
+    element_type const  a = static_cast<element_type>(alpha);
+    element_type const  b = static_cast<element_type>(beta);
+
+    //- When all three engines expose their memory through a span, and the product is large
+    //  enough to be worth it, hand off to the cache-blocked kernel.
+    //
+    if constexpr (detail::use_gemm_update_v<ET1, ET2, ETR>)
+    {
+        if (!is_constant_evaluated()  &&
+            detail::use_gemm<element_type>(mr.rows(), mr.columns(), m1.columns()))
+        {
+            constexpr bool  conj_1 = detail::is_conjugated_gemm_operand_v<ET1>;
+            constexpr bool  conj_2 = detail::is_conjugated_gemm_operand_v<ET2>;
+
+            detail::gemm<conj_1, conj_2>(a, m1.engine().span(), m2.engine().span(), b, mr.span());
+            return;
+        }
+    }
+
+    //- Otherwise, loop in the order that suits the layouts of the operands and the result.
+    //
+    detail::ordered_multiply_add_mm(a, m1, m2, b, mr);
 }
 
 }       //- STD_LA namespace
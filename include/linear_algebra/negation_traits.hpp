@@ -292,8 +292,9 @@ struct matrix_negation_engine_traits
 {
     using element_type_1 = typename ET1::element_type;
     using element_type   = select_matrix_negation_element_t<OT, element_type_1>;
+    using layout_type    = detail::result_engine_layout_t<ET1, ET1>;
     using engine_type    = conditional_t<is_matrix_engine_v<ET1>,
-                                         dr_matrix_engine<element_type, allocator<element_type>>,
+                                         dr_matrix_engine<element_type, allocator<element_type>, layout_type>,
                                          dr_vector_engine<element_type, allocator<element_type>>>;
 };
 
@@ -335,35 +336,35 @@ struct matrix_negation_engine_traits<OT, fs_vector_engine<T1, N1>>
 //
 //- dr_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1>
-struct matrix_negation_engine_traits<OT, fs_matrix_engine<T1, R1, C1>>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1>
+struct matrix_negation_engine_traits<OT, fs_matrix_engine<T1, R1, C1, L1>>
 {
     using element_type = select_matrix_negation_element_t<OT, T1>;
-    using engine_type  = fs_matrix_engine<T1, R1, C1>;
+    using engine_type  = fs_matrix_engine<T1, R1, C1, L1>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1>
-struct matrix_negation_engine_traits<OT, matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1>
+struct matrix_negation_engine_traits<OT, matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>>
 {
     using element_type = select_matrix_negation_element_t<OT, T1>;
-    using engine_type  = fs_matrix_engine<element_type, C1, R1>;
+    using engine_type  = fs_matrix_engine<element_type, C1, R1, L1>;
 };
 
 //-------------------
 //- fs_matrix_engine.
 //
-template<class OT, class T1, class A1>
-struct matrix_negation_engine_traits<OT, dr_matrix_engine<T1, A1>>
+template<class OT, class T1, class A1, class L1>
+struct matrix_negation_engine_traits<OT, dr_matrix_engine<T1, A1, L1>>
 {
     using element_type = select_matrix_negation_element_t<OT, T1>;
-    using engine_type  = dr_matrix_engine<T1, A1>;
+    using engine_type  = dr_matrix_engine<T1, A1, L1>;
 };
 
-template<class OT, class T1, class A1, class MCT1>
-struct matrix_negation_engine_traits<OT, matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>>
+template<class OT, class T1, class A1, class L1, class MCT1>
+struct matrix_negation_engine_traits<OT, matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>>
 {
     using element_type = select_matrix_negation_element_t<OT, T1>;
-    using engine_type  = dr_matrix_engine<T1, A1>;
+    using engine_type  = dr_matrix_engine<T1, A1, L1>;
 };
 
 
@@ -400,7 +401,7 @@ matrix_negation_arithmetic_traits<OT, vector<ET1, OT1>>::negate(vector<ET1, OT1>
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
     }
 
     index_type  ir = 0;
@@ -437,7 +438,7 @@ matrix_negation_arithmetic_traits<OT, matrix<ET1, OT1>>::negate(matrix<ET1, OT1>
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        mr.resize(rows, cols);
+        detail::resize_for_overwrite(mr, rows, cols);
     }
 
     index_type  ir = 0;
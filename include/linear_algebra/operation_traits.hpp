@@ -6,7 +6,8 @@
 //
 //              Class matrix_operation_traits provides a set of nested type aliases which, in
 //              turn, provide for element promotion, engine promotion, and computation for the
-//              four basic arithmetic operations (addition, subtraction, negation, multiplication).
+//              four basic arithmetic operations (addition, subtraction, negation, multiplication),
+//              for the fused multiply-add operation, and for the compound assignment operators.
 //
 //              Class template matrix_operation_traits_selector is a customization point,
 //              which can be specialized by users, that is used by the arithmetic operators
@@ -72,6 +73,11 @@ struct matrix_operation_traits
     template<class OTR, class OP1, class OP2>
     using multiplication_arithmetic_traits = matrix_multiplication_arithmetic_traits<OTR, OP1, OP2>;
 
+    //- Fused multiply-add
+    //
+    template<class OTR, class OP1, class OP2>
+    using multiply_add_arithmetic_traits = matrix_multiply_add_traits<OTR, OP1, OP2>;
+
     //- Default arithmetic operation traits.
     //
     template<class T1, class T2>
@@ -82,6 +88,91 @@ struct matrix_operation_traits
 
     template<class OTR, class T1, class T2>
     using division_arithmetic_traits = matrix_division_arithmetic_traits<OTR, T1, T2>;
+
+    //- Compound assignment traits.
+    //
+    template<class OTR, class OP1, class OP2>
+    using compound_assignment_traits = matrix_compound_assignment_traits<OTR, OP1, OP2>;
+};
+
+//==================================================================================================
+//                             **** EXPRESSION OPERATION TRAITS ****
+//==================================================================================================
+//  Traits type that defers element-wise addition, subtraction, and scaling.  The arithmetic
+//  traits referred to here return vectors and matrices whose engines are expression views (see
+//  expression_traits.hpp); these are evaluated in a single fused loop when assigned to an owning
+//  vector or matrix.  All other operations are performed as by matrix_operation_traits.
+//==================================================================================================
+//
+struct matrix_expression_operation_traits : public matrix_operation_traits
+{
+    template<class OTR, class OP1, class OP2>
+    using addition_arithmetic_traits = matrix_expression_addition_traits<OTR, OP1, OP2>;
+
+    template<class OTR, class OP1, class OP2>
+    using subtraction_arithmetic_traits = matrix_expression_subtraction_traits<OTR, OP1, OP2>;
+
+    template<class OTR, class OP1, class OP2>
+    using multiplication_arithmetic_traits = matrix_expression_multiplication_traits<OTR, OP1, OP2>;
+
+    template<class OTR, class T1, class T2>
+    using division_arithmetic_traits = matrix_expression_division_traits<OTR, T1, T2>;
+};
+
+//==================================================================================================
+//                              **** PARALLEL OPERATION TRAITS ****
+//==================================================================================================
+//  Traits type that computes large matrix-matrix products on a shared work-stealing thread pool
+//  (see parallel_traits.hpp).  The result of a parallel product is identical to that computed
+//  by matrix_operation_traits, whatever the number of threads.  All other operations are
+//  performed as by matrix_operation_traits.
+//==================================================================================================
+//
+struct matrix_parallel_operation_traits : public matrix_operation_traits
+{
+    template<class OTR, class OP1, class OP2>
+    using multiplication_arithmetic_traits = matrix_parallel_multiplication_traits<OTR, OP1, OP2>;
+};
+
+//==================================================================================================
+//                              **** STRASSEN OPERATION TRAITS ****
+//==================================================================================================
+//  Traits type that computes large matrix-matrix products by the Strassen-Winograd recursion
+//  (see strassen_traits.hpp).  Products whose dimensions are all at least strassen_crossover
+//  are divided into quadrants; smaller products, including those at the bottom of the
+//  recursion, are computed by the blocked kernel.  A type derived from this one may redefine
+//  strassen_crossover to tune the recursion.  All other operations are performed as by
+//  matrix_operation_traits.
+//==================================================================================================
+//
+struct matrix_strassen_operation_traits : public matrix_operation_traits
+{
+    static constexpr ptrdiff_t  strassen_crossover = 1024;
+
+    template<class OTR, class OP1, class OP2>
+    using multiplication_arithmetic_traits = matrix_strassen_multiplication_traits<OTR, OP1, OP2>;
+};
+
+//==================================================================================================
+//                                **** BLAS OPERATION TRAITS ****
+//==================================================================================================
+//  Traits type that hands matrix-matrix, matrix-vector, and vector-vector products, fused
+//  multiply-adds, and the updates += and -= to an external CBLAS library (see blas_traits.hpp),
+//  when the library is built with LA_USE_CBLAS defined and the operands are span-backed engines
+//  of a BLAS element type.  All other operations, and all operations when no CBLAS library is
+//  configured, are performed as by matrix_operation_traits.
+//==================================================================================================
+//
+struct matrix_blas_operation_traits : public matrix_operation_traits
+{
+    template<class OTR, class OP1, class OP2>
+    using multiplication_arithmetic_traits = matrix_blas_multiplication_traits<OTR, OP1, OP2>;
+
+    template<class OTR, class OP1, class OP2>
+    using multiply_add_arithmetic_traits = matrix_blas_multiply_add_traits<OTR, OP1, OP2>;
+
+    template<class OTR, class OP1, class OP2>
+    using compound_assignment_traits = matrix_blas_compound_assignment_traits<OTR, OP1, OP2>;
 };
 
 //==================================================================================================
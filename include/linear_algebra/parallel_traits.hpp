@@ -0,0 +1,144 @@
+//==================================================================================================
+//  File:       parallel_traits.hpp
+//
+//  Summary:    This header defines the private parallel matrix product and the public arithmetic
+//              traits used by matrix_parallel_operation_traits to distribute large matrix products
+//              over the threads of a work-stealing pool (see thread_pool.hpp).
+//
+//              The result matrix is divided into tiles, each of which is computed independently
+//              by the cache-blocked kernel over the full inner dimension.  Since every element is
+//              produced by the same sequence of operations however the tiles are scheduled, the
+//              result is identical for any number of threads, and identical to the serial product.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_PARALLEL_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_PARALLEL_TRAITS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Tiling parameters for the parallel product.  A tile of the result is tile_rows x tile_cols;
+//  both are multiples of the micro-kernel's register tile, so that the tiles of a parallel
+//  product line up with those of the serial product.  Products whose volume is less than
+//  min_volume are not worth the cost of waking the pool.
+//==================================================================================================
+//
+template<class T>
+struct gemm_parallel_blocking
+{
+    static constexpr ptrdiff_t  tile_rows  = gemm_blocking<T>::mc;
+    static constexpr ptrdiff_t  tile_cols  = 16 * gemm_blocking<T>::nr;
+    static constexpr ptrdiff_t  min_volume = 128 * 128 * 128;
+};
+
+template<class T> inline constexpr
+bool
+use_parallel_gemm(ptrdiff_t rows, ptrdiff_t cols, ptrdiff_t inner)
+{
+    using blk = gemm_parallel_blocking<T>;
+
+    return rows * cols * inner >= blk::min_volume  &&
+           (rows > blk::tile_rows  ||  cols > blk::tile_cols);
+}
+
+//- Computes C = alpha*A*B + beta*C on the spans of three engines, one result tile per task.
+//
+template<class T, class SA, class SB, class SC>
+void
+gemm_parallel(work_stealing_pool& pool, T alpha, SA const& a, SB const& b, T beta, SC const& c)
+{
+    using blk = gemm_parallel_blocking<T>;
+
+    ptrdiff_t const     m   = static_cast<ptrdiff_t>(c.extent(0));
+    ptrdiff_t const     n   = static_cast<ptrdiff_t>(c.extent(1));
+    ptrdiff_t const     k   = static_cast<ptrdiff_t>(a.extent(1));
+    ptrdiff_t const     rsa = static_cast<ptrdiff_t>(a.stride(0));
+    ptrdiff_t const     csa = static_cast<ptrdiff_t>(a.stride(1));
+    ptrdiff_t const     rsb = static_cast<ptrdiff_t>(b.stride(0));
+    ptrdiff_t const     csb = static_cast<ptrdiff_t>(b.stride(1));
+    ptrdiff_t const     rsc = static_cast<ptrdiff_t>(c.stride(0));
+    ptrdiff_t const     csc = static_cast<ptrdiff_t>(c.stride(1));
+    ptrdiff_t const     tm  = (m + blk::tile_rows - 1) / blk::tile_rows;
+    ptrdiff_t const     tn  = (n + blk::tile_cols - 1) / blk::tile_cols;
+
+    auto    tile = [&](ptrdiff_t t)
+    {
+        ptrdiff_t const     i0 = (t / tn) * blk::tile_rows;
+        ptrdiff_t const     j0 = (t % tn) * blk::tile_cols;
+        ptrdiff_t const     mt = (m - i0 < blk::tile_rows) ? (m - i0) : blk::tile_rows;
+        ptrdiff_t const     nt = (n - j0 < blk::tile_cols) ? (n - j0) : blk::tile_cols;
+
+        gemm_blocked(mt, nt, k, alpha,
+                     a.data() + i0*rsa, rsa, csa,
+                     b.data() + j0*csb, rsb, csb,
+                     beta, c.data() + i0*rsc + j0*csc, rsc, csc);
+    };
+
+    pool.parallel_for(tm * tn, tile);
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//                          **** PARALLEL MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Only products of two matrices are parallelized; all other products are computed by the
+//  standard multiplication traits.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct matrix_parallel_multiplication_traits
+:   public matrix_multiplication_arithmetic_traits<OT, OP1, OP2>
+{};
+
+//-------------------
+//- (matrix * matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_parallel_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_arithmetic_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using engine_type = typename base_traits::engine_type;
+    using result_type = typename base_traits::result_type;
+
+    static constexpr result_type    multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_parallel_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using index_type_r = typename result_type::index_type;
+    using element_type = typename result_type::element_type;
+
+    //- When the blocked kernel applies and the product is large enough, compute the tiles of
+    //  the result on the shared pool; otherwise, fall back to the serial product.
+    //
+    if constexpr (detail::use_gemm_v<ET1, ET2, engine_type>)
+    {
+        index_type_r    rows  = static_cast<index_type_r>(m1.rows());
+        index_type_r    cols  = static_cast<index_type_r>(m2.columns());
+        ptrdiff_t       inner = static_cast<ptrdiff_t>(m1.columns());
+
+        if (!is_constant_evaluated()  &&  detail::use_parallel_gemm<element_type>(rows, cols, inner))
+        {
+            result_type     mr;
+
+            if constexpr (is_resizable_engine_v<engine_type>)
+            {
+                detail::resize_for_overwrite(mr, rows, cols);
+            }
+
+            detail::gemm_parallel(detail::work_stealing_pool::shared_pool(),
+                                  element_type{1}, m1.span(), m2.span(), element_type{}, mr.span());
+            return mr;
+        }
+    }
+
+    return base_traits::multiply(m1, m2);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_PARALLEL_TRAITS_HPP_DEFINED
@@ -784,6 +784,233 @@ make_dyn_span(T* pdata, ST rows, ST cols, ST row_stride, ST col_stride = 1u)
     return basic_mdspan<T, dyn_mat_extents, dyn_mat_layout>(pdata, mapping);
 }
 
+//------------------------------------------------------------------------------
+//- These traits are used by the computational kernels to determine whether an engine's span
+//  refers directly to memory; i.e., that element (i, j) of the engine lives at the address
+//  data() + i*stride(0) + j*stride(1).  This is true for the owning engines and for subset and
+//  transpose views of them, but not for spans with element-transforming accessors (negation),
+//  nor for hermitian views (whose span does not express the conjugation).
+//
+template<class ST>
+struct is_direct_span : public false_type
+{};
+
+template<class T, class X, class L, class TA>
+struct is_direct_span<basic_mdspan<T, X, L, accessor_basic<TA>>> : public true_type
+{};
+
+template<class ET>
+struct is_hermitian_view_engine : public false_type
+{};
+
+template<class ET, class MCT>
+struct is_hermitian_view_engine<matrix_view_engine<ET, MCT, hermitian_view_tag>> : public true_type
+{};
+
+//- A view of a hermitian view (e.g., a row or a transpose of one) shares its conjugation, so
+//  these traits report whether a hermitian view appears anywhere in a chain of views.
+//
+template<class ET>
+struct has_hermitian_view : public is_hermitian_view_engine<ET>
+{};
+
+template<class ET, class MCT, class VFT>
+struct has_hermitian_view<matrix_view_engine<ET, MCT, VFT>>
+:   public bool_constant<is_same_v<VFT, hermitian_view_tag>  ||  has_hermitian_view<ET>::value>
+{};
+
+template<class ET, class VCT, class VFT>
+struct has_hermitian_view<vector_view_engine<ET, VCT, VFT>> : public has_hermitian_view<ET>
+{};
+
+template<class ET, bool = has_span_type_v<ET>>
+struct has_direct_span : public false_type
+{};
+
+template<class ET>
+struct has_direct_span<ET, true>
+:   public bool_constant<is_direct_span<engine_const_span_t<ET>>::value  &&
+                         !has_hermitian_view<ET>::value>
+{};
+
+template<class ET> inline constexpr
+bool    has_direct_span_v = has_direct_span<ET>::value;
+
+//- These helpers report whether the elements of two engines may share memory.  Engines whose
+//  spans refer directly to memory (including hermitian views, whose spans locate the elements
+//  without expressing the conjugation) are compared by the address ranges their elements span,
+//  so that interleaved but disjoint views are reported as overlapping; other engines cannot be
+//  compared, and are reported as not overlapping.
+//
+template<class ET>
+struct has_memory_span
+:   public bool_constant<has_span_type_v<ET>  &&  is_direct_span<engine_const_span_t<ET>>::value>
+{};
+
+template<class ST>
+pair<uintptr_t, uintptr_t>
+span_address_range(ST const& s) noexcept
+{
+    uintptr_t const     first = reinterpret_cast<uintptr_t>(s.data());
+    ptrdiff_t           last  = 0;
+
+    for (size_t r = 0;  r < ST::rank();  ++r)
+    {
+        if (s.extent(r) == 0)
+            return {first, first};
+
+        last += (static_cast<ptrdiff_t>(s.extent(r)) - 1)*static_cast<ptrdiff_t>(s.stride(r));
+    }
+    return {first, first + static_cast<uintptr_t>(last + 1)*sizeof(typename ST::element_type)};
+}
+
+template<class ET1, class ET2>
+bool
+engines_may_overlap(ET1 const& e1, ET2 const& e2) noexcept
+{
+    if constexpr (has_memory_span<ET1>::value  &&  has_memory_span<ET2>::value)
+    {
+        auto const  r1 = span_address_range(e1.span());
+        auto const  r2 = span_address_range(e2.span());
+
+        return r1.first < r2.second  &&  r2.first < r1.second;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+//- Reports whether two engines share memory other than element-for-element; that is, whether
+//  updating the elements of the first in order may change elements of the second not yet read,
+//  as when a matrix is updated from its own transpose or from a shifted submatrix of itself.
+//
+template<class ET1, class ET2>
+bool
+engines_overlap_inexactly(ET1 const& e1, ET2 const& e2) noexcept
+{
+    if constexpr (has_memory_span<ET1>::value  &&  has_memory_span<ET2>::value)
+    {
+        if (!engines_may_overlap(e1, e2))
+            return false;
+
+        auto const  s1 = e1.span();
+        auto const  s2 = e2.span();
+
+        if (static_cast<void const*>(s1.data()) != static_cast<void const*>(s2.data())  ||
+            sizeof(*s1.data()) != sizeof(*s2.data())  ||  s1.rank() != s2.rank())
+        {
+            return true;
+        }
+        for (size_t r = 0;  r < s1.rank();  ++r)
+        {
+            if (s1.extent(r) != s2.extent(r)  ||
+                (s1.extent(r) > 1  &&  s1.stride(r) != s2.stride(r)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+//- This alias template is used by mdspan_matrix_engine to SFINAE in/out its constructor taking
+//  an mdspan, which must refer directly to memory holding elements of (possibly const) type T.
+//
+template<class ST, class T>
+using enable_if_adoptable_span =
+        enable_if_t<is_direct_span<ST>::value  &&  is_convertible_v<typename ST::pointer, T*>, bool>;
+
+//------------------------------------------------------------------------------
+//- These traits report the order in which a matrix engine stores its elements: row_major,
+//  column_major, or void if the engine has no fixed storage order.  Transpose views of an engine
+//  have the opposite order; subset, negation, and hermitian views have the same order.  They
+//  are used by the arithmetic traits to choose loop orders whose inner loops are unit-stride,
+//  and by the engine traits to choose the layout of a result engine.
+//
+template<class ET>
+struct engine_layout
+{
+    using type = void;
+};
+
+template<class T, class AT, class LT>
+struct engine_layout<dr_matrix_engine<T, AT, LT>>
+{
+    using type = LT;
+};
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT>
+struct engine_layout<fs_matrix_engine<T, R, C, LT>>
+{
+    using type = LT;
+};
+
+template<class T, class LT>
+struct engine_layout<mdspan_matrix_engine<T, LT>>
+{
+    using type = conditional_t<is_same_v<LT, strided>, void, LT>;
+};
+
+template<class T, class LT>
+struct engine_layout<mmap_matrix_engine<T, LT>>
+{
+    using type = LT;
+};
+
+template<class ET, class MCT, class VFT>
+struct engine_layout<matrix_view_engine<ET, MCT, VFT>>
+{
+    using type = conditional_t<is_same_v<VFT, expression_view_tag>, void,
+                               typename engine_layout<ET>::type>;
+};
+
+template<class ET, class MCT>
+struct engine_layout<matrix_view_engine<ET, MCT, transpose_view_tag>>
+{
+    using source_layout = typename engine_layout<ET>::type;
+    using type          = conditional_t<is_same_v<source_layout, row_major>, column_major,
+                          conditional_t<is_same_v<source_layout, column_major>, row_major, void>>;
+};
+
+template<class ET, class MCT>
+struct engine_layout<matrix_view_engine<ET, MCT, hermitian_view_tag>>
+:   public engine_layout<matrix_view_engine<ET, MCT, transpose_view_tag>>
+{};
+
+template<class ET>
+using engine_layout_t = typename engine_layout<ET>::type;
+
+template<class ET> inline constexpr
+bool    is_row_major_v = is_same_v<engine_layout_t<ET>, row_major>;
+
+template<class ET> inline constexpr
+bool    is_column_major_v = is_same_v<engine_layout_t<ET>, column_major>;
+
+template<class LT> inline constexpr
+bool    is_matrix_layout_v = is_same_v<LT, row_major>  ||  is_same_v<LT, column_major>;
+
+//- The layout of the engine that holds the result of an operation on engines with layouts L1
+//  and L2: column-major if both are, and row-major otherwise.
+//
+template<class L1, class L2>
+using result_layout_t = conditional_t<is_same_v<L1, column_major>  &&  is_same_v<L2, column_major>,
+                                      column_major, row_major>;
+
+//- The layout of the engine that holds the result of an operation on engines ET1 and ET2, as
+//  above; a scalar operand takes the layout of the other operand.  This is used by the general
+//  engine traits, which handle engines (such as views and adopted buffers) not covered by the
+//  specializations for the owning engines.
+//
+template<class ET1, class ET2>
+using result_engine_layout_t =
+        result_layout_t<engine_layout_t<conditional_t<is_scalar_engine_v<ET1>, ET2, ET1>>,
+                        engine_layout_t<conditional_t<is_scalar_engine_v<ET2>, ET1, ET2>>>;
+
 
 //==================================================================================================
 //  This traits type is used for choosing between three alternative traits-type parameters.  It
@@ -816,14 +1043,53 @@ struct non_void_traits_chooser<void, void, DEF>
 //==================================================================================================
 //  The following are some private helper functions for allocating/deallocating the memory used
 //  by the dynamic vector and matrix engines.  Note that in this implementation all allocated
-//  memory is default-constructed.  This means that elements lying in (currently) unused capacity
-//  are also initialized; NB: this may or may not be what happens in the final version.
+//  memory is value-initialized, unless the engine's allocator is a default_init_allocator, or
+//  allocate_for_overwrite() is used; in those cases it is default-initialized, which leaves
+//  elements of trivially-constructible types uninitialized.  Elements lying in (currently) unused
+//  capacity, including the padding of a matrix engine's leading dimension, always hold value-
+//  initialized elements: the engines reset them after such an allocation, and reset elements that
+//  leave the logical extent when it shrinks, so that growing within capacity, copying the whole
+//  buffer, and transposing in place never read indeterminate values.
 //==================================================================================================
 //
+template<class AT>
+struct is_default_init_allocator : public false_type
+{};
+
+template<class T, class A>
+struct is_default_init_allocator<default_init_allocator<T, A>> : public true_type
+{};
+
+template<class AT> inline constexpr
+bool    is_default_init_allocator_v = is_default_init_allocator<AT>::value;
+
+template<class AT> inline
+typename allocator_traits<AT>::pointer
+allocate_for_overwrite(AT& alloc, size_t n)
+{
+    auto    p_dst = allocator_traits<AT>::allocate(alloc, n);
+
+    try
+    {
+        std::uninitialized_default_construct_n(p_dst, n);
+    }
+    catch (...)
+    {
+        allocator_traits<AT>::deallocate(alloc, p_dst, n);
+        throw;
+    }
+    return p_dst;
+}
+
 template<class AT> inline
 typename allocator_traits<AT>::pointer
 allocate(AT& alloc, size_t n)
 {
+    if constexpr (is_default_init_allocator_v<AT>)
+    {
+        return allocate_for_overwrite(alloc, n);
+    }
+
     auto    p_dst = allocator_traits<AT>::allocate(alloc, n);
 
     try
@@ -867,6 +1133,85 @@ deallocate(AT& alloc, typename allocator_traits<AT>::pointer p_dst, size_t n) no
     }
 }
 
+//- This helper assigns value-initialized elements to those of strided storage P, having leading
+//  dimension LD, that lie in the first OLD_LINES lines of OLD_LENGTH elements but outside the first
+//  LINES lines of LENGTH elements.  The engines use it to maintain the invariant described above.
+//
+template<class T>
+void
+reset_storage(T* p, ptrdiff_t ld, ptrdiff_t lines, ptrdiff_t length, ptrdiff_t old_lines, ptrdiff_t old_length)
+{
+    for (ptrdiff_t i = 0;  i < old_lines;  ++i)
+    {
+        ptrdiff_t const     first = (i < lines) ? min(length, old_length) : 0;
+
+        std::fill(p + i*ld + first, p + i*ld + old_length, T{});
+    }
+}
+
+//- This helper function resizes the dynamic engine of vector or matrix object OBJ (which must be
+//  empty) to the given size, without value-initializing the elements, if the engine type supports
+//  doing so.  It is used by the arithmetic traits for result objects whose elements are all
+//  assigned immediately afterwards.
+//
+template<class OBJ, class... IDX> constexpr
+void
+resize_for_overwrite(OBJ& obj, IDX... sizes)
+{
+    using engine_type = typename OBJ::engine_type;
+
+    if constexpr (is_constructible_v<engine_type, IDX..., for_overwrite_t>)
+    {
+        obj.engine() = engine_type(sizes..., for_overwrite);
+    }
+    else
+    {
+        obj.resize(sizes...);
+    }
+}
+
+//- These helpers determine the alignment guaranteed by a dynamic engine's allocator (zero if
+//  there is no guarantee beyond that of the element type), and the padded leading dimension
+//  (column capacity) that dr_matrix_engine uses for a buffer having the given row capacity and
+//  minimum column capacity.  See aligned_allocator for a description of the padding.
+//
+template<class AT>
+struct allocator_alignment : public integral_constant<size_t, 0>
+{};
+
+template<class T, size_t ALIGN>
+struct allocator_alignment<aligned_allocator<T, ALIGN>> : public integral_constant<size_t, ALIGN>
+{};
+
+template<class T, class A>
+struct allocator_alignment<default_init_allocator<T, A>> : public allocator_alignment<A>
+{};
+
+template<class AT> inline constexpr
+size_t  allocator_alignment_v = allocator_alignment<AT>::value;
+
+template<class T, class AT, class IT> constexpr
+IT
+padded_leading_dimension(IT rowcap, IT colcap) noexcept
+{
+    constexpr size_t    align = allocator_alignment_v<AT>;
+
+    if constexpr (align == 0  ||  align % sizeof(T) != 0)
+    {
+        return colcap;
+    }
+    else
+    {
+        constexpr IT    line = static_cast<IT>(align / sizeof(T));
+        IT              ld   = (colcap + line - 1) / line * line;
+
+        if (rowcap > 1  &&  (static_cast<size_t>(ld) * sizeof(T)) % 4096 == 0)
+        {
+            ld += line;
+        }
+        return ld;
+    }
+}
 
 //- This alias template is used for rebinding std-conforming allocators in the dynamic engines.
 //
@@ -895,6 +1240,116 @@ la_swap(T& t0, T& t1) noexcept(is_nothrow_movable_v<T>)
     t1 = std::move(t2);
 }
 
+//==================================================================================================
+//  These helper functions transpose the elements of a dynamic engine in place.  The engine's
+//  storage is described as a number of lines -- rows, or columns for column-major engines -- of
+//  equal length, with ld elements between the starts of adjacent lines, in a buffer with room
+//  for cap lines.  After the call, the storage holds length lines of lines elements each.
+//
+//  If a square of order max(lines, length) fits in the buffer, the elements are exchanged across
+//  its diagonal, a block at a time; the leading dimension is unchanged, and the function returns
+//  false.  Otherwise the lines are packed together, the packed array is permuted by following the
+//  cycles of the transposition, and the result is spread out again with a leading dimension of
+//  cap; the function returns true, and the caller must exchange its row and column capacities.
+//  The cycles are tracked with one bit per element, which is the only memory allocated.
+//==================================================================================================
+//
+template<class T>
+void
+transpose_square_in_place(T* p, ptrdiff_t n, ptrdiff_t ld)
+{
+    constexpr ptrdiff_t     block = 32;
+
+    for (ptrdiff_t ib = 0;  ib < n;  ib += block)
+    {
+        ptrdiff_t const     ie = min(ib + block, n);
+
+        for (ptrdiff_t jb = ib;  jb < n;  jb += block)
+        {
+            ptrdiff_t const     je = min(jb + block, n);
+
+            for (ptrdiff_t i = ib;  i < ie;  ++i)
+            {
+                for (ptrdiff_t j = max(jb, i + 1);  j < je;  ++j)
+                {
+                    la_swap(p[i*ld + j], p[j*ld + i]);
+                }
+            }
+        }
+    }
+}
+
+template<class T>
+bool
+transpose_storage_in_place(T* p, ptrdiff_t lines, ptrdiff_t length, ptrdiff_t ld, ptrdiff_t cap)
+{
+    ptrdiff_t const     order = max(lines, length);
+
+    if (ld >= order  &&  cap >= order)
+    {
+        transpose_square_in_place(p, order, ld);
+        return false;
+    }
+
+    //- Pack the lines, so that element (i, j) is at p[i*length + j].
+    //
+    if (ld != length)
+    {
+        for (ptrdiff_t i = 1;  i < lines;  ++i)
+        {
+            std::move(p + i*ld, p + i*ld + length, p + i*length);
+        }
+    }
+
+    //- Element (i, j) belongs at p[j*lines + i]; equivalently, the element at k < n - 1 belongs
+    //  at (k * lines) mod (n - 1), and the last element stays where it is.  Each cycle of that
+    //  permutation is followed backwards from its first unvisited position.
+    //
+    ptrdiff_t const     n = lines * length;
+
+    if (n > 2)
+    {
+        ptrdiff_t const     m = n - 1;
+        std::vector<bool>   visited(static_cast<size_t>(n), false);
+
+        for (ptrdiff_t k0 = 1;  k0 < m;  ++k0)
+        {
+            if (visited[static_cast<size_t>(k0)]) continue;
+
+            T           tmp(std::move(p[k0]));
+            ptrdiff_t   k = k0;
+
+            for (;;)
+            {
+                ptrdiff_t const     src = static_cast<ptrdiff_t>((static_cast<size_t>(k) * static_cast<size_t>(length))
+                                                                 % static_cast<size_t>(m));
+
+                visited[static_cast<size_t>(k)] = true;
+
+                if (src == k0) break;
+
+                p[k] = std::move(p[src]);
+                k    = src;
+            }
+            p[k] = std::move(tmp);
+        }
+    }
+
+    //- Spread the new lines (of which there are length) out to a leading dimension of cap,
+    //  and reset the elements between and after them, as in newly-allocated storage.
+    //
+    if (cap != lines)
+    {
+        for (ptrdiff_t i = length - 1;  i > 0;  --i)
+        {
+            std::move_backward(p + i*lines, p + i*lines + lines, p + i*cap + lines);
+            std::fill(p + (i - 1)*cap + lines, p + i*cap, T{});
+        }
+    }
+    std::fill(p + (length - 1)*cap + lines, p + ld*cap, T{});
+    return true;
+}
+
 
 //==================================================================================================
 //  These helper functions are used inside engine member functions to validate a source engine
@@ -995,6 +1450,14 @@ assign_from_vector_engine(ET1& dst, ET2 const& src)
     }
 }
 
+//- When the source and destination are both backed by spans, and the source is contiguous
+//  along the dimension in which the destination is strided (as when a transpose view of an
+//  engine is materialized in an engine of the same layout), the elements are copied by the
+//  blocked kernel in transpose_kernels.hpp, rather than by the simple loops.
+//
+template<class T, class U>
+struct transpose_kernel;
+
 template<class ET1, class ET2> constexpr
 void
 assign_from_matrix_engine(ET1& dst, ET2 const& src)
@@ -1008,14 +1471,55 @@ assign_from_matrix_engine(ET1& dst, ET2 const& src)
     index_type_src  rows = src.rows();
     index_type_src  cols = src.columns();
 
-    for (; si < rows;  ++di, ++si)
+    if constexpr (has_direct_span_v<ET1>  &&  has_direct_span_v<ET2>)
+    {
+        if (!is_constant_evaluated())
+        {
+            auto const  sd = dst.span();
+            auto const  ss = src.span();
+
+            ptrdiff_t const     rsd = static_cast<ptrdiff_t>(sd.stride(0));
+            ptrdiff_t const     csd = static_cast<ptrdiff_t>(sd.stride(1));
+            ptrdiff_t const     rss = static_cast<ptrdiff_t>(ss.stride(0));
+            ptrdiff_t const     css = static_cast<ptrdiff_t>(ss.stride(1));
+
+            if ((rss == 1  &&  csd == 1  &&  css != 1)  ||  (css == 1  &&  rsd == 1  &&  rss != 1))
+            {
+                using kernel_type = transpose_kernel<elem_type_dst, typename ET2::element_type>;
+
+                kernel_type::copy(static_cast<ptrdiff_t>(rows), static_cast<ptrdiff_t>(cols),
+                                  ss.data(), rss, css, sd.data(), rsd, csd);
+                return;
+            }
+        }
+    }
+
+    //- Column-major destinations are filled a column at a time.
+    //
+    if constexpr (is_column_major_v<ET1>)
     {
         index_type_dst  dj = 0;
         index_type_src  sj = 0;
 
         for (; sj < cols;  ++dj, ++sj)
         {
-            dst(di, dj) = static_cast<elem_type_dst>(src(si, sj));
+            for (di = 0, si = 0;  si < rows;  ++di, ++si)
+            {
+                dst(di, dj) = static_cast<elem_type_dst>(src(si, sj));
+            }
+        }
+    }
+    else
+    {
+        for (; si < rows;  ++di, ++si)
+        {
+            index_type_dst  dj = 0;
+            index_type_src  sj = 0;
+
+            for (; sj < cols;  ++dj, ++sj)
+            {
+                dst(di, dj) = static_cast<elem_type_dst>(src(si, sj));
+            }
         }
     }
 }
@@ -12,12 +12,14 @@
 namespace STD_LA {
 //- This trivial class template is used to represent the presence of a scalar operand in an
 //  expression.  It is part of the public interface so that users wishing to create customized
-//  arithmetic operation traits can easily detect when an operand is a scalar.
+//  arithmetic operation traits can easily detect when an operand is a scalar.  Its element type
+//  is the type of the scalar, so that the general engine traits can promote it.
 //
 template<class T>
 struct scalar_engine
 {
     using engine_category = scalar_engine_tag;
+    using element_type    = T;
 };
 
 
@@ -72,5 +74,97 @@ template<class ET1, class ET2> inline constexpr
 bool    engines_are_similar_v = detail::engines_match_v<ET1, ET2>;
 
 
+//- This allocator adaptor is an opt-in allocation policy for the dynamically-resizable engines.
+//  Elements allocated by an engine using it are default-initialized rather than value-initialized,
+//  so that elements of trivially-constructible types (float, double, etc.) are left uninitialized
+//  instead of being zeroed.  Note that this applies to every allocation the engine performs,
+//  including those made by resize() and reserve().
+//
+template<class T, class A>
+class default_init_allocator : public A
+{
+    using base_traits = allocator_traits<A>;
+
+  public:
+    template<class U>
+    struct rebind
+    {
+        using other = default_init_allocator<U, typename base_traits::template rebind_alloc<U>>;
+    };
+
+    using A::A;
+
+    default_init_allocator() = default;
+
+    template<class U, class B>
+    default_init_allocator(default_init_allocator<U, B> const& other) noexcept
+    :   A(static_cast<B const&>(other))
+    {}
+
+    template<class U>
+    void    construct(U* p) noexcept(is_nothrow_default_constructible_v<U>)
+            {
+                ::new (static_cast<void*>(p)) U;
+            }
+
+    template<class U, class... ARGS>
+    void    construct(U* p, ARGS&&... args)
+            {
+                base_traits::construct(static_cast<A&>(*this), p, std::forward<ARGS>(args)...);
+            }
+};
+
+//- This allocator is an opt-in storage policy for the dynamically-resizable engines.  The memory
+//  it allocates is aligned to ALIGN bytes (by default, one cache line).  In addition, an engine
+//  of type dr_matrix_engine using it rounds its column capacity (i.e., its leading dimension) up
+//  to a multiple of ALIGN bytes, so that every row begins on an aligned boundary, and pads the
+//  column capacity by a further ALIGN bytes whenever a row would otherwise occupy a multiple of
+//  4096 bytes, so that successive rows do not alias in the cache.  It may be combined with
+//  default_init_allocator, as in default_init_allocator<T, aligned_allocator<T>>.
+//
+template<class T, size_t ALIGN>
+class aligned_allocator
+{
+    static_assert((ALIGN & (ALIGN - 1)) == 0  &&  ALIGN >= alignof(T));
+
+  public:
+    using value_type = T;
+
+    static constexpr size_t     alignment = ALIGN;
+
+    template<class U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, ALIGN>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template<class U>
+    aligned_allocator(aligned_allocator<U, ALIGN> const&) noexcept
+    {}
+
+    T*      allocate(size_t n)
+            {
+                if (n > static_cast<size_t>(-1) / sizeof(T))
+                {
+                    throw bad_array_new_length();
+                }
+                return static_cast<T*>(::operator new(n * sizeof(T), align_val_t(ALIGN)));
+            }
+
+    void    deallocate(T* p, size_t) noexcept
+            {
+                ::operator delete(p, align_val_t(ALIGN));
+            }
+
+    template<class U>
+    friend bool     operator ==(aligned_allocator const&, aligned_allocator<U, ALIGN> const&) noexcept
+                    {
+                        return true;
+                    }
+};
+
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_PUBLIC_SUPPORT_HPP_DEFINED
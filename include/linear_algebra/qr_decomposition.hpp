@@ -0,0 +1,690 @@
+//==================================================================================================
+//  File:       qr_decomposition.hpp
+//
+//  Summary:    This header defines the Householder QR factorization, the extraction of its
+//              economy-size Q and R factors, and the least-squares solver built upon it.
+//
+//              The factorization overwrites its (m x n) operand with R (on and above the
+//              diagonal) and with the Householder vectors v(j) (below the diagonal, each having an
+//              implied unit leading element), and returns the scalar factors tau(j), such that
+//              Q = H(0)*H(1)*...*H(k-1), where H(j) = I - tau(j)*v(j)*v(j)^H and k = min(m, n).
+//
+//              It is computed by a blocked algorithm.  Each panel of columns is a submatrix view
+//              of the operand, which is factored by simple loops; the reflectors of the panel
+//              are then accumulated in the compact WY form H(k0)*...*H(k1-1) = I - V*T*V^H, and
+//              applied to the trailing columns by two products with the blocked GEMM kernel.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_QR_DECOMPOSITION_HPP_DEFINED
+#define LINEAR_ALGEBRA_QR_DECOMPOSITION_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The types of the objects created from a QR factorization of an (R x C) operand having engine
+//  ET, where K = min(R, C): the vector of reflector factors (K), the economy-size Q (R x K) and R
+//  (K x C), and the solutions of least-squares problems having a vector (C) or an (R x N) matrix
+//  right-hand side with engine ETB (C x N).  Fixed-size operands give rise to fixed-size results.
+//==================================================================================================
+//
+template<class ET, class OT>
+struct qr_types : public decomposition_types<ET, OT>
+{
+    using base_type      = decomposition_types<ET, OT>;
+    using value_type     = typename base_type::value_type;
+    using reflector_type = typename base_type::vector_type;
+    using q_type         = typename base_type::matrix_type;
+    using r_type         = typename base_type::matrix_type;
+    using solution_type  = typename base_type::vector_type;
+
+    template<class ETB>
+    using solutions_type = matrix<dr_matrix_engine<value_type, allocator<value_type>,
+                                                   typename decomposition_types<ETB, OT>::layout_type>, OT>;
+
+    static constexpr reflector_type     make_reflectors(ptrdiff_t k)        { return reflector_type(k); }
+    static constexpr q_type             make_q(ptrdiff_t m, ptrdiff_t k)    { return q_type(m, k); }
+    static constexpr r_type             make_r(ptrdiff_t k, ptrdiff_t n)    { return r_type(k, n); }
+    static constexpr solution_type      make_solution(ptrdiff_t n)          { return solution_type(n); }
+
+    template<class ETB>
+    static constexpr solutions_type<ETB>
+    make_solutions(ptrdiff_t n, ptrdiff_t k)
+    {
+        return solutions_type<ETB>(n, k);
+    }
+};
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT, class OT>
+struct qr_types<fs_matrix_engine<T, R, C, LT>, OT>
+:   public decomposition_types<fs_matrix_engine<T, R, C, LT>, OT>
+{
+    static constexpr ptrdiff_t  K = (R < C) ? R : C;
+
+    using value_type     = T;
+    using reflector_type = vector<fs_vector_engine<T, K>, OT>;
+    using q_type         = matrix<fs_matrix_engine<T, R, K, LT>, OT>;
+    using r_type         = matrix<fs_matrix_engine<T, K, C, LT>, OT>;
+    using solution_type  = vector<fs_vector_engine<T, C>, OT>;
+
+    template<class ETB>
+    struct solutions
+    {
+        using type = matrix<dr_matrix_engine<T, allocator<T>,
+                                             typename decomposition_types<ETB, OT>::layout_type>, OT>;
+    };
+
+    template<class U, ptrdiff_t N, class LB>
+    struct solutions<fs_matrix_engine<U, R, N, LB>>
+    {
+        using type = matrix<fs_matrix_engine<T, C, N, LB>, OT>;
+    };
+
+    template<class ETB>
+    using solutions_type = typename solutions<ETB>::type;
+
+    static constexpr reflector_type     make_reflectors(ptrdiff_t)          { return reflector_type(); }
+    static constexpr q_type             make_q(ptrdiff_t, ptrdiff_t)        { return q_type(); }
+    static constexpr r_type             make_r(ptrdiff_t, ptrdiff_t)        { return r_type(); }
+    static constexpr solution_type      make_solution(ptrdiff_t)            { return solution_type(); }
+
+    template<class ETB>
+    static constexpr solutions_type<ETB>
+    make_solutions(ptrdiff_t n, ptrdiff_t k)
+    {
+        if constexpr (is_resizable_engine_v<typename solutions_type<ETB>::engine_type>)
+            return solutions_type<ETB>(n, k);
+        else
+            return solutions_type<ETB>();
+    }
+};
+
+//==================================================================================================
+//  The unblocked kernel.  Function qr_panel() factors the first np columns of the (mp x ue)
+//  matrix whose elements are addressed by S, applying each reflector H(j)^H to columns (j, ue)
+//  as it is generated, and storing tau(j) in element t0 + j of TAU.  A reflector is chosen so
+//  that the diagonal element of R is real; if the column is already zero below a real diagonal
+//  element, H(j) is the identity and tau(j) is zero.  If COL_MAJOR is true, the reflector is
+//  applied column by column; otherwise it is applied by sweeps over the rows, using a work row.
+//==================================================================================================
+//
+template<bool COL_MAJOR, class S, class TAU>
+void
+qr_panel(S& s, ptrdiff_t mp, ptrdiff_t np, ptrdiff_t ue, TAU& tau, ptrdiff_t t0)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+    using real_type  = element_real_t<value_type>;
+
+    std::vector<value_type>     work(COL_MAJOR ? 0 : static_cast<size_t>(ue));
+
+    for (ptrdiff_t j = 0;  j < np;  ++j)
+    {
+        value_type const    alpha = s(j, j);
+        real_type           xnorm = real_type{};
+
+        for (ptrdiff_t i = j + 1;  i < mp;  ++i)
+        {
+            xnorm = xnorm + element_norm(s(i, j));
+        }
+
+        if (xnorm == real_type{}  &&  element_norm(alpha - value_type(element_real(alpha))) == real_type{})
+        {
+            tau(t0 + j) = value_type{};
+            continue;
+        }
+
+        using std::sqrt;
+        real_type const     mag  = sqrt(element_norm(alpha) + xnorm);
+        real_type const     beta = (element_real(alpha) < real_type{}) ? mag : -mag;
+        value_type const    tj   = (value_type(beta) - alpha) / beta;
+        value_type const    scl  = value_type{1} / (alpha - value_type(beta));
+
+        for (ptrdiff_t i = j + 1;  i < mp;  ++i)
+        {
+            s(i, j) = s(i, j) * scl;
+        }
+        s(j, j)     = value_type(beta);
+        tau(t0 + j) = tj;
+
+        //- Apply H(j)^H = I - conj(tau)*v*v^H to the columns to the right.
+        //
+        value_type const    ctj = element_conj(tj);
+
+        if constexpr (COL_MAJOR)
+        {
+            for (ptrdiff_t c = j + 1;  c < ue;  ++c)
+            {
+                value_type  w = s(j, c);
+
+                for (ptrdiff_t i = j + 1;  i < mp;  ++i)
+                {
+                    w = w + element_conj(s(i, j)) * s(i, c);
+                }
+                w = ctj * w;
+                s(j, c) = s(j, c) - w;
+
+                for (ptrdiff_t i = j + 1;  i < mp;  ++i)
+                {
+                    s(i, c) = s(i, c) - s(i, j) * w;
+                }
+            }
+        }
+        else
+        {
+            for (ptrdiff_t c = j + 1;  c < ue;  ++c)
+            {
+                work[c] = s(j, c);
+            }
+            for (ptrdiff_t i = j + 1;  i < mp;  ++i)
+            {
+                value_type const    vi = element_conj(s(i, j));
+
+                for (ptrdiff_t c = j + 1;  c < ue;  ++c)
+                {
+                    work[c] = work[c] + vi * s(i, c);
+                }
+            }
+            for (ptrdiff_t c = j + 1;  c < ue;  ++c)
+            {
+                work[c]  = ctj * work[c];
+                s(j, c) = s(j, c) - work[c];
+            }
+            for (ptrdiff_t i = j + 1;  i < mp;  ++i)
+            {
+                value_type const    vi = s(i, j);
+
+                for (ptrdiff_t c = j + 1;  c < ue;  ++c)
+                {
+                    s(i, c) = s(i, c) - vi * work[c];
+                }
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The compact WY kernels.  Function qr_form_t() computes the (kb x kb) upper triangular factor
+//  T of the block reflector I - V*T*V^H = H(0)*...*H(kb-1) formed from the reflectors stored in
+//  the (mp x kb) panel S, storing it row by row in PT.  Function qr_apply_block() applies the
+//  conjugate transpose of that block reflector (if ADJOINT is true) or the block reflector itself
+//  (if it is false) to the (mp x n2) matrix C at PC, as
+//      W = V^H*C;  W = T^H*W (or T*W);  C = C - V*W
+//  where the products with the rectangular part of V (rows kb and beyond) are computed by the
+//  GEMM kernel, and those with its unit lower triangular top by simple loops.  PW points to a
+//  work area of kb*n2 elements.
+//==================================================================================================
+//
+template<class S, class TAU, class T>
+void
+qr_form_t(S& s, ptrdiff_t mp, ptrdiff_t kb, TAU const& tau, ptrdiff_t t0, T* pt)
+{
+    for (ptrdiff_t j = 0;  j < kb;  ++j)
+    {
+        T const     tj = tau(t0 + j);
+
+        pt[j*kb + j] = tj;
+
+        for (ptrdiff_t i = 0;  i < j;  ++i)
+        {
+            T   vv = element_conj(s(j, i));
+
+            for (ptrdiff_t r = j + 1;  r < mp;  ++r)
+            {
+                vv += element_conj(s(r, i)) * s(r, j);
+            }
+            pt[i*kb + j] = -tj * vv;
+        }
+        for (ptrdiff_t i = 0;  i < j;  ++i)
+        {
+            T   ti = T{};
+
+            for (ptrdiff_t l = i;  l < j;  ++l)
+            {
+                ti += pt[i*kb + l] * pt[l*kb + j];
+            }
+            pt[i*kb + j] = ti;
+        }
+    }
+}
+
+template<bool ADJOINT, class T>
+void
+qr_apply_block(ptrdiff_t mp, ptrdiff_t kb, ptrdiff_t n2,
+               T const* pv, ptrdiff_t rsv, ptrdiff_t csv, T const* pt,
+               T* pc, ptrdiff_t rsc, ptrdiff_t csc, T* pw)
+{
+    //- W = V1^H * C1 + V2^H * C2
+    //
+    for (ptrdiff_t i = 0;  i < kb;  ++i)
+    {
+        for (ptrdiff_t c = 0;  c < n2;  ++c)
+        {
+            pw[i*n2 + c] = pc[i*rsc + c*csc];
+        }
+        for (ptrdiff_t r = i + 1;  r < kb;  ++r)
+        {
+            T const     vri = element_conj(pv[r*rsv + i*csv]);
+
+            for (ptrdiff_t c = 0;  c < n2;  ++c)
+            {
+                pw[i*n2 + c] += vri * pc[r*rsc + c*csc];
+            }
+        }
+    }
+    if (mp > kb)
+    {
+        gemm_blocked<is_complex_v<T>, false>(kb, n2, mp - kb, T{1},
+                                             pv + kb*rsv, csv, rsv,
+                                             pc + kb*rsc, rsc, csc,
+                                             T{1}, pw, n2, 1);
+    }
+
+    //- W = T^H * W, from the bottom row up, or W = T * W, from the top row down, so that each
+    //  row is computed from unchanged rows.
+    //
+    if constexpr (ADJOINT)
+    {
+        for (ptrdiff_t i = kb - 1;  i >= 0;  --i)
+        {
+            T const     tii = element_conj(pt[i*kb + i]);
+
+            for (ptrdiff_t c = 0;  c < n2;  ++c)
+            {
+                pw[i*n2 + c] *= tii;
+            }
+            for (ptrdiff_t l = 0;  l < i;  ++l)
+            {
+                T const     tli = element_conj(pt[l*kb + i]);
+
+                for (ptrdiff_t c = 0;  c < n2;  ++c)
+                {
+                    pw[i*n2 + c] += tli * pw[l*n2 + c];
+                }
+            }
+        }
+    }
+    else
+    {
+        for (ptrdiff_t i = 0;  i < kb;  ++i)
+        {
+            T const     tii = pt[i*kb + i];
+
+            for (ptrdiff_t c = 0;  c < n2;  ++c)
+            {
+                pw[i*n2 + c] *= tii;
+            }
+            for (ptrdiff_t l = i + 1;  l < kb;  ++l)
+            {
+                T const     til = pt[i*kb + l];
+
+                for (ptrdiff_t c = 0;  c < n2;  ++c)
+                {
+                    pw[i*n2 + c] += til * pw[l*n2 + c];
+                }
+            }
+        }
+    }
+
+    //- C2 = C2 - V2 * W;  C1 = C1 - V1 * W
+    //
+    if (mp > kb)
+    {
+        gemm_blocked(mp - kb, n2, kb, T{-1},
+                     pv + kb*rsv, rsv, csv,
+                     pw, n2, 1,
+                     T{1}, pc + kb*rsc, rsc, csc);
+    }
+    for (ptrdiff_t r = 0;  r < kb;  ++r)
+    {
+        for (ptrdiff_t c = 0;  c < n2;  ++c)
+        {
+            pc[r*rsc + c*csc] -= pw[r*n2 + c];
+        }
+        for (ptrdiff_t i = 0;  i < r;  ++i)
+        {
+            T const     vri = pv[r*rsv + i*csv];
+
+            for (ptrdiff_t c = 0;  c < n2;  ++c)
+            {
+                pc[r*rsc + c*csc] -= vri * pw[i*n2 + c];
+            }
+        }
+    }
+}
+
+//==================================================================================================
+//  The blocking parameter of the factorization (the number of columns in a panel), and the
+//  factorization driver.  Span-backed operands having GEMM element types are factored by panels
+//  at run time; all others are factored as a single panel, through A's own operator().
+//==================================================================================================
+//
+struct qr_blocking
+{
+    static constexpr ptrdiff_t  nb = 32;
+};
+
+template<class MT, class TAU>
+void
+qr_factor_in_place(MT& a, TAU& tau)
+{
+    using engine_type = typename MT::engine_type;
+    using value_type  = typename MT::value_type;
+
+    constexpr bool          col_major = is_column_major_v<engine_type>;
+    constexpr ptrdiff_t     nb        = qr_blocking::nb;
+
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n  = static_cast<ptrdiff_t>(a.columns());
+    ptrdiff_t const     kn = (m < n) ? m : n;
+
+    if constexpr (has_direct_span_v<engine_type>  &&  is_gemm_element_v<value_type>)
+    {
+        if (kn > nb)
+        {
+            auto                s  = a.span();
+            value_type* const   p  = s.data();
+            ptrdiff_t const     rs = static_cast<ptrdiff_t>(s.stride(0));
+            ptrdiff_t const     cs = static_cast<ptrdiff_t>(s.stride(1));
+
+            std::vector<value_type>     t(static_cast<size_t>(nb * nb));
+            std::vector<value_type>     w(static_cast<size_t>(nb * n));
+
+            for (ptrdiff_t k0 = 0;  k0 < kn;  k0 += nb)
+            {
+                ptrdiff_t const     kb = (kn - k0 < nb) ? (kn - k0) : nb;
+                ptrdiff_t const     mp = m - k0;
+                auto                panel = a.submatrix(k0, mp, k0, kb);
+                auto                ps    = panel.span();
+
+                qr_panel<col_major>(ps, mp, kb, kb, tau, k0);
+
+                if (k0 + kb < n)
+                {
+                    qr_form_t(ps, mp, kb, tau, k0, t.data());
+                    qr_apply_block<true>(mp, kb, n - k0 - kb, p + k0*rs + k0*cs, rs, cs, t.data(),
+                                         p + k0*rs + (k0 + kb)*cs, rs, cs, w.data());
+                }
+            }
+            return;
+        }
+    }
+
+    qr_panel<col_major>(a, m, kn, n, tau, 0);
+}
+
+//- Function qr_apply() overwrites the (m x k) matrix X with H(j)*X (if CONJ is false) or with
+//  H(j)^H*X (if CONJ is true), for the reflector j stored in the factorization QR, modifying only
+//  columns [c0, k) of X.
+//
+template<bool CONJ, class QR, class TAU, class XT>
+void
+qr_apply(QR const& qr, TAU const& tau, ptrdiff_t j, XT& x, ptrdiff_t c0)
+{
+    using value_type = typename QR::value_type;
+
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(qr.rows());
+    ptrdiff_t const     k  = static_cast<ptrdiff_t>(x.columns());
+    value_type const    tj = CONJ ? element_conj(value_type(tau(j))) : value_type(tau(j));
+
+    if (tj == value_type{}) return;
+
+    for (ptrdiff_t c = c0;  c < k;  ++c)
+    {
+        value_type  w = x(j, c);
+
+        for (ptrdiff_t i = j + 1;  i < m;  ++i)
+        {
+            w = w + element_conj(qr(i, j)) * x(i, c);
+        }
+        w = tj * w;
+        x(j, c) = x(j, c) - w;
+
+        for (ptrdiff_t i = j + 1;  i < m;  ++i)
+        {
+            x(i, c) = x(i, c) - qr(i, j) * w;
+        }
+    }
+}
+
+//- Function qr_apply_q() overwrites the (m x k) matrix X with Q*X, where Q = H(0)*...*H(kn-1) is
+//  formed from the reflectors stored in the (m x kn) matrix V, in the layout of qr_factor().  If
+//  V and X are span-backed and have GEMM element types, blocks of reflectors are applied, last
+//  block first, in compact WY form; otherwise the reflectors are applied one at a time.
+//
+template<class VM, class TAU, class XT>
+void
+qr_apply_q(VM const& v, TAU const& tau, XT& x)
+{
+    using value_type = typename VM::value_type;
+
+    constexpr ptrdiff_t     nb = qr_blocking::nb;
+
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(v.rows());
+    ptrdiff_t const     kn = static_cast<ptrdiff_t>(v.columns());
+    ptrdiff_t const     k  = static_cast<ptrdiff_t>(x.columns());
+
+    if constexpr (has_direct_span_v<typename VM::engine_type>  &&
+                  has_direct_span_v<typename XT::engine_type>  &&  is_gemm_element_v<value_type>)
+    {
+        if (kn > nb)
+        {
+            auto                xs  = x.span();
+            value_type* const   px  = xs.data();
+            ptrdiff_t const     rsx = static_cast<ptrdiff_t>(xs.stride(0));
+            ptrdiff_t const     csx = static_cast<ptrdiff_t>(xs.stride(1));
+
+            std::vector<value_type>     t(static_cast<size_t>(nb * nb));
+            std::vector<value_type>     w(static_cast<size_t>(nb * k));
+
+            for (ptrdiff_t k0 = ((kn - 1) / nb) * nb;  k0 >= 0;  k0 -= nb)
+            {
+                ptrdiff_t const     kb    = (kn - k0 < nb) ? (kn - k0) : nb;
+                ptrdiff_t const     mp    = m - k0;
+                auto                panel = v.submatrix(k0, mp, k0, kb);
+                auto                ps    = panel.span();
+
+                qr_form_t(ps, mp, kb, tau, k0, t.data());
+                qr_apply_block<false>(mp, kb, k, ps.data(),
+                                      static_cast<ptrdiff_t>(ps.stride(0)),
+                                      static_cast<ptrdiff_t>(ps.stride(1)),
+                                      t.data(), px + k0*rsx, rsx, csx, w.data());
+            }
+            return;
+        }
+    }
+
+    for (ptrdiff_t j = kn - 1;  j >= 0;  --j)
+    {
+        qr_apply<false>(v, tau, j, x, 0);
+    }
+}
+
+template<class QR>
+void
+qr_check_rank(QR const& qr, ptrdiff_t n)
+{
+    using value_type = typename QR::value_type;
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        if (qr(i, i) == value_type{})
+        {
+            throw runtime_error("matrix is rank deficient");
+        }
+    }
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Function qr_factor() overwrites the (m x n) matrix A, which may be any matrix (or view of a
+//  matrix) having a writable engine, with its QR factorization, and returns the vector of the
+//  min(m, n) reflector factors tau.  Functions qr_q() and qr_r() extract the economy-size
+//  factors from the factorization: Q (m x k), whose columns are orthonormal, and the upper
+//  trapezoidal R (k x n), where k = min(m, n).
+//
+//  Function least_squares() returns the x that minimizes ||A*x - b|| for a vector b, or the X
+//  that minimizes the norm of each column of A*X - B for a matrix B, where A has at least as
+//  many rows as columns.  It throws if A does not have full column rank.
+//==================================================================================================
+//
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+auto
+qr_factor(matrix<ET, OT>& a)
+{
+    using types = detail::qr_types<ET, OT>;
+
+    auto    tau = types::make_reflectors(a.rows() < a.columns() ? a.rows() : a.columns());
+
+    detail::qr_factor_in_place(a, tau);
+    return tau;
+}
+
+template<class ET, class OT, detail::enable_if_writable<ET, ET> = true> inline
+auto
+qr_factor(matrix<ET, OT>&& a)
+{
+    return qr_factor(a);
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline
+auto
+qr_q(matrix<ET1, OT1> const& qr, vector<ET2, OT2> const& tau)
+{
+    using types      = detail::qr_types<ET1, OT1>;
+    using value_type = typename types::value_type;
+
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(qr.rows());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(qr.rows() < qr.columns() ? qr.rows() : qr.columns());
+
+    if (tau.size() != k)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto    q = types::make_q(m, k);
+
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < k;  ++j)
+        {
+            q(i, j) = (i == j) ? value_type{1} : value_type{};
+        }
+    }
+    for (ptrdiff_t j = k - 1;  j >= 0;  --j)
+    {
+        detail::qr_apply<false>(qr, tau, j, q, j);
+    }
+    return q;
+}
+
+template<class ET, class OT> inline
+auto
+qr_r(matrix<ET, OT> const& qr)
+{
+    using types      = detail::qr_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(qr.columns());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(qr.rows() < qr.columns() ? qr.rows() : qr.columns());
+
+    auto    r = types::make_r(k, n);
+
+    for (ptrdiff_t i = 0;  i < k;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < n;  ++j)
+        {
+            r(i, j) = (j < i) ? value_type{} : value_type(qr(i, j));
+        }
+    }
+    return r;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline
+auto
+least_squares(matrix<ET1, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    using types = detail::qr_types<ET1, OT1>;
+
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.columns());
+
+    if (m < n)
+    {
+        throw runtime_error("least-squares problem is underdetermined");
+    }
+    if (b.size() != m)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    typename types::matrix_type     qr(a);
+    auto const                      tau = qr_factor(qr);
+    auto                            y   = types::make_vector(m);
+    auto                            yc  = detail::vector_as_column<decltype(y)>{y};
+
+    detail::qr_check_rank(qr, n);
+
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        y(i) = b(i);
+    }
+    for (ptrdiff_t j = 0;  j < n;  ++j)
+    {
+        detail::qr_apply<true>(qr, tau, j, yc, 0);
+    }
+
+    auto    x  = types::make_solution(n);
+    auto    xc = detail::vector_as_column<decltype(x)>{x};
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        x(i) = y(i);
+    }
+    detail::trsm_upper(qr.submatrix(0, n, 0, n), xc);
+    return x;
+}
+
+template<class ET1, class OT1, class ET2, class OT2> inline
+auto
+least_squares(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using types = detail::qr_types<ET1, OT1>;
+
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.columns());
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(b.columns());
+
+    if (m < n)
+    {
+        throw runtime_error("least-squares problem is underdetermined");
+    }
+    if (b.rows() != m)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    typename types::matrix_type                             qr(a);
+    auto const                                              tau = qr_factor(qr);
+    typename detail::decomposition_types<ET2, OT1>::matrix_type y(b);
+
+    detail::qr_check_rank(qr, n);
+
+    for (ptrdiff_t j = 0;  j < n;  ++j)
+    {
+        detail::qr_apply<true>(qr, tau, j, y, 0);
+    }
+
+    auto    x = types::template make_solutions<ET2>(n, k);
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < k;  ++j)
+        {
+            x(i, j) = y(i, j);
+        }
+    }
+    detail::trsm_upper(qr.submatrix(0, n, 0, n), x);
+    return x;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_QR_DECOMPOSITION_HPP_DEFINED
@@ -0,0 +1,321 @@
+//==================================================================================================
+//  File:       strassen_traits.hpp
+//
+//  Summary:    This header defines the private Strassen-Winograd matrix product and the public
+//              arithmetic traits used by matrix_strassen_operation_traits to compute large matrix
+//              products with seven half-size products per level of recursion, instead of eight.
+//
+//              The operands and the result are divided into quadrants by submatrix spans (see
+//              noe_mdspan_submatrix), and the recursion bottoms out in the cache-blocked kernel.
+//              The sums and differences of quadrants are formed in two temporaries per level,
+//              taken from a per-thread scratch arena that is sized once for the whole recursion,
+//              using the schedule of Boyer, Dumas, Pernet, and Zhou, which stores the seven
+//              intermediate products in the quadrants of the result.
+//
+//              The error bound of the Strassen-Winograd product is weaker than that of the
+//              conventional product, and grows with the depth of the recursion, so its results
+//              will generally differ from those of matrix_operation_traits in the last few bits.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_STRASSEN_TRAITS_HPP_DEFINED
+#define LINEAR_ALGEBRA_STRASSEN_TRAITS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The crossover of the recursion.  Operation traits types may provide a static member
+//  strassen_crossover; those that do not use default_crossover.  A product is divided into
+//  quadrants only if each of its dimensions is at least the crossover; the crossover is never
+//  taken to be less than min_crossover.
+//==================================================================================================
+//
+struct strassen_blocking
+{
+    static constexpr ptrdiff_t  default_crossover = 1024;
+    static constexpr ptrdiff_t  min_crossover     = 2;
+};
+
+template<class OT, class = void>
+struct strassen_crossover
+{
+    static constexpr ptrdiff_t  value = strassen_blocking::default_crossover;
+};
+
+template<class OT>
+struct strassen_crossover<OT, void_t<decltype(OT::strassen_crossover)>>
+{
+    static constexpr ptrdiff_t  value = (OT::strassen_crossover < strassen_blocking::min_crossover)
+                                      ? strassen_blocking::min_crossover : OT::strassen_crossover;
+};
+
+template<class OT> inline constexpr
+ptrdiff_t   strassen_crossover_v = strassen_crossover<OT>::value;
+
+inline constexpr
+bool
+use_strassen(ptrdiff_t rows, ptrdiff_t cols, ptrdiff_t inner, ptrdiff_t crossover)
+{
+    return rows >= crossover  &&  cols >= crossover  &&  inner >= crossover;
+}
+
+//- Returns the number of elements of scratch space needed by the recursion for a product of
+//  an (m x k) matrix with a (k x n) matrix: at each level, one temporary of (m/2) x max(k/2, n/2)
+//  elements and one of (k/2) x (n/2) elements.
+//
+inline constexpr
+ptrdiff_t
+strassen_scratch_size(ptrdiff_t m, ptrdiff_t n, ptrdiff_t k, ptrdiff_t crossover)
+{
+    ptrdiff_t   size = 0;
+
+    for (;  use_strassen(m, n, k, crossover);  m /= 2, n /= 2, k /= 2)
+    {
+        size += (m/2) * ((k/2 > n/2) ? k/2 : n/2) + (k/2) * (n/2);
+    }
+    return size;
+}
+
+//==================================================================================================
+//  The scratch arena.  Each thread keeps one buffer per element type, which grows to the largest
+//  size requested and is then reused; the recursion takes its temporaries from the buffer in
+//  stack order, so that no memory is allocated below the top level.
+//==================================================================================================
+//
+template<class T>
+class strassen_workspace
+{
+  public:
+    static strassen_workspace&  local();
+
+    T*      buffer(ptrdiff_t n);
+
+  private:
+    unique_ptr<T[]>     mp_buf;
+    ptrdiff_t           m_cap = 0;
+};
+
+template<class T> inline
+strassen_workspace<T>&
+strassen_workspace<T>::local()
+{
+    static thread_local strassen_workspace  ws;
+    return ws;
+}
+
+template<class T>
+T*
+strassen_workspace<T>::buffer(ptrdiff_t n)
+{
+    if (n > m_cap)
+    {
+        mp_buf.reset(new T[static_cast<size_t>(n)]);
+        m_cap = n;
+    }
+    return mp_buf.get();
+}
+
+//==================================================================================================
+//  Computes SR = OP(S1, S2) element-wise on three spans of the same shape, any of which may be
+//  the same span.  The vectorized element-wise kernel is used when the spans are all row- or
+//  all column-contiguous; otherwise the elements are combined one at a time.
+//==================================================================================================
+//
+template<class OP, class S1, class S2, class SR>
+void
+strassen_combine(S1 const& s1, S2 const& s2, SR const& sr)
+{
+    if (simd_elementwise<OP>(s1, s2, sr)) return;
+
+    ptrdiff_t const     rows = static_cast<ptrdiff_t>(sr.extent(0));
+    ptrdiff_t const     cols = static_cast<ptrdiff_t>(sr.extent(1));
+
+    for (ptrdiff_t i = 0;  i < rows;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < cols;  ++j)
+        {
+            sr(i, j) = OP::elem(s1(i, j), s2(i, j));
+        }
+    }
+}
+
+//==================================================================================================
+//  Computes C = A*B on the spans of the operands and the result, where A is (m x k), B is
+//  (k x n), and C is (m x n); C must not share elements with A or B, and P_WORK must point to
+//  strassen_scratch_size(m, n, k, crossover) elements.  If any dimension is less than the
+//  crossover, the blocked kernel computes the product directly.  Otherwise the leading even
+//  part of each dimension is divided into quadrants and multiplied by the 22-step schedule
+//  below, and an odd trailing row, column, or inner index is then handled by the blocked
+//  kernel (dynamic peeling).
+//==================================================================================================
+//
+template<class T, class SA, class SB, class SC>
+void
+strassen_multiply(SA const& a, SB const& b, SC const& c, T* p_work, ptrdiff_t crossover)
+{
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(c.extent(0));
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(c.extent(1));
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(a.extent(1));
+
+    if (!use_strassen(m, n, k, crossover))
+    {
+        gemm(T{1}, a, b, T{}, c);
+        return;
+    }
+
+    ptrdiff_t const     mh = m / 2;
+    ptrdiff_t const     nh = n / 2;
+    ptrdiff_t const     kh = k / 2;
+
+    auto const  a11 = noe_mdspan_submatrix(a, ptrdiff_t(0), mh, ptrdiff_t(0), kh);
+    auto const  a12 = noe_mdspan_submatrix(a, ptrdiff_t(0), mh, kh, kh);
+    auto const  a21 = noe_mdspan_submatrix(a, mh, mh, ptrdiff_t(0), kh);
+    auto const  a22 = noe_mdspan_submatrix(a, mh, mh, kh, kh);
+    auto const  b11 = noe_mdspan_submatrix(b, ptrdiff_t(0), kh, ptrdiff_t(0), nh);
+    auto const  b12 = noe_mdspan_submatrix(b, ptrdiff_t(0), kh, nh, nh);
+    auto const  b21 = noe_mdspan_submatrix(b, kh, kh, ptrdiff_t(0), nh);
+    auto const  b22 = noe_mdspan_submatrix(b, kh, kh, nh, nh);
+    auto const  c11 = noe_mdspan_submatrix(c, ptrdiff_t(0), mh, ptrdiff_t(0), nh);
+    auto const  c12 = noe_mdspan_submatrix(c, ptrdiff_t(0), mh, nh, nh);
+    auto const  c21 = noe_mdspan_submatrix(c, mh, mh, ptrdiff_t(0), nh);
+    auto const  c22 = noe_mdspan_submatrix(c, mh, mh, nh, nh);
+
+    //- The temporaries: X holds the sums of quadrants of A, and then the product P1; Y holds
+    //  the sums of quadrants of B.  The deeper levels of the recursion use the scratch space
+    //  that follows them.
+    //
+    T* const    p_x    = p_work;
+    T* const    p_y    = p_x + mh * ((kh > nh) ? kh : nh);
+    T* const    p_next = p_y + kh * nh;
+
+    auto const  xs = make_dyn_span(p_x, mh, kh, kh);
+    auto const  xp = make_dyn_span(p_x, mh, nh, nh);
+    auto const  yt = make_dyn_span(p_y, kh, nh, nh);
+
+    strassen_combine<simd_subtract>(a11, a21, xs);          //- S3 = A11 - A21
+    strassen_combine<simd_subtract>(b22, b12, yt);          //- T3 = B22 - B12
+    strassen_multiply(xs, yt, c21, p_next, crossover);      //- P7 = S3 * T3
+    strassen_combine<simd_add>(a21, a22, xs);               //- S1 = A21 + A22
+    strassen_combine<simd_subtract>(b12, b11, yt);          //- T1 = B12 - B11
+    strassen_multiply(xs, yt, c22, p_next, crossover);      //- P5 = S1 * T1
+    strassen_combine<simd_subtract>(xs, a11, xs);           //- S2 = S1 - A11
+    strassen_combine<simd_subtract>(b22, yt, yt);           //- T2 = B22 - T1
+    strassen_multiply(xs, yt, c12, p_next, crossover);      //- P6 = S2 * T2
+    strassen_combine<simd_subtract>(a12, xs, xs);           //- S4 = A12 - S2
+    strassen_multiply(xs, b22, c11, p_next, crossover);     //- P3 = S4 * B22
+    strassen_multiply(a11, b11, xp, p_next, crossover);     //- P1 = A11 * B11
+    strassen_combine<simd_add>(xp, c12, c12);               //- U2 = P1 + P6
+    strassen_combine<simd_add>(c12, c21, c21);              //- U3 = U2 + P7
+    strassen_combine<simd_add>(c12, c22, c12);              //- U4 = U2 + P5
+    strassen_combine<simd_add>(c21, c22, c22);              //- U7 = U3 + P5    (C22)
+    strassen_combine<simd_add>(c12, c11, c12);              //- U5 = U4 + P3    (C12)
+    strassen_combine<simd_subtract>(yt, b21, yt);           //- T4 = T2 - B21
+    strassen_multiply(a22, yt, c11, p_next, crossover);     //- P4 = A22 * T4
+    strassen_combine<simd_subtract>(c21, c11, c21);         //- U6 = U3 - P4    (C21)
+    strassen_multiply(a12, b21, c11, p_next, crossover);    //- P2 = A12 * B21
+    strassen_combine<simd_add>(xp, c11, c11);               //- U1 = P1 + P2    (C11)
+
+    //- Peel off the odd trailing inner index, column, and row, if any.
+    //
+    if (k > 2*kh)
+    {
+        gemm(T{1}, noe_mdspan_submatrix(a, ptrdiff_t(0), 2*mh, 2*kh, ptrdiff_t(1)),
+                   noe_mdspan_submatrix(b, 2*kh, ptrdiff_t(1), ptrdiff_t(0), 2*nh),
+             T{1}, noe_mdspan_submatrix(c, ptrdiff_t(0), 2*mh, ptrdiff_t(0), 2*nh));
+    }
+    if (n > 2*nh)
+    {
+        gemm(T{1}, a, noe_mdspan_submatrix(b, ptrdiff_t(0), k, 2*nh, ptrdiff_t(1)),
+             T{}, noe_mdspan_submatrix(c, ptrdiff_t(0), m, 2*nh, ptrdiff_t(1)));
+    }
+    if (m > 2*mh)
+    {
+        gemm(T{1}, noe_mdspan_submatrix(a, 2*mh, ptrdiff_t(1), ptrdiff_t(0), k),
+                   noe_mdspan_submatrix(b, ptrdiff_t(0), k, ptrdiff_t(0), 2*nh),
+             T{}, noe_mdspan_submatrix(c, 2*mh, ptrdiff_t(1), ptrdiff_t(0), 2*nh));
+    }
+}
+
+//- Computes C = A*B on the spans of three engines, taking the scratch space from the calling
+//  thread's arena.
+//
+template<class T, class SA, class SB, class SC>
+void
+strassen(SA const& a, SB const& b, SC const& c, ptrdiff_t crossover)
+{
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(c.extent(0));
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(c.extent(1));
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(a.extent(1));
+    T* const            p = strassen_workspace<T>::local().buffer(strassen_scratch_size(m, n, k, crossover));
+
+    strassen_multiply(noe_mdspan_submatrix(a, ptrdiff_t(0), m, ptrdiff_t(0), k),
+                      noe_mdspan_submatrix(b, ptrdiff_t(0), k, ptrdiff_t(0), n),
+                      noe_mdspan_submatrix(c, ptrdiff_t(0), m, ptrdiff_t(0), n),
+                      p, crossover);
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//                          **** STRASSEN MULTIPLICATION TRAITS ****
+//==================================================================================================
+//  Only products of two matrices are computed by the recursion; all other products are computed
+//  by the standard multiplication traits.
+//==================================================================================================
+//
+template<class OT, class OP1, class OP2>
+struct matrix_strassen_multiplication_traits
+:   public matrix_multiplication_arithmetic_traits<OT, OP1, OP2>
+{};
+
+//-------------------
+//- (matrix * matrix)
+//
+template<class OT, class ET1, class OT1, class ET2, class OT2>
+struct matrix_strassen_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_arithmetic_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using engine_type = typename base_traits::engine_type;
+    using result_type = typename base_traits::result_type;
+
+    static constexpr result_type    multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+template<class OT, class ET1, class OT1, class ET2, class OT2> inline constexpr
+auto
+matrix_strassen_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    using index_type_r = typename result_type::index_type;
+    using element_type = typename result_type::element_type;
+
+    //- When the blocked kernel applies and every dimension of the product reaches the crossover,
+    //  compute it by the recursion; otherwise, fall back to the standard product.
+    //
+    if constexpr (detail::use_gemm_v<ET1, ET2, engine_type>)
+    {
+        constexpr ptrdiff_t     crossover = detail::strassen_crossover_v<OT>;
+
+        index_type_r    rows  = static_cast<index_type_r>(m1.rows());
+        index_type_r    cols  = static_cast<index_type_r>(m2.columns());
+        ptrdiff_t       inner = static_cast<ptrdiff_t>(m1.columns());
+
+        if (!is_constant_evaluated()  &&  detail::use_strassen(rows, cols, inner, crossover))
+        {
+            result_type     mr;
+
+            if constexpr (is_resizable_engine_v<engine_type>)
+            {
+                detail::resize_for_overwrite(mr, rows, cols);
+            }
+
+            detail::strassen<element_type>(m1.span(), m2.span(), mr.span(), crossover);
+            return mr;
+        }
+    }
+
+    return base_traits::multiply(m1, m2);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_STRASSEN_TRAITS_HPP_DEFINED
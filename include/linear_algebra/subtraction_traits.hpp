@@ -291,8 +291,9 @@ struct matrix_subtraction_engine_traits
     using element_type_1 = typename ET1::element_type;
     using element_type_2 = typename ET2::element_type;
     using element_type   = select_matrix_subtraction_element_t<OT, element_type_1, element_type_2>;
+    using layout_type    = detail::result_engine_layout_t<ET1, ET2>;
     using engine_type    = conditional_t<is_matrix_engine_v<ET1>,
-                                         dr_matrix_engine<element_type, allocator<element_type>>,
+                                         dr_matrix_engine<element_type, allocator<element_type>, layout_type>,
                                          dr_vector_engine<element_type, allocator<element_type>>>;
 };
 
@@ -371,177 +372,177 @@ struct matrix_subtraction_engine_traits<OT, fs_vector_engine<T1, N1>, fs_vector_
 //
 //- dr_matrix_engine - dr_matrix_engine.
 //
-template<class OT, class T1, class A1, class T2, class A2>
+template<class OT, class T1, class A1, class L1, class T2, class A2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        dr_matrix_engine<T1, A1>,
-                                        dr_matrix_engine<T2, A2>>
+                                        dr_matrix_engine<T1, A1, L1>,
+                                        dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class T2, class A2, class MCT2>
+template<class OT, class T1, class A1, class L1, class T2, class A2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        dr_matrix_engine<T1, A1>,
-                                        matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                        dr_matrix_engine<T1, A1, L1>,
+                                        matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, class A2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, class A2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                        dr_matrix_engine<T2, A2>>
+                                        matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                        dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, class A2, class MCT2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, class A2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                        matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                        matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                        matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
 //--------------------------------------
 //- dr_matrix_engine - fs_matrix_engine.
 //
-template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, class A1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        dr_matrix_engine<T1, A1>,
-                                        fs_matrix_engine<T2, R2, C2>>
+                                        dr_matrix_engine<T1, A1, L1>,
+                                        fs_matrix_engine<T2, R2, C2, L2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, class A1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        dr_matrix_engine<T1, A1>,
-                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                        dr_matrix_engine<T1, A1, L1>,
+                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                        fs_matrix_engine<T2, R2, C2>>
+                                        matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                        fs_matrix_engine<T2, R2, C2, L2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, class A1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, class A1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<dr_matrix_engine<T1, A1>, MCT1>,
-                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                        matrix_transpose_engine<dr_matrix_engine<T1, A1, L1>, MCT1>,
+                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
 //--------------------------------------
 //- fs_matrix_engine - dr_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, class A2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        fs_matrix_engine<T1, R1, C1>,
-                                        dr_matrix_engine<T2, A2>>
+                                        fs_matrix_engine<T1, R1, C1, L1>,
+                                        dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, class A2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, class A2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        fs_matrix_engine<T1, R1, C1>,
-                                        matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                        fs_matrix_engine<T1, R1, C1, L1>,
+                                        matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, class A2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, class A2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                        dr_matrix_engine<T2, A2>>
+                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                        dr_matrix_engine<T2, A2, L2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, class A2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, class A2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                        matrix_transpose_engine<dr_matrix_engine<T2, A2>, MCT2>>
+                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                        matrix_transpose_engine<dr_matrix_engine<T2, A2, L2>, MCT2>>
 {
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
     using alloc_type   = detail::rebind_alloc_t<A2, element_type>;
-    using engine_type  = dr_matrix_engine<element_type, alloc_type>;
+    using engine_type  = dr_matrix_engine<element_type, alloc_type, detail::result_layout_t<L1, L2>>;
 };
 
 //--------------------------------------
 //- fs_matrix_engine - fs_matrix_engine.
 //
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        fs_matrix_engine<T1, R1, C1>,
-                                        fs_matrix_engine<T2, R2, C2>>
+                                        fs_matrix_engine<T1, R1, C1, L1>,
+                                        fs_matrix_engine<T2, R2, C2, L2>>
 {
     static_assert(R1 == R2);
     static_assert(C1 == C2);
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R1, C1>;
+    using engine_type  = fs_matrix_engine<element_type, R1, C1, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1,class T2, ptrdiff_t R2, ptrdiff_t C2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1,class T2, ptrdiff_t R2, ptrdiff_t C2, class L2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                        fs_matrix_engine<T2, R2, C2>>
+                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                        fs_matrix_engine<T2, R2, C2, L2>>
 {
     static_assert(R1 == C2);
     static_assert(C1 == R2);
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R2, C2>;
+    using engine_type  = fs_matrix_engine<element_type, R2, C2, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        fs_matrix_engine<T1, R1, C1>,
-                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                        fs_matrix_engine<T1, R1, C1, L1>,
+                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     static_assert(R1 == C2);
     static_assert(C1 == R2);
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, R1, C1>;
+    using engine_type  = fs_matrix_engine<element_type, R1, C1, detail::result_layout_t<L1, L2>>;
 };
 
-template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class MCT2>
+template<class OT, class T1, ptrdiff_t R1, ptrdiff_t C1, class L1, class MCT1, class T2, ptrdiff_t R2, ptrdiff_t C2, class L2, class MCT2>
 struct matrix_subtraction_engine_traits<OT,
-                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1>, MCT1>,
-                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2>, MCT2>>
+                                        matrix_transpose_engine<fs_matrix_engine<T1, R1, C1, L1>, MCT1>,
+                                        matrix_transpose_engine<fs_matrix_engine<T2, R2, C2, L2>, MCT2>>
 {
     static_assert(R1 == R2);
     static_assert(C1 == C2);
     using element_type = select_matrix_subtraction_element_t<OT, T1, T2>;
-    using engine_type  = fs_matrix_engine<element_type, C1, R1>;
+    using engine_type  = fs_matrix_engine<element_type, C1, R1, detail::result_layout_t<L1, L2>>;
 };
 
 
@@ -583,7 +584,16 @@ matrix_subtraction_arithmetic_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::su
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        vr.resize(elems);
+        detail::resize_for_overwrite(vr, elems);
+    }
+
+    if constexpr (detail::use_simd_elementwise_v<ET1, ET2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&
+            detail::simd_elementwise<detail::simd_subtract>(v1.span(), v2.span(), vr.span()))
+        {
+            return vr;
+        }
     }
 
     index_type_r    ir = 0;
@@ -625,7 +635,16 @@ matrix_subtraction_arithmetic_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::su
 
     if constexpr (is_resizable_engine_v<engine_type>)
     {
-        mr.resize(rows, cols);
+        detail::resize_for_overwrite(mr, rows, cols);
+    }
+
+    if constexpr (detail::use_simd_elementwise_v<ET1, ET2, engine_type>)
+    {
+        if (!is_constant_evaluated()  &&
+            detail::simd_elementwise<detail::simd_subtract>(m1.span(), m2.span(), mr.span()))
+        {
+            return mr;
+        }
     }
 
     index_type_r    ir = 0;
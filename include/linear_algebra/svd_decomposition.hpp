@@ -0,0 +1,1164 @@
+//==================================================================================================
+//  File:       svd_decomposition.hpp
+//
+//  Summary:    This header defines the singular value decomposition A = U*S*V^T of real matrices,
+//              and the pseudo-inverse, rank, and condition number computed from it.
+//
+//              An (m x n) operand is decomposed through a column-major work copy of A (if
+//              m >= n) or of A^T (otherwise), so that the work matrix W has at least as many rows
+//              as columns.  W is then decomposed by one of two methods:
+//
+//              One-sided Jacobi, for fixed-size operands and for operands having few columns.
+//              Pairs of columns of W are rotated until all are mutually orthogonal; the column
+//              norms are then the singular values, and the normalized columns the left singular
+//              vectors.  Each rotation works on two contiguous columns, and is highly accurate.
+//
+//              Golub-Kahan bidiagonalization, for larger operands.  W is reduced to an upper
+//              bidiagonal matrix B = Q^T*W*P by reflectors applied alternately from the left and
+//              right; for large operands the reduction is blocked, with the reflectors of each
+//              panel accumulated into two (n x nb) matrices, and the trailing matrix updated
+//              through the blocked GEMM kernel.  The singular values of B are then found by the
+//              implicit-shift QR algorithm, and its singular vectors are transformed by Q and P
+//              in compact WY form.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SVD_DECOMPOSITION_HPP_DEFINED
+#define LINEAR_ALGEBRA_SVD_DECOMPOSITION_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  The types of the objects created by the SVD of an (R x C) operand having engine ET, where
+//  M = max(R, C) and K = min(R, C): the column-major work matrices W (M x K), V (K x K), and the
+//  full left singular vectors of W (M x M); the singular values (K); the thin factors U (R x K)
+//  and V^T (K x C); the full factors U (R x R) and V^T (C x C); and the pseudo-inverse (C x R).
+//  Fixed-size operands give rise to fixed-size objects.
+//==================================================================================================
+//
+template<class ET, class OT>
+struct svd_types : public decomposition_types<ET, OT>
+{
+    using base_type    = decomposition_types<ET, OT>;
+    using value_type   = typename base_type::value_type;
+    using matrix_type  = typename base_type::matrix_type;
+    using work_type    = matrix<dr_matrix_engine<value_type, allocator<value_type>, column_major>, OT>;
+    using values_type  = typename base_type::vector_type;
+
+    static constexpr bool   fixed_size = false;
+
+    static constexpr work_type      make_work(ptrdiff_t m, ptrdiff_t k)     { return work_type(m, k); }
+    static constexpr work_type      make_vwork(ptrdiff_t k)                 { return work_type(k, k); }
+    static constexpr work_type      make_uwork(ptrdiff_t m)                 { return work_type(m, m); }
+    static constexpr values_type    make_values(ptrdiff_t k)                { return values_type(k); }
+    static constexpr matrix_type    make_u(ptrdiff_t m, ptrdiff_t k)        { return matrix_type(m, k); }
+    static constexpr matrix_type    make_vt(ptrdiff_t k, ptrdiff_t n)       { return matrix_type(k, n); }
+    static constexpr matrix_type    make_u_full(ptrdiff_t m)                { return matrix_type(m, m); }
+    static constexpr matrix_type    make_vt_full(ptrdiff_t n)               { return matrix_type(n, n); }
+    static constexpr matrix_type    make_pinv(ptrdiff_t n, ptrdiff_t m)     { return matrix_type(n, m); }
+};
+
+template<class T, ptrdiff_t R, ptrdiff_t C, class LT, class OT>
+struct svd_types<fs_matrix_engine<T, R, C, LT>, OT>
+:   public decomposition_types<fs_matrix_engine<T, R, C, LT>, OT>
+{
+    static constexpr ptrdiff_t  M = (R < C) ? C : R;
+    static constexpr ptrdiff_t  K = (R < C) ? R : C;
+
+    using value_type   = T;
+    using work_type    = matrix<fs_matrix_engine<T, M, K, column_major>, OT>;
+    using vwork_type   = matrix<fs_matrix_engine<T, K, K, column_major>, OT>;
+    using uwork_type   = matrix<fs_matrix_engine<T, M, M, column_major>, OT>;
+    using values_type  = vector<fs_vector_engine<T, K>, OT>;
+
+    static constexpr bool   fixed_size = true;
+
+    static constexpr work_type      make_work(ptrdiff_t, ptrdiff_t)     { return work_type(); }
+    static constexpr vwork_type     make_vwork(ptrdiff_t)               { return vwork_type(); }
+    static constexpr uwork_type     make_uwork(ptrdiff_t)               { return uwork_type(); }
+    static constexpr values_type    make_values(ptrdiff_t)              { return values_type(); }
+
+    static constexpr auto   make_u(ptrdiff_t, ptrdiff_t)    { return matrix<fs_matrix_engine<T, R, K, LT>, OT>(); }
+    static constexpr auto   make_vt(ptrdiff_t, ptrdiff_t)   { return matrix<fs_matrix_engine<T, K, C, LT>, OT>(); }
+    static constexpr auto   make_u_full(ptrdiff_t)          { return matrix<fs_matrix_engine<T, R, R, LT>, OT>(); }
+    static constexpr auto   make_vt_full(ptrdiff_t)         { return matrix<fs_matrix_engine<T, C, C, LT>, OT>(); }
+    static constexpr auto   make_pinv(ptrdiff_t, ptrdiff_t)  { return matrix<fs_matrix_engine<T, C, R, LT>, OT>(); }
+};
+
+//==================================================================================================
+//  The tuning parameters: the number of columns in a panel of the blocked bidiagonalization,
+//  and the largest number of columns of a dynamic work matrix decomposed by one-sided Jacobi.
+//==================================================================================================
+//
+struct svd_blocking
+{
+    static constexpr ptrdiff_t  nb         = 32;
+    static constexpr ptrdiff_t  jacobi_max = 32;
+};
+
+//==================================================================================================
+//  Helpers for column-major work matrices.  Function svd_set_identity() sets Z to the identity;
+//  function svd_sort() sorts the singular values S into descending order, along with the
+//  columns of U and V if VECTORS is true.  Function svd_complete() overwrites columns [r, k) of
+//  the (m x k) matrix U, whose first r columns are orthonormal, with an orthonormal completion:
+//  columns r through k-1 of the Q of a QR factorization of those first r columns.
+//==================================================================================================
+//
+template<class ZT>
+void
+svd_set_identity(ZT& z)
+{
+    using value_type = typename ZT::value_type;
+
+    for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(z.columns());  ++j)
+    {
+        for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(z.rows());  ++i)
+        {
+            z(i, j) = (i == j) ? value_type{1} : value_type{};
+        }
+    }
+}
+
+template<bool VECTORS, class ST, class UT, class VT>
+void
+svd_sort(ST& s, ptrdiff_t k, UT& u, VT& v)
+{
+    for (ptrdiff_t i = 0;  i < k - 1;  ++i)
+    {
+        ptrdiff_t   l = i;
+
+        for (ptrdiff_t j = i + 1;  j < k;  ++j)
+        {
+            if (s(l) < s(j)) l = j;
+        }
+        if (l != i)
+        {
+            la_swap(s(i), s(l));
+
+            if constexpr (VECTORS)
+            {
+                for (ptrdiff_t r = 0;  r < static_cast<ptrdiff_t>(u.rows());  ++r)
+                {
+                    la_swap(u(r, i), u(r, l));
+                }
+                for (ptrdiff_t r = 0;  r < static_cast<ptrdiff_t>(v.rows());  ++r)
+                {
+                    la_swap(v(r, i), v(r, l));
+                }
+            }
+        }
+    }
+}
+
+template<class UT>
+void
+svd_complete(UT& u, ptrdiff_t r, ptrdiff_t k)
+{
+    using value_type = typename UT::value_type;
+    using qr_type    = matrix<dr_matrix_engine<value_type, allocator<value_type>, column_major>,
+                              matrix_operation_traits>;
+
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(u.rows());
+
+    if (r == k) return;
+
+    for (ptrdiff_t j = r;  j < k;  ++j)
+    {
+        for (ptrdiff_t i = 0;  i < m;  ++i)
+        {
+            u(i, j) = (i == j) ? value_type{1} : value_type{};
+        }
+    }
+    if (r == 0) return;
+
+    qr_type     q(m, r);
+
+    for (ptrdiff_t j = 0;  j < r;  ++j)
+    {
+        for (ptrdiff_t i = 0;  i < m;  ++i)
+        {
+            q(i, j) = u(i, j);
+        }
+    }
+
+    auto const  tau = qr_factor(q);
+    auto        x   = u.submatrix(0, m, r, k - r);
+
+    for (ptrdiff_t j = r - 1;  j >= 0;  --j)
+    {
+        qr_apply<false>(q, tau, j, x, 0);
+    }
+}
+
+//==================================================================================================
+//  The one-sided Jacobi kernel.  Function svd_jacobi() rotates pairs of columns of the (m x k)
+//  work matrix W, m >= k, in cyclic sweeps, until each pair is orthogonal to within a tolerance
+//  relative to the product of their norms, accumulating the rotations into V if VECTORS is true.
+//  The rotation chosen for columns p and q, having squared norms a and b and inner product g,
+//  is the one that annihilates g in the 2x2 Gram matrix [a g; g b].  It then stores the column
+//  norms in S.
+//==================================================================================================
+//
+template<bool VECTORS, class WT, class ST, class VT>
+void
+svd_jacobi(WT& w, ST& s, VT& v)
+{
+    using value_type = typename WT::value_type;
+
+    constexpr ptrdiff_t     max_sweeps = 60;
+
+    auto                ws = w.span();
+    value_type* const   pw = ws.data();
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(ws.extent(0));
+    ptrdiff_t const     k  = static_cast<ptrdiff_t>(ws.extent(1));
+    ptrdiff_t const     cw = static_cast<ptrdiff_t>(ws.stride(1));
+
+    using std::abs;
+    using std::sqrt;
+
+    value_type const    tol = sqrt(static_cast<value_type>(m)) * numeric_limits<value_type>::epsilon();
+
+    if constexpr (VECTORS)
+    {
+        svd_set_identity(v);
+    }
+
+    for (ptrdiff_t sweep = 0;  ;  ++sweep)
+    {
+        bool    rotated = false;
+
+        for (ptrdiff_t p = 0;  p < k - 1;  ++p)
+        {
+            for (ptrdiff_t q = p + 1;  q < k;  ++q)
+            {
+                value_type* const   wp = pw + p*cw;
+                value_type* const   wq = pw + q*cw;
+                value_type          a  = value_type{};
+                value_type          b  = value_type{};
+                value_type          g  = value_type{};
+
+                for (ptrdiff_t i = 0;  i < m;  ++i)
+                {
+                    a += wp[i] * wp[i];
+                    b += wq[i] * wq[i];
+                    g += wp[i] * wq[i];
+                }
+                if (abs(g) <= tol * sqrt(a) * sqrt(b)) continue;
+
+                value_type const    zeta = (b - a) / (value_type{2} * g);
+                value_type const    t    = ((zeta < value_type{}) ? value_type{-1} : value_type{1})
+                                         / (abs(zeta) + sqrt(value_type{1} + zeta*zeta));
+                value_type const    c    = value_type{1} / sqrt(value_type{1} + t*t);
+                value_type const    sn   = c * t;
+
+                for (ptrdiff_t i = 0;  i < m;  ++i)
+                {
+                    value_type const    x = wp[i];
+                    value_type const    y = wq[i];
+
+                    wp[i] = c * x - sn * y;
+                    wq[i] = sn * x + c * y;
+                }
+                if constexpr (VECTORS)
+                {
+                    for (ptrdiff_t i = 0;  i < k;  ++i)
+                    {
+                        value_type const    x = v(i, p);
+                        value_type const    y = v(i, q);
+
+                        v(i, p) = c * x - sn * y;
+                        v(i, q) = sn * x + c * y;
+                    }
+                }
+                rotated = true;
+            }
+        }
+        if (!rotated) break;
+
+        if (sweep == max_sweeps)
+        {
+            throw runtime_error("singular value iteration did not converge");
+        }
+    }
+
+    for (ptrdiff_t j = 0;  j < k;  ++j)
+    {
+        value_type  a = value_type{};
+
+        for (ptrdiff_t i = 0;  i < m;  ++i)
+        {
+            a += pw[j*cw + i] * pw[j*cw + i];
+        }
+        s(j) = sqrt(a);
+    }
+}
+
+//==================================================================================================
+//  The bidiagonalization kernels.  Function svd_reflector() generates the reflector that
+//  annihilates all but the first of the n elements of S that start at (i, j) and step by
+//  (di, dj), storing the reflector vector in those elements, with its unit leading element at
+//  (i, j), and the resulting element of B in BETA; it returns the reflector's factor tau.
+//==================================================================================================
+//
+template<class S, class T>
+T
+svd_reflector(S& s, ptrdiff_t i, ptrdiff_t j, ptrdiff_t di, ptrdiff_t dj, ptrdiff_t n, T& beta)
+{
+    T const     alpha = s(i, j);
+    T           xnorm = T{};
+
+    for (ptrdiff_t l = 1;  l < n;  ++l)
+    {
+        T const     x = s(i + l*di, j + l*dj);
+
+        xnorm += x * x;
+    }
+
+    s(i, j) = T{1};
+
+    if (xnorm == T{})
+    {
+        beta = alpha;
+        return T{};
+    }
+
+    using std::sqrt;
+    T const     mag = sqrt(alpha*alpha + xnorm);
+    T const     scl = T{1} / (alpha - ((alpha < T{}) ? mag : -mag));
+
+    beta = (alpha < T{}) ? mag : -mag;
+
+    for (ptrdiff_t l = 1;  l < n;  ++l)
+    {
+        s(i + l*di, j + l*dj) *= scl;
+    }
+    return (beta - alpha) / beta;
+}
+
+//- Function svd_bidiagonalize_panel() reduces rows and columns [k0, n) of the column-major
+//  (m x n) matrix S by simple loops, applying each reflector as soon as it is generated.  The
+//  diagonal of B is stored in D and its superdiagonal in E; the left reflectors are left in the
+//  columns of S below the diagonal, and the right reflectors in its rows right of the
+//  superdiagonal.
+//
+template<class S, class VT>
+void
+svd_bidiagonalize_panel(S& s, ptrdiff_t k0, ptrdiff_t m, ptrdiff_t n, VT& d, VT& e, VT& tauq, VT& taup)
+{
+    using value_type = remove_cvref_t<decltype(s(0, 0))>;
+
+    std::vector<value_type>     x(static_cast<size_t>(m));
+
+    for (ptrdiff_t i = k0;  i < n;  ++i)
+    {
+        value_type  beta;
+        value_type  tq = svd_reflector(s, i, i, 1, 0, m - i, beta);
+
+        d(i)    = beta;
+        tauq(i) = tq;
+
+        //- Apply H = I - tauq*v*v^T from the left to S(i:m, i+1:n).
+        //
+        if (tq != value_type{})
+        {
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                value_type  vc = value_type{};
+
+                for (ptrdiff_t r = i;  r < m;  ++r)
+                {
+                    vc += s(r, i) * s(r, c);
+                }
+                vc *= tq;
+
+                for (ptrdiff_t r = i;  r < m;  ++r)
+                {
+                    s(r, c) -= vc * s(r, i);
+                }
+            }
+        }
+        s(i, i) = d(i);
+
+        if (i < n - 1)
+        {
+            value_type  tp = svd_reflector(s, i, i + 1, 0, 1, n - i - 1, beta);
+
+            e(i)    = beta;
+            taup(i) = tp;
+
+            //- Apply G = I - taup*u*u^T from the right to S(i+1:m, i+1:n).
+            //
+            if (tp != value_type{})
+            {
+                for (ptrdiff_t r = i + 1;  r < m;  ++r)
+                {
+                    x[r] = value_type{};
+                }
+                for (ptrdiff_t c = i + 1;  c < n;  ++c)
+                {
+                    value_type const    uc = s(i, c);
+
+                    for (ptrdiff_t r = i + 1;  r < m;  ++r)
+                    {
+                        x[r] += s(r, c) * uc;
+                    }
+                }
+                for (ptrdiff_t c = i + 1;  c < n;  ++c)
+                {
+                    value_type const    uc = tp * s(i, c);
+
+                    for (ptrdiff_t r = i + 1;  r < m;  ++r)
+                    {
+                        s(r, c) -= x[r] * uc;
+                    }
+                }
+            }
+            s(i, i + 1) = e(i);
+        }
+        else
+        {
+            e(i)    = value_type{};
+            taup(i) = value_type{};
+        }
+    }
+}
+
+//- Function svd_bidiagonalize_block() reduces the nb rows and columns [k0, k0+nb) of the span S
+//  without updating the trailing submatrix, forming the (m x nb) matrix X and the (n x nb)
+//  matrix Y (stored by columns at PX and PY) such that the trailing submatrix is reduced by
+//  A = A - V*Y^T - X*U^T, where V holds the left reflectors of the panel and U^T the right
+//  ones.  Each row and column of the panel is first brought up to date with the reflectors
+//  before it, and each product with the trailing submatrix is corrected for the updates that
+//  have been deferred.  The unit leading elements of the reflectors are left in place in S.
+//
+template<class S, class VT, class T>
+void
+svd_bidiagonalize_block(S& s, ptrdiff_t k0, ptrdiff_t nb, ptrdiff_t m, ptrdiff_t n,
+                        VT& d, VT& e, VT& tauq, VT& taup, T* px, T* py)
+{
+    std::vector<T>  t(static_cast<size_t>(nb + 1));
+
+    auto    xm = [px, m](ptrdiff_t r, ptrdiff_t l) -> T&   { return px[r + l*m]; };
+    auto    ym = [py, n](ptrdiff_t r, ptrdiff_t l) -> T&   { return py[r + l*n]; };
+
+    for (ptrdiff_t j = 0;  j < nb;  ++j)
+    {
+        ptrdiff_t const     i = k0 + j;
+
+        //- Update column i, and generate the left reflector that reduces it.
+        //
+        for (ptrdiff_t l = 0;  l < j;  ++l)
+        {
+            T const     yil = ym(i, l);
+            T const     uli = s(k0 + l, i);
+
+            for (ptrdiff_t r = i;  r < m;  ++r)
+            {
+                s(r, i) -= s(r, k0 + l) * yil + xm(r, l) * uli;
+            }
+        }
+
+        T       beta;
+        T const tq = svd_reflector(s, i, i, 1, 0, m - i, beta);
+
+        d(i)    = beta;
+        tauq(i) = tq;
+
+        if (i == n - 1)
+        {
+            e(i)    = T{};
+            taup(i) = T{};
+            continue;
+        }
+
+        //- Column j of Y:  tauq*(A^T*v - Y*(V^T*v) - U*(X^T*v)).
+        //
+        for (ptrdiff_t c = i + 1;  c < n;  ++c)
+        {
+            T   yc = T{};
+
+            for (ptrdiff_t r = i;  r < m;  ++r)
+            {
+                yc += s(r, c) * s(r, i);
+            }
+            ym(c, j) = yc;
+        }
+        for (ptrdiff_t l = 0;  l < j;  ++l)
+        {
+            T   tl = T{};
+
+            for (ptrdiff_t r = i;  r < m;  ++r)
+            {
+                tl += s(r, k0 + l) * s(r, i);
+            }
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                ym(c, j) -= ym(c, l) * tl;
+            }
+        }
+        for (ptrdiff_t l = 0;  l < j;  ++l)
+        {
+            T   tl = T{};
+
+            for (ptrdiff_t r = i;  r < m;  ++r)
+            {
+                tl += xm(r, l) * s(r, i);
+            }
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                ym(c, j) -= s(k0 + l, c) * tl;
+            }
+        }
+        for (ptrdiff_t c = i + 1;  c < n;  ++c)
+        {
+            ym(c, j) *= tq;
+        }
+
+        //- Update row i, and generate the right reflector that reduces it.
+        //
+        for (ptrdiff_t l = 0;  l <= j;  ++l)
+        {
+            T const     vil = s(i, k0 + l);
+
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                s(i, c) -= ym(c, l) * vil;
+            }
+        }
+        for (ptrdiff_t l = 0;  l < j;  ++l)
+        {
+            T const     xil = xm(i, l);
+
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                s(i, c) -= s(k0 + l, c) * xil;
+            }
+        }
+
+        T const     tp = svd_reflector(s, i, i + 1, 0, 1, n - i - 1, beta);
+
+        e(i)    = beta;
+        taup(i) = tp;
+
+        //- Column j of X:  taup*(A*u - V*(Y^T*u) - X*(U^T*u)).
+        //
+        for (ptrdiff_t r = i + 1;  r < m;  ++r)
+        {
+            xm(r, j) = T{};
+        }
+        for (ptrdiff_t c = i + 1;  c < n;  ++c)
+        {
+            T const     uc = s(i, c);
+
+            for (ptrdiff_t r = i + 1;  r < m;  ++r)
+            {
+                xm(r, j) += s(r, c) * uc;
+            }
+        }
+        for (ptrdiff_t l = 0;  l <= j;  ++l)
+        {
+            T   tl = T{};
+
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                tl += ym(c, l) * s(i, c);
+            }
+            for (ptrdiff_t r = i + 1;  r < m;  ++r)
+            {
+                xm(r, j) -= s(r, k0 + l) * tl;
+            }
+        }
+        for (ptrdiff_t l = 0;  l < j;  ++l)
+        {
+            T   tl = T{};
+
+            for (ptrdiff_t c = i + 1;  c < n;  ++c)
+            {
+                tl += s(k0 + l, c) * s(i, c);
+            }
+            for (ptrdiff_t r = i + 1;  r < m;  ++r)
+            {
+                xm(r, j) -= xm(r, l) * tl;
+            }
+        }
+        for (ptrdiff_t r = i + 1;  r < m;  ++r)
+        {
+            xm(r, j) *= tp;
+        }
+    }
+}
+
+//- Function svd_bidiagonalize() is the reduction driver.  Dynamic work matrices are reduced by
+//  panels while more than 2*nb columns remain; the rest of the reduction is done by simple loops.
+//
+template<class WT, class VT>
+void
+svd_bidiagonalize(WT& w, VT& d, VT& e, VT& tauq, VT& taup)
+{
+    using value_type = typename WT::value_type;
+
+    constexpr ptrdiff_t     nb = svd_blocking::nb;
+
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(w.rows());
+    ptrdiff_t const     n  = static_cast<ptrdiff_t>(w.columns());
+    ptrdiff_t           k0 = 0;
+
+    if constexpr (is_gemm_element_v<value_type>)
+    {
+        if (n > 2*nb)
+        {
+            auto                s  = w.span();
+            value_type* const   p  = s.data();
+            ptrdiff_t const     rs = static_cast<ptrdiff_t>(s.stride(0));
+            ptrdiff_t const     cs = static_cast<ptrdiff_t>(s.stride(1));
+
+            std::vector<value_type>     x(static_cast<size_t>(m * nb)), y(static_cast<size_t>(n * nb));
+
+            for (;  n - k0 > 2*nb;  k0 += nb)
+            {
+                ptrdiff_t const     k1 = k0 + nb;
+
+                svd_bidiagonalize_block(s, k0, nb, m, n, d, e, tauq, taup, x.data(), y.data());
+
+                gemm_blocked(m - k1, n - k1, nb, value_type{-1},
+                             p + k1*rs + k0*cs, rs, cs,
+                             y.data() + k1, n, 1,
+                             value_type{1}, p + k1*rs + k1*cs, rs, cs);
+                gemm_blocked(m - k1, n - k1, nb, value_type{-1},
+                             x.data() + k1, 1, m,
+                             p + k0*rs + k1*cs, rs, cs,
+                             value_type{1}, p + k1*rs + k1*cs, rs, cs);
+
+                for (ptrdiff_t i = k0;  i < k1;  ++i)
+                {
+                    s(i, i)     = d(i);
+                    s(i, i + 1) = e(i);
+                }
+            }
+        }
+    }
+
+    svd_bidiagonalize_panel(w, k0, m, n, d, e, tauq, taup);
+}
+
+//==================================================================================================
+//  The bidiagonal SVD kernel.  Function svd_bidiagonal_qr() overwrites the diagonal D of the
+//  (n x n) upper bidiagonal matrix B with its singular values, destroying the superdiagonal E, by
+//  the implicit-shift QR algorithm of Golub and Reinsch.  A negligible superdiagonal element
+//  splits the matrix; a negligible diagonal element is first chased out of its row by rotations
+//  from the left.  If VECTORS is true, the rotations from the left and right are applied to the
+//  columns of the column-major matrices U and V respectively.
+//==================================================================================================
+//
+template<class ZT, class T>
+void
+svd_rotate(ZT& z, ptrdiff_t i, ptrdiff_t j, T c, T s)
+{
+    auto            zs = z.span();
+    T* const        zi = zs.data() + i*static_cast<ptrdiff_t>(zs.stride(1));
+    T* const        zj = zs.data() + j*static_cast<ptrdiff_t>(zs.stride(1));
+    ptrdiff_t const nr = static_cast<ptrdiff_t>(zs.extent(0));
+
+    for (ptrdiff_t k = 0;  k < nr;  ++k)
+    {
+        T const     x = zi[k];
+        T const     y = zj[k];
+
+        zi[k] = x * c + y * s;
+        zj[k] = y * c - x * s;
+    }
+}
+
+template<bool VECTORS, class VT, class UT, class VVT>
+void
+svd_bidiagonal_qr(VT& d, VT const& e, ptrdiff_t n, UT& u, VVT& v)
+{
+    using value_type = remove_cvref_t<decltype(d(0))>;
+
+    constexpr ptrdiff_t     max_iter = 30;
+    value_type const        eps      = numeric_limits<value_type>::epsilon();
+
+    using std::abs;
+    using std::hypot;
+
+    //- The superdiagonal is held shifted by one, so that f[i] couples d[i-1] and d[i].
+    //
+    std::vector<value_type>     f(static_cast<size_t>(n));
+    value_type                  anorm = value_type{};
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        f[i]  = (i == 0) ? value_type{} : value_type(e(i - 1));
+        anorm = (abs(d(i)) + abs(f[i]) > anorm) ? abs(d(i)) + abs(f[i]) : anorm;
+    }
+
+    value_type const    tol = eps * anorm;
+
+    for (ptrdiff_t k = n - 1;  k >= 0;  --k)
+    {
+        for (ptrdiff_t iter = 0;  ;  ++iter)
+        {
+            ptrdiff_t   l      = k;
+            bool        cancel = true;
+
+            for (;  l >= 0;  --l)
+            {
+                if (l == 0  ||  abs(f[l]) <= tol)
+                {
+                    cancel = false;
+                    break;
+                }
+                if (abs(d(l - 1)) <= tol) break;
+            }
+
+            //- d(l-1) is negligible: annihilate f[l..k] by rotations from the left.
+            //
+            if (cancel)
+            {
+                value_type  c = value_type{};
+                value_type  s = value_type{1};
+
+                for (ptrdiff_t i = l;  i <= k;  ++i)
+                {
+                    value_type const    g0 = s * f[i];
+
+                    f[i] = c * f[i];
+                    if (abs(g0) <= tol) break;
+
+                    value_type const    h = hypot(g0, value_type(d(i)));
+
+                    c    = d(i) / h;
+                    s    = -g0 / h;
+                    d(i) = h;
+
+                    if constexpr (VECTORS)
+                    {
+                        svd_rotate(u, l - 1, i, c, s);
+                    }
+                }
+            }
+
+            value_type  z = d(k);
+
+            if (l == k)
+            {
+                if (z < value_type{})
+                {
+                    d(k) = -z;
+
+                    if constexpr (VECTORS)
+                    {
+                        for (ptrdiff_t r = 0;  r < static_cast<ptrdiff_t>(v.rows());  ++r)
+                        {
+                            v(r, k) = -v(r, k);
+                        }
+                    }
+                }
+                break;
+            }
+
+            if (iter == max_iter)
+            {
+                throw runtime_error("singular value iteration did not converge");
+            }
+
+            //- Shift from the bottom 2x2 minor, and chase the bulge from the top of the
+            //  unreduced block [l, k] down to its bottom.
+            //
+            value_type  x  = d(l);
+            value_type  y  = d(k - 1);
+            value_type  g  = f[k - 1];
+            value_type  h  = f[k];
+            value_type  ff = ((y - z)*(y + z) + (g - h)*(g + h)) / (value_type{2} * h * y);
+
+            g  = hypot(ff, value_type{1});
+            ff = ((x - z)*(x + z) + h*((y / (ff + ((ff < value_type{}) ? -g : g))) - h)) / x;
+
+            value_type  c = value_type{1};
+            value_type  s = value_type{1};
+
+            for (ptrdiff_t j = l;  j < k;  ++j)
+            {
+                ptrdiff_t const     i = j + 1;
+
+                g = f[i];
+                y = d(i);
+                h = s * g;
+                g = c * g;
+                z = hypot(ff, h);
+                f[j] = z;
+                c = ff / z;
+                s = h / z;
+                ff = x * c + g * s;
+                g  = g * c - x * s;
+                h  = y * s;
+                y  = y * c;
+
+                if constexpr (VECTORS)
+                {
+                    svd_rotate(v, j, i, c, s);
+                }
+
+                z    = hypot(ff, h);
+                d(j) = z;
+
+                if (z != value_type{})
+                {
+                    c = ff / z;
+                    s = h / z;
+                }
+                ff = c * g + s * y;
+                x  = c * y - s * g;
+
+                if constexpr (VECTORS)
+                {
+                    svd_rotate(u, j, i, c, s);
+                }
+            }
+            f[l] = value_type{};
+            f[k] = ff;
+            d(k) = x;
+        }
+    }
+}
+
+//==================================================================================================
+//  The decomposition driver.  Function svd_compute() computes the singular values S of the
+//  column-major (m x k) work matrix W, m >= k, destroying W.  If VECTORS is true, it also stores
+//  the left singular vectors in the first k columns of U, which is (m x k) or (m x m), completing
+//  the rest of U to an orthonormal basis, and the right singular vectors in V (k x k).
+//==================================================================================================
+//
+template<bool VECTORS, class Types, class WT, class ST, class UT, class VT>
+void
+svd_compute(WT& w, ST& s, UT& u, VT& v)
+{
+    using value_type = typename WT::value_type;
+
+    ptrdiff_t const     m  = static_cast<ptrdiff_t>(w.rows());
+    ptrdiff_t const     k  = static_cast<ptrdiff_t>(w.columns());
+    ptrdiff_t const     ku = VECTORS ? static_cast<ptrdiff_t>(u.columns()) : 0;
+
+    if (Types::fixed_size  ||  k <= svd_blocking::jacobi_max)
+    {
+        svd_jacobi<VECTORS>(w, s, v);
+        svd_sort<VECTORS>(s, k, w, v);
+
+        if constexpr (VECTORS)
+        {
+            ptrdiff_t   r = 0;
+
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                if (s(j) == value_type{}) continue;
+
+                for (ptrdiff_t i = 0;  i < m;  ++i)
+                {
+                    u(i, j) = w(i, j) / s(j);
+                }
+                r = j + 1;
+            }
+            svd_complete(u, r, ku);
+        }
+    }
+    else if constexpr (!Types::fixed_size)
+    {
+        auto    e    = Types::make_values(k);
+        auto    tauq = Types::make_values(k);
+        auto    taup = Types::make_values(k);
+
+        svd_bidiagonalize(w, s, e, tauq, taup);
+
+        if constexpr (VECTORS)
+        {
+            auto    ub = Types::make_vwork(k);
+
+            svd_set_identity(ub);
+            svd_set_identity(v);
+            svd_bidiagonal_qr<true>(s, e, k, ub, v);
+            svd_sort<true>(s, k, ub, v);
+
+            svd_set_identity(u);
+            for (ptrdiff_t j = 0;  j < k;  ++j)
+            {
+                for (ptrdiff_t i = 0;  i < k;  ++i)
+                {
+                    u(i, j) = ub(i, j);
+                }
+            }
+            qr_apply_q(w, tauq, u);
+
+            if (k > 1)
+            {
+                auto    x = v.submatrix(1, k - 1, 0, k);
+
+                qr_apply_q(w.t().submatrix(1, k - 1, 0, k - 1), taup, x);
+            }
+        }
+        else
+        {
+            svd_bidiagonal_qr<false>(s, e, k, w, w);
+            svd_sort<false>(s, k, w, w);
+        }
+    }
+}
+
+//- Function svd_work() returns the work matrix for A: a copy of A if A has at least as many rows
+//  as columns, or of A^T otherwise.
+//
+template<class Types, class ET, class OT>
+auto
+svd_work(matrix<ET, OT> const& a)
+{
+    ptrdiff_t const     m     = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n     = static_cast<ptrdiff_t>(a.columns());
+    bool const          trans = m < n;
+    auto                w     = Types::make_work(trans ? n : m, trans ? m : n);
+
+    for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(w.columns());  ++j)
+    {
+        for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(w.rows());  ++i)
+        {
+            w(i, j) = trans ? a(j, i) : a(i, j);
+        }
+    }
+    return w;
+}
+
+//- Function svd_factors() computes the SVD of A, returning U, S, and V^T, where U and V^T are
+//  thin if FULL is false, and square otherwise.
+//
+template<bool FULL, class ET, class OT>
+auto
+svd_factors(matrix<ET, OT> const& a)
+{
+    using types      = svd_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    static_assert(is_floating_point_v<value_type>, "the singular value decomposition requires real floating-point elements");
+
+    ptrdiff_t const     m     = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n     = static_cast<ptrdiff_t>(a.columns());
+    ptrdiff_t const     mw    = (m < n) ? n : m;
+    ptrdiff_t const     k     = (m < n) ? m : n;
+    bool const          trans = m < n;
+
+    auto    w  = svd_work<types>(a);
+    auto    s  = types::make_values(k);
+    auto    vw = types::make_vwork(k);
+    auto    uw = [mw, k]()
+                 {
+                     if constexpr (FULL)
+                         return types::make_uwork(mw);
+                     else
+                         return types::make_work(mw, k);
+                 }();
+
+    svd_compute<true, types>(w, s, uw, vw);
+
+    auto    u  = [m, k]()
+                 {
+                     if constexpr (FULL)
+                         return types::make_u_full(m);
+                     else
+                         return types::make_u(m, k);
+                 }();
+    auto    vt = [n, k]()
+                 {
+                     if constexpr (FULL)
+                         return types::make_vt_full(n);
+                     else
+                         return types::make_vt(k, n);
+                 }();
+
+    //- If W = A^T = Uw*S*Vw^T, then A = Vw*S*Uw^T.
+    //
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(u.rows());  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(u.columns());  ++j)
+        {
+            u(i, j) = trans ? vw(i, j) : uw(i, j);
+        }
+    }
+    for (ptrdiff_t i = 0;  i < static_cast<ptrdiff_t>(vt.rows());  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < static_cast<ptrdiff_t>(vt.columns());  ++j)
+        {
+            vt(i, j) = trans ? uw(j, i) : vw(j, i);
+        }
+    }
+    return tuple<decltype(u), decltype(s), decltype(vt)>(std::move(u), std::move(s), std::move(vt));
+}
+
+template<class ST>
+auto
+svd_default_tolerance(ST const& s, ptrdiff_t m, ptrdiff_t n)
+{
+    using value_type = remove_cvref_t<decltype(s(0))>;
+
+    value_type const    mn = static_cast<value_type>((m < n) ? n : m);
+
+    return (s.size() == 0) ? value_type{} : mn * numeric_limits<value_type>::epsilon() * s(0);
+}
+
+}       //- detail namespace
+//==================================================================================================
+//  Function singular_values() returns the singular values of A, in descending order.  Functions
+//  svd() and svd_full() return a tuple of U, the vector S of singular values in descending
+//  order, and V^T, such that A = U*diag(S)*V^T; for an (m x n) A, where k = min(m, n), svd()
+//  returns the thin factors U (m x k) and V^T (k x n), and svd_full() the square factors U
+//  (m x m) and V^T (n x n).  Both throw if the iteration fails to converge.
+//
+//  Function pinv() returns the Moore-Penrose pseudo-inverse of A (n x m), and function
+//  matrix_rank() the number of singular values of A greater than a tolerance; singular values
+//  not greater than the tolerance are treated as zero by both.  The default tolerance is
+//  max(m, n)*eps*s(0), where eps is the machine epsilon of the element type and s(0) the largest
+//  singular value.  Function condition_number() returns the ratio of the largest singular value
+//  of A to the smallest, which is infinite if A does not have full rank.
+//
+//  All of these require real floating-point elements.
+//==================================================================================================
+//
+template<class ET, class OT> inline
+auto
+singular_values(matrix<ET, OT> const& a)
+{
+    using types      = detail::svd_types<ET, OT>;
+    using value_type = typename types::value_type;
+
+    static_assert(is_floating_point_v<value_type>, "the singular value decomposition requires real floating-point elements");
+
+    auto    w = detail::svd_work<types>(a);
+    auto    s = types::make_values(static_cast<ptrdiff_t>(w.columns()));
+
+    detail::svd_compute<false, types>(w, s, w, w);
+    return s;
+}
+
+template<class ET, class OT> inline
+auto
+svd(matrix<ET, OT> const& a)
+{
+    return detail::svd_factors<false>(a);
+}
+
+template<class ET, class OT> inline
+auto
+svd_full(matrix<ET, OT> const& a)
+{
+    return detail::svd_factors<true>(a);
+}
+
+template<class ET, class OT, class T> inline
+auto
+pinv(matrix<ET, OT> const& a, T tol)
+{
+    using value_type = remove_cv_t<typename ET::element_type>;
+
+    static_assert(is_floating_point_v<value_type>, "the pseudo-inverse requires real floating-point elements");
+
+    using types      = detail::svd_types<ET, OT>;
+
+    ptrdiff_t const     m = static_cast<ptrdiff_t>(a.rows());
+    ptrdiff_t const     n = static_cast<ptrdiff_t>(a.columns());
+
+    auto [u, s, vt] = detail::svd_factors<false>(a);
+    auto    x       = types::make_pinv(n, m);
+
+    //- X = V*diag(1/S)*U^T, over the singular values greater than the tolerance.
+    //
+    for (ptrdiff_t l = 0;  l < static_cast<ptrdiff_t>(s.size());  ++l)
+    {
+        value_type const    sl = (s(l) > static_cast<value_type>(tol)) ? value_type{1} / s(l) : value_type{};
+
+        for (ptrdiff_t j = 0;  j < n;  ++j)
+        {
+            vt(l, j) *= sl;
+        }
+    }
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < m;  ++j)
+        {
+            x(i, j) = value_type{};
+        }
+    }
+    for (ptrdiff_t l = 0;  l < static_cast<ptrdiff_t>(s.size());  ++l)
+    {
+        for (ptrdiff_t i = 0;  i < n;  ++i)
+        {
+            value_type const    vil = vt(l, i);
+
+            if (vil == value_type{}) continue;
+
+            for (ptrdiff_t j = 0;  j < m;  ++j)
+            {
+                x(i, j) += vil * u(j, l);
+            }
+        }
+    }
+    return x;
+}
+
+template<class ET, class OT> inline
+auto
+pinv(matrix<ET, OT> const& a)
+{
+    auto const  s = singular_values(a);
+
+    return pinv(a, detail::svd_default_tolerance(s, a.rows(), a.columns()));
+}
+
+template<class ET, class OT, class T> inline
+ptrdiff_t
+matrix_rank(matrix<ET, OT> const& a, T tol)
+{
+    using value_type = remove_cv_t<typename ET::element_type>;
+
+    static_assert(is_floating_point_v<value_type>, "the matrix rank requires real floating-point elements");
+
+    auto const  s = singular_values(a);
+    ptrdiff_t   r = 0;
+
+    while (r < static_cast<ptrdiff_t>(s.size())  &&  s(r) > static_cast<value_type>(tol))
+    {
+        ++r;
+    }
+    return r;
+}
+
+template<class ET, class OT> inline
+ptrdiff_t
+matrix_rank(matrix<ET, OT> const& a)
+{
+    static_assert(is_floating_point_v<remove_cv_t<typename ET::element_type>>,
+                  "the matrix rank requires real floating-point elements");
+
+    auto const  s = singular_values(a);
+    auto const  t = detail::svd_default_tolerance(s, a.rows(), a.columns());
+    ptrdiff_t   r = 0;
+
+    while (r < static_cast<ptrdiff_t>(s.size())  &&  s(r) > t)
+    {
+        ++r;
+    }
+    return r;
+}
+
+template<class ET, class OT> inline
+auto
+condition_number(matrix<ET, OT> const& a)
+{
+    using value_type = remove_cv_t<typename ET::element_type>;
+
+    static_assert(is_floating_point_v<value_type>, "the condition number requires real floating-point elements");
+
+    auto const          s = singular_values(a);
+    ptrdiff_t const     k = static_cast<ptrdiff_t>(s.size());
+
+    if (k == 0) return value_type{};
+    if (s(k - 1) == value_type{}) return numeric_limits<value_type>::infinity();
+    return s(0) / s(k - 1);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SVD_DECOMPOSITION_HPP_DEFINED
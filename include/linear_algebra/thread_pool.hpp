@@ -0,0 +1,297 @@
+//==================================================================================================
+//  File:       thread_pool.hpp
+//
+//  Summary:    This header defines a private work-stealing thread pool, used by the parallel
+//              arithmetic traits to distribute independent pieces of work (such as the tiles of
+//              a matrix product) over several threads.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_THREAD_POOL_HPP_DEFINED
+#define LINEAR_ALGEBRA_THREAD_POOL_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  A pool of worker threads that executes parallel loops.  A call to parallel_for(n, fn) deals
+//  the task indices [0, n) out in contiguous blocks, one block per participant (the workers
+//  plus the calling thread, which also executes tasks).  Each participant takes tasks from the
+//  front of its own queue; a participant whose queue is empty steals tasks from the back of the
+//  other queues.  The call returns when every task has completed, rethrowing the first exception
+//  thrown by a task, if any.
+//
+//  Only one parallel loop runs at a time; a parallel_for() called from inside a task runs its
+//  loop serially on the calling thread.  Which thread executes a given task is unspecified, so
+//  tasks must be independent of each other.
+//==================================================================================================
+//
+class work_stealing_pool
+{
+  public:
+    explicit work_stealing_pool(size_t threads);
+    ~work_stealing_pool() noexcept;
+
+    work_stealing_pool(work_stealing_pool const&) = delete;
+    work_stealing_pool&     operator =(work_stealing_pool const&) = delete;
+
+    size_t  thread_count() const noexcept;
+
+    template<class FN>
+    void    parallel_for(ptrdiff_t n, FN const& fn);
+
+    static work_stealing_pool&  shared_pool();
+
+  private:
+    using invoker = void (*)(void const*, ptrdiff_t);
+
+    struct task_queue
+    {
+        mutex               m_mutex;
+        deque<ptrdiff_t>    m_tasks;
+    };
+
+    size_t                      m_count;
+    unique_ptr<task_queue[]>    mp_queues;
+    std::vector<thread>         m_threads;
+    mutex                       m_job_mutex;
+    mutex                       m_state_mutex;
+    condition_variable          m_wake;
+    condition_variable          m_done;
+    size_t                      m_generation;
+    bool                        m_stop;
+    invoker                     m_invoke;
+    void const*                 mp_context;
+    atomic<ptrdiff_t>           m_remaining;
+    exception_ptr               m_error;
+
+    static bool&    in_pool_task() noexcept;
+
+    void    run(ptrdiff_t n, invoker fn, void const* ctx);
+    bool    run_one(size_t self);
+    bool    take_task(size_t self, ptrdiff_t& task);
+    void    work(size_t self);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+inline
+work_stealing_pool::work_stealing_pool(size_t threads)
+:   m_count((threads == 0) ? 1 : threads)
+,   mp_queues(new task_queue[(threads == 0) ? 1 : threads])
+,   m_threads()
+,   m_job_mutex()
+,   m_state_mutex()
+,   m_wake()
+,   m_done()
+,   m_generation(0)
+,   m_stop(false)
+,   m_invoke(nullptr)
+,   mp_context(nullptr)
+,   m_remaining(0)
+,   m_error()
+{
+    m_threads.reserve(m_count - 1);
+
+    for (size_t i = 1;  i < m_count;  ++i)
+    {
+        m_threads.emplace_back([this, i]() { work(i); });
+    }
+}
+
+inline
+work_stealing_pool::~work_stealing_pool() noexcept
+{
+    {
+        lock_guard<mutex>   lock(m_state_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (auto& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+//----------
+//- Capacity
+//
+inline size_t
+work_stealing_pool::thread_count() const noexcept
+{
+    return m_count;
+}
+
+//-----------
+//- Execution
+//
+template<class FN>
+void
+work_stealing_pool::parallel_for(ptrdiff_t n, FN const& fn)
+{
+    if (n <= 0) return;
+
+    if (m_count == 1  ||  n == 1  ||  in_pool_task())
+    {
+        for (ptrdiff_t i = 0;  i < n;  ++i)
+        {
+            fn(i);
+        }
+    }
+    else
+    {
+        run(n, [](void const* ctx, ptrdiff_t i) { (*static_cast<FN const*>(ctx))(i); }, &fn);
+    }
+}
+
+//- The shared pool has one participant per hardware thread, and is created on first use.
+//
+inline work_stealing_pool&
+work_stealing_pool::shared_pool()
+{
+    static work_stealing_pool   pool(thread::hardware_concurrency());
+    return pool;
+}
+
+//------------------------
+//- Private implementation
+//
+inline bool&
+work_stealing_pool::in_pool_task() noexcept
+{
+    static thread_local bool    in_task = false;
+    return in_task;
+}
+
+inline void
+work_stealing_pool::run(ptrdiff_t n, invoker fn, void const* ctx)
+{
+    lock_guard<mutex>   job_lock(m_job_mutex);
+
+    m_invoke   = fn;
+    mp_context = ctx;
+    m_error    = nullptr;
+    m_remaining.store(n);
+
+    //- Deal out the tasks in contiguous blocks, one per participant.
+    //
+    ptrdiff_t const     parts = static_cast<ptrdiff_t>(m_count);
+
+    for (ptrdiff_t p = 0;  p < parts;  ++p)
+    {
+        lock_guard<mutex>   lock(mp_queues[p].m_mutex);
+
+        for (ptrdiff_t i = p*n / parts;  i < (p + 1)*n / parts;  ++i)
+        {
+            mp_queues[p].m_tasks.push_back(i);
+        }
+    }
+
+    {
+        lock_guard<mutex>   lock(m_state_mutex);
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    //- The calling thread participates, then waits for tasks still running elsewhere.
+    //
+    in_pool_task() = true;
+    while (run_one(0)) {}
+    in_pool_task() = false;
+
+    exception_ptr   error;
+    {
+        unique_lock<mutex>  lock(m_state_mutex);
+        m_done.wait(lock, [this]() { return m_remaining.load() == 0; });
+        error = exchange(m_error, nullptr);
+    }
+
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
+inline bool
+work_stealing_pool::run_one(size_t self)
+{
+    ptrdiff_t   task;
+
+    if (!take_task(self, task)) return false;
+
+    try
+    {
+        m_invoke(mp_context, task);
+    }
+    catch (...)
+    {
+        lock_guard<mutex>   lock(m_state_mutex);
+
+        if (!m_error)
+        {
+            m_error = current_exception();
+        }
+    }
+
+    if (m_remaining.fetch_sub(1) == 1)
+    {
+        lock_guard<mutex>   lock(m_state_mutex);
+        m_done.notify_all();
+    }
+    return true;
+}
+
+inline bool
+work_stealing_pool::take_task(size_t self, ptrdiff_t& task)
+{
+    {
+        task_queue&         own = mp_queues[self];
+        lock_guard<mutex>   lock(own.m_mutex);
+
+        if (!own.m_tasks.empty())
+        {
+            task = own.m_tasks.front();
+            own.m_tasks.pop_front();
+            return true;
+        }
+    }
+
+    for (size_t k = 1;  k < m_count;  ++k)
+    {
+        task_queue&         victim = mp_queues[(self + k) % m_count];
+        lock_guard<mutex>   lock(victim.m_mutex);
+
+        if (!victim.m_tasks.empty())
+        {
+            task = victim.m_tasks.back();
+            victim.m_tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void
+work_stealing_pool::work(size_t self)
+{
+    size_t  seen = 0;
+
+    in_pool_task() = true;
+
+    for (;;)
+    {
+        {
+            unique_lock<mutex>  lock(m_state_mutex);
+            m_wake.wait(lock, [this, seen]() { return m_stop  ||  m_generation != seen; });
+
+            if (m_stop) return;
+            seen = m_generation;
+        }
+
+        while (run_one(self)) {}
+    }
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_THREAD_POOL_HPP_DEFINED
@@ -0,0 +1,272 @@
+//==================================================================================================
+//  File:       transpose_kernels.hpp
+//
+//  Summary:    This header defines the private kernel used to copy the elements of a matrix
+//              engine into an engine of the opposite storage order -- for example, to materialize
+//              a transpose view of a row-major matrix as a row-major matrix -- when both engines
+//              are backed by memory that can be addressed through a span (see
+//              detail::has_direct_span_v).  Such a copy reads along one dimension and writes
+//              along the other, so one side or the other misses the cache on every element if it
+//              is done by simple loops.
+//
+//              The kernel divides the matrix recursively, always halving its longer dimension,
+//              until the pieces are small enough for both the source and destination blocks to
+//              remain in the L1 cache.  Each such block is copied as a grid of small square tiles,
+//              which are transposed in vector registers using SSE2 or AVX intrinsics for float
+//              and double elements, and by scalar loops otherwise.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TRANSPOSE_KERNELS_HPP_DEFINED
+#define LINEAR_ALGEBRA_TRANSPOSE_KERNELS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Traits type transpose_tile<T> describes the in-register transpose of a square tile of
+//  elements of type T.  Its member function transpose() reads the tile from a source in which
+//  each column is contiguous (with lds elements between the starts of adjacent columns), and
+//  writes it to a destination in which each row is contiguous (with ldd elements between the
+//  starts of adjacent rows).  The primary template describes the absence of vector support
+//  (size == 0).
+//==================================================================================================
+//
+template<class T>
+struct transpose_tile
+{
+    static constexpr ptrdiff_t  size = 0;
+};
+
+#if defined(LA_SIMD_AVX512) || defined(LA_SIMD_AVX)
+
+template<>
+struct transpose_tile<float>
+{
+    static constexpr ptrdiff_t  size = 8;
+
+    static void
+    transpose(float const* ps, ptrdiff_t lds, float* pd, ptrdiff_t ldd) noexcept
+    {
+        __m256  r0 = _mm256_loadu_ps(ps);
+        __m256  r1 = _mm256_loadu_ps(ps + lds);
+        __m256  r2 = _mm256_loadu_ps(ps + 2*lds);
+        __m256  r3 = _mm256_loadu_ps(ps + 3*lds);
+        __m256  r4 = _mm256_loadu_ps(ps + 4*lds);
+        __m256  r5 = _mm256_loadu_ps(ps + 5*lds);
+        __m256  r6 = _mm256_loadu_ps(ps + 6*lds);
+        __m256  r7 = _mm256_loadu_ps(ps + 7*lds);
+
+        __m256  t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256  t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256  t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256  t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256  t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256  t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256  t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256  t7 = _mm256_unpackhi_ps(r6, r7);
+
+        r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm256_storeu_ps(pd,         _mm256_permute2f128_ps(r0, r4, 0x20));
+        _mm256_storeu_ps(pd + ldd,   _mm256_permute2f128_ps(r1, r5, 0x20));
+        _mm256_storeu_ps(pd + 2*ldd, _mm256_permute2f128_ps(r2, r6, 0x20));
+        _mm256_storeu_ps(pd + 3*ldd, _mm256_permute2f128_ps(r3, r7, 0x20));
+        _mm256_storeu_ps(pd + 4*ldd, _mm256_permute2f128_ps(r0, r4, 0x31));
+        _mm256_storeu_ps(pd + 5*ldd, _mm256_permute2f128_ps(r1, r5, 0x31));
+        _mm256_storeu_ps(pd + 6*ldd, _mm256_permute2f128_ps(r2, r6, 0x31));
+        _mm256_storeu_ps(pd + 7*ldd, _mm256_permute2f128_ps(r3, r7, 0x31));
+    }
+};
+
+template<>
+struct transpose_tile<double>
+{
+    static constexpr ptrdiff_t  size = 4;
+
+    static void
+    transpose(double const* ps, ptrdiff_t lds, double* pd, ptrdiff_t ldd) noexcept
+    {
+        __m256d     r0 = _mm256_loadu_pd(ps);
+        __m256d     r1 = _mm256_loadu_pd(ps + lds);
+        __m256d     r2 = _mm256_loadu_pd(ps + 2*lds);
+        __m256d     r3 = _mm256_loadu_pd(ps + 3*lds);
+
+        __m256d     t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d     t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d     t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d     t3 = _mm256_unpackhi_pd(r2, r3);
+
+        _mm256_storeu_pd(pd,         _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(pd + ldd,   _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(pd + 2*ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(pd + 3*ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+};
+
+#elif defined(LA_SIMD_SSE2)
+
+template<>
+struct transpose_tile<float>
+{
+    static constexpr ptrdiff_t  size = 4;
+
+    static void
+    transpose(float const* ps, ptrdiff_t lds, float* pd, ptrdiff_t ldd) noexcept
+    {
+        __m128  r0 = _mm_loadu_ps(ps);
+        __m128  r1 = _mm_loadu_ps(ps + lds);
+        __m128  r2 = _mm_loadu_ps(ps + 2*lds);
+        __m128  r3 = _mm_loadu_ps(ps + 3*lds);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(pd,         r0);
+        _mm_storeu_ps(pd + ldd,   r1);
+        _mm_storeu_ps(pd + 2*ldd, r2);
+        _mm_storeu_ps(pd + 3*ldd, r3);
+    }
+};
+
+template<>
+struct transpose_tile<double>
+{
+    static constexpr ptrdiff_t  size = 2;
+
+    static void
+    transpose(double const* ps, ptrdiff_t lds, double* pd, ptrdiff_t ldd) noexcept
+    {
+        __m128d     r0 = _mm_loadu_pd(ps);
+        __m128d     r1 = _mm_loadu_pd(ps + lds);
+
+        _mm_storeu_pd(pd,       _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(pd + ldd, _mm_unpackhi_pd(r0, r1));
+    }
+};
+
+#endif
+
+//==================================================================================================
+//  The kernel.  Its member function copy() sets D(i, j) = S(i, j) for an (m x n) source S and
+//  destination D, each described by a pointer to its (0, 0) element and a pair of row/column
+//  strides.  It requires that the columns of S, and the rows of D, be contiguous, or the other
+//  way around; the second case is handled by exchanging the roles of rows and columns.  The
+//  kernel is declared in private_support.hpp, so that assign_from_matrix_engine() can use it.
+//==================================================================================================
+//
+template<class T, class U>
+struct transpose_kernel
+{
+    //- The edge of the square blocks at which the recursion stops; a pair of 32 x 32 blocks of
+    //  complex<double> fills a 32K L1 data cache.
+    //
+    static constexpr ptrdiff_t  leaf = 32;
+
+    static void     copy(ptrdiff_t m, ptrdiff_t n, U const* ps, ptrdiff_t rss, ptrdiff_t css,
+                         T* pd, ptrdiff_t rsd, ptrdiff_t csd);
+
+  private:
+    static void     copy_recursive(ptrdiff_t m, ptrdiff_t n, U const* ps, ptrdiff_t lds,
+                                   T* pd, ptrdiff_t ldd);
+    static void     copy_block(ptrdiff_t m, ptrdiff_t n, U const* ps, ptrdiff_t lds,
+                               T* pd, ptrdiff_t ldd);
+};
+
+template<class T, class U>
+void
+transpose_kernel<T,U>::copy
+(ptrdiff_t m, ptrdiff_t n, U const* ps, ptrdiff_t rss, ptrdiff_t css, T* pd, ptrdiff_t rsd, ptrdiff_t csd)
+{
+    if (rss == 1  &&  csd == 1)
+    {
+        copy_recursive(m, n, ps, css, pd, rsd);
+    }
+    else
+    {
+        copy_recursive(n, m, ps, rss, pd, csd);
+    }
+}
+
+//- Here, and below, element S(i, j) is at ps[i + j*lds], and element D(i, j) is at pd[i*ldd + j].
+//
+template<class T, class U>
+void
+transpose_kernel<T,U>::copy_recursive
+(ptrdiff_t m, ptrdiff_t n, U const* ps, ptrdiff_t lds, T* pd, ptrdiff_t ldd)
+{
+    while (m > leaf  ||  n > leaf)
+    {
+        if (m >= n)
+        {
+            ptrdiff_t const     mh = m / 2;
+
+            copy_recursive(mh, n, ps, lds, pd, ldd);
+            ps += mh;
+            pd += mh*ldd;
+            m  -= mh;
+        }
+        else
+        {
+            ptrdiff_t const     nh = n / 2;
+
+            copy_recursive(m, nh, ps, lds, pd, ldd);
+            ps += nh*lds;
+            pd += nh;
+            n  -= nh;
+        }
+    }
+    copy_block(m, n, ps, lds, pd, ldd);
+}
+
+template<class T, class U>
+void
+transpose_kernel<T,U>::copy_block
+(ptrdiff_t m, ptrdiff_t n, U const* ps, ptrdiff_t lds, T* pd, ptrdiff_t ldd)
+{
+    ptrdiff_t   mt = 0;
+    ptrdiff_t   nt = 0;
+
+    //- Whole tiles are transposed in registers, when the element types allow it...
+    //
+    if constexpr (is_same_v<T, U>  &&  transpose_tile<T>::size != 0)
+    {
+        constexpr ptrdiff_t     TS = transpose_tile<T>::size;
+
+        mt = m - m % TS;
+        nt = n - n % TS;
+
+        for (ptrdiff_t i = 0;  i < mt;  i += TS)
+        {
+            for (ptrdiff_t j = 0;  j < nt;  j += TS)
+            {
+                transpose_tile<T>::transpose(ps + i + j*lds, lds, pd + i*ldd + j, ldd);
+            }
+        }
+    }
+
+    //- ...and whatever remains at the right-hand and bottom edges is copied by scalar loops.
+    //
+    for (ptrdiff_t i = 0;  i < mt;  ++i)
+    {
+        for (ptrdiff_t j = nt;  j < n;  ++j)
+        {
+            pd[i*ldd + j] = static_cast<T>(ps[i + j*lds]);
+        }
+    }
+    for (ptrdiff_t i = mt;  i < m;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < n;  ++j)
+        {
+            pd[i*ldd + j] = static_cast<T>(ps[i + j*lds]);
+        }
+    }
+}
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_TRANSPOSE_KERNELS_HPP_DEFINED
@@ -611,5 +611,100 @@ vector_view_engine<ET, VCT, row_view_tag>::vector_view_engine(referent_type& eng
 ,   m_row(row)
 {}
 
+//==================================================================================================
+//  Vector expression engine, meant to act as a "view" of a pending element-wise operation (sum,
+//  difference, or scaling) on one or two operands.  See the matrix expression engine for details.
+//==================================================================================================
+//
+template<class EXPR>
+class vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_vector_engine_tag;
+    using element_type    = typename EXPR::element_type;
+    using value_type      = remove_cv_t<element_type>;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type;
+    using const_reference = element_type;
+    using difference_type = typename EXPR::difference_type;
+    using index_type      = typename EXPR::index_type;
+
+    //- Construct/copy/destroy
+    //
+    ~vector_view_engine() noexcept = default;
+
+    constexpr vector_view_engine() = default;
+    constexpr vector_view_engine(vector_view_engine&&) noexcept = default;
+    constexpr vector_view_engine(vector_view_engine const&) = default;
+    explicit constexpr vector_view_engine(EXPR const& expr);
+
+    constexpr vector_view_engine&    operator =(vector_view_engine&&) noexcept = default;
+    constexpr vector_view_engine&    operator =(vector_view_engine const&) = default;
+
+    //- Capacity
+    //
+    constexpr index_type    capacity() const noexcept;
+    constexpr index_type    size() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(index_type i) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(vector_view_engine& rhs) noexcept;
+
+  private:
+    EXPR    m_expr;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class EXPR> constexpr
+vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::vector_view_engine(EXPR const& expr)
+:   m_expr(expr)
+{}
+
+//----------
+//- Capacity
+//
+template<class EXPR> constexpr
+typename vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::index_type
+vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::capacity() const noexcept
+{
+    return m_expr.size();
+}
+
+template<class EXPR> constexpr
+typename vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::index_type
+vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::size() const noexcept
+{
+    return m_expr.size();
+}
+
+//----------------
+//- Element access
+//
+template<class EXPR> constexpr
+typename vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::reference
+vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::operator ()(index_type i) const
+{
+    return m_expr(i);
+}
+
+//-----------
+//- Modifiers
+//
+template<class EXPR> constexpr
+void
+vector_view_engine<EXPR, readable_vector_engine_tag, expression_view_tag>::swap(vector_view_engine& rhs) noexcept
+{
+    detail::la_swap(m_expr, rhs.m_expr);
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_SUBVECTOR_ENGINE_HPP_DEFINED
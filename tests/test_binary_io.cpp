@@ -0,0 +1,310 @@
+#include "test_common.hpp"
+
+#include <cstdio>
+
+//==================================================================================================
+//  Unit tests for the binary file format.  Vectors and matrices saved to a file must load back
+//  unchanged, whatever their engines and layouts; mismatched files must be rejected; and files
+//  must be mappable without copying their elements.
+//==================================================================================================
+//
+namespace {
+
+std::string
+temp_path(char const* name)
+{
+    return ::testing::TempDir() + "la_io_" + name + ".bin";
+}
+
+}   //- anonymous namespace
+
+
+TEST(BinaryIO, SaveLoadMatrix)
+{
+    std::string const   path = temp_path("matrix");
+
+    dyn_matrix<double>  d1(7, 5, 9, 8);
+    dyn_matrix<double>  d2;
+
+    fill_matrix(d1, 1);
+    save(path, d1);
+    load(path, d2);
+    check_equal(d2, d1);
+
+    //- Column-major matrices are stored column by column, and may be loaded into either layout.
+    //
+    dyn_matrix<cx_double, std::allocator<cx_double>, column_major>  c1(4, 6), c2;
+    dyn_matrix<cx_double>                                           r2(1, 1);
+
+    fill_matrix(c1, 2);
+    c1(3, 5) = cx_double(1.5, -2.5);
+    save(path, c1);
+    load(path, c2);
+    load(path, r2);
+    check_equal(c2, c1);
+    check_equal(r2, c1);
+
+    //- Fixed-size destinations must have the size recorded in the file.
+    //
+    fs_matrix<int, 3, 4>    f1, f2;
+    fs_matrix<int, 4, 3>    f3;
+
+    fill_matrix(f1, 3);
+    save(path, f1);
+    load(path, f2);
+    check_equal(f2, f1);
+    EXPECT_THROW(load(path, f3), runtime_error);
+
+    //- Views are saved by value.
+    //
+    dyn_matrix<int>     d3;
+
+    save(path, f1.t());
+    load(path, d3);
+    check_equal(d3, f1.t());
+
+    save(path, d1.submatrix(1, 3, 2, 2));
+    load(path, d2);
+    check_equal(d2, d1.submatrix(1, 3, 2, 2));
+
+    std::remove(path.c_str());
+}
+
+
+TEST(BinaryIO, SaveLoadVector)
+{
+    std::string const   path = temp_path("vector");
+
+    dyn_vector<float>   v1(100), v2;
+    fs_vector<float, 100>   f1;
+    fs_vector<float, 3>     f2;
+
+    for (ptrdiff_t i = 0;  i < v1.size();  ++i)
+    {
+        v1(i) = static_cast<float>(i) * 0.25f;
+    }
+
+    save(path, v1);
+    load(path, v2);
+    load(path, f1);
+    EXPECT_THROW(load(path, f2), runtime_error);
+    EXPECT_TRUE(v_cmp_eq(v2.engine(), v1.engine()));
+    EXPECT_TRUE(v_cmp_eq(f1.engine(), v1.engine()));
+
+    dyn_matrix<float>   m1(3, 4);
+
+    fill_matrix(m1, 4);
+    save(path, m1.row(2));
+    load(path, v2);
+    EXPECT_TRUE(v_cmp_eq(v2.engine(), m1.row(2).engine()));
+
+    std::remove(path.c_str());
+}
+
+
+TEST(BinaryIO, InvalidFiles)
+{
+    std::string const   path = temp_path("invalid");
+
+    dyn_matrix<double>  d1(3, 4);
+    dyn_vector<double>  v1(3);
+    dyn_matrix<float>   f1;
+
+    EXPECT_THROW(load(temp_path("missing"), d1), runtime_error);
+
+    save(path, d1);
+    EXPECT_THROW(load(path, f1), runtime_error);
+    EXPECT_THROW(load(path, v1), runtime_error);
+
+    save(path, v1);
+    EXPECT_THROW(load(path, d1), runtime_error);
+
+    //- Truncated payload.
+    //
+    {
+        std::ofstream   os(path, std::ios::binary | std::ios::trunc);
+        auto const      hdr = detail::make_file_header<double, row_major>(2, 3, 4, 3, 4);
+
+        os.write(reinterpret_cast<char const*>(&hdr), sizeof(hdr));
+        os.write(reinterpret_cast<char const*>(d1.span().data()), 5*sizeof(double));
+    }
+    EXPECT_THROW(load(path, d1), runtime_error);
+
+    {
+        std::ofstream   os(path, std::ios::binary | std::ios::trunc);
+        os << "short";
+    }
+    EXPECT_THROW(load(path, d1), runtime_error);
+
+    std::remove(path.c_str());
+}
+
+
+TEST(BinaryIO, RowWriter)
+{
+    std::string const   path = temp_path("rows");
+
+    dyn_matrix<double>  d1(300, 17);
+
+    fill_matrix(d1, 5);
+
+    {
+        matrix_row_writer<double>   w(path, 17);
+
+        for (ptrdiff_t i = 0;  i < 150;  ++i)
+        {
+            w.write_row(d1.row(i));
+        }
+        for (ptrdiff_t i = 150;  i < 300;  ++i)
+        {
+            w.write_row(&d1(i, 0));
+        }
+        EXPECT_EQ(w.rows(), 300);
+        EXPECT_EQ(w.columns(), 17);
+        EXPECT_THROW(w.write_row(dyn_vector<double>(16)), runtime_error);
+    }
+
+    dyn_matrix<double>  d2;
+
+    load(path, d2);
+    check_equal(d2, d1);
+
+    //- An explicitly-closed writer rejects further rows.
+    //
+    matrix_row_writer<int>  w2(path, 3);
+
+    w2.write_row(dyn_vector<int>{1, 2, 3});
+    w2.close();
+    EXPECT_FALSE(w2.is_open());
+    EXPECT_THROW(w2.write_row(dyn_vector<int>{4, 5, 6}), runtime_error);
+
+    dyn_matrix<int>     d3;
+
+    load(path, d3);
+    check_equal(d3, dyn_matrix<int>{{1, 2, 3}});
+
+    //- Move-assigning onto an open writer completes the file it was writing.
+    //
+    std::string const   path2 = temp_path("rows2");
+
+    {
+        matrix_row_writer<int>  w3(path, 3);
+        matrix_row_writer<int>  w4(path2, 2);
+
+        w3.write_row(dyn_vector<int>{1, 2, 3});
+        w3.write_row(dyn_vector<int>{4, 5, 6});
+        w4.write_row(dyn_vector<int>{7, 8});
+
+        w3 = std::move(w4);
+        EXPECT_EQ(w3.rows(), 1);
+        EXPECT_EQ(w3.columns(), 2);
+        EXPECT_FALSE(w4.is_open());
+
+        load(path, d3);
+        check_equal(d3, dyn_matrix<int>{{1, 2, 3}, {4, 5, 6}});
+
+        w3.write_row(dyn_vector<int>{9, 10});
+    }
+    load(path2, d3);
+    check_equal(d3, dyn_matrix<int>{{7, 8}, {9, 10}});
+
+    //- A file to which no rows were written holds an empty matrix, which is rejected.
+    //
+    {
+        matrix_row_writer<int>  w5(path, 3);
+    }
+    EXPECT_THROW(load(path, d3), runtime_error);
+    check_equal(d3, dyn_matrix<int>{{7, 8}, {9, 10}});
+
+    std::remove(path.c_str());
+    std::remove(path2.c_str());
+}
+
+
+#ifdef LA_HAS_MMAP
+TEST(BinaryIO, MappedFile)
+{
+    std::string const   path = temp_path("mapped");
+
+    dyn_matrix<double>  d1(40, 30);
+    dyn_matrix<double, std::allocator<double>, column_major>    c1(40, 30);
+
+    fill_matrix(d1, 6);
+    fill_matrix(c1, 6);
+    save(path, d1);
+
+    {
+        mapped_file     mf(path);
+
+        EXPECT_EQ(mf.rank(), 2);
+        EXPECT_EQ(mf.rows(), 40);
+        EXPECT_EQ(mf.columns(), 30);
+        EXPECT_FALSE(mf.is_column_major());
+
+        auto    m1 = mf.as_matrix<double>();
+
+        EXPECT_TRUE((is_same_v<decltype(m1), mdspan_matrix<double const>>));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(m1.span().data()) % 64, 0u);
+        check_equal(m1, d1);
+        check_equal(m1 * d1.t(), d1 * d1.t());
+
+        EXPECT_THROW(mf.as_matrix<float>(), runtime_error);
+        EXPECT_THROW((mf.as_matrix<double, column_major>()), runtime_error);
+    }
+
+    //- Column-major files map as column-major matrices.
+    //
+    save(path, c1);
+    {
+        mapped_file     mf(path);
+        auto            m2 = mf.as_matrix<double, column_major>();
+
+        EXPECT_TRUE(mf.is_column_major());
+        EXPECT_EQ(m2.span().stride(1), 40);
+        check_equal(m2, c1);
+    }
+
+    //- Files written by mmap_matrix_engine may have spare capacity, which becomes padding.
+    //
+    {
+        mmap_matrix<double>     m3(mmap_matrix_engine<double>(path, 40, 30, 50, 32));
+
+        m3 = d1;
+    }
+    {
+        mapped_file         mf(path);
+        auto                m4 = mf.as_matrix<double>();
+        dyn_matrix<double>  d4;
+
+        EXPECT_EQ(m4.span().stride(0), 32);
+        check_equal(m4, d1);
+
+        load(path, d4);
+        check_equal(d4, d1);
+
+        //- And a mapping may be moved.
+        //
+        mapped_file         mf2(std::move(mf));
+
+        EXPECT_EQ(mf.rank(), 0);
+        check_equal(mf2.as_matrix<double>(), d1);
+    }
+
+    //- Vectors map as matrices with one row.
+    //
+    dyn_vector<int>     v1{3, 1, 4, 1, 5};
+
+    save(path, v1);
+    {
+        mapped_file     mf(path);
+        auto            m5 = mf.as_matrix<int>();
+
+        EXPECT_EQ(mf.rank(), 1);
+        EXPECT_EQ(m5.rows(), 1);
+        EXPECT_EQ(m5.columns(), 5);
+        EXPECT_EQ(m5(0, 4), 5);
+    }
+
+    std::remove(path.c_str());
+}
+#endif
@@ -0,0 +1,306 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for matrix_blas_operation_traits.  When the library is configured with a CBLAS
+//  library (LA_USE_CBLAS), products and updates of the BLAS element types are handed to it;
+//  otherwise they are computed by the built-in kernels.  Either way the results must agree with
+//  simple loops, to within a tolerance that allows for a different order of accumulation.
+//==================================================================================================
+//
+namespace {
+
+using blas_traits = matrix_blas_operation_traits;
+
+template<class T, class L = row_major>
+using blas_matrix = matrix<dr_matrix_engine<T, std::allocator<T>, L>, blas_traits>;
+
+template<class T>
+using blas_vector = STD_LA::vector<dr_vector_engine<T>, blas_traits>;
+
+template<class T>
+double
+tolerance(ptrdiff_t inner)
+{
+    return 16.0 * static_cast<double>(std::numeric_limits<detail::simd_real_t<T>>::epsilon())
+                * static_cast<double>(inner + 1);
+}
+
+template<class T, class L1, class L2>
+void
+check_product(ptrdiff_t rows, ptrdiff_t cols, ptrdiff_t inner)
+{
+    blas_matrix<T, L1>  m1(rows, inner), t1(inner, rows);
+    blas_matrix<T, L2>  m2(inner, cols), t2(cols, inner);
+
+    fill_matrix(m1, 1, 7);
+    fill_matrix(m2, 2, 7);
+    fill_matrix(t1, 3, 7);
+    fill_matrix(t2, 4, 7);
+
+    double const    tol = tolerance<T>(inner);
+
+    check_close(m1 * m2, reference_product<cx_double>(m1, m2), tol);
+    check_close(t1.t() * m2, reference_product<cx_double>(t1.t(), m2), tol);
+    check_close(m1 * t2.t(), reference_product<cx_double>(m1, t2.t()), tol);
+    check_close(t1.t() * t2.t(), reference_product<cx_double>(t1.t(), t2.t()), tol);
+}
+
+}   //- anonymous namespace
+
+
+TEST(BlasTraits, Selection)
+{
+    using mat_t = blas_matrix<double>;
+    using vec_t = blas_vector<double>;
+    using cas_t = select_matrix_compound_assignment_t<blas_traits, vec_t, vec_t>;
+    using fma_t = select_matrix_multiply_add_arithmetic_t<blas_traits, mat_t, mat_t>;
+
+    EXPECT_TRUE((is_same_v<decltype(mat_t() * mat_t()), mat_t>));
+    EXPECT_TRUE((is_same_v<cas_t, matrix_blas_compound_assignment_traits<blas_traits, vec_t, vec_t>>));
+    EXPECT_TRUE((is_same_v<fma_t, matrix_blas_multiply_add_traits<blas_traits, mat_t, mat_t>>));
+
+    EXPECT_EQ(detail::has_cblas, (detail::use_blas_gemm_v<dr_matrix_engine<double>, dr_matrix_engine<double>,
+                                                           dr_matrix_engine<double>>));
+    EXPECT_FALSE((detail::use_blas_gemm_v<dr_matrix_engine<int>, dr_matrix_engine<int>, dr_matrix_engine<int>>));
+    EXPECT_FALSE((detail::use_blas_v<dr_vector_engine<float>, dr_vector_engine<double>, dr_vector_engine<double>>));
+}
+
+
+TEST(BlasTraits, Routing)
+{
+    //- Operands with a unit stride are described by a leading dimension and a transpose flag;
+    //  others, and all operands when no CBLAS library is configured, are declined.
+    //
+    std::vector<double>     a(6*8, 1.0), b(8*5, 2.0), c(6*5, 0.0);
+
+    EXPECT_EQ(detail::blas_gemm(6, 5, 8, 1.0, a.data(), 8, 1, false, b.data(), 5, 1, false, 0.0, c.data(), 5, 1),
+              detail::has_cblas);
+    EXPECT_EQ(detail::blas_gemm(6, 5, 8, 1.0, a.data(), 1, 6, false, b.data(), 1, 8, false, 0.0, c.data(), 1, 6),
+              detail::has_cblas);
+    EXPECT_FALSE(detail::blas_gemm(3, 5, 8, 1.0, a.data(), 16, 2, false, b.data(), 5, 1, false, 0.0, c.data(), 5, 1));
+    EXPECT_FALSE(detail::blas_gemm(6, 5, 8, 1.0, a.data(), 4, 1, false, b.data(), 5, 1, false, 0.0, c.data(), 5, 1));
+    EXPECT_FALSE(detail::blas_gemm(6, 5, 0, 1.0, a.data(), 8, 1, false, b.data(), 5, 1, false, 0.0, c.data(), 5, 1));
+
+    if constexpr (detail::has_cblas)
+    {
+        EXPECT_EQ(c[0], 16.0);
+        EXPECT_EQ(c[29], 16.0);
+    }
+
+    //- A conjugated operand can only be passed as the transpose of a row-major array.
+    //
+    std::vector<cx_double>  ca(4*4), cc(4*4);
+
+    EXPECT_FALSE(detail::blas_gemm(4, 4, 4, cx_double(1), ca.data(), 4, 1, true, ca.data(), 4, 1, false,
+                                   cx_double(0), cc.data(), 4, 1));
+    EXPECT_EQ(detail::blas_gemm(4, 4, 4, cx_double(1), ca.data(), 1, 4, true, ca.data(), 4, 1, false,
+                                cx_double(0), cc.data(), 4, 1),
+              detail::has_cblas);
+}
+
+
+TEST(BlasTraits, MatrixProducts)
+{
+    check_product<double, row_major, row_major>(37, 29, 41);
+    check_product<double, column_major, row_major>(37, 29, 41);
+    check_product<double, row_major, column_major>(8, 50, 3);
+    check_product<float, column_major, column_major>(64, 64, 64);
+    check_product<cx_float, row_major, row_major>(20, 21, 22);
+    check_product<cx_double, column_major, row_major>(33, 17, 25);
+
+    //- Degenerate and small fixed-size products.
+    //
+    check_product<double, row_major, row_major>(1, 1, 1);
+    check_product<double, row_major, row_major>(1, 40, 1);
+
+    matrix<fs_matrix_engine<double, 3, 3>, blas_traits>    f1, f2;
+
+    fill_matrix(f1, 5, 7);
+    fill_matrix(f2, 6, 7);
+    check_close(f1 * f2, reference_product<cx_double>(f1, f2), tolerance<double>(3));
+
+    matrix<fs_matrix_engine<float, 8, 6>, blas_traits>  f3;
+    matrix<fs_matrix_engine<float, 6, 9>, blas_traits>  f4;
+
+    fill_matrix(f3, 7, 7);
+    fill_matrix(f4, 8, 7);
+    check_close(f3 * f4, reference_product<cx_double>(f3, f4), tolerance<float>(6));
+
+    //- Submatrix views with a leading dimension larger than their width, and hermitian views.
+    //
+    blas_matrix<cx_double>  m1(40, 30), m2(30, 40);
+
+    fill_matrix(m1, 9, 7);
+    fill_matrix(m2, 10, 7);
+
+    auto const  s1 = m1.submatrix(3, 20, 4, 25);
+    auto const  s2 = m2.submatrix(1, 25, 2, 30);
+
+    check_close(s1 * s2, reference_product<cx_double>(s1, s2), tolerance<cx_double>(25));
+
+    auto    conj_transpose = [](auto const& m)
+    {
+        dyn_matrix<cx_double>   mh(m.columns(), m.rows());
+
+        for (ptrdiff_t i = 0;  i < m.rows();  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < m.columns();  ++j)
+            {
+                mh(j, i) = std::conj(m(i, j));
+            }
+        }
+        return mh;
+    };
+
+    check_close(m1.h() * m1, reference_product<cx_double>(conj_transpose(m1), m1), tolerance<cx_double>(40));
+    check_close(m2 * m2.h(), reference_product<cx_double>(m2, conj_transpose(m2)), tolerance<cx_double>(40));
+
+    //- Other element types use the built-in kernels.
+    //
+    matrix<dr_matrix_engine<int>, blas_traits>  i1(3, 4), i2(4, 2);
+
+    fill_matrix(i1, 1);
+    fill_matrix(i2, 2);
+    EXPECT_TRUE(i1 * i2 == (dyn_matrix<int>(i1) * dyn_matrix<int>(i2)));
+}
+
+
+TEST(BlasTraits, VectorProducts)
+{
+    blas_matrix<double>                 m1(23, 17);
+    blas_matrix<double, column_major>   m2(17, 23);
+    blas_vector<double>                 v1(17), v2(23);
+
+    fill_matrix(m1, 1, 7);
+    fill_matrix(m2, 2, 7);
+    fill_vector(v1, 3, 7);
+    fill_vector(v2, 4, 7);
+
+    auto    check = [](auto const& vr, auto const& m, auto const& v, bool left)
+    {
+        ASSERT_EQ(vr.size(), (left) ? m.columns() : m.rows());
+
+        for (ptrdiff_t i = 0;  i < vr.size();  ++i)
+        {
+            double  er = 0;
+
+            for (ptrdiff_t k = 0;  k < v.size();  ++k)
+            {
+                er += (left) ? v(k) * m(k, i) : m(i, k) * v(k);
+            }
+            EXPECT_NEAR(vr(i), er, tolerance<double>(v.size())) << i;
+        }
+    };
+
+    check(m1 * v1, m1, v1, false);
+    check(m2 * v2, m2, v2, false);
+    check(v2 * m1, m1, v2, true);
+    check(v1 * m2, m2, v1, true);
+    check(m1.t() * v2, m1.t(), v2, false);
+    check(v1 * m1.t(), m1.t(), v1, true);
+
+    //- Row and column views are strided vectors.
+    //
+    check(m1 * m2.column(3), m1, m2.column(3), false);
+    check(m1.row(4) * m2, m2, m1.row(4), true);
+
+    //- Inner products, real and complex (without conjugation).
+    //
+    double  dr = 0;
+
+    for (ptrdiff_t i = 0;  i < v1.size();  ++i)
+    {
+        dr += v1(i) * m2(i, 5);
+    }
+    EXPECT_NEAR(v1 * m2.column(5), dr, tolerance<double>(17));
+
+    blas_vector<cx_float>   c1(50), c2(50);
+    cx_double               cr{};
+
+    fill_vector(c1, 5, 7);
+    fill_vector(c2, 6, 7);
+
+    for (ptrdiff_t i = 0;  i < c1.size();  ++i)
+    {
+        cr += cx_double(c1(i)) * cx_double(c2(i));
+    }
+    EXPECT_LE(std::abs(cx_double(c1 * c2) - cr), tolerance<cx_float>(50));
+}
+
+
+TEST(BlasTraits, MultiplyAdd)
+{
+    blas_matrix<double>                 a(30, 20), c(30, 25);
+    blas_matrix<double, column_major>   b(20, 25), d(30, 25);
+
+    fill_matrix(a, 1, 7);
+    fill_matrix(b, 2, 7);
+    fill_matrix(c, 3, 7);
+    d = c;
+
+    auto    ref = reference_product<cx_double>(a, b);
+
+    for (ptrdiff_t i = 0;  i < ref.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < ref.columns();  ++j)
+        {
+            ref(i, j) = 2.0 * ref(i, j) - 0.5 * c(i, j);
+        }
+    }
+
+    multiply_add(2.0, a, b, -0.5, c);
+    check_close(c, ref, tolerance<double>(20));
+
+    multiply_add(2.0, a, b, -0.5, d);
+    check_close(d, ref, tolerance<double>(20));
+
+    EXPECT_THROW(multiply_add(1.0, a, a, 0.0, c), runtime_error);
+}
+
+
+TEST(BlasTraits, CompoundAssignment)
+{
+    blas_vector<double>     v1(40), v2(40), v3(40);
+
+    fill_vector(v1, 1, 7);
+    fill_vector(v2, 2, 7);
+    v3 = v1;
+
+    v1 += v2;
+    v1 -= v2;
+    v1 -= v2;
+
+    for (ptrdiff_t i = 0;  i < v1.size();  ++i)
+    {
+        EXPECT_NEAR(v1(i), v3(i) - v2(i), 1e-14);
+    }
+
+    blas_matrix<cx_double>                  m1(12, 9), m3(12, 9);
+    blas_matrix<cx_double, column_major>    m2(12, 9);
+
+    fill_matrix(m1, 3, 7);
+    fill_matrix(m2, 4, 7);
+    m3 = m1;
+
+    //- Operands of the same layout are updated a line at a time; mixed layouts fall back.
+    //
+    m1 += m3;
+    m1 -= m2;
+    m1.submatrix(2, 5, 1, 4) += m3.submatrix(0, 5, 0, 4);
+
+    for (ptrdiff_t i = 0;  i < m1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < m1.columns();  ++j)
+        {
+            cx_double   er = 2.0 * m3(i, j) - m2(i, j);
+
+            if (i >= 2  &&  i < 7  &&  j >= 1  &&  j < 5)
+            {
+                er += m3(i - 2, j - 1);
+            }
+            EXPECT_LE(std::abs(m1(i, j) - er), 1e-14) << "(" << i << ", " << j << ")";
+        }
+    }
+
+    EXPECT_THROW(m1 += blas_matrix<cx_double>(3, 3), runtime_error);
+}
@@ -0,0 +1,346 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the Cholesky and LDL^T factorizations, the triangular solves, and the rank-1
+//  update and downdate.  Hermitian positive definite operands are formed as B*B^H + n*I from
+//  pseudo-random B; their strict upper triangles are then overwritten with a marker value, which
+//  the factorizations must neither read nor modify.
+//==================================================================================================
+//
+namespace {
+
+template<class MT>
+MT
+make_hpd(ptrdiff_t n, unsigned seed)
+{
+    using elem_t = typename MT::element_type;
+
+    dyn_matrix<elem_t>  b(n, n), a(n, n);
+
+    fill_random(b, seed);
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < n;  ++j)
+        {
+            elem_t  e = (i == j) ? elem_t(static_cast<double>(n)) : elem_t{};
+
+            for (ptrdiff_t k = 0;  k < n;  ++k)
+            {
+                e = e + b(i, k) * conj_of(b(j, k));
+            }
+            a(i, j) = e;
+        }
+    }
+    return MT(a);
+}
+
+template<class MT>
+bool
+upper_is_marked(MT const& m)
+{
+    using elem_t = typename MT::element_type;
+
+    for (ptrdiff_t i = 0;  i < m.rows();  ++i)
+    {
+        for (ptrdiff_t j = i + 1;  j < m.columns();  ++j)
+        {
+            if (m(i, j) != elem_t(12345)) return false;
+        }
+    }
+    return true;
+}
+
+//- Returns the largest difference between A and L*D*L^H, where L is the lower triangle of LD
+//  (with a unit diagonal if LDLT is true) and D is the diagonal of LD (or the identity).
+//
+template<bool LDLT, class M1, class M2>
+double
+factor_error(M1 const& a, M2 const& ld)
+{
+    using elem_t = typename M1::element_type;
+
+    double  diff = 0.0;
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j <= i;  ++j)
+        {
+            elem_t  e{};
+
+            for (ptrdiff_t k = 0;  k <= j;  ++k)
+            {
+                if constexpr (LDLT)
+                {
+                    elem_t const    lik = (k == i) ? elem_t{1} : ld(i, k);
+                    elem_t const    ljk = (k == j) ? elem_t{1} : ld(j, k);
+                    e = e + lik * ld(k, k) * conj_of(ljk);
+                }
+                else
+                {
+                    e = e + ld(i, k) * conj_of(ld(j, k));
+                }
+            }
+            diff = std::max(diff, magnitude(e - a(i, j)));
+        }
+    }
+    return diff;
+}
+
+template<class MT>
+void
+check_factors(ptrdiff_t n, unsigned seed, double tol)
+{
+    MT  a = make_hpd<MT>(n, seed);
+    MT  l = a;
+    MT  d = a;
+
+    mark_upper(l);
+    mark_upper(d);
+    cholesky_factor(l);
+    ldlt_factor(d);
+
+    EXPECT_TRUE(upper_is_marked(l));
+    EXPECT_TRUE(upper_is_marked(d));
+    EXPECT_LE(factor_error<false>(a, l), tol);
+    EXPECT_LE(factor_error<true>(a, d), tol);
+}
+
+}   //- anonymous namespace
+
+
+TEST(CholeskyDecomposition, Factor)
+{
+    check_factors<dyn_matrix<double>>(1, 1, 1e-12);
+    check_factors<dyn_matrix<double>>(10, 2, 1e-12);
+    check_factors<dyn_matrix<double>>(48, 3, 1e-11);
+    check_factors<dyn_matrix<double>>(100, 4, 1e-10);
+    check_factors<dyn_matrix<double>>(150, 5, 1e-10);
+    check_factors<dyn_matrix<double, allocator<double>, column_major>>(130, 6, 1e-10);
+    check_factors<dyn_matrix<float>>(70, 7, 1e-2);
+    check_factors<dyn_matrix<cx_double>>(110, 8, 1e-10);
+    check_factors<fs_matrix<double, 4, 4>>(4, 9, 1e-13);
+    check_factors<fs_matrix<double, 60, 60>>(60, 10, 1e-10);
+
+    //- A transpose view of the operand is factored in place; its lower triangle is the upper
+    //  triangle of the operand.
+    //
+    dyn_matrix<double>  a = make_hpd<dyn_matrix<double>>(90, 11);
+    dyn_matrix<double>  b = a;
+
+    cholesky_factor(b.t());
+    EXPECT_LE(factor_error<false>(a, b.t()), 1e-10);
+
+    //- A matrix that is not positive definite.
+    //
+    dyn_matrix<double>  c{{1.0, 2.0}, {2.0, 1.0}};
+    dyn_matrix<double>  d(3, 4);
+
+    EXPECT_THROW(cholesky_factor(c), runtime_error);
+    EXPECT_THROW(cholesky_factor(d), runtime_error);
+}
+
+TEST(CholeskyDecomposition, Semidefinite)
+{
+    //- A positive semidefinite matrix of rank one, v*v^T, has an LDL^T factorization with two
+    //  zeros in D, but no Cholesky factorization.
+    //
+    dyn_matrix<double>  a{{1.0, 2.0, 3.0}, {2.0, 4.0, 6.0}, {3.0, 6.0, 9.0}};
+    dyn_matrix<double>  d = a;
+
+    ldlt_factor(d);
+    EXPECT_EQ(d(0, 0), 1.0);
+    EXPECT_EQ(d(1, 0), 2.0);
+    EXPECT_EQ(d(2, 0), 3.0);
+    EXPECT_EQ(d(1, 1), 0.0);
+    EXPECT_EQ(d(2, 2), 0.0);
+    EXPECT_LE(factor_error<true>(a, d), 1e-15);
+    EXPECT_THROW(cholesky_factor(dyn_matrix<double>(a)), runtime_error);
+
+    //- An indefinite matrix also has one, unless a zero pivot has a non-zero column below it.
+    //
+    fs_matrix<double, 2, 2>     b{{1.0, 2.0}, {2.0, 1.0}};
+    fs_matrix<double, 2, 2>     e = b;
+    fs_matrix<double, 2, 2>     f{{0.0, 1.0}, {1.0, 0.0}};
+
+    ldlt_factor(e);
+    EXPECT_EQ(e(1, 0), 2.0);
+    EXPECT_EQ(e(1, 1), -3.0);
+    EXPECT_THROW(ldlt_factor(f), runtime_error);
+}
+
+TEST(CholeskyDecomposition, Solve)
+{
+    using dmat = dyn_matrix<double>;
+
+    dmat                a = make_hpd<dmat>(120, 20);
+    dmat                b(120, 3);
+    dyn_vector<double>  v(120);
+
+    fill_random(b, 21);
+    for (ptrdiff_t i = 0;  i < v.size();  ++i)
+    {
+        v(i) = b(i, 2);
+    }
+
+    dmat    l = a;
+    dmat    d = a;
+
+    cholesky_factor(l);
+    ldlt_factor(d);
+
+    auto    x1 = cholesky_solve(l, b);
+    auto    x2 = ldlt_solve(d, b);
+    auto    y1 = cholesky_solve(l, v);
+    auto    y2 = ldlt_solve(d, v);
+
+    EXPECT_LE(max_difference(a * x1, b), 1e-10);
+    EXPECT_LE(max_difference(a * x2, b), 1e-10);
+    for (ptrdiff_t i = 0;  i < v.size();  ++i)
+    {
+        EXPECT_NEAR(y1(i), x1(i, 2), 1e-12);
+        EXPECT_NEAR(y2(i), x1(i, 2), 1e-12);
+    }
+
+    //- The triangular solves read only the named triangle.
+    //
+    dmat    lt(120, 120), ut(120, 120);
+
+    for (ptrdiff_t i = 0;  i < 120;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j <= i;  ++j)
+        {
+            lt(i, j) = l(i, j);
+            ut(j, i) = l(i, j);
+        }
+    }
+
+    EXPECT_LE(max_difference(lt * lower_triangular_solve(l, b), b), 1e-12);
+    EXPECT_LE(max_difference(ut * upper_triangular_solve(l.t(), b), b), 1e-12);
+
+    auto    z = upper_triangular_solve(ut, lower_triangular_solve(l, v));
+
+    for (ptrdiff_t i = 0;  i < v.size();  ++i)
+    {
+        EXPECT_NEAR(z(i), y1(i), 1e-12);
+    }
+
+    //- Complex elements.
+    //
+    using cmat = dyn_matrix<cx_double>;
+
+    cmat    ca = make_hpd<cmat>(60, 22);
+    cmat    cb(60, 2);
+    cmat    cl = ca;
+
+    fill_random(cb, 23);
+    cholesky_factor(cl);
+    EXPECT_LE(max_difference(ca * cholesky_solve(cl, cb), cb), 1e-10);
+
+    //- Fixed-size operands give fixed-size results.
+    //
+    fs_matrix<double, 3, 3>     fa{{4.0, 2.0, 2.0}, {2.0, 5.0, 3.0}, {2.0, 3.0, 6.0}};
+    fs_vector<double, 3>        fb{8.0, 10.0, 11.0};
+
+    cholesky_factor(fa);
+
+    auto    fx = cholesky_solve(fa, fb);
+
+    EXPECT_TRUE((is_same_v<decltype(fx), fs_vector<double, 3>>));
+    EXPECT_NEAR(fx(0), 1.0, 1e-14);
+    EXPECT_NEAR(fx(1), 1.0, 1e-14);
+    EXPECT_NEAR(fx(2), 1.0, 1e-14);
+
+    EXPECT_THROW(lower_triangular_solve(dmat(3, 3), v), runtime_error);
+}
+
+TEST(CholeskyDecomposition, UpdateDowndate)
+{
+    using dmat = dyn_matrix<double>;
+
+    dmat                a = make_hpd<dmat>(80, 30);
+    dyn_vector<double>  x(80);
+
+    for (ptrdiff_t i = 0;  i < x.size();  ++i)
+    {
+        x(i) = std::sin(0.1 * static_cast<double>(i + 1));
+    }
+
+    dmat    ax = a;
+
+    for (ptrdiff_t i = 0;  i < 80;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 80;  ++j)
+        {
+            ax(i, j) = a(i, j) + x(i) * x(j);
+        }
+    }
+
+    dmat    l = a;
+    dmat    lx = ax;
+
+    cholesky_factor(l);
+    cholesky_factor(lx);
+    mark_upper(l);
+
+    cholesky_update(l, x);
+    EXPECT_TRUE(upper_is_marked(l));
+    EXPECT_LE(factor_error<false>(ax, l), 1e-10);
+
+    cholesky_downdate(l, x);
+    EXPECT_LE(factor_error<false>(a, l), 1e-10);
+
+    cholesky_downdate(lx, x);
+    EXPECT_LE(factor_error<false>(a, lx), 1e-10);
+
+    //- Complex elements.
+    //
+    using cmat = dyn_matrix<cx_double>;
+
+    cmat                    ca = make_hpd<cmat>(40, 31);
+    cmat                    cax = ca;
+    dyn_vector<cx_double>   cx(40);
+
+    for (ptrdiff_t i = 0;  i < cx.size();  ++i)
+    {
+        cx(i) = cx_double(std::cos(0.3 * static_cast<double>(i)), std::sin(0.2 * static_cast<double>(i)));
+    }
+    for (ptrdiff_t i = 0;  i < 40;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 40;  ++j)
+        {
+            cax(i, j) = ca(i, j) + cx(i) * std::conj(cx(j));
+        }
+    }
+
+    cmat    cl = ca;
+
+    cholesky_factor(cl);
+    cholesky_update(cl, cx);
+    EXPECT_LE(factor_error<false>(cax, cl), 1e-10);
+    cholesky_downdate(cl, cx);
+    EXPECT_LE(factor_error<false>(ca, cl), 1e-10);
+
+    //- Downdating past positive definiteness.
+    //
+    dmat                b{{1.0, 0.0}, {0.0, 1.0}};
+    dyn_vector<double>  y{2.0, 0.0};
+
+    cholesky_factor(b);
+    EXPECT_THROW(cholesky_downdate(b, y), runtime_error);
+
+    //- A rejected downdate leaves the factor unchanged, even when the loss of definiteness would
+    //  only be found after modifying its leading columns.
+    //
+    dyn_vector<double>  z{0.6, 0.8, 0.7};
+    dmat                c3{{4.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+
+    cholesky_factor(c3);
+
+    dmat const          c0 = c3;
+
+    EXPECT_THROW(cholesky_downdate(c3, z), runtime_error);
+    EXPECT_TRUE(c3 == c0);
+
+    cholesky_downdate(c3, dyn_vector<double>{0.6, 0.5, 0.0});
+    EXPECT_NEAR(c3(0, 0), std::sqrt(4.0 - 0.36), 1e-15);
+}
@@ -1,6 +1,7 @@
 #ifndef LA_TEST_COMMON_HPP_DEFINED
 #define LA_TEST_COMMON_HPP_DEFINED
 
+#include <atomic>
 #include <iostream>
 #include <iomanip>
 #include <string_view>
@@ -123,6 +124,242 @@ static const mi_init_list   il_44_2 = LST_44_2;
 static const mf_init_list   fl_44_2 = LST_44_2;
 
 
+//- An allocator that counts the allocations made through it, so that tests can check that an
+//  operation on engines using it allocates nothing.  Memory allocated internally by the library,
+//  such as the per-thread packing buffers of the multiplication kernels, is not counted; tests
+//  check that by other means.
+//
+inline std::atomic<long>    allocation_count{0};
+
+template<class T>
+struct counting_allocator : public std::allocator<T>
+{
+    template<class U>
+    struct rebind
+    {
+        using other = counting_allocator<U>;
+    };
+
+    counting_allocator() = default;
+
+    template<class U>
+    counting_allocator(counting_allocator<U> const&) noexcept
+    {}
+
+    T*  allocate(size_t n)
+        {
+            ++allocation_count;
+            return std::allocator<T>::allocate(n);
+        }
+};
+
+template<class T, class L = row_major>
+using counted_matrix = dyn_matrix<T, counting_allocator<T>, L>;
+
+template<class T>
+using counted_vector = dyn_vector<T, counting_allocator<T>>;
+
+//- Returns a test element that depends on its position and on a seed.  Real parts are integers
+//  in [-5, 5], and imaginary parts integers in [-6, 6], divided by the scale; with the default
+//  scale of one, sums and products of elements are exact in every element type.
+//
+template<class T>
+T
+test_value(ptrdiff_t i, ptrdiff_t j, int seed, int scale = 1)
+{
+    if constexpr (detail::is_complex_v<T>)
+    {
+        using real_t = typename T::value_type;
+
+        return T(static_cast<real_t>((i*7 + j*3 + seed) % 11 - 5) / static_cast<real_t>(scale),
+                 static_cast<real_t>((i + j*5 + seed) % 13 - 6) / static_cast<real_t>(scale));
+    }
+    else
+    {
+        return static_cast<T>((i*7 + j*3 + seed) % 11 - 5) / static_cast<T>(scale);
+    }
+}
+
+//- Fills a matrix, or a vector, with the test elements for the given seed and scale; the
+//  elements of a vector are those of the first column of a matrix.
+//
+template<class MT>
+void
+fill_matrix(MT& m, int seed, int scale = 1)
+{
+    using elem_t = typename MT::element_type;
+
+    for (ptrdiff_t i = 0;  i < m.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < m.columns();  ++j)
+        {
+            m(i, j) = test_value<elem_t>(i, j, seed, scale);
+        }
+    }
+}
+
+template<class VT>
+void
+fill_vector(VT& v, int seed, int scale = 1)
+{
+    using elem_t = typename VT::element_type;
+
+    for (ptrdiff_t i = 0;  i < v.size();  ++i)
+    {
+        v(i) = test_value<elem_t>(i, 0, seed, scale);
+    }
+}
+
+//- Computes the product of two matrices with simple inner-product loops, converting the
+//  elements of the operands to T, which by default is the element type of the first operand.
+//
+template<class T = void, class M1, class M2>
+auto
+reference_product(M1 const& m1, M2 const& m2)
+{
+    using elem_t = std::conditional_t<std::is_void_v<T>, typename M1::element_type, T>;
+
+    dyn_matrix<elem_t>  mr(m1.rows(), m2.columns());
+
+    for (ptrdiff_t i = 0;  i < m1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < m2.columns();  ++j)
+        {
+            elem_t  er{};
+
+            for (ptrdiff_t k = 0;  k < m1.columns();  ++k)
+            {
+                er = er + static_cast<elem_t>(m1(i, k)) * static_cast<elem_t>(m2(k, j));
+            }
+            mr(i, j) = er;
+        }
+    }
+    return mr;
+}
+
+template<class M1, class M2>
+void
+check_equal(M1 const& m1, M2 const& m2)
+{
+    ASSERT_EQ(m1.rows(), m2.rows());
+    ASSERT_EQ(m1.columns(), m2.columns());
+
+    for (ptrdiff_t i = 0;  i < m1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < m1.columns();  ++j)
+        {
+            EXPECT_EQ(m1(i, j), m2(i, j));
+        }
+    }
+}
+
+//- Checks that every element of MR is within TOL of the corresponding element of the reference
+//  result MN, which is computed in complex<double>.
+//
+template<class MR, class MN>
+void
+check_close(MR const& mr, MN const& mn, double tol)
+{
+    ASSERT_EQ(mr.rows(), mn.rows());
+    ASSERT_EQ(mr.columns(), mn.columns());
+
+    for (ptrdiff_t i = 0;  i < mr.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < mr.columns();  ++j)
+        {
+            ASSERT_LE(std::abs(cx_double(mr(i, j)) - mn(i, j)), tol) << "(" << i << ", " << j << ")";
+        }
+    }
+}
+
+//- Fills a matrix with pseudo-random elements in [-1, 1], drawn from a linear congruential
+//  sequence determined by the seed; complex elements have pseudo-random real and imaginary
+//  parts.  Used by the tests of the decompositions.
+//
+template<class MT>
+void
+fill_random(MT& m, unsigned seed)
+{
+    using elem_t = typename MT::element_type;
+    using real_t = decltype(std::abs(elem_t{}));
+
+    unsigned    state = seed*2654435761u + 1u;
+    auto        next  = [&state]()
+    {
+        state = state*1664525u + 1013904223u;
+        return static_cast<real_t>(static_cast<int>(state >> 16) % 2001 - 1000) / real_t(1000);
+    };
+
+    for (typename MT::index_type i = 0;  i < m.rows();  ++i)
+    {
+        for (typename MT::index_type j = 0;  j < m.columns();  ++j)
+        {
+            if constexpr (detail::is_complex_v<elem_t>)
+            {
+                real_t const    re = next();
+                m(i, j) = elem_t(re, next());
+            }
+            else
+            {
+                m(i, j) = next();
+            }
+        }
+    }
+}
+
+template<class T>
+double
+magnitude(T const& t)
+{
+    return static_cast<double>(std::abs(t));
+}
+
+template<class T>
+T
+conj_of(T const& t)
+{
+    if constexpr (detail::is_complex_v<T>)
+        return std::conj(t);
+    else
+        return t;
+}
+
+//- Returns the largest magnitude of the element-wise difference of two matrices.
+//
+template<class M1, class M2>
+double
+max_difference(M1 const& m1, M2 const& m2)
+{
+    double  diff = 0.0;
+
+    for (ptrdiff_t i = 0;  i < m1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < m1.columns();  ++j)
+        {
+            diff = std::max(diff, magnitude(m1(i, j) - m2(i, j)));
+        }
+    }
+    return diff;
+}
+
+//- Overwrites the strict upper triangle of a matrix with a marker value, which factorizations
+//  that read only the lower triangle must neither read nor modify.
+//
+template<class MT>
+void
+mark_upper(MT& m)
+{
+    using elem_t = typename MT::element_type;
+
+    for (ptrdiff_t i = 0;  i < m.rows();  ++i)
+    {
+        for (ptrdiff_t j = i + 1;  j < m.columns();  ++j)
+        {
+            m(i, j) = elem_t(12345);
+        }
+    }
+}
+
 template<typename = void>
 struct test_expr : public std::false_type {};
 
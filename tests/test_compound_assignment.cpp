@@ -0,0 +1,319 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the compound assignment operators (+=, -=, *=, and /=).  Each operator must
+//  update its left-hand operand in place, whatever its engine, layout, or view, giving the same
+//  result as the corresponding binary operator; and must allocate nothing.
+//==================================================================================================
+//
+namespace {
+
+template<class T, class L1, class L2>
+void
+check_matrix(ptrdiff_t m, ptrdiff_t n)
+{
+    dyn_matrix<T, std::allocator<T>, L1>    a(m, n);
+    dyn_matrix<T, std::allocator<T>, L2>    b(m, n);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+
+    auto const  ref_add = a + b;
+    auto const  ref_sub = a - b;
+    auto const  ref_mul = a * T(4);
+    auto const  ref_div = a / T(2);
+    auto* const data    = a.span().data();
+
+    a += b;
+    check_equal(a, ref_add);
+    a -= b;
+    a -= b;
+    check_equal(a, ref_sub);
+    a += b;
+    a *= T(4);
+    check_equal(a, ref_mul);
+    a /= T(8);
+    check_equal(a, ref_div);
+
+    //- The update happens in place.
+    //
+    EXPECT_EQ(a.span().data(), data);
+}
+
+//- Operation traits whose compound assignment traits count their calls before deferring to
+//  the default traits.
+//
+struct counting_operation_traits : public matrix_operation_traits
+{
+    static inline int   calls = 0;
+
+    template<class OTR, class OP1, class OP2>
+    struct compound_assignment_traits
+    {
+        using default_traits = matrix_compound_assignment_traits<OTR, OP1, OP2>;
+
+        static constexpr void
+        add_assign(OP1& op1, OP2 const& op2)
+        {
+            ++calls;
+            default_traits::add_assign(op1, op2);
+        }
+
+        static constexpr void
+        multiply_assign(OP1& op1, OP2 const& op2)
+        {
+            ++calls;
+            default_traits::multiply_assign(op1, op2);
+        }
+    };
+};
+
+}   //- anonymous namespace
+
+
+TEST(CompoundAssignment, Vectors)
+{
+    dyn_vector<double>      v1(37), v2(37);
+    fs_vector<double, 37>   f1;
+
+    fill_vector(v1, 1);
+    fill_vector(v2, 2);
+    f1 = v1;
+
+    auto const  ref_add = v1 + v2;
+    auto const  ref_sub = v1 - v2;
+
+    v1 += v2;
+    EXPECT_TRUE(v_cmp_eq(v1.engine(), ref_add.engine()));
+    v1 -= v2;
+    v1 -= v2;
+    EXPECT_TRUE(v_cmp_eq(v1.engine(), ref_sub.engine()));
+
+    f1 *= 3.0;
+    v1 = v2 * 3.0;
+    v2 *= 3;
+    EXPECT_TRUE(v_cmp_eq(v2.engine(), v1.engine()));
+    f1 /= 3.0;
+    f1 += v1;
+    f1 -= v1;
+
+    for (ptrdiff_t i = 0;  i < 37;  ++i)
+    {
+        EXPECT_EQ(f1(i), test_value<double>(i, 0, 1));
+    }
+
+    //- Mixed element types use the element type's own compound assignment.
+    //
+    dyn_vector<int>     i1{1, 2, 3};
+    dyn_vector<float>   g1{0.5f, 1.5f, 2.5f};
+
+    g1 += i1;
+    i1 *= 2;
+    EXPECT_EQ(g1(2), 5.5f);
+    EXPECT_EQ(i1(2), 6);
+
+    //- Complex vectors may be scaled by real or complex scalars.
+    //
+    dyn_vector<cx_double>   c1{cx_double(1, 2), cx_double(-3, 4)};
+
+    c1 *= 2.0;
+    EXPECT_EQ(c1(1), cx_double(-6, 8));
+    c1 /= cx_double(0, 2);
+    EXPECT_EQ(c1(0), cx_double(2, -1));
+
+    EXPECT_THROW(v1 += dyn_vector<double>(36), runtime_error);
+    EXPECT_THROW(v1 -= dyn_vector<double>(38), runtime_error);
+}
+
+
+TEST(CompoundAssignment, Matrices)
+{
+    check_matrix<double,    row_major,    row_major>(9, 13);
+    check_matrix<double,    column_major, row_major>(9, 13);
+    check_matrix<float,     row_major,    column_major>(40, 17);
+    check_matrix<float,     column_major, column_major>(40, 17);
+    check_matrix<cx_double, row_major,    row_major>(6, 5);
+    check_matrix<int,       row_major,    column_major>(6, 5);
+
+    fs_matrix<double, 3, 4>     f1, f2;
+    dyn_matrix<double>          d1(3, 4);
+
+    fill_matrix(f1, 1);
+    fill_matrix(f2, 2);
+    fill_matrix(d1, 2);
+
+    auto const  ref = f1 + f2;
+
+    f1 += d1;
+    check_equal(f1, ref);
+    f1 -= f2;
+    f1 *= 0.5;
+    f1 /= 0.25;
+    check_equal(f1, (ref - f2) * 2.0);
+
+    EXPECT_THROW(d1 += dyn_matrix<double>(3, 5), runtime_error);
+    EXPECT_THROW(d1 -= dyn_matrix<double>(4, 4), runtime_error);
+}
+
+
+TEST(CompoundAssignment, Views)
+{
+    dyn_matrix<double>  d1(8, 10), d2(8, 10), r1(8, 10);
+    dyn_vector<double>  v1(10), v2(8);
+
+    fill_matrix(d1, 1);
+    fill_matrix(d2, 2);
+    fill_vector(v1, 3);
+    fill_vector(v2, 4);
+    r1 = d1;
+
+    //- Rows, columns, and submatrices are updated through temporary views.
+    //
+    d1.row(2) += v1;
+    d1.column(3) -= v2;
+    d1.submatrix(4, 3, 5, 4) *= 2.0;
+    d1.submatrix(1, 2, 1, 2) /= 4.0;
+    d1.t() += d2.t();
+
+    for (ptrdiff_t i = 0;  i < 8;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 10;  ++j)
+        {
+            double  e = r1(i, j);
+
+            if (i == 2)
+                e += v1(j);
+            if (j == 3)
+                e -= v2(i);
+            if (i >= 4  &&  i < 7  &&  j >= 5  &&  j < 9)
+                e *= 2.0;
+            if (i >= 1  &&  i < 3  &&  j >= 1  &&  j < 3)
+                e /= 4.0;
+            e += d2(i, j);
+
+            EXPECT_EQ(d1(i, j), e);
+        }
+    }
+
+    //- Named views, and views as right-hand operands.
+    //
+    auto    s1 = d1.submatrix(0, 4, 0, 4);
+    auto    r2 = s1 + d2.submatrix(4, 4, 6, 4);
+
+    s1 += d2.submatrix(4, 4, 6, 4);
+    check_equal(s1, r2);
+
+    auto    c1 = d1.column(9);
+    auto    r3 = c1 + d2.column(0);
+
+    c1 += d2.column(0);
+    EXPECT_TRUE(v_cmp_eq(c1.engine(), r3.engine()));
+
+    //- A matrix may be updated with itself.
+    //
+    r1 = d1 + d1;
+    d1 += d1;
+    check_equal(d1, r1);
+}
+
+
+TEST(CompoundAssignment, Aliasing)
+{
+    //- A right-hand operand sharing elements with the left-hand operand, other than
+    //  element-for-element, gives the same result as the binary operator.
+    //
+    dyn_matrix<double>                                          m(3, 3);
+    dyn_matrix<double, std::allocator<double>, column_major>    c(5, 5);
+    dyn_matrix<double>                                          d(6, 7);
+    dyn_matrix<double>                                          e(6, 6);
+
+    for (ptrdiff_t i = 0;  i < 9;  ++i)
+    {
+        m(i / 3, i % 3) = static_cast<double>(i);
+    }
+    fill_matrix(c, 1);
+    fill_matrix(d, 2);
+    fill_matrix(e, 3);
+
+    dyn_matrix<double> const    rm = m + m.t();
+    dyn_matrix<double> const    rc = c - c.t();
+    dyn_matrix<double> const    rd = d.submatrix(1, 4, 2, 5) - d.submatrix(0, 4, 0, 5);
+    dyn_vector<double> const    re = e.row(2) + e.column(1);
+
+    m += m.t();
+    c -= c.t();
+    d.submatrix(1, 4, 2, 5) -= d.submatrix(0, 4, 0, 5);
+    e.row(2) += e.column(1);
+
+    check_equal(m, rm);
+    check_equal(c, rc);
+    check_equal(d.submatrix(1, 4, 2, 5), rd);
+    EXPECT_TRUE(v_cmp_eq(e.row(2).engine(), re.engine()));
+    EXPECT_EQ(m(1, 0), 4.0);
+    EXPECT_EQ(m(1, 1), 8.0);
+    EXPECT_EQ(m(1, 2), 12.0);
+}
+
+
+TEST(CompoundAssignment, NoAllocation)
+{
+    counted_matrix<double>                  d1(64, 48), d2(64, 48);
+    counted_matrix<float, column_major>     c1(33, 21), c2(33, 21);
+    counted_vector<double>                  v1(48);
+    counted_vector<cx_double>               z1(19), z2(19);
+
+    fill_matrix(d1, 1);
+    fill_matrix(d2, 2);
+    fill_matrix(c1, 3);
+    fill_matrix(c2, 4);
+    fill_vector(v1, 5);
+
+    long const  before = allocation_count.load();
+
+    d1 += d2;
+    d1 -= d2.t().t();
+    d1 *= 2.0;
+    d1 /= 2.0;
+    c1 += c2;
+    c1 -= d2.submatrix(0, 33, 0, 21);
+    c1 *= 3.0f;
+    d1.row(7) += v1;
+    d1.column(5) *= 0.5;
+    d1.submatrix(3, 20, 4, 30) -= d2.submatrix(10, 20, 10, 30);
+    z1 += z2;
+    z1 *= 2.0;
+    z1 /= cx_double(1, 1);
+    d1 += d1;
+    d1.t() -= d1.t();
+
+    EXPECT_EQ(allocation_count.load() - before, 0);
+}
+
+
+TEST(CompoundAssignment, TraitsHook)
+{
+    using count_vector = STD_LA::vector<dr_vector_engine<double>, counting_operation_traits>;
+    using count_matrix = matrix<dr_matrix_engine<double>, counting_operation_traits>;
+
+    count_vector        v1(5);
+    count_matrix        m1(3, 4);
+    dyn_matrix<double>  d1(3, 4);
+
+    fill_vector(v1, 1);
+    fill_matrix(m1, 1);
+    fill_matrix(d1, 2);
+
+    auto const  ref = m1 + d1;
+
+    counting_operation_traits::calls = 0;
+    m1 += d1;
+    check_equal(m1, ref);
+    EXPECT_EQ(counting_operation_traits::calls, 1);
+
+    //- The traits are selected from the left-hand operand alone when the right is a scalar.
+    //
+    v1 *= 2.0;
+    d1 *= 2.0;
+    EXPECT_EQ(counting_operation_traits::calls, 2);
+    EXPECT_EQ(v1(1), 2.0 * test_value<double>(1, 0, 1));
+}
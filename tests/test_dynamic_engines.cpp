@@ -1,5 +1,37 @@
 #include "test_common.hpp"
 
+namespace {
+
+//- This allocator fills the memory that it allocates with a sentinel value, so that tests can
+//  determine which elements have been left uninitialized.
+//
+template<class T>
+struct sentinel_allocator : public std::allocator<T>
+{
+    template<class U>
+    struct rebind
+    {
+        using other = sentinel_allocator<U>;
+    };
+
+    sentinel_allocator() = default;
+
+    template<class U>
+    sentinel_allocator(sentinel_allocator<U> const&) noexcept
+    {}
+
+    T*  allocate(size_t n)
+        {
+            T*  p = std::allocator<T>::allocate(n);
+            std::fill_n(reinterpret_cast<unsigned char*>(p), n*sizeof(T), 0x5A);
+            return p;
+        }
+};
+
+int const   sentinel = 0x5A5A5A5A;
+
+}   //- anonymous namespace
+
 //==================================================================================================
 //  Unit tests for dynamically-resizeable vector engine.
 //==================================================================================================
@@ -29,6 +61,72 @@ TEST(DynVectorEngine, DirectCtor)
 }
 
 
+TEST(DynVectorEngine, ForOverwriteCtor)
+{
+    using alloc_t = sentinel_allocator<int>;
+
+    dr_vector_engine<int, alloc_t>  e1(4);
+    dr_vector_engine<int, alloc_t>  e2(4, for_overwrite);
+
+    EXPECT_EQ(e2.size(), 4);
+    EXPECT_GE(e2.capacity(), 4);
+
+    //- Verify that elements are value initialized only by the ordinary constructor.
+    //
+    EXPECT_EQ(e1(0), 0);
+    EXPECT_EQ(e1(3), 0);
+    EXPECT_EQ(e2(0), sentinel);
+    EXPECT_EQ(e2(3), sentinel);
+
+    //- Verify that writing all elements gives the expected result.
+    //
+    e2(0) = 13;  e2(1) = 17;  e2(2) = 19;  e2(3) = 23;
+    EXPECT_TRUE(v_cmp_eq(e2, {13, 17, 19, 23}));
+}
+
+
+TEST(DynVectorEngine, DefaultInitAllocator)
+{
+    using alloc_t = default_init_allocator<int, sentinel_allocator<int>>;
+
+    dr_vector_engine<int, alloc_t>  e1(4);
+
+    //- Verify that elements are default initialized, including those added by resizing.
+    //
+    EXPECT_EQ(e1.size(), 4);
+    EXPECT_EQ(e1(0), sentinel);
+    EXPECT_EQ(e1(3), sentinel);
+
+    e1 = {1, 2, 3, 4};
+    e1.resize(6);
+    EXPECT_EQ(e1(0), 1);
+    EXPECT_EQ(e1(3), 4);
+    EXPECT_EQ(e1(5), sentinel);
+
+    //- Verify that shrinking and growing again within capacity exposes value-initialized
+    //  elements, as does growing into capacity that was never part of the logical extent.
+    //
+    dr_vector_engine<int, alloc_t>  e4(2, 6);
+
+    e1(5) = 9;
+    e1.resize(3);
+    e1.resize(6);
+    EXPECT_EQ(e1(2), 3);
+    EXPECT_EQ(e1(5), 0);
+    e4.resize(6);
+    EXPECT_EQ(e4(0), sentinel);
+    EXPECT_EQ(e4(5), 0);
+
+    //- Verify copying and list construction.
+    //
+    dr_vector_engine<int, alloc_t>  e2(e1);
+    dr_vector_engine<int, alloc_t>  e3 = {5, 6, 7};
+
+    EXPECT_TRUE(v_cmp_eq(e2, e1));
+    EXPECT_TRUE(v_cmp_eq(e3, {5, 6, 7}));
+}
+
+
 TEST(DynVectorEngine, CmpEq)
 {
     std::initializer_list<float>    l1 = {0, 0, 0, 0};
@@ -502,6 +600,263 @@ TEST(DynMatrixEngine, DirectCtor)
 }
 
 
+TEST(DynMatrixEngine, ForOverwriteCtor)
+{
+    using alloc_t = sentinel_allocator<int>;
+
+    dr_matrix_engine<int, alloc_t>  e1(3, 4);
+    dr_matrix_engine<int, alloc_t>  e2(3, 4, for_overwrite);
+
+    EXPECT_EQ(e2.rows(), 3);
+    EXPECT_EQ(e2.columns(), 4);
+    EXPECT_GE(e2.row_capacity(), 3);
+    EXPECT_GE(e2.column_capacity(), 4);
+
+    //- Verify that elements are value initialized only by the ordinary constructor.
+    //
+    EXPECT_EQ(e1(0, 0), 0);
+    EXPECT_EQ(e1(2, 3), 0);
+    EXPECT_EQ(e2(0, 0), sentinel);
+    EXPECT_EQ(e2(2, 3), sentinel);
+
+    //- Verify that assignment from another engine, which overwrites every element, gives the
+    //  expected result.
+    //
+    dr_matrix_engine<int>   e3 = {{1, 2}, {3, 4}, {5, 6}};
+
+    e2 = e3;
+    EXPECT_TRUE(m_cmp_eq(e2, e3));
+}
+
+
+TEST(DynMatrixEngine, DefaultInitAllocator)
+{
+    using alloc_t = default_init_allocator<int, sentinel_allocator<int>>;
+
+    dr_matrix_engine<int, alloc_t>  e1(2, 2);
+
+    //- Verify that elements are default initialized, including those added by resizing.
+    //
+    EXPECT_EQ(e1(0, 0), sentinel);
+    EXPECT_EQ(e1(1, 1), sentinel);
+
+    e1 = {{1, 2}, {3, 4}};
+    e1.resize(3, 3);
+    EXPECT_EQ(e1(0, 0), 1);
+    EXPECT_EQ(e1(1, 1), 4);
+    EXPECT_EQ(e1(2, 2), sentinel);
+
+    //- Verify copying.
+    //
+    dr_matrix_engine<int, alloc_t>  e2(e1);
+    EXPECT_TRUE(m_cmp_eq(e2, e1));
+}
+
+
+TEST(DynMatrixEngine, UnusedCapacity)
+{
+    using alloc_t = default_init_allocator<int, sentinel_allocator<int>>;
+    using eng_t   = dr_matrix_engine<int, alloc_t>;
+    using ceng_t  = dr_matrix_engine<int, alloc_t, column_major>;
+
+    //- Verify that growing within the existing capacity exposes value-initialized elements,
+    //  rather than those left uninitialized by the allocation.
+    //
+    eng_t   e1(2, 2, 4, 4);
+
+    e1(0, 0) = 1;  e1(0, 1) = 2;  e1(1, 0) = 3;  e1(1, 1) = 4;
+    e1.resize(4, 4);
+    EXPECT_EQ(e1.row_capacity(), 4);
+    EXPECT_EQ(e1(0, 0), 1);
+    EXPECT_EQ(e1(1, 1), 4);
+    EXPECT_EQ(e1(0, 3), 0);
+    EXPECT_EQ(e1(3, 0), 0);
+    EXPECT_EQ(e1(3, 3), 0);
+
+    //- Verify that shrinking and growing again does not expose the elements that were removed.
+    //
+    e1(3, 3) = 9;  e1(2, 1) = 8;
+    e1.resize(2, 3);
+    e1.resize(4, 4);
+    EXPECT_EQ(e1(1, 1), 4);
+    EXPECT_EQ(e1(3, 3), 0);
+    EXPECT_EQ(e1(2, 1), 0);
+
+    ceng_t  e2(2, 3, 4, 4);
+
+    e2(1, 2) = 5;  e2.resize(1, 1);  e2.resize(3, 3);
+    EXPECT_EQ(e2(1, 2), 0);
+    EXPECT_EQ(e2(2, 0), 0);
+
+    //- Verify that storage allocated for overwriting has value-initialized padding and unused
+    //  capacity, including that read by transposing across a square of the larger extent.
+    //
+    eng_t   e3(2, 3, 3, 3);
+
+    e3.resize(2, 3);
+    for (ptrdiff_t i = 0;  i < 2;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 3;  ++j)
+        {
+            e3(i, j) = static_cast<int>(10*i + j);
+        }
+    }
+    e3.transpose_in_place();
+    ASSERT_EQ(e3.rows(), 3);
+    e3.resize(3, 3);
+    EXPECT_EQ(e3(2, 1), 12);
+    EXPECT_EQ(e3(0, 2), 0);
+    EXPECT_EQ(e3(2, 2), 0);
+
+    dr_matrix_engine<int, sentinel_allocator<int>>  e4(3, 3, for_overwrite);
+
+    e4.resize(1, 1);
+    e4.resize(3, 3);
+    EXPECT_EQ(e4(2, 2), 0);
+
+    dr_matrix_engine<float, default_init_allocator<float, aligned_allocator<float>>>    e5(7, 3);
+
+    e5.resize(7, 16);
+    EXPECT_EQ(e5.column_capacity(), 16);
+    EXPECT_EQ(e5(6, 15), 0.0f);
+}
+
+
+TEST(DynMatrixEngine, ArithmeticResults)
+{
+    using alloc_t = sentinel_allocator<double>;
+    using mat_t   = matrix<dr_matrix_engine<double, alloc_t>>;
+
+    mat_t   m1(3, 4), m2(3, 4);
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            m1(i, j) = static_cast<double>(i + j);
+            m2(i, j) = static_cast<double>(i * j);
+        }
+    }
+
+    //- Result engines are allocated without value initialization; verify that every element
+    //  of each result is written.
+    //
+    auto    r1 = m1 + m2;
+    auto    r2 = m1 - m2;
+    auto    r3 = m1 * 2.0;
+    auto    r4 = m1 / 2.0;
+    auto    r5 = m1 * m2.t();
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            EXPECT_EQ(r1(i, j), m1(i, j) + m2(i, j));
+            EXPECT_EQ(r2(i, j), m1(i, j) - m2(i, j));
+            EXPECT_EQ(r3(i, j), m1(i, j) * 2.0);
+            EXPECT_EQ(r4(i, j), m1(i, j) / 2.0);
+        }
+        for (ptrdiff_t j = 0;  j < 3;  ++j)
+        {
+            double  dot = 0.0;
+
+            for (ptrdiff_t k = 0;  k < 4;  ++k)
+            {
+                dot += m1(i, k) * m2(j, k);
+            }
+            EXPECT_EQ(r5(i, j), dot);
+        }
+    }
+}
+
+
+TEST(DynMatrixEngine, AlignedAllocator)
+{
+    using alloc_t = aligned_allocator<double>;
+    using eng_t   = dr_matrix_engine<double, alloc_t>;
+
+    auto    is_aligned = [](void const* p) { return reinterpret_cast<uintptr_t>(p) % 64 == 0; };
+
+    //- Verify that the column capacity is rounded up to a whole number of cache lines, and that
+    //  every row begins on a cache-line boundary.
+    //
+    eng_t   e1(3, 5);
+    EXPECT_EQ(e1.rows(), 3);
+    EXPECT_EQ(e1.columns(), 5);
+    EXPECT_EQ(e1.column_capacity(), 8);
+
+    for (ptrdiff_t i = 0;  i < e1.rows();  ++i)
+    {
+        EXPECT_TRUE(is_aligned(&e1(i, 0)));
+    }
+
+    //- Verify that rows whose length is a multiple of 4096 bytes are padded by a cache line, but
+    //  that a single row is not.
+    //
+    eng_t   e2(4, 512);
+    EXPECT_EQ(e2.column_capacity(), 520);
+
+    eng_t   e3(1, 512);
+    EXPECT_EQ(e3.column_capacity(), 512);
+
+    //- Verify that capacity requests and resizing preserve the alignment.
+    //
+    eng_t   e4(2, 3, 2, 9);
+    EXPECT_EQ(e4.column_capacity(), 16);
+
+    e1(2, 4) = 7.0;
+    e1.resize(6, 13);
+    EXPECT_EQ(e1.column_capacity(), 16);
+    EXPECT_EQ(e1(2, 4), 7.0);
+    EXPECT_TRUE(is_aligned(&e1(5, 0)));
+
+    //- Verify the combination with default_init_allocator, and the dynamic vector engine.
+    //
+    dr_matrix_engine<float, default_init_allocator<float, aligned_allocator<float>>>    e5(7, 3);
+    EXPECT_EQ(e5.column_capacity(), 16);
+    EXPECT_TRUE(is_aligned(&e5(6, 0)));
+
+    dr_vector_engine<double, alloc_t>   e6(11);
+    EXPECT_TRUE(is_aligned(&e6(0)));
+}
+
+
+TEST(DynMatrixEngine, AlignedArithmetic)
+{
+    using mat_t = matrix<dr_matrix_engine<double, aligned_allocator<double>>>;
+
+    mat_t   m1(9, 21), m2(9, 21);
+
+    for (ptrdiff_t i = 0;  i < 9;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 21;  ++j)
+        {
+            m1(i, j) = static_cast<double>(i + j);
+            m2(i, j) = static_cast<double>(i * j);
+        }
+    }
+
+    //- The results of arithmetic on aligned engines also use the aligned allocator, and are
+    //  computed by the aligned kernels.
+    //
+    auto    r1 = m1 + m2;
+    auto    r2 = m1 - m2;
+    auto    r3 = m1 / 4.0;
+
+    EXPECT_TRUE((std::is_same_v<decltype(r1), mat_t>));
+    EXPECT_EQ(r1.column_capacity(), 24);
+
+    for (ptrdiff_t i = 0;  i < 9;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 21;  ++j)
+        {
+            EXPECT_EQ(r1(i, j), m1(i, j) + m2(i, j));
+            EXPECT_EQ(r2(i, j), m1(i, j) - m2(i, j));
+            EXPECT_EQ(r3(i, j), m1(i, j) / 4.0);
+        }
+    }
+}
+
 TEST(DynMatrixEngine, CmpEq)
 {
     dr_matrix_engine<float>     e1(4, 4), e2(4, 4), e3{4, 4};
@@ -1039,6 +1394,128 @@ TEST(DynMatrixEngine, Swap)
 }
 
 
+TEST(DynMatrixEngine, TransposeInPlace)
+{
+    auto    check = [](auto const& e, auto const& ref)
+    {
+        ASSERT_EQ(e.rows(), ref.columns());
+        ASSERT_EQ(e.columns(), ref.rows());
+
+        for (ptrdiff_t i = 0;  i < e.rows();  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < e.columns();  ++j)
+            {
+                ASSERT_EQ(e(i, j), ref(j, i));
+            }
+        }
+    };
+    auto    fill = [](auto& e)
+    {
+        for (ptrdiff_t i = 0;  i < e.rows();  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < e.columns();  ++j)
+            {
+                e(i, j) = static_cast<double>(i*1000 + j);
+            }
+        }
+    };
+
+    //- Square, spanning several blocks; the storage and capacities are unchanged.
+    //
+    dr_matrix_engine<double>    e1(70, 70), r1;
+
+    fill(e1);
+    r1 = e1;
+
+    double const*   p_elems = e1.span().data();
+
+    e1.transpose_in_place();
+    check(e1, r1);
+    EXPECT_EQ(e1.span().data(), p_elems);
+
+    //- Rectangular, with capacity for a square of the larger extent.
+    //
+    dr_matrix_engine<double>    e2(20, 45, 50, 50), r2;
+
+    fill(e2);
+    r2 = e2;
+    e2.transpose_in_place();
+    check(e2, r2);
+    EXPECT_EQ(e2.row_capacity(), 50);
+    EXPECT_EQ(e2.column_capacity(), 50);
+
+    //- Rectangular without that capacity, packed and padded, in both layouts; the capacities
+    //  are exchanged, and the padding reads as zero.
+    //
+    dr_matrix_engine<double>    e3(37, 91), r3;
+
+    fill(e3);
+    r3 = e3;
+    e3.transpose_in_place();
+    check(e3, r3);
+    EXPECT_EQ(e3.row_capacity(), 91);
+    EXPECT_EQ(e3.column_capacity(), 37);
+
+    dr_matrix_engine<double>    e4(30, 11, 33, 14), r4;
+
+    fill(e4);
+    r4 = e4;
+    e4.transpose_in_place();
+    check(e4, r4);
+    EXPECT_EQ(e4.row_capacity(), 14);
+    EXPECT_EQ(e4.column_capacity(), 33);
+    EXPECT_EQ(e4.span().data()[30], 0.0);
+    e4.resize(14, 33);
+    EXPECT_EQ(e4(13, 32), 0.0);
+
+    using cm_engine = dr_matrix_engine<double, std::allocator<double>, column_major>;
+
+    cm_engine   e5(16, 5, 19, 7), r5;
+
+    fill(e5);
+    r5 = e5;
+    e5.transpose_in_place();
+    check(e5, r5);
+    EXPECT_EQ(e5.row_capacity(), 7);
+    EXPECT_EQ(e5.column_capacity(), 19);
+
+    //- Transposing twice restores the original; a single row becomes a single column.
+    //
+    e5.transpose_in_place();
+    EXPECT_TRUE(m_cmp_eq(e5, r5));
+
+    dr_matrix_engine<double>    e6(1, 9), r6;
+
+    fill(e6);
+    r6 = e6;
+    e6.transpose_in_place();
+    check(e6, r6);
+}
+
+
+TEST(DynMatrix, TransposeInPlace)
+{
+    dyn_matrix<std::string>     m1(3, 2);
+
+    //- The elements are "a" through "f", in row-major order.
+    //
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 2;  ++j)
+        {
+            m1(i, j) = std::string(1, static_cast<char>('a' + 2*i + j));
+        }
+    }
+
+    m1.transpose_in_place();
+    EXPECT_EQ(m1.rows(), 2);
+    EXPECT_EQ(m1.columns(), 3);
+    EXPECT_EQ(m1(0, 1), "c");
+    EXPECT_EQ(m1(1, 2), "f");
+    EXPECT_EQ(m1(1, 0), "b");
+}
+
+
 TEST(DynMatrixEngine, Span)
 {
     dr_matrix_engine<float>         e1(il_44_2), e2{4, 4}, e3{e1};
@@ -1107,3 +1584,130 @@ TEST(DynMatrixEngine, Span)
     EXPECT_EQ(e1(2, 2), 333.0f);
     EXPECT_EQ(e1(3, 3), 444.0f);
 }
+
+
+TEST(DynMatrixEngine, RowGrowth)
+{
+    dr_matrix_engine<float>     e1 LST_44_2 ;
+
+    //- Adding rows beyond the row capacity should at least double it, preserving elements.
+    //
+    e1.resize(5, 4);
+    EXPECT_EQ(e1.rows(), 5);
+    EXPECT_GE(e1.row_capacity(), 8);
+    EXPECT_EQ(e1.column_capacity(), 4);
+    EXPECT_EQ(e1(0, 0), 11.0f);
+    EXPECT_EQ(e1(3, 3), 44.0f);
+    EXPECT_EQ(e1(4, 0), 0.0f);
+    EXPECT_EQ(e1(4, 3), 0.0f);
+
+    //- Adding rows within the row capacity should not reallocate.
+    //
+    float const*    p_elems = e1.span().data();
+
+    e1.resize(8, 4);
+    EXPECT_EQ(e1.span().data(), p_elems);
+    EXPECT_EQ(e1(3, 3), 44.0f);
+
+    //- Growing the columns should preserve elements when the rows are padded.
+    //
+    e1.resize(8, 6, 8, 7);
+    EXPECT_EQ(e1.rows(), 8);
+    EXPECT_EQ(e1.columns(), 6);
+    EXPECT_GE(e1.column_capacity(), 7);
+    EXPECT_EQ(e1(0, 0), 11.0f);
+    EXPECT_EQ(e1(2, 1), 32.0f);
+    EXPECT_EQ(e1(3, 3), 44.0f);
+    EXPECT_EQ(e1(3, 5), 0.0f);
+}
+
+
+TEST(DynMatrix, AppendRows)
+{
+    dyn_matrix<double>  m1;
+    dyn_vector<double>  v1 = {1.0, 2.0, 3.0};
+
+    //- Appending a row to an empty matrix sets its column count.
+    //
+    m1.append_row(v1);
+    EXPECT_EQ(m1.rows(), 1);
+    EXPECT_EQ(m1.columns(), 3);
+    EXPECT_EQ(m1(0, 2), 3.0);
+
+    //- Append many rows one at a time; the number of reallocations should be logarithmic.
+    //
+    ptrdiff_t       reallocs = 0;
+    double const*   p_elems  = m1.span().data();
+
+    for (int i = 1;  i < 1000;  ++i)
+    {
+        v1(0) = static_cast<double>(i);
+        m1.append_row(v1);
+
+        if (m1.span().data() != p_elems)
+        {
+            ++reallocs;
+            p_elems = m1.span().data();
+        }
+    }
+    EXPECT_EQ(m1.rows(), 1000);
+    EXPECT_LE(reallocs, 11);
+    EXPECT_EQ(m1(0, 0), 1.0);
+    EXPECT_EQ(m1(999, 0), 999.0);
+    EXPECT_EQ(m1(999, 1), 2.0);
+    EXPECT_EQ(m1(500, 2), 3.0);
+
+    //- Append a block of rows, from a fixed-size matrix and from a view.
+    //
+    fs_matrix<float, 2, 3>  f1 = {{7, 8, 9}, {10, 11, 12}};
+
+    m1.append_rows(f1);
+    EXPECT_EQ(m1.rows(), 1002);
+    EXPECT_EQ(m1(1000, 0), 7.0);
+    EXPECT_EQ(m1(1001, 2), 12.0);
+
+    dyn_matrix<double>  m2 = {{1, 2}, {3, 4}, {5, 6}};
+
+    m1.append_rows(m2.t());
+    EXPECT_EQ(m1.rows(), 1004);
+    EXPECT_EQ(m1(1002, 0), 1.0);
+    EXPECT_EQ(m1(1003, 2), 6.0);
+
+    //- Rows of the wrong size are rejected.
+    //
+    dyn_vector<double>  v2(4);
+
+    EXPECT_THROW(m1.append_row(v2), runtime_error);
+    EXPECT_THROW(m1.append_rows(m2), runtime_error);
+    EXPECT_EQ(m1.rows(), 1004);
+}
+
+TEST(DynMatrix, AppendRowsAliased)
+{
+    //- Appending rows of the matrix itself, both when the storage must grow and when it has the
+    //  capacity, gives copies of the rows as they were before appending.
+    //
+    dyn_matrix<double>  m1 = {{1, 2, 3}, {4, 5, 6}};
+
+    ASSERT_EQ(m1.row_capacity(), 2);
+    m1.append_row(m1.row(0));
+    EXPECT_EQ(m1.rows(), 3);
+    EXPECT_GE(m1.row_capacity(), 4);
+    EXPECT_TRUE(v_cmp_eq(m1.row(2), {1.0, 2.0, 3.0}));
+
+    m1.append_row(m1.row(1));
+    EXPECT_TRUE(v_cmp_eq(m1.row(3), {4.0, 5.0, 6.0}));
+
+    m1.append_rows(m1);
+    EXPECT_EQ(m1.rows(), 8);
+    EXPECT_TRUE(v_cmp_eq(m1.row(4), {1.0, 2.0, 3.0}));
+    EXPECT_TRUE(v_cmp_eq(m1.row(7), {4.0, 5.0, 6.0}));
+
+    dyn_matrix<double>  m2 = {{1, 2}, {3, 4}};
+
+    m2.append_rows(m2.t());
+    EXPECT_TRUE(m_cmp_eq(m2, {{1, 2}, {3, 4}, {1, 3}, {2, 4}}));
+
+    m2.append_rows(m2.submatrix(1, 3, 0, 2));
+    EXPECT_TRUE(m_cmp_eq(m2, {{1, 2}, {3, 4}, {1, 3}, {2, 4}, {3, 4}, {1, 3}, {2, 4}}));
+}
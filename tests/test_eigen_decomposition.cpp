@@ -0,0 +1,231 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the symmetric eigensolvers.  Symmetric operands are formed from pseudo-random
+//  elements; their strict upper triangles are then overwritten with a marker value, which the
+//  solvers must not read.  Decompositions are checked by forming A*V - V*diag(d) and V^T*V - I,
+//  at sizes on both sides of the blocking parameter.
+//==================================================================================================
+//
+namespace {
+
+template<class MT>
+MT
+make_symmetric(ptrdiff_t n, unsigned seed)
+{
+    using elem_t = typename MT::element_type;
+
+    dyn_matrix<elem_t>  a(n, n);
+
+    fill_random(a, seed);
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < i;  ++j)
+        {
+            a(j, i) = a(i, j);
+        }
+    }
+    return MT(a);
+}
+
+//- Returns the largest elements of A*V - V*diag(d) and V^T*V - I, where A is formed from the
+//  lower triangle of its argument.
+//
+template<class M1, class M2, class VT>
+std::pair<double, double>
+eigen_error(M1 const& a, M2 const& v, VT const& d)
+{
+    using elem_t = typename M1::element_type;
+
+    double  resid = 0.0;
+    double  orth  = 0.0;
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            elem_t  r = -v(i, j) * d(j);
+            elem_t  o = (i == j) ? elem_t{-1} : elem_t{};
+
+            for (ptrdiff_t k = 0;  k < a.rows();  ++k)
+            {
+                r += ((k <= i) ? a(i, k) : a(k, i)) * v(k, j);
+                o += v(k, i) * v(k, j);
+            }
+            resid = std::max(resid, static_cast<double>(std::abs(r)));
+            orth  = std::max(orth, static_cast<double>(std::abs(o)));
+        }
+    }
+    return {resid, orth};
+}
+
+template<class VT>
+bool
+is_ascending(VT const& d)
+{
+    for (ptrdiff_t i = 1;  i < d.size();  ++i)
+    {
+        if (d(i) < d(i - 1)) return false;
+    }
+    return true;
+}
+
+template<class MT>
+void
+check_eigen(ptrdiff_t n, unsigned seed, double tol)
+{
+    MT  a = make_symmetric<MT>(n, seed);
+
+    mark_upper(a);
+
+    MT      v  = a;
+    auto    d1 = symmetric_eigenvalues(a);
+    auto    d2 = symmetric_eigen(v);
+
+    ASSERT_EQ(d1.size(), n);
+    ASSERT_EQ(d2.size(), n);
+    EXPECT_TRUE(is_ascending(d1));
+    EXPECT_TRUE(is_ascending(d2));
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        EXPECT_NEAR(d1(i), d2(i), tol);
+    }
+
+    auto const  err = eigen_error(a, v, d2);
+
+    EXPECT_LE(err.first, tol);
+    EXPECT_LE(err.second, tol);
+}
+
+}   //- anonymous namespace
+
+
+TEST(EigenDecomposition, Symmetric)
+{
+    check_eigen<dyn_matrix<double>>(1, 1, 1e-14);
+    check_eigen<dyn_matrix<double>>(2, 2, 1e-14);
+    check_eigen<dyn_matrix<double>>(7, 3, 1e-13);
+    check_eigen<dyn_matrix<double>>(64, 4, 1e-12);
+    check_eigen<dyn_matrix<double>>(65, 5, 1e-12);
+    check_eigen<dyn_matrix<double>>(150, 6, 1e-11);
+    check_eigen<dyn_matrix<double, allocator<double>, column_major>>(130, 7, 1e-11);
+    check_eigen<dyn_matrix<float>>(80, 8, 1e-3);
+    check_eigen<fs_matrix<double, 5, 5>>(5, 9, 1e-13);
+    check_eigen<fs_matrix<double, 70, 70>>(70, 10, 1e-11);
+
+    //- A view is decomposed in place; the lower triangle of a transpose view is the upper
+    //  triangle of its matrix.
+    //
+    dyn_matrix<double>  a = make_symmetric<dyn_matrix<double>>(90, 11);
+    dyn_matrix<double>  b = a;
+    auto                d = symmetric_eigen(b.t());
+
+    EXPECT_LE(eigen_error(a, b.t(), d).first, 1e-11);
+    EXPECT_LE(eigen_error(a, b.t(), d).second, 1e-11);
+
+    EXPECT_THROW(symmetric_eigenvalues(dyn_matrix<double>(3, 4)), runtime_error);
+}
+
+TEST(EigenDecomposition, KnownSpectra)
+{
+    //- The second-difference matrix tridiag(-1, 2, -1) of order n has the eigenvalues
+    //  2 - 2*cos(k*pi/(n+1)), for k = 1, ..., n.
+    //
+    ptrdiff_t const     n  = 100;
+    double const        pi = 3.14159265358979323846;
+
+    dyn_matrix<double>  a(n, n);
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        a(i, i) = 2.0;
+        if (i > 0) a(i, i - 1) = -1.0;
+    }
+
+    auto    d = symmetric_eigenvalues(a);
+
+    for (ptrdiff_t k = 0;  k < n;  ++k)
+    {
+        EXPECT_NEAR(d(k), 2.0 - 2.0*std::cos(static_cast<double>(k + 1)*pi/static_cast<double>(n + 1)), 1e-13);
+    }
+
+    //- Repeated eigenvalues: Q*diag(1, 1, 1, 3, 3, 5)*Q^T for an orthogonal Q.
+    //
+    dyn_matrix<double>  q = make_symmetric<dyn_matrix<double>>(6, 12);
+    dyn_matrix<double>  e(6, 6);
+
+    symmetric_eigen(q);
+
+    double const    lambda[] = {1.0, 1.0, 1.0, 3.0, 3.0, 5.0};
+
+    for (ptrdiff_t i = 0;  i < 6;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 6;  ++j)
+        {
+            double  eij = 0.0;
+
+            for (ptrdiff_t k = 0;  k < 6;  ++k)
+            {
+                eij += q(i, k) * lambda[k] * q(j, k);
+            }
+            e(i, j) = eij;
+        }
+    }
+
+    dyn_matrix<double>  ev = e;
+    auto                ed = symmetric_eigen(ev);
+
+    for (ptrdiff_t k = 0;  k < 6;  ++k)
+    {
+        EXPECT_NEAR(ed(k), lambda[k], 1e-14);
+    }
+    EXPECT_LE(eigen_error(e, ev, ed).second, 1e-14);
+}
+
+TEST(EigenDecomposition, FixedSize3x3)
+{
+    using fmat = fs_matrix<double, 3, 3>;
+
+    for (unsigned seed = 20;  seed < 40;  ++seed)
+    {
+        fmat    a = make_symmetric<fmat>(3, seed);
+        fmat    v = a;
+        auto    d = symmetric_eigenvalues(a);
+        auto    e = symmetric_eigen(v);
+        auto    g = symmetric_eigenvalues(dyn_matrix<double>(a));
+
+        EXPECT_TRUE((is_same_v<decltype(d), fs_vector<double, 3>>));
+        EXPECT_TRUE(is_ascending(d));
+        EXPECT_TRUE(is_ascending(e));
+
+        for (ptrdiff_t i = 0;  i < 3;  ++i)
+        {
+            EXPECT_NEAR(d(i), g(i), 1e-13);
+            EXPECT_NEAR(e(i), g(i), 1e-14);
+        }
+        EXPECT_LE(eigen_error(a, v, e).first, 1e-14);
+        EXPECT_LE(eigen_error(a, v, e).second, 1e-14);
+    }
+
+    //- Diagonal and degenerate matrices.
+    //
+    fmat    b{{3.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 2.0}};
+    fmat    c{{2.0, 1.0, 1.0}, {1.0, 2.0, 1.0}, {1.0, 1.0, 2.0}};
+    fmat    cv = c;
+    auto    bd = symmetric_eigenvalues(b);
+    auto    cd = symmetric_eigenvalues(c);
+    auto    ce = symmetric_eigen(cv);
+
+    EXPECT_EQ(bd(0), 1.0);
+    EXPECT_EQ(bd(1), 2.0);
+    EXPECT_EQ(bd(2), 3.0);
+    EXPECT_NEAR(cd(0), 1.0, 1e-14);
+    EXPECT_NEAR(cd(1), 1.0, 1e-14);
+    EXPECT_NEAR(cd(2), 4.0, 1e-14);
+    EXPECT_NEAR(ce(0), 1.0, 1e-14);
+    EXPECT_NEAR(ce(2), 4.0, 1e-14);
+    EXPECT_LE(eigen_error(c, cv, ce).first, 1e-14);
+    EXPECT_LE(eigen_error(c, cv, ce).second, 1e-14);
+}
@@ -0,0 +1,255 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the vectorized element-wise addition, subtraction, and division kernels.  The
+//  results of the arithmetic operators are compared with simple reference loops; since each
+//  element is computed by the same single IEEE operation either way, they must agree exactly.
+//==================================================================================================
+//
+namespace {
+
+template<class T>
+using simd_real_t = STD_LA::detail::simd_real_t<T>;
+
+template<class M1, class M2, class MR>
+void
+check_sum_and_difference(M1 const& m1, M2 const& m2, MR const& sum, MR const& diff)
+{
+    ASSERT_EQ(sum.rows(), m1.rows());
+    ASSERT_EQ(sum.columns(), m1.columns());
+    ASSERT_EQ(diff.rows(), m1.rows());
+    ASSERT_EQ(diff.columns(), m1.columns());
+
+    for (typename MR::index_type i = 0;  i < sum.rows();  ++i)
+    {
+        for (typename MR::index_type j = 0;  j < sum.columns();  ++j)
+        {
+            EXPECT_EQ(sum(i, j), m1(i, j) + m2(i, j));
+            EXPECT_EQ(diff(i, j), m1(i, j) - m2(i, j));
+        }
+    }
+}
+
+template<class M1, class S2, class MR>
+void
+check_quotient(M1 const& m1, S2 const& s2, MR const& quot)
+{
+    ASSERT_EQ(quot.rows(), m1.rows());
+    ASSERT_EQ(quot.columns(), m1.columns());
+
+    for (typename MR::index_type i = 0;  i < quot.rows();  ++i)
+    {
+        for (typename MR::index_type j = 0;  j < quot.columns();  ++j)
+        {
+            EXPECT_EQ(quot(i, j), m1(i, j) / s2);
+        }
+    }
+}
+
+template<class T>
+void
+check_dyn_elementwise(ptrdiff_t rows, ptrdiff_t cols)
+{
+    dyn_matrix<T>   m1(rows, cols), m2(rows, cols);
+
+    fill_matrix(m1, 1, 3);
+    fill_matrix(m2, 2, 3);
+
+    check_sum_and_difference(m1, m2, dyn_matrix<T>(m1 + m2), dyn_matrix<T>(m1 - m2));
+    check_quotient(m1, simd_real_t<T>(3), dyn_matrix<T>(m1 / simd_real_t<T>(3)));
+}
+
+}   //- anonymous namespace
+
+
+TEST(ElementwiseKernels, Traits)
+{
+    using dr_t = dr_matrix_engine<double>;
+    using fs_t = fs_matrix_engine<double, 4, 4>;
+    using dv_t = dr_vector_engine<float>;
+
+    EXPECT_TRUE((detail::use_simd_elementwise_v<dr_t, fs_t, dr_t>));
+    EXPECT_TRUE((detail::use_simd_elementwise_v<dv_t, dv_t, dv_t>));
+    EXPECT_TRUE((detail::use_simd_elementwise_v<matrix_transpose_engine<dr_t, readable_matrix_engine_tag>, dr_t, dr_t>));
+    EXPECT_FALSE((detail::use_simd_elementwise_v<matrix_negation_engine<dr_t>, dr_t, dr_t>));
+    EXPECT_FALSE((detail::use_simd_elementwise_v<dr_matrix_engine<int>, dr_matrix_engine<int>, dr_matrix_engine<int>>));
+    EXPECT_FALSE((detail::use_simd_elementwise_v<dr_matrix_engine<float>, dr_t, dr_t>));
+
+    EXPECT_TRUE((detail::use_simd_scalar_v<dr_t, double, dr_t>));
+    EXPECT_TRUE((detail::use_simd_scalar_v<dr_t, int, dr_t>));
+    EXPECT_TRUE((detail::use_simd_scalar_v<dr_matrix_engine<cx_float>, float, dr_matrix_engine<cx_float>>));
+    EXPECT_FALSE((detail::use_simd_scalar_v<dr_matrix_engine<cx_float>, cx_float, dr_matrix_engine<cx_float>>));
+    EXPECT_FALSE((detail::use_simd_scalar_v<dr_matrix_engine<cx_double>, float, dr_matrix_engine<cx_double>>));
+}
+
+
+TEST(ElementwiseKernels, DynFlat)
+{
+    check_dyn_elementwise<double>(1, 1);
+    check_dyn_elementwise<double>(3, 5);
+    check_dyn_elementwise<double>(37, 29);
+    check_dyn_elementwise<float>(1, 67);
+    check_dyn_elementwise<float>(41, 23);
+    check_dyn_elementwise<cx_float>(13, 9);
+    check_dyn_elementwise<cx_double>(17, 11);
+}
+
+
+TEST(ElementwiseKernels, DynPadded)
+{
+    //- Operands whose column capacities exceed their column counts are processed row by row.
+    //
+    dyn_matrix<double>  m1(19, 21, 24, 40), m2(19, 21);
+    dyn_matrix<float>   m3(9, 35, 9, 37), m4(9, 35, 12, 64);
+
+    fill_matrix(m1, 3, 3);
+    fill_matrix(m2, 4, 3);
+    fill_matrix(m3, 5, 3);
+    fill_matrix(m4, 6, 3);
+
+    check_sum_and_difference(m1, m2, dyn_matrix<double>(m1 + m2), dyn_matrix<double>(m1 - m2));
+    check_sum_and_difference(m2, m1, dyn_matrix<double>(m2 + m1), dyn_matrix<double>(m2 - m1));
+    check_sum_and_difference(m3, m4, dyn_matrix<float>(m3 + m4), dyn_matrix<float>(m3 - m4));
+    check_quotient(m1, 7.0, dyn_matrix<double>(m1 / 7.0));
+    check_quotient(m4, 3.0f, dyn_matrix<float>(m4 / 3.0f));
+}
+
+
+TEST(ElementwiseKernels, Views)
+{
+    dyn_matrix<double>  m1(30, 40), m2(40, 30);
+
+    fill_matrix(m1, 7, 3);
+    fill_matrix(m2, 8, 3);
+
+    //- Submatrices are row-contiguous, with row strides larger than their column counts.
+    //
+    auto    s1 = m1.submatrix(2, 20, 5, 19);
+    auto    s2 = m1.submatrix(9, 20, 21, 19);
+    check_sum_and_difference(s1, s2, dyn_matrix<double>(s1 + s2), dyn_matrix<double>(s1 - s2));
+
+    //- Transposes are not row-contiguous, and so are computed by the simple loops.
+    //
+    auto    t2 = m2.t();
+    check_sum_and_difference(m1, t2, dyn_matrix<double>(m1 + t2), dyn_matrix<double>(m1 - t2));
+    check_sum_and_difference(t2, m1, dyn_matrix<double>(t2 + m1), dyn_matrix<double>(t2 - m1));
+}
+
+
+TEST(ElementwiseKernels, FixedSize)
+{
+    fs_matrix<double, 5, 7>     m1, m2;
+    fs_matrix<float, 3, 11>     m3, m4;
+
+    fill_matrix(m1, 9, 3);
+    fill_matrix(m2, 10, 3);
+    fill_matrix(m3, 11, 3);
+    fill_matrix(m4, 12, 3);
+
+    check_sum_and_difference(m1, m2, fs_matrix<double, 5, 7>(m1 + m2), fs_matrix<double, 5, 7>(m1 - m2));
+    check_sum_and_difference(m3, m4, fs_matrix<float, 3, 11>(m3 + m4), fs_matrix<float, 3, 11>(m3 - m4));
+    check_quotient(m1, 2, fs_matrix<double, 5, 7>(m1 / 2));
+
+    //- Mixed fixed-size and dynamic operands.
+    //
+    dyn_matrix<double>  m5(5, 7);
+    fill_matrix(m5, 13, 3);
+    check_sum_and_difference(m1, m5, dyn_matrix<double>(m1 + m5), dyn_matrix<double>(m1 - m5));
+}
+
+
+TEST(ElementwiseKernels, Vectors)
+{
+    dyn_vector<double>      v1(53), v2(53);
+    fs_vector<float, 19>    v3, v4;
+
+    fill_vector(v1, 1, 7);
+    fill_vector(v2, 2, 7);
+    fill_vector(v3, 3, 7);
+    fill_vector(v4, 4, 7);
+
+    dyn_vector<double>      r1 = v1 + v2;
+    dyn_vector<double>      r2 = v1 - v2;
+    dyn_vector<double>      r3 = v1 / 3.0;
+    fs_vector<float, 19>    r4 = v3 + v4;
+    fs_vector<float, 19>    r5 = v3 - v4;
+    fs_vector<float, 19>    r6 = v3 / 3.0f;
+
+    for (ptrdiff_t i = 0;  i < v1.size();  ++i)
+    {
+        EXPECT_EQ(r1(i), v1(i) + v2(i));
+        EXPECT_EQ(r2(i), v1(i) - v2(i));
+        EXPECT_EQ(r3(i), v1(i) / 3.0);
+    }
+    for (ptrdiff_t i = 0;  i < v3.size();  ++i)
+    {
+        EXPECT_EQ(r4(i), v3(i) + v4(i));
+        EXPECT_EQ(r5(i), v3(i) - v4(i));
+        EXPECT_EQ(r6(i), v3(i) / 3.0f);
+    }
+
+    //- Rows of a matrix are row-contiguous; columns are not.
+    //
+    dyn_matrix<double>  m1(9, 53);
+    fill_matrix(m1, 5, 3);
+
+    dyn_vector<double>  r7 = m1.row(4) + v1;
+    dyn_vector<double>  r8 = m1.column(6) - v1.subvector(0, 9);
+
+    for (ptrdiff_t i = 0;  i < r7.size();  ++i)
+    {
+        EXPECT_EQ(r7(i), m1(4, i) + v1(i));
+    }
+    for (ptrdiff_t i = 0;  i < r8.size();  ++i)
+    {
+        EXPECT_EQ(r8(i), m1(i, 6) - v1(i));
+    }
+}
+
+
+TEST(ElementwiseKernels, InstructionSets)
+{
+    //- Each instruction set supported by this CPU, down to the scalar loops, is selected in turn;
+    //  all must give the same results.  Aligned operands exercise the aligned loads and stores.
+    //
+    using detail::simd_isa;
+
+    simd_isa const  detected = detail::simd_detect_isa();
+
+    for (simd_isa isa : {simd_isa::none, simd_isa::sse2, simd_isa::avx, simd_isa::avx512})
+    {
+        if (static_cast<int>(isa) > static_cast<int>(detected)) break;
+
+        detail::simd_limit_isa(isa);
+        EXPECT_EQ(detail::simd_active_isa(), isa);
+
+        check_dyn_elementwise<double>(37, 29);
+        check_dyn_elementwise<float>(41, 23);
+        check_dyn_elementwise<cx_double>(17, 11);
+
+        using aligned_t = matrix<dr_matrix_engine<float, aligned_allocator<float>>, matrix_operation_traits>;
+
+        aligned_t   m1(13, 45), m2(13, 45);
+
+        fill_matrix(m1, 7, 3);
+        fill_matrix(m2, 8, 3);
+        check_sum_and_difference(m1, m2, aligned_t(m1 + m2), aligned_t(m1 - m2));
+        check_quotient(m1, 3.0f, aligned_t(m1 / 3.0f));
+
+        dyn_matrix<double>  m3(9, 21);
+
+        fill_matrix(m3, 9, 3);
+
+        dyn_matrix<double>  m4 = m3;
+
+        m3 *= 2.0;
+        for (ptrdiff_t i = 0;  i < m3.rows();  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < m3.columns();  ++j)
+            {
+                EXPECT_EQ(m3(i, j), 2.0 * m4(i, j));
+            }
+        }
+    }
+    detail::simd_limit_isa(simd_isa::avx512);
+}
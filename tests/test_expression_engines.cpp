@@ -0,0 +1,192 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the expression view engines produced by matrix_expression_operation_traits.
+//  Results of deferred expressions are compared with those computed eagerly by the default
+//  operation traits.
+//==================================================================================================
+//
+namespace {
+
+using ex_traits  = matrix_expression_operation_traits;
+using ex_dyn_mat = matrix<dr_matrix_engine<double>, ex_traits>;
+using ex_dyn_vec = STD_LA::vector<dr_vector_engine<double>, ex_traits>;
+using ex_fs_mat  = matrix<fs_matrix_engine<double, 3, 4>, ex_traits>;
+
+template<class T>
+struct is_expression_engine : public std::false_type
+{};
+
+template<class EXPR>
+struct is_expression_engine<matrix_expression_engine<EXPR>> : public std::true_type
+{};
+
+template<class EXPR>
+struct is_expression_engine<vector_expression_engine<EXPR>> : public std::true_type
+{};
+
+template<class OBJ>
+constexpr bool  has_expression_engine = is_expression_engine<typename OBJ::engine_type>::value;
+
+}   //- anonymous namespace
+
+
+TEST(ExpressionEngines, ResultTypes)
+{
+    ex_dyn_mat  a(3, 4), b(3, 4);
+    ex_dyn_vec  u(5), v(5);
+
+    //- Element-wise operations are deferred.
+    //
+    EXPECT_TRUE(has_expression_engine<decltype(a + b)>);
+    EXPECT_TRUE(has_expression_engine<decltype(a - b)>);
+    EXPECT_TRUE(has_expression_engine<decltype(2.0 * a)>);
+    EXPECT_TRUE(has_expression_engine<decltype(a * 2.0)>);
+    EXPECT_TRUE(has_expression_engine<decltype(a / 2.0)>);
+    EXPECT_TRUE(has_expression_engine<decltype(a + b - 2.0*a)>);
+    EXPECT_TRUE(has_expression_engine<decltype(u + v)>);
+    EXPECT_TRUE(has_expression_engine<decltype(u - v/4.0)>);
+    EXPECT_TRUE((std::is_same_v<decltype(a + b), matrix<decltype(a + b)::engine_type, ex_traits>>));
+
+    //- Products of vectors and matrices are materialized.
+    //
+    EXPECT_TRUE((std::is_same_v<decltype(a * b.t())::engine_type, dr_matrix_engine<double>>));
+    EXPECT_TRUE((std::is_same_v<decltype(a.t() * u.subvector(0, 3))::engine_type, dr_vector_engine<double>>));
+
+    //- Element promotion follows the default element traits.
+    //
+    EXPECT_TRUE((std::is_same_v<decltype(a + b)::element_type, double>));
+    EXPECT_TRUE((std::is_same_v<decltype(a * 2.0f)::element_type, double>));
+    EXPECT_TRUE((std::is_same_v<decltype(a * cx_double(1, 1))::element_type, cx_double>));
+}
+
+
+TEST(ExpressionEngines, DynMatrix)
+{
+    ex_dyn_mat          a(7, 9), b(7, 9), c(7, 9);
+    dyn_matrix<double>  da(7, 9), db(7, 9), dc(7, 9);
+
+    fill_matrix(a, 1);  fill_matrix(da, 1);
+    fill_matrix(b, 2);  fill_matrix(db, 2);
+    fill_matrix(c, 3);  fill_matrix(dc, 3);
+
+    auto    ex = a + b - 2.0*c;
+
+    EXPECT_EQ(ex.rows(), 7);
+    EXPECT_EQ(ex.columns(), 9);
+    EXPECT_EQ(ex(2, 3), da(2, 3) + db(2, 3) - 2.0*dc(2, 3));
+
+    dyn_matrix<double>  r1 = a + b - 2.0*c;
+    dyn_matrix<double>  r2 = da + db - 2.0*dc;
+    EXPECT_TRUE(r1 == r2);
+
+    ex_dyn_mat  r3(7, 9);
+    r3 = (a - c) / 4.0 + b*3.0;
+    r2 = (da - dc) / 4.0 + db*3.0;
+    EXPECT_TRUE(r3 == r2);
+
+    //- Views as operands.
+    //
+    dyn_matrix<double>  r4 = a.t() + b.t() - (-c).t();
+    r2 = da.t() + db.t() - (-dc).t();
+    EXPECT_TRUE(r4 == r2);
+
+    dyn_matrix<double>  r5 = a.submatrix(1, 4, 2, 5) - 0.5*c.submatrix(3, 4, 0, 5);
+    dyn_matrix<double>  ds = dc.submatrix(3, 4, 0, 5);
+    r2 = da.submatrix(1, 4, 2, 5) - 0.5*ds;
+    EXPECT_TRUE(r5 == r2);
+
+    //- Operands with default operation traits.
+    //
+    dyn_matrix<double>  r6 = a + db - c*0.25;
+    r2 = da + db - dc*0.25;
+    EXPECT_TRUE(r6 == r2);
+}
+
+
+TEST(ExpressionEngines, Aliasing)
+{
+    ex_dyn_mat          a(5, 6), b(5, 6);
+    dyn_matrix<double>  da(5, 6), db(5, 6);
+
+    fill_matrix(a, 4);  fill_matrix(da, 4);
+    fill_matrix(b, 5);  fill_matrix(db, 5);
+
+    //- Element-wise expressions read each element only before it is written, so assigning an
+    //  expression to one of its own (untransposed) operands is well defined.
+    //
+    a = a + 2.0*b;
+    da = da + 2.0*db;
+    EXPECT_TRUE(a == da);
+
+    a = a / 2.0 - b;
+    da = da / 2.0 - db;
+    EXPECT_TRUE(a == da);
+}
+
+
+TEST(ExpressionEngines, FsMatrix)
+{
+    ex_fs_mat                   a, b;
+    fs_matrix<double, 3, 4>     da, db;
+
+    fill_matrix(a, 6);  fill_matrix(da, 6);
+    fill_matrix(b, 7);  fill_matrix(db, 7);
+
+    fs_matrix<double, 3, 4>     r1 = 3.0*a - b/2.0;
+    fs_matrix<double, 3, 4>     r2 = 3.0*da - db/2.0;
+    EXPECT_TRUE(r1 == r2);
+
+    ex_fs_mat   r3;
+    r3 = a + b + a;
+    r2 = da + db + da;
+    EXPECT_TRUE(r3 == r2);
+}
+
+
+TEST(ExpressionEngines, Vectors)
+{
+    ex_dyn_vec          u(11), v(11);
+    dyn_vector<double>  du(11), dv(11);
+
+    fill_vector(u, 1);  fill_vector(du, 1);
+    fill_vector(v, 2);  fill_vector(dv, 2);
+
+    auto    ex = u - v*3.0 + u/2.0;
+
+    EXPECT_EQ(ex.size(), 11);
+    EXPECT_EQ(ex(4), du(4) - dv(4)*3.0 + du(4)/2.0);
+
+    dyn_vector<double>  r1 = u - v*3.0 + u/2.0;
+    dyn_vector<double>  r2 = du - dv*3.0 + du/2.0;
+    EXPECT_TRUE(r1 == r2);
+
+    fs_vector<double, 4>    r3 = u.subvector(2, 4) + 2.0*v.subvector(5, 4);
+    dyn_vector<double>      dw = dv.subvector(5, 4);
+    fs_vector<double, 4>    r4 = du.subvector(2, 4) + 2.0*dw;
+    EXPECT_TRUE(r3 == r4);
+
+    //- Vector-matrix products are computed eagerly; the results may then take part in
+    //  deferred expressions.
+    //
+    ex_dyn_mat  m(11, 3);
+    fill_matrix(m, 3);
+
+    dyn_matrix<double>  dm(11, 3);
+    fill_matrix(dm, 3);
+
+    dyn_vector<double>  r5 = u*m - 2.0*(v*m);
+    dyn_vector<double>  r6 = du*dm - 2.0*(dv*dm);
+    EXPECT_TRUE(r5 == r6);
+}
+
+
+TEST(ExpressionEngines, Errors)
+{
+    ex_dyn_mat  a(3, 4), b(3, 4);
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+
+    fs_matrix<double, 4, 3>     f;
+    EXPECT_THROW((f = a + b), runtime_error);
+}
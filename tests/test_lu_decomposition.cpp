@@ -0,0 +1,322 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the LU factorization and the solve, inverse, and determinant built upon it.
+//  Operands are filled with pseudo-random values, and the factors are checked by comparing the
+//  product L*U with the permuted operand, within a tolerance.
+//==================================================================================================
+//
+namespace {
+
+//- Checks that P*A = L*U, where LU holds the factors of A and P is described by the vector p.
+//
+template<class M1, class M2, class PV>
+void
+check_factors(M1 const& a, M2 const& lu, PV const& p, double tol)
+{
+    using elem_t = typename M1::element_type;
+
+    ptrdiff_t const     m  = a.rows();
+    ptrdiff_t const     n  = a.columns();
+    ptrdiff_t const     kn = std::min(m, n);
+
+    ASSERT_EQ(p.size(), m);
+
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < n;  ++j)
+        {
+            elem_t  e{};
+
+            for (ptrdiff_t k = 0;  k <= std::min({i, j, kn - 1});  ++k)
+            {
+                elem_t const    lik = (k == i) ? elem_t{1} : lu(i, k);
+                e = e + lik * lu(k, j);
+            }
+            EXPECT_LE(magnitude(e - a(p(i), j)), tol);
+        }
+    }
+
+    //- The pivots are chosen by magnitude, so the multipliers are bounded by one.
+    //
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < std::min(i, kn);  ++j)
+        {
+            EXPECT_LE(magnitude(lu(i, j)), 2.0);
+        }
+    }
+}
+
+template<class MT>
+void
+check_dyn_factor(ptrdiff_t rows, ptrdiff_t cols, unsigned seed, double tol)
+{
+    MT  a(rows, cols);
+
+    fill_random(a, seed);
+
+    MT      lu = a;
+    auto    p  = lu_factor(lu);
+
+    check_factors(a, lu, p, tol);
+}
+
+constexpr double
+constexpr_small_lu()
+{
+    fs_matrix<double, 3, 3>     a{{2.0, 1.0, 1.0}, {4.0, -6.0, 0.0}, {-2.0, 7.0, 2.0}};
+    fs_vector<double, 3>        b{5.0, -2.0, 9.0};
+
+    auto const  x   = solve(a, b);
+    auto const  inv = inverse(a);
+
+    return determinant(a) + x(0) + x(1) + x(2) + inv(0, 0) * 16.0;
+}
+
+}   //- anonymous namespace
+
+
+TEST(LuDecomposition, DynFactor)
+{
+    check_dyn_factor<dyn_matrix<double>>(1, 1, 1, 1e-12);
+    check_dyn_factor<dyn_matrix<double>>(7, 7, 2, 1e-12);
+    check_dyn_factor<dyn_matrix<double>>(32, 32, 3, 1e-11);
+    check_dyn_factor<dyn_matrix<double>>(100, 100, 4, 1e-10);
+    check_dyn_factor<dyn_matrix<double>>(129, 129, 5, 1e-10);
+    check_dyn_factor<dyn_matrix<double, allocator<double>, column_major>>(100, 100, 6, 1e-10);
+    check_dyn_factor<dyn_matrix<float>>(80, 80, 7, 1e-2);
+    check_dyn_factor<dyn_matrix<cx_double>>(70, 70, 8, 1e-10);
+
+    //- Rectangular matrices.
+    //
+    check_dyn_factor<dyn_matrix<double>>(90, 40, 10, 1e-10);
+    check_dyn_factor<dyn_matrix<double>>(40, 90, 11, 1e-10);
+    check_dyn_factor<dyn_matrix<double, allocator<double>, column_major>>(40, 90, 12, 1e-10);
+}
+
+TEST(LuDecomposition, Views)
+{
+    //- A submatrix view has no swap_rows() member, so its rows are exchanged element by element;
+    //  the elements outside the view are unchanged.
+    //
+    dyn_matrix<double>  a(60, 60);
+
+    fill_random(a, 20);
+
+    dyn_matrix<double>  sub = a.submatrix(5, 50, 7, 50);
+    dyn_matrix<double>  lu  = a;
+    auto                p   = lu_factor(lu.submatrix(5, 50, 7, 50));
+
+    check_factors(sub, lu.submatrix(5, 50, 7, 50), p, 1e-10);
+    EXPECT_EQ(lu(0, 0), a(0, 0));
+    EXPECT_EQ(lu(59, 59), a(59, 59));
+    EXPECT_EQ(lu(10, 3), a(10, 3));
+
+    //- A transpose view is span-backed, and so is factored by blocks.
+    //
+    dyn_matrix<double>  b(70, 70);
+
+    fill_random(b, 21);
+
+    dyn_matrix<double>  bt  = b.t();
+    dyn_matrix<double>  lut = b;
+    auto                q   = lu_factor(lut.t());
+
+    check_factors(bt, lut.t(), q, 1e-10);
+}
+
+TEST(LuDecomposition, FsSmall)
+{
+    EXPECT_TRUE((detail::use_fs_small_lu_v<fs_matrix_engine<double, 4, 4>>));
+    EXPECT_TRUE((detail::use_fs_small_lu_v<fs_matrix_engine<float, 1, 1>>));
+    EXPECT_FALSE((detail::use_fs_small_lu_v<fs_matrix_engine<double, 3, 4>>));
+    EXPECT_FALSE((detail::use_fs_small_lu_v<fs_matrix_engine<double, 5, 5>>));
+    EXPECT_FALSE((detail::use_fs_small_lu_v<dr_matrix_engine<double>>));
+
+    //- The factorization is usable in constant expressions.  The result is
+    //  det(a) + sum(x) + 16 * inv(a)(0, 0) = -16 + 4 + 12.
+    //
+    static_assert(constexpr_small_lu() == 0.0);
+
+    //- The unrolled kernel makes the same choices as the general one.
+    //
+    fs_matrix<double, 4, 4>     a;
+    fs_matrix<double, 5, 5>     b;
+
+    fill_random(a, 30);
+    fill_random(b, 31);
+
+    fs_matrix<double, 4, 4>     lu_a = a;
+    dyn_matrix<double>          lu_d = a;
+    auto                        p_a  = lu_factor(lu_a);
+    auto                        p_d  = lu_factor(lu_d);
+
+    EXPECT_TRUE((is_same_v<decltype(p_a), fs_vector<ptrdiff_t, 4>>));
+    check_factors(a, lu_a, p_a, 1e-14);
+    EXPECT_LE(max_difference(lu_a, lu_d), 1e-14);
+    for (ptrdiff_t i = 0;  i < 4;  ++i)
+    {
+        EXPECT_EQ(p_a(i), p_d(i));
+    }
+
+    fs_matrix<double, 5, 5>     lu_b = b;
+    auto                        p_b  = lu_factor(lu_b);
+
+    check_factors(b, lu_b, p_b, 1e-13);
+}
+
+TEST(LuDecomposition, Solve)
+{
+    dyn_matrix<double>  a(120, 120);
+    dyn_matrix<double>  b(120, 3);
+    dyn_vector<double>  v(120);
+
+    fill_random(a, 40);
+    fill_random(b, 41);
+    for (ptrdiff_t i = 0;  i < v.size();  ++i)
+    {
+        v(i) = b(i, 1);
+    }
+
+    auto    x = solve(a, b);
+    auto    y = solve(a, v);
+
+    EXPECT_EQ(x.rows(), 120);
+    EXPECT_EQ(x.columns(), 3);
+    EXPECT_EQ(y.size(), 120);
+    EXPECT_LE(max_difference(a * x, b), 1e-9);
+
+    for (ptrdiff_t i = 0;  i < y.size();  ++i)
+    {
+        EXPECT_NEAR(y(i), x(i, 1), 1e-9);
+    }
+
+    //- Factoring once and solving for several right-hand sides.
+    //
+    dyn_matrix<double>  lu = a;
+    auto                p  = lu_factor(lu);
+    auto                z  = lu_solve(lu, p, b);
+
+    EXPECT_LE(max_difference(z, x), 1e-12);
+
+    //- Fixed-size operands give fixed-size results.
+    //
+    fs_matrix<double, 3, 3>     c{{2.0, 1.0, 1.0}, {4.0, -6.0, 0.0}, {-2.0, 7.0, 2.0}};
+    fs_vector<double, 3>        w{5.0, -2.0, 9.0};
+    auto                        u = solve(c, w);
+
+    EXPECT_TRUE((is_same_v<decltype(u), fs_vector<double, 3>>));
+    EXPECT_NEAR(u(0), 1.0, 1e-14);
+    EXPECT_NEAR(u(1), 1.0, 1e-14);
+    EXPECT_NEAR(u(2), 2.0, 1e-14);
+
+    //- Complex elements.
+    //
+    dyn_matrix<cx_double>   ca(40, 40);
+    dyn_matrix<cx_double>   cb(40, 2);
+
+    fill_random(ca, 42);
+    fill_random(cb, 43);
+    EXPECT_LE(max_difference(ca * solve(ca, cb), cb), 1e-10);
+}
+
+TEST(LuDecomposition, Inverse)
+{
+    dyn_matrix<double>  a(50, 50);
+    dyn_matrix<double>  id(50, 50);
+
+    fill_random(a, 50);
+    for (ptrdiff_t i = 0;  i < 50;  ++i)
+    {
+        id(i, i) = 1.0;
+    }
+
+    auto    ai = inverse(a);
+
+    EXPECT_LE(max_difference(a * ai, id), 1e-10);
+    EXPECT_LE(max_difference(ai * a, id), 1e-10);
+
+    dyn_matrix<double, allocator<double>, column_major>     b = a;
+    auto                                                    bi = inverse(b);
+
+    EXPECT_TRUE((is_same_v<decltype(bi), dyn_matrix<double, allocator<double>, column_major>>));
+    EXPECT_LE(max_difference(bi, ai), 1e-10);
+
+    fs_matrix<float, 2, 2>  c{{4.0f, 7.0f}, {2.0f, 6.0f}};
+    auto                    ci = inverse(c);
+
+    EXPECT_NEAR(ci(0, 0), 0.6f, 1e-6f);
+    EXPECT_NEAR(ci(0, 1), -0.7f, 1e-6f);
+    EXPECT_NEAR(ci(1, 0), -0.2f, 1e-6f);
+    EXPECT_NEAR(ci(1, 1), 0.4f, 1e-6f);
+}
+
+TEST(LuDecomposition, Determinant)
+{
+    fs_matrix<double, 2, 2>     a{{0.0, 1.0}, {1.0, 0.0}};
+    fs_matrix<double, 3, 3>     b{{2.0, 0.0, 0.0}, {0.0, 3.0, 0.0}, {0.0, 0.0, 4.0}};
+    dyn_matrix<double>          c{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 10.0}};
+
+    EXPECT_EQ(determinant(a), -1.0);
+    EXPECT_EQ(determinant(b), 24.0);
+    EXPECT_NEAR(determinant(c), -3.0, 1e-12);
+
+    //- The determinant of a product is the product of the determinants.
+    //
+    dyn_matrix<double>  e(64, 64), f(64, 64);
+
+    fill_random(e, 60);
+    fill_random(f, 61);
+
+    double const    de  = determinant(e);
+    double const    df  = determinant(f);
+    double const    def = determinant(e * f);
+
+    EXPECT_NEAR(def / (de * df), 1.0, 1e-9);
+}
+
+TEST(LuDecomposition, Singular)
+{
+    dyn_matrix<double>  a{{1.0, 2.0, 3.0}, {2.0, 4.0, 6.0}, {1.0, 0.0, 1.0}};
+    dyn_vector<double>  b{1.0, 2.0, 3.0};
+
+    EXPECT_EQ(determinant(a), 0.0);
+    EXPECT_THROW(solve(a, b), runtime_error);
+    EXPECT_THROW(inverse(a), runtime_error);
+
+    //- A singular matrix still has a factorization, with a zero on the diagonal of U.
+    //
+    dyn_matrix<double>  lu = a;
+    auto                p  = lu_factor(lu);
+
+    check_factors(a, lu, p, 1e-14);
+    EXPECT_EQ(lu(2, 2), 0.0);
+
+    dyn_matrix<double>  c(3, 4);
+
+    EXPECT_THROW(inverse(c), runtime_error);
+    EXPECT_THROW(determinant(c), runtime_error);
+    EXPECT_THROW(solve(dyn_matrix<double>(3, 3), dyn_vector<double>(4)), runtime_error);
+}
+
+TEST(LuDecomposition, ElementTypes)
+{
+    //- Integral elements are rejected at compile time, since their factors would be truncated;
+    //  an integer matrix is decomposed by converting it to a floating-point one first.
+    //
+    EXPECT_TRUE(detail::is_decomposable_element_v<double>);
+    EXPECT_TRUE(detail::is_decomposable_element_v<float const>);
+    EXPECT_TRUE(detail::is_decomposable_element_v<cx_double>);
+    EXPECT_FALSE(detail::is_decomposable_element_v<int>);
+    EXPECT_FALSE(detail::is_decomposable_element_v<long>);
+    EXPECT_FALSE(detail::is_decomposable_element_v<std::complex<int>>);
+
+    dyn_matrix<int>     a{{2, 1}, {1, 1}};
+    dyn_matrix<double>  ad(a);
+    auto const          x = solve(ad, dyn_vector<double>{1.0, 2.0});
+
+    EXPECT_EQ(determinant(ad), 1.0);
+    EXPECT_NEAR(x(0), -1.0, 1e-15);
+    EXPECT_NEAR(x(1), 3.0, 1e-15);
+}
@@ -0,0 +1,267 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the layout policies of the owning matrix engines.  Column-major engines must
+//  store their elements column by column, interoperate with row-major engines, and produce the
+//  same arithmetic results as row-major engines, whichever loop order the traits choose.
+//==================================================================================================
+//
+namespace {
+
+template<class T>
+using cm_matrix = dyn_matrix<T, std::allocator<T>, column_major>;
+
+//- Multiplies operands of every combination of layouts, and compares the results with a
+//  reference product.  Below the blocked kernel's threshold the results must agree exactly.
+//
+template<class T, class LA, class LB>
+void
+check_products(ptrdiff_t m, ptrdiff_t k, ptrdiff_t n)
+{
+    dyn_matrix<T, std::allocator<T>, LA>    a(m, k);
+    dyn_matrix<T, std::allocator<T>, LB>    b(k, n);
+    dyn_vector<T>                           x(k), y(m);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_vector(x, 3);
+    fill_vector(y, 4);
+
+    auto const  ref = reference_product<T>(a, b);
+    auto const  c   = a * b;
+    auto const  ax  = a * x;
+    auto const  ya  = y * a;
+
+    check_equal(c, ref);
+
+    for (ptrdiff_t i = 0;  i < m;  ++i)
+    {
+        T   er{};
+
+        for (ptrdiff_t p = 0;  p < k;  ++p)
+        {
+            er = er + (a(i, p) * x(p));
+        }
+        EXPECT_EQ(ax(i), er);
+    }
+    for (ptrdiff_t j = 0;  j < k;  ++j)
+    {
+        T   er{};
+
+        for (ptrdiff_t p = 0;  p < m;  ++p)
+        {
+            er = er + (y(p) * a(p, j));
+        }
+        EXPECT_EQ(ya(j), er);
+    }
+}
+
+}   //- anonymous namespace
+
+
+TEST(MatrixLayout, Traits)
+{
+    using rm_t = dr_matrix_engine<double>;
+    using cm_t = dr_matrix_engine<double, std::allocator<double>, column_major>;
+    using fc_t = fs_matrix_engine<float, 3, 2, column_major>;
+
+    EXPECT_TRUE((is_same_v<rm_t::layout_type, row_major>));
+    EXPECT_TRUE((is_same_v<cm_t::layout_type, layout_left>));
+    EXPECT_TRUE((is_same_v<fs_matrix_engine<float, 3, 2>::layout_type, layout_right>));
+
+    EXPECT_TRUE(detail::is_row_major_v<rm_t>);
+    EXPECT_TRUE(detail::is_column_major_v<cm_t>);
+    EXPECT_TRUE(detail::is_column_major_v<fc_t>);
+    EXPECT_TRUE((detail::is_row_major_v<matrix_transpose_engine<cm_t, readable_matrix_engine_tag>>));
+    EXPECT_TRUE((detail::is_column_major_v<matrix_subset_engine<cm_t, writable_matrix_engine_tag>>));
+    EXPECT_FALSE((detail::is_row_major_v<dr_vector_engine<double>>));
+    EXPECT_FALSE((detail::is_column_major_v<dr_vector_engine<double>>));
+
+    //- Results are column-major only when both operands are.
+    //
+    cm_matrix<double>   c1(2, 3), c2(2, 3);
+    dyn_matrix<double>  r1(2, 3);
+
+    EXPECT_TRUE((is_same_v<decltype(c1 + c2)::engine_type, cm_t>));
+    EXPECT_TRUE((is_same_v<decltype(c1 - r1)::engine_type, rm_t>));
+    EXPECT_TRUE((is_same_v<decltype(c1 * 2.0)::engine_type, cm_t>));
+    EXPECT_TRUE((is_same_v<decltype(c1 / 2.0)::engine_type, cm_t>));
+    EXPECT_TRUE((is_same_v<decltype(c1 * c2.t())::engine_type, cm_t>));
+
+    fs_matrix<float, 3, 2, column_major>    f1;
+    fs_matrix<float, 2, 3, column_major>    f2;
+
+    EXPECT_TRUE((is_same_v<decltype(f1 * f2)::engine_type, fs_matrix_engine<float, 3, 3, column_major>>));
+    EXPECT_TRUE((is_same_v<decltype(f1 + f1)::engine_type, fc_t>));
+}
+
+
+TEST(MatrixLayout, DynStorage)
+{
+    cm_matrix<double>   m1(3, 4, 5, 6);
+
+    fill_matrix(m1, 0);
+    EXPECT_EQ(m1.row_capacity(), 5);
+    EXPECT_EQ(m1.column_capacity(), 6);
+
+    //- Elements are stored column by column, with the row capacity as the leading dimension.
+    //
+    auto    s1 = m1.span();
+    EXPECT_EQ(s1.stride(0), 1);
+    EXPECT_EQ(s1.stride(1), 5);
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            EXPECT_EQ(s1.data()[i + 5*j], m1(i, j));
+            EXPECT_EQ(s1(i, j), m1(i, j));
+        }
+    }
+
+    //- Resizing and reserving preserve the surviving elements.
+    //
+    cm_matrix<double>   m2 = m1;
+
+    m1.resize(6, 7);
+    EXPECT_EQ(m1.rows(), 6);
+    EXPECT_EQ(m1.columns(), 7);
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            EXPECT_EQ(m1(i, j), m2(i, j));
+        }
+    }
+
+    m2.reserve(12, 12);
+    m2.resize(2, 3);
+    EXPECT_EQ(m2(1, 2), m1(1, 2));
+
+    //- Row and column swaps.
+    //
+    cm_matrix<int>  m3 = {{1, 2, 3}, {4, 5, 6}};
+
+    m3.swap_rows(0, 1);
+    m3.swap_columns(0, 2);
+    check_equal(m3, dyn_matrix<int>{{6, 5, 4}, {3, 2, 1}});
+    EXPECT_EQ(m3.span().data()[0], 6);
+    EXPECT_EQ(m3.span().data()[1], 3);
+}
+
+
+TEST(MatrixLayout, AlignedColumns)
+{
+    //- With aligned_allocator, each column of a column-major engine begins on an aligned
+    //  boundary.
+    //
+    dyn_matrix<double, aligned_allocator<double>, column_major>     m1(13, 5);
+
+    EXPECT_EQ(m1.row_capacity() % 8, 0);
+    EXPECT_GE(m1.row_capacity(), 13);
+    EXPECT_EQ(m1.column_capacity(), 5);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&m1(0, 3)) % 64, 0u);
+}
+
+
+TEST(MatrixLayout, FixedSize)
+{
+    constexpr fs_matrix<int, 2, 3, column_major>    m1 = {{1, 2, 3}, {4, 5, 6}};
+
+    static_assert(m1(1, 0) == 4);
+    static_assert(m1.span().data()[1] == 4);
+    static_assert(m1.span().stride(0) == 1);
+    static_assert(m1.span().stride(1) == 2);
+
+    fs_matrix<int, 2, 3, column_major>  m2 = m1;
+
+    m2.swap_rows(0, 1);
+    check_equal(m2, fs_matrix<int, 2, 3>{{4, 5, 6}, {1, 2, 3}});
+
+    //- Conversions between layouts copy elements, not storage.
+    //
+    fs_matrix<int, 2, 3>                m3 = m1;
+    fs_matrix<int, 2, 3, column_major>  m4 = m3;
+    cm_matrix<int>                      m5 = m3;
+    dyn_matrix<int>                     m6 = m5;
+
+    check_equal(m3, m1);
+    check_equal(m4, m1);
+    check_equal(m5, m1);
+    check_equal(m6, m1);
+    EXPECT_EQ(m3.span().data()[1], 2);
+    EXPECT_EQ(m5.span().data()[1], 4);
+}
+
+
+TEST(MatrixLayout, Elementwise)
+{
+    cm_matrix<double>   c1(19, 21), c2(19, 21), c3(19, 21, 24, 21);
+    dyn_matrix<double>  r1(19, 21);
+
+    fill_matrix(c1, 1);
+    fill_matrix(c2, 2);
+    fill_matrix(c3, 3);
+    fill_matrix(r1, 4);
+
+    cm_matrix<double>   s12 = c1 + c2;
+    cm_matrix<double>   d13 = c1 - c3;
+    cm_matrix<double>   q1  = c1 / 4.0;
+    dyn_matrix<double>  s1r = c1 + r1;
+
+    for (ptrdiff_t i = 0;  i < c1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < c1.columns();  ++j)
+        {
+            EXPECT_EQ(s12(i, j), c1(i, j) + c2(i, j));
+            EXPECT_EQ(d13(i, j), c1(i, j) - c3(i, j));
+            EXPECT_EQ(q1(i, j),  c1(i, j) / 4.0);
+            EXPECT_EQ(s1r(i, j), c1(i, j) + r1(i, j));
+        }
+    }
+
+    fs_matrix<float, 5, 3, column_major>    f1, f2;
+
+    fill_matrix(f1, 5);
+    fill_matrix(f2, 6);
+    check_equal(fs_matrix<float, 5, 3, column_major>(f1 - f2), dyn_matrix<float>(dyn_matrix<float>(f1) - dyn_matrix<float>(f2)));
+}
+
+
+TEST(MatrixLayout, Products)
+{
+    check_products<double, row_major,    row_major>(7, 9, 11);
+    check_products<double, row_major,    column_major>(7, 9, 11);
+    check_products<double, column_major, row_major>(7, 9, 11);
+    check_products<double, column_major, column_major>(7, 9, 11);
+    check_products<int,    column_major, column_major>(13, 5, 8);
+    check_products<int,    column_major, row_major>(13, 5, 8);
+    check_products<cx_double, column_major, column_major>(4, 6, 3);
+
+    //- Small fixed-size column-major operands use the unrolled kernels.
+    //
+    fs_matrix<float, 4, 4, column_major>    f1;
+    fs_matrix<float, 4, 4>                  f2;
+
+    fill_matrix(f1, 7);
+    fill_matrix(f2, 8);
+    check_equal(f1 * f2, reference_product<float>(f1, f2));
+    check_equal(f1 * f1, reference_product<float>(f1, f1));
+
+    //- Large products use the blocked kernel, whatever the layouts.
+    //
+    cm_matrix<double>   c1(150, 130), c2(130, 170);
+    dyn_matrix<double>  r2(130, 170);
+
+    fill_matrix(c1, 9);
+    fill_matrix(c2, 10);
+    fill_matrix(r2, 10);
+
+    auto const  ref = reference_product<double>(c1, r2);
+    auto const  p1  = c1 * c2;
+    auto const  p2  = c1 * r2;
+
+    check_equal(p1, ref);
+    check_equal(p2, ref);
+}
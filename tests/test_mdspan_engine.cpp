@@ -0,0 +1,259 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for mdspan_matrix_engine, which adopts external buffers.  Matrices using it must
+//  read and write the buffer in place, work with views, and produce owning engines as the
+//  results of arithmetic.
+//==================================================================================================
+//
+namespace {
+
+std::vector<double>
+make_buffer(ptrdiff_t n)
+{
+    std::vector<double>     buf(static_cast<size_t>(n));
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        buf[i] = static_cast<double>(i % 13) - 6.0;
+    }
+    return buf;
+}
+
+}   //- anonymous namespace
+
+
+TEST(MdspanEngine, Traits)
+{
+    using w_engine = mdspan_matrix_engine<double>;
+    using r_engine = mdspan_matrix_engine<double const, column_major>;
+
+    EXPECT_TRUE(is_writable_engine_v<w_engine>);
+    EXPECT_FALSE(is_resizable_engine_v<w_engine>);
+    EXPECT_TRUE(is_readable_engine_v<r_engine>);
+    EXPECT_FALSE(is_writable_engine_v<r_engine>);
+    EXPECT_TRUE((is_same_v<r_engine::element_type, double>));
+    EXPECT_TRUE((is_same_v<r_engine::reference, double const&>));
+
+    EXPECT_TRUE(detail::has_direct_span_v<w_engine>);
+    EXPECT_TRUE(detail::has_direct_span_v<r_engine>);
+    EXPECT_TRUE(detail::is_row_major_v<w_engine>);
+    EXPECT_TRUE(detail::is_column_major_v<r_engine>);
+    EXPECT_TRUE((is_same_v<detail::engine_layout_t<mdspan_matrix_engine<float, strided>>, void>));
+
+    //- Arithmetic results are owning engines, column-major only when both operands are.
+    //
+    std::vector<double>     buf = make_buffer(12);
+    mdspan_matrix<double>   m1(w_engine(buf.data(), 3, 4));
+    mdspan_matrix<double const, column_major>   m2(r_engine(buf.data(), 3, 4));
+    dyn_matrix<float>       m3(3, 4);
+
+    EXPECT_TRUE((is_same_v<decltype(m1 + m1)::engine_type, dr_matrix_engine<double>>));
+    EXPECT_TRUE((is_same_v<decltype(m1 - m3)::engine_type, dr_matrix_engine<double>>));
+    EXPECT_TRUE((is_same_v<decltype(m1 * 2.0)::engine_type, dr_matrix_engine<double>>));
+    EXPECT_TRUE((is_same_v<decltype(m2 + m2)::engine_type,
+                           dr_matrix_engine<double, std::allocator<double>, column_major>>));
+    EXPECT_TRUE((is_same_v<decltype(m2 * 2.0)::engine_type,
+                           dr_matrix_engine<double, std::allocator<double>, column_major>>));
+    EXPECT_TRUE((is_same_v<decltype(m2 * m1.t())::engine_type, dr_matrix_engine<double>>));
+    EXPECT_TRUE((is_same_v<decltype(m1 * m2.t())::engine_type, dr_matrix_engine<double>>));
+}
+
+
+TEST(MdspanEngine, AdoptPointer)
+{
+    std::vector<double>     buf = make_buffer(12);
+    mdspan_matrix<double>   m1(mdspan_matrix_engine<double>(buf.data(), 3, 4));
+
+    EXPECT_EQ(m1.rows(), 3);
+    EXPECT_EQ(m1.columns(), 4);
+    EXPECT_EQ(m1.span().data(), buf.data());
+    EXPECT_EQ(m1.span().stride(0), 4);
+    EXPECT_EQ(m1.span().stride(1), 1);
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            EXPECT_EQ(m1(i, j), buf[i*4 + j]);
+        }
+    }
+
+    //- Writes go to the buffer.
+    //
+    m1(2, 1) = 99.0;
+    EXPECT_EQ(buf[9], 99.0);
+
+    m1 = {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}};
+    EXPECT_EQ(buf[0], 1.0);
+    EXPECT_EQ(buf[11], 12.0);
+
+    m1.swap_rows(0, 2);
+    EXPECT_EQ(buf[0], 9.0);
+    EXPECT_EQ(buf[8], 1.0);
+
+    //- Copies refer to the same buffer.
+    //
+    mdspan_matrix<double>   m2 = m1;
+
+    m2(0, 0) = -1.0;
+    EXPECT_EQ(m1(0, 0), -1.0);
+    EXPECT_EQ(buf[0], -1.0);
+}
+
+
+TEST(MdspanEngine, AdoptStrided)
+{
+    //- A 3x4 row-major matrix in a buffer whose rows are padded to 6 elements.
+    //
+    std::vector<double>     buf = make_buffer(18);
+    mdspan_matrix<double>   m1(mdspan_matrix_engine<double>(buf.data(), 3, 4, 6, 1));
+
+    EXPECT_EQ(m1(1, 0), buf[6]);
+    EXPECT_EQ(m1(2, 3), buf[15]);
+    EXPECT_EQ(m1.span().stride(0), 6);
+
+    //- The same buffer viewed as a 4x3 column-major matrix with padded columns, and as a
+    //  matrix with arbitrary strides.
+    //
+    mdspan_matrix<double, column_major>     m2(mdspan_matrix_engine<double, column_major>(buf.data(), 4, 3, 1, 6));
+    mdspan_matrix<double, strided>          m3(mdspan_matrix_engine<double, strided>(buf.data(), 2, 3, 7, 2));
+
+    EXPECT_EQ(m2(3, 2), buf[15]);
+    EXPECT_EQ(m3(1, 2), buf[11]);
+    EXPECT_TRUE(m_cmp_eq(m2.engine(), m1.t().engine()));
+
+    m3(1, 1) = 42.0;
+    EXPECT_EQ(buf[9], 42.0);
+
+    //- Dense buffers need no strides.
+    //
+    mdspan_matrix<double, column_major>     m4(mdspan_matrix_engine<double, column_major>(buf.data(), 4, 3));
+
+    EXPECT_EQ(m4.span().stride(0), 1);
+    EXPECT_EQ(m4.span().stride(1), 4);
+    EXPECT_EQ(m4(1, 2), buf[9]);
+}
+
+
+TEST(MdspanEngine, AdoptMdspan)
+{
+    std::vector<double>     buf = make_buffer(20);
+
+    basic_mdspan<double, extents<dynamic_extent, dynamic_extent>>   s1(buf.data(), 4, 5);
+    basic_mdspan<double const, extents<2, 10>>                      s2(buf.data());
+
+    mdspan_matrix<double>           m1(s1);
+    mdspan_matrix<double const>     m2(s2);
+
+    EXPECT_EQ(m1.rows(), 4);
+    EXPECT_EQ(m1.columns(), 5);
+    EXPECT_EQ(m2.rows(), 2);
+    EXPECT_EQ(m2.columns(), 10);
+    EXPECT_EQ(m1(3, 4), buf[19]);
+    EXPECT_EQ(m2(1, 0), buf[10]);
+
+    //- Subspans keep the parent's strides.
+    //
+    auto    s3 = subspan(s1, std::pair<ptrdiff_t, ptrdiff_t>(1, 3), std::pair<ptrdiff_t, ptrdiff_t>(2, 5));
+
+    mdspan_matrix<double>   m3(s3);
+
+    EXPECT_EQ(m3.rows(), 2);
+    EXPECT_EQ(m3.columns(), 3);
+    EXPECT_EQ(m3(0, 0), buf[7]);
+    EXPECT_EQ(m3(1, 2), buf[14]);
+
+    //- A span whose layout does not match the engine's layout is rejected.
+    //
+    basic_mdspan<double, extents<dynamic_extent, dynamic_extent>, layout_left>  s4(buf.data(), 4, 5);
+
+    EXPECT_THROW((mdspan_matrix_engine<double>(s4)), runtime_error);
+    EXPECT_NO_THROW((mdspan_matrix_engine<double, column_major>(s4)));
+    EXPECT_NO_THROW((mdspan_matrix_engine<double, strided>(s4)));
+}
+
+
+TEST(MdspanEngine, InvalidStrides)
+{
+    std::vector<double>     buf = make_buffer(12);
+
+    EXPECT_THROW((mdspan_matrix_engine<double>(buf.data(), 3, 4, 3, 1)), runtime_error);
+    EXPECT_THROW((mdspan_matrix_engine<double>(buf.data(), 3, 4, 4, 2)), runtime_error);
+    EXPECT_THROW((mdspan_matrix_engine<double, column_major>(buf.data(), 3, 4, 3, 1)), runtime_error);
+    EXPECT_THROW((mdspan_matrix_engine<double, strided>(buf.data(), 3, 4, 0, 1)), runtime_error);
+    EXPECT_THROW((mdspan_matrix_engine<double>(buf.data(), -1, 4)), runtime_error);
+    EXPECT_THROW((mdspan_matrix_engine<double>(nullptr, 3, 4)), runtime_error);
+    EXPECT_NO_THROW((mdspan_matrix_engine<double>(nullptr, 0, 0)));
+}
+
+
+TEST(MdspanEngine, Arithmetic)
+{
+    std::vector<double>     b1 = make_buffer(6), b2 = make_buffer(7), br(6);
+
+    std::reverse(b2.begin(), b2.end());
+
+    mdspan_matrix<double>       m1(mdspan_matrix_engine<double>(b1.data(), 2, 3));
+    mdspan_matrix<double const> m2(mdspan_matrix_engine<double const>(b2.data(), 2, 3));
+    mdspan_matrix<double>       mr(mdspan_matrix_engine<double>(br.data(), 2, 3));
+    dyn_matrix<double>          d1(m1), d2(m2);
+
+    EXPECT_TRUE(m_cmp_eq((m1 + m2).engine(), (d1 + d2).engine()));
+    EXPECT_TRUE(m_cmp_eq((m1 - m2).engine(), (d1 - d2).engine()));
+    EXPECT_TRUE(m_cmp_eq((m2 * 3.0).engine(), (d2 * 3.0).engine()));
+    EXPECT_TRUE(m_cmp_eq((m1 / 2.0).engine(), (d1 / 2.0).engine()));
+    EXPECT_TRUE(m_cmp_eq((-m1).engine(), (-d1).engine()));
+    EXPECT_TRUE(m_cmp_eq((m1 * m2.t()).engine(), (d1 * d2.t()).engine()));
+
+    //- Results assigned to an adopting matrix are written into its buffer.
+    //
+    mr = m1 + m2;
+    for (size_t i = 0;  i < br.size();  ++i)
+    {
+        EXPECT_EQ(br[i], b1[i] + b2[i]);
+    }
+
+    //- Views of an adopting matrix refer to the buffer.
+    //
+    mr.row(1) = d1.row(0);
+    EXPECT_EQ(br[3], b1[0]);
+    EXPECT_EQ(br[5], b1[2]);
+
+    mr.submatrix(0, 2, 1, 1) = dyn_matrix<double>{{7}, {8}};
+    EXPECT_EQ(br[1], 7.0);
+    EXPECT_EQ(br[4], 8.0);
+
+    mr.t()(2, 0) = 11.0;
+    EXPECT_EQ(br[2], 11.0);
+    EXPECT_EQ(mr.column(2)(0), 11.0);
+}
+
+
+TEST(MdspanEngine, Products)
+{
+    //- Products large enough to use the blocked kernel, with operands in padded buffers.
+    //
+    ptrdiff_t const     m = 90, k = 110, n = 70;
+
+    std::vector<double> b1 = make_buffer(m*(k + 3)), b2 = make_buffer(n*(k + 1)), br(m*n);
+
+    mdspan_matrix<double>                   m1(mdspan_matrix_engine<double>(b1.data(), m, k, k + 3, 1));
+    mdspan_matrix<double, column_major>     m2(mdspan_matrix_engine<double, column_major>(b2.data(), k, n, 1, k + 1));
+    mdspan_matrix<double>                   mr(mdspan_matrix_engine<double>(br.data(), m, n));
+    dyn_matrix<double>                      d1(m1), d2(m2);
+
+    auto const  dr = d1 * d2;
+
+    mr = m1 * m2;
+    EXPECT_TRUE(m_cmp_eq(mr.engine(), dr.engine()));
+    EXPECT_TRUE(m_cmp_eq((m2.t() * m1.t()).engine(), dr.t().engine()));
+
+    dyn_vector<double>  v(k);
+
+    for (ptrdiff_t i = 0;  i < k;  ++i)
+    {
+        v(i) = static_cast<double>(i % 5);
+    }
+    EXPECT_TRUE(v_cmp_eq((m1 * v).engine(), (d1 * v).engine()));
+}
@@ -0,0 +1,419 @@
+#include "test_common.hpp"
+
+#ifdef LA_HAS_MMAP
+#include <cstdio>
+#include <fstream>
+
+//==================================================================================================
+//  Unit tests for mmap_matrix_engine, which stores its elements in a memory-mapped file.  Files
+//  written by one engine must be readable by another, resizing must preserve elements, and
+//  matrices using the engine must work with views and arithmetic.
+//==================================================================================================
+//
+namespace {
+
+std::string
+temp_path(char const* name)
+{
+    return ::testing::TempDir() + "la_mmap_" + name + ".bin";
+}
+
+}   //- anonymous namespace
+
+
+TEST(MmapEngine, Traits)
+{
+    using rm_t = mmap_matrix_engine<double>;
+    using cm_t = mmap_matrix_engine<float, column_major>;
+
+    EXPECT_TRUE(is_resizable_engine_v<rm_t>);
+    EXPECT_TRUE(detail::has_direct_span_v<rm_t>);
+    EXPECT_TRUE(detail::is_row_major_v<rm_t>);
+    EXPECT_TRUE(detail::is_column_major_v<cm_t>);
+    EXPECT_FALSE(is_copy_constructible_v<rm_t>);
+    EXPECT_TRUE(is_nothrow_move_constructible_v<rm_t>);
+
+    mmap_matrix<double>     m1(3, 4);
+    mmap_matrix<float, column_major>    m2(3, 4);
+
+    EXPECT_FALSE(m1.engine().is_file_backed());
+    EXPECT_TRUE((is_same_v<decltype(m1 + m1)::engine_type, dr_matrix_engine<double>>));
+    EXPECT_TRUE((is_same_v<decltype(m2 * 2.0f)::engine_type,
+                           dr_matrix_engine<float, std::allocator<float>, column_major>>));
+}
+
+
+TEST(MmapEngine, CreateAndOpen)
+{
+    std::string const   path = temp_path("create");
+    dyn_matrix<double>  d1(5, 7);
+
+    fill_matrix(d1, 1);
+
+    {
+        mmap_matrix_engine<double>  e1(path, 5, 7, 6, 8);
+
+        EXPECT_TRUE(e1.is_file_backed());
+        EXPECT_EQ(e1.mode(), mmap_mode::read_write);
+        EXPECT_EQ(e1.rows(), 5);
+        EXPECT_EQ(e1.columns(), 7);
+        EXPECT_EQ(e1.row_capacity(), 6);
+        EXPECT_EQ(e1.column_capacity(), 8);
+        EXPECT_EQ(e1(4, 6), 0.0);
+
+        //- The elements follow the header, aligned for SIMD access.
+        //
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(e1.span().data()) % 64, 0u);
+        EXPECT_EQ(e1.span().stride(0), 8);
+
+        e1 = d1.engine();
+        e1.flush();
+    }
+
+    //- Reopened for writing, changes reach the file.
+    //
+    {
+        mmap_matrix<double>     m1(mmap_matrix_engine<double>(path, mmap_mode::read_write));
+
+        EXPECT_TRUE(m_cmp_eq(m1.engine(), d1.engine()));
+        EXPECT_EQ(m1.row_capacity(), 6);
+        m1(2, 3) = 100.0;
+    }
+
+    //- Reopened for reading, changes are private to the engine.
+    //
+    {
+        mmap_matrix<double>     m2(mmap_matrix_engine<double>(path, mmap_mode::read_only));
+
+        EXPECT_EQ(m2.engine().mode(), mmap_mode::read_only);
+        EXPECT_EQ(m2(2, 3), 100.0);
+        m2(2, 3) = -1.0;
+        EXPECT_EQ(m2(2, 3), -1.0);
+
+        //- Resizing within the capacity is allowed; growing it is not.
+        //
+        m2.resize(6, 8);
+        EXPECT_THROW(m2.resize(7, 8), runtime_error);
+    }
+    {
+        mmap_matrix_engine<double>  e3(path, mmap_mode::read_only);
+
+        EXPECT_EQ(e3(2, 3), 100.0);
+        EXPECT_EQ(e3.rows(), 5);
+    }
+
+    std::remove(path.c_str());
+}
+
+
+TEST(MmapEngine, InvalidFiles)
+{
+    std::string const   path = temp_path("invalid");
+
+    EXPECT_THROW((mmap_matrix_engine<double>(temp_path("missing"), mmap_mode::read_only)), runtime_error);
+
+    {
+        mmap_matrix_engine<double, column_major>    e1(path, 3, 4);
+    }
+
+    EXPECT_THROW((mmap_matrix_engine<float, column_major>(path, mmap_mode::read_only)), runtime_error);
+    EXPECT_THROW((mmap_matrix_engine<double>(path, mmap_mode::read_only)), runtime_error);
+    EXPECT_NO_THROW((mmap_matrix_engine<double, column_major>(path, mmap_mode::read_only)));
+
+    {
+        std::ofstream   os(path, std::ios::binary | std::ios::trunc);
+        os << "not a matrix file, but long enough to hold a header of sixty-four bytes";
+    }
+    EXPECT_THROW((mmap_matrix_engine<double>(path, mmap_mode::read_only)), runtime_error);
+
+    //- A corrupt header whose capacities multiply to a small number when the product wraps
+    //  around must not be mistaken for a header describing a small matrix.
+    //
+    {
+        mmap_matrix_engine<double>  e1(path, 2, 3);
+    }
+    {
+        auto const      hdr = detail::make_file_header<double, row_major>(2, 2, 3, int64_t(1) << 32,
+                                                                          int64_t(1) << 32);
+        std::fstream    fs(path, std::ios::binary | std::ios::in | std::ios::out);
+
+        fs.write(reinterpret_cast<char const*>(&hdr), sizeof(hdr));
+    }
+    EXPECT_THROW((mmap_matrix_engine<double>(path, mmap_mode::read_only)), runtime_error);
+    EXPECT_THROW((mmap_matrix_engine<double>(path, mmap_mode::read_write)), runtime_error);
+    EXPECT_THROW((mapped_file(path).as_matrix<double>()), runtime_error);
+
+    EXPECT_THROW((mmap_matrix_engine<double>(path, 0, 4)), runtime_error);
+    std::remove(path.c_str());
+}
+
+
+TEST(MmapEngine, Resize)
+{
+    std::string const   path = temp_path("resize");
+    dyn_matrix<int>     d1(4, 5);
+
+    fill_matrix(d1, 2);
+
+    {
+        mmap_matrix<int>    m1(mmap_matrix_engine<int>(path, 4, 5));
+
+        m1 = d1;
+
+        //- Growing the columns changes the leading dimension, and so moves every row.
+        //
+        m1.resize(6, 9);
+        EXPECT_EQ(m1.rows(), 6);
+        EXPECT_EQ(m1.columns(), 9);
+        EXPECT_GE(m1.row_capacity(), 8);
+
+        for (ptrdiff_t i = 0;  i < m1.rows();  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < m1.columns();  ++j)
+            {
+                EXPECT_EQ(m1(i, j), (i < 4  &&  j < 5) ? d1(i, j) : 0);
+            }
+        }
+
+        m1.resize(2, 3);
+        EXPECT_EQ(m1.column_capacity(), 9);
+        m1.reserve(20, 20);
+        EXPECT_EQ(m1(1, 2), d1(1, 2));
+    }
+
+    //- The file records the new size and capacity.
+    //
+    {
+        mmap_matrix_engine<int>     e2(path, mmap_mode::read_only);
+
+        EXPECT_EQ(e2.rows(), 2);
+        EXPECT_EQ(e2.columns(), 3);
+        EXPECT_EQ(e2.row_capacity(), 20);
+        EXPECT_EQ(e2.column_capacity(), 20);
+        EXPECT_EQ(e2(1, 2), d1(1, 2));
+    }
+    std::remove(path.c_str());
+
+    //- Anonymous, column-major storage.
+    //
+    mmap_matrix<double, column_major>   m3(3, 4);
+    dyn_matrix<double>                  d3(3, 4);
+
+    fill_matrix(m3, 3);
+    fill_matrix(d3, 3);
+    m3.resize(7, 5);
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            EXPECT_EQ(m3(i, j), d3(i, j));
+        }
+        EXPECT_EQ(m3(i, 4), 0.0);
+    }
+    EXPECT_EQ(m3.span().stride(0), 1);
+    EXPECT_EQ(m3.span().stride(1), m3.row_capacity());
+
+    m3.swap_rows(0, 2);
+    m3.swap_columns(0, 3);
+    EXPECT_EQ(m3(0, 0), d3(2, 3));
+}
+
+
+TEST(MmapEngine, TransposeInPlace)
+{
+    std::string const   path = temp_path("transpose");
+    dyn_matrix<double>  d1(6, 9);
+
+    fill_matrix(d1, 6);
+
+    {
+        mmap_matrix<double>     m1(mmap_matrix_engine<double>(path, 6, 9));
+
+        m1 = d1;
+        m1.transpose_in_place();
+        EXPECT_TRUE(m1 == d1.t());
+        EXPECT_EQ(m1.row_capacity(), 9);
+        EXPECT_EQ(m1.column_capacity(), 6);
+    }
+
+    //- The new extents and capacities are recorded in the file.
+    //
+    {
+        mmap_matrix<double>     m2(mmap_matrix_engine<double>(path, mmap_mode::read_only));
+
+        EXPECT_TRUE(m2 == d1.t());
+        EXPECT_EQ(m2.rows(), 9);
+        EXPECT_EQ(m2.column_capacity(), 6);
+    }
+    std::remove(path.c_str());
+
+    mmap_matrix<float, column_major>    m3(4, 4);
+    dyn_matrix<float>                   d3(4, 4);
+
+    fill_matrix(m3, 7);
+    fill_matrix(d3, 7);
+    m3.transpose_in_place();
+    EXPECT_TRUE(m3 == d3.t());
+}
+
+
+TEST(MmapEngine, Advice)
+{
+    std::string const   path = temp_path("advice");
+    dyn_matrix<double>  d1(600, 100);
+
+    fill_matrix(d1, 8);
+
+    //- Discarding pages must not lose elements or the header, whether the mapping is shared with
+    //  a file opened for writing, private to a file opened for reading only, or anonymous.
+    //
+    {
+        mmap_matrix<double>     m1(mmap_matrix_engine<double>(path, 600, 100));
+
+        m1 = d1;
+        m1.engine().advise_rows(mmap_advice::dont_need, 1, 5);
+        m1.engine().advise_rows(mmap_advice::dont_need, 100, 300);
+        EXPECT_TRUE(m1 == d1);
+        m1.engine().advise(mmap_advice::dont_need);
+        EXPECT_TRUE(m1 == d1);
+    }
+    {
+        mmap_matrix<double>     m2(mmap_matrix_engine<double>(path, mmap_mode::read_only));
+
+        EXPECT_TRUE(m2 == d1);
+
+        m2(0, 0)   = 100.0;
+        m2(299, 7) = 200.0;
+        m2.engine().advise(mmap_advice::dont_need);
+        m2.engine().advise_rows(mmap_advice::dont_need, 200, 200);
+        EXPECT_EQ(m2(0, 0), 100.0);
+        EXPECT_EQ(m2(299, 7), 200.0);
+        EXPECT_EQ(m2.rows(), 600);
+
+        mmap_matrix<double>     m3(mmap_matrix_engine<double>(path, mmap_mode::read_only));
+
+        EXPECT_TRUE(m3 == d1);
+    }
+    std::remove(path.c_str());
+
+    mmap_matrix<double>                 m4(600, 100);
+    mmap_matrix<double, column_major>   m5(600, 100);
+
+    m4 = d1;
+    m5 = d1;
+    m4.engine().advise_rows(mmap_advice::dont_need, 10, 500);
+    m4.engine().advise(mmap_advice::dont_need);
+    m5.engine().advise_rows(mmap_advice::dont_need, 0, 600);
+    EXPECT_TRUE(m4 == d1);
+    EXPECT_TRUE(m5 == d1);
+
+    //- The other hints leave the elements unchanged.
+    //
+    m4.engine().advise(mmap_advice::sequential);
+    m4.engine().advise_rows(mmap_advice::will_need, 0, 1);
+    m4.engine().advise_rows(mmap_advice::random, 599, 1);
+    m4.engine().advise(mmap_advice::normal);
+    EXPECT_TRUE(m4 == d1);
+}
+
+
+TEST(MmapEngine, ViewsAndArithmetic)
+{
+    std::string const   path = temp_path("views");
+    ptrdiff_t const     m = 96, n = 80;
+
+    mmap_matrix<double>     m1(mmap_matrix_engine<double>(path, m, n));
+    dyn_matrix<double>      d1(m, n), d2(n, 16);
+
+    fill_matrix(m1, 4);
+    fill_matrix(d1, 4);
+    fill_matrix(d2, 5);
+
+    m1.engine().advise(mmap_advice::sequential);
+
+    //- Stream row blocks (tiles) of the mapped matrix through the arithmetic operators.
+    //
+    ptrdiff_t const     tile = 32;
+
+    for (ptrdiff_t i = 0;  i < m;  i += tile)
+    {
+        m1.engine().advise_rows(mmap_advice::will_need, i, tile);
+
+        auto                r1 = m1.submatrix(i, tile, 0, n) * d2;
+        auto                r2 = d1.submatrix(i, tile, 0, n) * d2;
+
+        EXPECT_TRUE(m_cmp_eq(r1.engine(), r2.engine()));
+
+        m1.engine().advise_rows(mmap_advice::dont_need, i, tile);
+    }
+
+    EXPECT_TRUE(v_cmp_eq((m1.row(5) + d1.row(6)).engine(), (d1.row(5) + d1.row(6)).engine()));
+    EXPECT_TRUE(v_cmp_eq((m1.column(7) * 2.0).engine(), (d1.column(7) * 2.0).engine()));
+    EXPECT_TRUE(m_cmp_eq((m1.t() - d1.t()).engine(), dyn_matrix<double>(n, m).engine()));
+
+    //- Writes through views reach the mapping, and so the file.
+    //
+    m1.row(3) = d1.row(0);
+    m1.submatrix(10, 2, 20, 2) = dyn_matrix<double>{{1, 2}, {3, 4}};
+    m1.t()(0, 50) = 99.0;
+    m1.engine().flush();
+
+    mmap_matrix_engine<double>  e2(path, mmap_mode::read_only);
+
+    EXPECT_EQ(e2(3, 7), d1(0, 7));
+    EXPECT_EQ(e2(11, 21), 4.0);
+    EXPECT_EQ(e2(50, 0), 99.0);
+
+    std::remove(path.c_str());
+}
+
+
+TEST(MmapEngine, AppendRows)
+{
+    std::string const   path = temp_path("append");
+    dyn_matrix<double>  d1(40, 6);
+
+    fill_matrix(d1, 4);
+
+    //- Appending rows grows the file in place; the matrix stays backed by it.
+    //
+    {
+        mmap_matrix<double>     m1(mmap_matrix_engine<double>(path, 2, 6));
+
+        m1 = d1.submatrix(0, 2, 0, 6);
+        m1.append_row(d1.row(2));
+        EXPECT_TRUE(m1.engine().is_file_backed());
+
+        for (ptrdiff_t i = 3;  i < 24;  ++i)
+        {
+            m1.append_row(d1.row(i));
+        }
+        m1.append_rows(d1.submatrix(24, 8, 0, 6));
+        ASSERT_EQ(m1.row_capacity(), 32);
+
+        //- Rows of the matrix itself, while its storage grows.
+        //
+        m1.append_rows(m1.submatrix(0, 8, 0, 6));
+
+        EXPECT_TRUE(m1.engine().is_file_backed());
+        EXPECT_EQ(m1.rows(), 40);
+        EXPECT_GE(m1.row_capacity(), 40);
+    }
+
+    mmap_matrix_engine<double>  e2(path, mmap_mode::read_only);
+
+    ASSERT_EQ(e2.rows(), 40);
+    ASSERT_EQ(e2.columns(), 6);
+
+    for (ptrdiff_t i = 0;  i < 40;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 6;  ++j)
+        {
+            EXPECT_EQ(e2(i, j), d1((i < 32) ? i : i - 32, j));
+        }
+    }
+    std::remove(path.c_str());
+}
+
+#endif  //- LA_HAS_MMAP
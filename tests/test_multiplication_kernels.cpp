@@ -0,0 +1,310 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the blocked matrix-matrix multiplication kernel.  Operands are filled with
+//  small integers, so that the results of the blocked kernel and of a simple reference loop are
+//  exactly representable and may be compared for equality.
+//==================================================================================================
+//
+namespace {
+
+template<class T>
+void
+check_dyn_product(ptrdiff_t rows, ptrdiff_t inner, ptrdiff_t cols)
+{
+    dyn_matrix<T>   m1(rows, inner), m2(inner, cols);
+
+    fill_matrix(m1, 1);
+    fill_matrix(m2, 2);
+
+    auto    m3 = m1 * m2;
+    auto    m4 = reference_product(m1, m2);
+
+    EXPECT_EQ(m3.rows(), rows);
+    EXPECT_EQ(m3.columns(), cols);
+    EXPECT_TRUE(m3 == m4);
+}
+
+}   //- anonymous namespace
+
+
+TEST(MulKernels, Traits)
+{
+    using dr_t = dr_matrix_engine<double>;
+    using fs_t = fs_matrix_engine<double, 4, 4>;
+
+    EXPECT_TRUE((detail::has_direct_span_v<dr_t>));
+    EXPECT_TRUE((detail::has_direct_span_v<fs_t>));
+    EXPECT_TRUE((detail::has_direct_span_v<matrix_transpose_engine<dr_t, readable_matrix_engine_tag>>));
+    EXPECT_TRUE((detail::has_direct_span_v<matrix_subset_engine<dr_t, readable_matrix_engine_tag>>));
+    EXPECT_FALSE((detail::has_direct_span_v<matrix_negation_engine<dr_t>>));
+    EXPECT_FALSE((detail::has_direct_span_v<matrix_hermitian_engine<dr_t, readable_matrix_engine_tag>>));
+
+    EXPECT_TRUE((detail::use_gemm_v<dr_t, fs_t, dr_t>));
+    EXPECT_FALSE((detail::use_gemm_v<dr_matrix_engine<int>, dr_matrix_engine<int>, dr_matrix_engine<int>>));
+    EXPECT_FALSE((detail::use_gemm_v<dr_matrix_engine<float>, dr_t, dr_t>));
+}
+
+
+TEST(MulKernels, DynBlocked)
+{
+    check_dyn_product<double>(1, 1, 1);
+    check_dyn_product<double>(5, 7, 3);
+    check_dyn_product<double>(67, 53, 71);
+    check_dyn_product<double>(131, 300, 45);
+    check_dyn_product<double>(3, 513, 2);
+    check_dyn_product<float>(97, 129, 101);
+    check_dyn_product<complex<double>>(35, 270, 29);
+}
+
+
+TEST(MulKernels, DynBlockedViews)
+{
+    dyn_matrix<double>  m1(90, 40), m2(90, 50), m3(100, 100);
+
+    fill_matrix(m1, 3);
+    fill_matrix(m2, 4);
+    fill_matrix(m3, 5);
+
+    //- Transposed left-hand operand.
+    //
+    auto    r1 = m1.t() * m2;
+    EXPECT_TRUE(r1 == reference_product(m1.t(), m2));
+
+    //- Transposed right-hand operand.
+    //
+    auto    r2 = m2.t() * m1;
+    EXPECT_TRUE(r2 == reference_product(m2.t(), m1));
+
+    //- Submatrix operands, with row strides larger than their column counts.
+    //
+    auto    s1 = m3.submatrix(3, 60, 7, 45);
+    auto    s2 = m3.submatrix(11, 45, 2, 33);
+    auto    r3 = s1 * s2;
+    EXPECT_TRUE(r3 == reference_product(s1, s2));
+
+    //- Negated operands are not spannable, and so exercise the simple loops.
+    //
+    auto    r4 = -m1.t() * m2;
+    EXPECT_TRUE(r4 == reference_product(-m1.t(), m2));
+}
+
+
+
+TEST(MulKernels, TransposedOperands)
+{
+    using cm_matrix = matrix<dr_matrix_engine<double, std::allocator<double>, column_major>>;
+
+    dyn_matrix<double>  a(70, 90), b(80, 90), c(90, 60);
+    cm_matrix           d(90, 70);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_matrix(c, 3);
+    fill_matrix(d, 4);
+
+    //- Operands whose elements are contiguous along the inner dimension: a row-major A with the
+    //  transpose of a row-major B, and the transposes of a column-major A and a row-major B.
+    //
+    EXPECT_TRUE((a * b.t()) == reference_product(a, b.t()));
+    EXPECT_TRUE((d.t() * b.t()) == reference_product(d.t(), b.t()));
+    EXPECT_TRUE((c.t() * d) == reference_product(c.t(), d));
+
+    //- Edge slivers of both operands, with contiguous inner dimensions.
+    //
+    auto    s1 = a.submatrix(1, 68, 3, 88);
+    auto    s2 = b.submatrix(2, 77, 3, 88);
+    EXPECT_TRUE((s1 * s2.t()) == reference_product(s1, s2.t()));
+}
+
+
+TEST(MulKernels, HermitianOperands)
+{
+    using cx_t = complex<double>;
+    using dr_t = dr_matrix_engine<cx_t>;
+    using he_t = matrix_hermitian_engine<dr_t, readable_matrix_engine_tag>;
+
+    EXPECT_TRUE((detail::use_gemm_update_v<he_t, dr_t, dr_t>));
+    EXPECT_TRUE((detail::use_gemm_update_v<dr_t, he_t, dr_t>));
+    EXPECT_FALSE((detail::use_gemm_v<he_t, dr_t, dr_t>));
+
+    dyn_matrix<cx_t>    a(50, 40), b(50, 45), ah(40, 50);
+
+    fill_matrix(a, 0);
+    fill_matrix(b, 5);
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            ah(j, i) = std::conj(a(i, j));
+        }
+    }
+
+    //- Hermitian views are multiplied by the blocked kernel, which conjugates while packing.
+    //
+    EXPECT_TRUE((a.h() * b) == reference_product(ah, b));
+    EXPECT_TRUE((b.t() * a.h().h()) == reference_product(b.t(), a));
+    EXPECT_TRUE((ah.h() * a.h()) == reference_product(a, ah));
+}
+
+TEST(MulKernels, FsBlocked)
+{
+    fs_matrix<double, 32, 24>   m1;
+    fs_matrix<double, 24, 40>   m2;
+
+    fill_matrix(m1, 6);
+    fill_matrix(m2, 7);
+
+    auto    m3 = m1 * m2;
+
+    EXPECT_EQ(m3.rows(), 32);
+    EXPECT_EQ(m3.columns(), 40);
+    EXPECT_TRUE(m3 == reference_product(m1, m2));
+}
+
+
+TEST(MulKernels, AlphaBeta)
+{
+    dyn_matrix<double>  a(37, 29), b(29, 41), c(37, 41);
+
+    fill_matrix(a, 8);
+    fill_matrix(b, 9);
+    fill_matrix(c, 10);
+
+    auto    ab = reference_product(a, b);
+    auto    c0 = c;
+
+    detail::gemm(2.0, a.span(), b.span(), 3.0, c.span());
+
+    for (ptrdiff_t i = 0;  i < c.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < c.columns();  ++j)
+        {
+            EXPECT_EQ(c(i, j), 2.0*ab(i, j) + 3.0*c0(i, j));
+        }
+    }
+}
+
+
+namespace {
+
+template<class T, ptrdiff_t R, ptrdiff_t K, ptrdiff_t C>
+void
+check_fs_small_product()
+{
+    fs_matrix<T, R, K>  m1;
+    fs_matrix<T, K, C>  m2;
+
+    fill_matrix(m1, 11);
+    fill_matrix(m2, 12);
+
+    fs_matrix<T, R, C>  r1 = m1 * m2;
+    EXPECT_TRUE(r1 == reference_product(m1, m2));
+}
+
+template<class T, ptrdiff_t N>
+void
+check_fs_small_vector_product()
+{
+    fs_matrix<T, N, N>  m1;
+    fs_vector<T, N>     v1, v2;
+
+    fill_matrix(m1, 11);
+
+    for (ptrdiff_t i = 0;  i < N;  ++i)
+    {
+        v1(i) = static_cast<T>(i*3 - 2);
+        v2(i) = static_cast<T>(5 - i*2);
+    }
+
+    fs_vector<T, N>     r2 = m1 * v1;
+    fs_vector<T, N>     r3 = v2 * m1;
+
+    for (ptrdiff_t i = 0;  i < N;  ++i)
+    {
+        T   e2{}, e3{};
+
+        for (ptrdiff_t k = 0;  k < N;  ++k)
+        {
+            e2 = e2 + m1(i, k) * v1(k);
+            e3 = e3 + v2(k) * m1(k, i);
+        }
+        EXPECT_EQ(r2(i), e2);
+        EXPECT_EQ(r3(i), e3);
+    }
+}
+
+constexpr float
+constexpr_small_products()
+{
+    fs_matrix<float, 4, 4>  m1, m2;
+    fs_vector<float, 4>     v1;
+
+    for (ptrdiff_t i = 0;  i < 4;  ++i)
+    {
+        v1(i) = static_cast<float>(i + 1);
+
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            m1(i, j) = static_cast<float>(i == j);
+            m2(i, j) = static_cast<float>(i*4 + j);
+        }
+    }
+
+    auto    r1 = m1 * m2;
+    auto    r2 = m2 * v1;
+    auto    r3 = v1 * m2;
+
+    return r1(2, 3) + r2(1) + r3(3);
+}
+
+}   //- anonymous namespace
+
+
+TEST(MulKernels, FsSmall)
+{
+    using f44 = fs_matrix_engine<float, 4, 4>;
+    using f45 = fs_matrix_engine<float, 4, 5>;
+    using d4  = fs_vector_engine<double, 4>;
+
+    EXPECT_TRUE((detail::use_fs_small_v<f44, f44, f44>));
+    EXPECT_TRUE((detail::use_fs_small_v<f44, d4, fs_vector_engine<double, 4>>));
+    EXPECT_FALSE((detail::use_fs_small_v<f44, f45, f45>));
+    EXPECT_FALSE((detail::use_fs_small_v<fs_matrix_engine<float, 3, 4>, fs_vector_engine<float, 4>,
+                                          fs_vector_engine<float, 4>>));
+    EXPECT_FALSE((detail::use_fs_small_v<f44, dr_matrix_engine<float>, dr_matrix_engine<float>>));
+
+    //- The products are usable in constant expressions.  The result is
+    //  m2(2, 3) + (m2 * v1)(1) + (v1 * m2)(3) = 11 + 60 + 110.
+    //
+    static_assert(constexpr_small_products() == 181.0f);
+
+    check_fs_small_product<float, 4, 4, 4>();
+    check_fs_small_product<float, 3, 4, 4>();
+    check_fs_small_product<float, 4, 3, 4>();
+    check_fs_small_product<float, 2, 3, 2>();
+    check_fs_small_product<float, 1, 1, 1>();
+    check_fs_small_product<double, 4, 4, 4>();
+    check_fs_small_product<double, 2, 4, 3>();
+    check_fs_small_product<int, 4, 4, 4>();
+    check_fs_small_product<cx_double, 3, 3, 3>();
+
+    check_fs_small_vector_product<float, 4>();
+    check_fs_small_vector_product<float, 3>();
+    check_fs_small_vector_product<double, 4>();
+    check_fs_small_vector_product<double, 2>();
+    check_fs_small_vector_product<int, 4>();
+
+    //- Mixed element types are promoted, and use the unrolled scalar kernels.
+    //
+    fs_matrix<float, 4, 4>  m1;
+    fs_matrix<double, 4, 4> m2;
+
+    fill_matrix(m1, 13);
+    fill_matrix(m2, 14);
+
+    fs_matrix<double, 4, 4> r1 = m1 * m2;
+    fs_matrix<double, 4, 4> m3 = m1;
+    EXPECT_TRUE(r1 == reference_product(m3, m2));
+}
@@ -0,0 +1,373 @@
+#include "test_common.hpp"
+
+#include <cmath>
+#include <limits>
+
+//==================================================================================================
+//  Unit tests for the fused multiply-add, C = alpha*op(A)*op(B) + beta*C.  Operands are filled
+//  with small integers, and alpha and beta are powers of two, so that the results are exactly
+//  representable whatever order the kernels accumulate in.
+//==================================================================================================
+//
+namespace {
+
+//- Computes alpha*(m1*m2) + beta*mc with simple loops.
+//
+template<class T, class M1, class M2, class MC>
+dyn_matrix<T>
+reference_update(T alpha, M1 const& m1, M2 const& m2, T beta, MC const& mc)
+{
+    dyn_matrix<T>   mr = reference_product<T>(m1, m2);
+
+    for (ptrdiff_t i = 0;  i < mr.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < mr.columns();  ++j)
+        {
+            mr(i, j) = alpha * mr(i, j) + beta * mc(i, j);
+        }
+    }
+    return mr;
+}
+
+template<class T, class LA, class LB, class LC>
+void
+check_update(ptrdiff_t m, ptrdiff_t k, ptrdiff_t n)
+{
+    dyn_matrix<T, std::allocator<T>, LA>    a(m, k);
+    dyn_matrix<T, std::allocator<T>, LB>    b(k, n);
+    dyn_matrix<T, std::allocator<T>, LC>    c(m, n);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_matrix(c, 3);
+
+    auto const  ref = reference_update(T{2}, a, b, T{4}, c);
+
+    multiply_add(T{2}, a, b, T{4}, c);
+    check_equal(c, ref);
+
+    //- Transpose views are multiplied in place of the matrices they view.
+    //
+    dyn_matrix<T, std::allocator<T>, LA>    at(k, m);
+    dyn_matrix<T, std::allocator<T>, LB>    bt(n, k);
+
+    at = a.t();
+    bt = b.t();
+    fill_matrix(c, 4);
+
+    auto const  ref_t = reference_update(T{1}, a, b, T{-1}, c);
+
+    multiply_add(1, at.t(), bt.t(), -1, c);
+    check_equal(c, ref_t);
+}
+
+//- Operation traits whose multiply-add traits count their calls before deferring to the
+//  default traits.
+//
+struct counting_operation_traits : public matrix_operation_traits
+{
+    static inline int   calls = 0;
+
+    template<class OTR, class OP1, class OP2>
+    struct multiply_add_arithmetic_traits
+    {
+        template<class S1, class S2, class MR>
+        static constexpr void
+        multiply_add(S1 const& alpha, OP1 const& m1, OP2 const& m2, S2 const& beta, MR& mr)
+        {
+            ++calls;
+            matrix_multiply_add_traits<OTR, OP1, OP2>::multiply_add(alpha, m1, m2, beta, mr);
+        }
+    };
+};
+
+}   //- anonymous namespace
+
+
+TEST(MultiplyAdd, Small)
+{
+    check_update<double, row_major,    row_major,    row_major>(5, 7, 6);
+    check_update<double, column_major, row_major,    column_major>(5, 7, 6);
+    check_update<double, row_major,    column_major, row_major>(5, 7, 6);
+    check_update<double, column_major, column_major, column_major>(5, 7, 6);
+    check_update<int,    row_major,    row_major,    row_major>(4, 3, 9);
+    check_update<int,    column_major, column_major, column_major>(4, 3, 9);
+    check_update<float,  row_major,    column_major, column_major>(6, 2, 3);
+
+    fs_matrix<float, 3, 4>  f1;
+    fs_matrix<float, 4, 2>  f2;
+    fs_matrix<float, 3, 2>  f3;
+
+    fill_matrix(f1, 1);
+    fill_matrix(f2, 2);
+    fill_matrix(f3, 3);
+
+    auto const  ref = reference_update(0.5f, f1, f2, 2.0f, f3);
+
+    multiply_add(0.5f, f1, f2, 2.0f, f3);
+    check_equal(f3, ref);
+}
+
+
+TEST(MultiplyAdd, Blocked)
+{
+    check_update<double, row_major,    row_major,    row_major>(70, 300, 90);
+    check_update<double, column_major, row_major,    row_major>(70, 300, 90);
+    check_update<double, row_major,    column_major, column_major>(65, 40, 130);
+    check_update<float,  column_major, column_major, column_major>(33, 550, 41);
+}
+
+
+TEST(MultiplyAdd, ZeroBeta)
+{
+    //- With beta equal to zero, the prior contents of the result are not read.
+    //
+    double const        nan = std::numeric_limits<double>::quiet_NaN();
+    dyn_matrix<double>  a(40, 50), b(50, 60), c1(40, 60), c2(3, 4);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+
+    for (ptrdiff_t i = 0;  i < c1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < c1.columns();  ++j)
+        {
+            c1(i, j) = nan;
+        }
+    }
+    c2 = c1.submatrix(0, 3, 0, 4);
+
+    multiply_add(1.0, a, b, 0.0, c1);
+    check_equal(c1, a * b);
+
+    multiply_add(3.0, a.submatrix(0, 3, 0, 5), b.submatrix(0, 5, 0, 4), 0.0, c2);
+
+    for (ptrdiff_t i = 0;  i < c2.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < c2.columns();  ++j)
+        {
+            EXPECT_FALSE(std::isnan(c2(i, j)));
+        }
+    }
+}
+
+
+TEST(MultiplyAdd, Hermitian)
+{
+    dyn_matrix<cx_double>   a(30, 20), b(30, 25), c(20, 25), ah(20, 30);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_matrix(c, 3);
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            ah(j, i) = std::conj(a(i, j));
+        }
+    }
+
+    //- h() is a view of the conjugate transpose.
+    //
+    auto    hv = a.h();
+
+    EXPECT_EQ(hv.rows(), 20);
+    EXPECT_EQ(hv(3, 7), std::conj(a(7, 3)));
+    EXPECT_TRUE((detail::is_column_major_v<decltype(hv)::engine_type>));
+    check_equal(a.h() * b, ah * b);
+
+    //- Views of a hermitian view keep its conjugation, whichever kernel computes the product.
+    //
+    dyn_matrix<cx_double>   ac(30, 20);
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            ac(i, j) = std::conj(a(i, j));
+        }
+    }
+    check_equal(b.t() * a.h().t(), b.t() * ac);
+    EXPECT_EQ(a.h().row(2)(5), std::conj(a(5, 2)));
+
+    //- Large enough for the blocked kernel, which conjugates while packing.
+    //
+    cx_double const     alpha(2.0, 0.0), beta(0.0, 1.0);
+    auto const          ref1 = reference_update(alpha, ah, b, beta, c);
+
+    multiply_add(alpha, a.h(), b, beta, c);
+    check_equal(c, ref1);
+
+    dyn_matrix<cx_double>   d(20, 20);
+
+    fill_matrix(d, 4);
+
+    auto const  ref2 = reference_update(alpha, ah, a, beta, d);
+
+    multiply_add(alpha, a.h(), a.h().h(), beta, d);
+    check_equal(d, ref2);
+
+    //- Small products use the loops.
+    //
+    auto const  ref3 = reference_update(alpha, ah.submatrix(0, 2, 0, 3), b.submatrix(0, 3, 0, 2),
+                                        beta, c.submatrix(0, 2, 0, 2));
+
+    multiply_add(alpha, a.submatrix(0, 3, 0, 2).h(), b.submatrix(0, 3, 0, 2), beta, c.submatrix(0, 2, 0, 2));
+    check_equal(c.submatrix(0, 2, 0, 2), ref3);
+}
+
+
+TEST(MultiplyAdd, Views)
+{
+    //- The result may be a view, such as one quadrant of a larger matrix.
+    //
+    dyn_matrix<double>  a(80, 60), b(60, 90), c(160, 180), c0;
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_matrix(c, 3);
+    c0 = c;
+
+    auto const  ref = reference_update(-2.0, a, b, 0.5, c.submatrix(80, 80, 90, 90));
+
+    multiply_add(-2.0, a, b, 0.5, c.submatrix(80, 80, 90, 90));
+    check_equal(c.submatrix(80, 80, 90, 90), ref);
+    check_equal(c.submatrix(0, 80, 0, 180), c0.submatrix(0, 80, 0, 180));
+    check_equal(c.submatrix(80, 80, 0, 90), c0.submatrix(80, 80, 0, 90));
+
+    auto    ct = c.t();
+
+    multiply_add(1.0, b.t(), a.t(), 0.0, ct.submatrix(0, 90, 0, 80));
+    check_equal(c.submatrix(0, 80, 0, 90), a * b);
+
+    //- Mismatched sizes are rejected.
+    //
+    EXPECT_THROW(multiply_add(1.0, a, a, 1.0, c), runtime_error);
+    EXPECT_THROW(multiply_add(1.0, a, b, 1.0, c), runtime_error);
+}
+
+
+TEST(MultiplyAdd, Aliasing)
+{
+    //- The result may share elements with either operand, whichever kernel computes the update.
+    //
+    for (ptrdiff_t n : {6, 120})
+    {
+        dyn_matrix<double>  a(n, n), b(n, n);
+
+        fill_matrix(a, 1);
+        fill_matrix(b, 2);
+
+        dyn_matrix<double>  a0 = a;
+        auto const          r1 = reference_update(2.0, a0, b, 0.5, a0);
+
+        multiply_add(2.0, a, b, 0.5, a);
+        check_equal(a, r1);
+
+        a = a0;
+        auto const          r2 = reference_update(1.0, b, a0.t(), -1.0, a0);
+
+        multiply_add(1.0, b, a.t(), -1.0, a);
+        check_equal(a, r2);
+
+        a = a0;
+        auto const          r3 = reference_update(1.0, a0, a0, 0.0, a0);
+
+        multiply_add(1.0, a, a, 0.0, a);
+        check_equal(a, r3);
+
+        //- Views of the result that overlap an operand, but not the elements it updates.
+        //
+        ptrdiff_t const     h  = n / 2;
+
+        a = a0;
+        dyn_matrix<double>  r4 = a0;
+        auto const          u4 = reference_update(1.0, a0.submatrix(0, h, 0, h), a0.submatrix(0, h, h, h),
+                                                  1.0, a0.submatrix(h, h, 0, h));
+
+        r4.submatrix(h, h, 0, h) = u4;
+        multiply_add(1.0, a.submatrix(0, h, 0, h), a.submatrix(0, h, h, h), 1.0, a.submatrix(h, h, 0, h));
+        check_equal(a, r4);
+    }
+
+    dyn_matrix<int>     d(5, 5);
+
+    fill_matrix(d, 3);
+
+    dyn_matrix<int>     d0 = d;
+    auto const          rd = reference_update(1, d0.t(), d0, 1, d0);
+
+    multiply_add(1, d.t(), d, 1, d);
+    check_equal(d, rd);
+}
+
+
+TEST(MultiplyAdd, NoAllocation)
+{
+    counted_matrix<double>  a(150, 170), b(170, 130), c(150, 130);
+    counted_matrix<int>     d(9, 8), e(8, 7), f(9, 7);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_matrix(c, 3);
+    fill_matrix(d, 4);
+    fill_matrix(e, 5);
+    fill_matrix(f, 6);
+
+    auto    updates = [&]()
+    {
+        multiply_add(2.0, a, b, 0.5, c);
+        multiply_add(1.0, b.t(), a.t(), -1.0, c.t());
+        multiply_add(1.0, a.submatrix(0, 100, 0, 100), b.submatrix(0, 100, 0, 100), 1.0,
+                     c.submatrix(50, 100, 30, 100));
+        multiply_add(3, d, e, 2, f);
+        multiply_add(1, e.t(), d.t(), 0, f.t());
+    };
+
+    //- The first blocked products on this thread may create or grow its packing buffers; after
+    //  that, products of the same shapes allocate nothing: neither engines, nor new buffers,
+    //  which would be allocated before the old ones were released, and so have new addresses.
+    //
+    updates();
+
+    auto&           ws      = detail::gemm_workspace<double>::local();
+    double* const   p_abuf  = ws.a_buffer(0);
+    double* const   p_bbuf  = ws.b_buffer(0);
+    long const      before  = allocation_count.load();
+
+    updates();
+    updates();
+
+    EXPECT_NE(p_abuf, nullptr);
+    EXPECT_EQ(allocation_count.load() - before, 0);
+    EXPECT_EQ(ws.a_buffer(0), p_abuf);
+    EXPECT_EQ(ws.b_buffer(0), p_bbuf);
+}
+
+
+TEST(MultiplyAdd, TraitsHook)
+{
+    using count_matrix = matrix<dr_matrix_engine<double>, counting_operation_traits>;
+
+    count_matrix        a(4, 5), b(5, 6), c(4, 6);
+    dyn_matrix<double>  d(5, 6);
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    fill_matrix(c, 3);
+    fill_matrix(d, 2);
+
+    auto const  ref = reference_update(2.0, a, b, 1.0, c);
+
+    //- Traits are selected from the operands, as for multiplication.
+    //
+    counting_operation_traits::calls = 0;
+    multiply_add(2.0, a, b, 1.0, c);
+    EXPECT_EQ(counting_operation_traits::calls, 1);
+    check_equal(c, ref);
+
+    multiply_add(1.0, a, d, 0.0, c);
+    EXPECT_EQ(counting_operation_traits::calls, 2);
+    check_equal(c, a * d);
+}
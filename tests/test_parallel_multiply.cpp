@@ -0,0 +1,129 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the work-stealing thread pool and the parallel matrix-matrix product used by
+//  matrix_parallel_operation_traits.  Every tile of a parallel product is computed by the same
+//  operations as in the serial product, so results must agree exactly, for any thread count.
+//==================================================================================================
+//
+namespace {
+
+using detail::work_stealing_pool;
+
+template<class T>
+void
+check_parallel_gemm(ptrdiff_t rows, ptrdiff_t cols, ptrdiff_t inner)
+{
+    dyn_matrix<T>   m1(rows, inner), m2(inner, cols), serial(rows, cols);
+
+    fill_matrix(m1, 1, 3);
+    fill_matrix(m2, 2, 3);
+    detail::gemm(T{1}, m1.span(), m2.span(), T{}, serial.span());
+
+    for (size_t threads : {1u, 2u, 3u, 4u})
+    {
+        work_stealing_pool  pool(threads);
+        dyn_matrix<T>       mr(rows, cols);
+
+        detail::gemm_parallel(pool, T{1}, m1.span(), m2.span(), T{}, mr.span());
+        EXPECT_TRUE(mr == serial) << "threads = " << threads;
+    }
+}
+
+}   //- anonymous namespace
+
+
+TEST(ThreadPool, RunsEveryTask)
+{
+    for (size_t threads : {1u, 2u, 4u})
+    {
+        work_stealing_pool          pool(threads);
+        std::vector<atomic<int>>    counts(1000);
+
+        EXPECT_EQ(pool.thread_count(), threads);
+
+        for (int pass = 0;  pass < 3;  ++pass)
+        {
+            pool.parallel_for(1000, [&](ptrdiff_t i) { counts[i].fetch_add(1); });
+        }
+        for (auto const& c : counts)
+        {
+            EXPECT_EQ(c.load(), 3);
+        }
+    }
+
+    work_stealing_pool  pool(0);
+    EXPECT_EQ(pool.thread_count(), 1u);
+}
+
+
+TEST(ThreadPool, Exceptions)
+{
+    work_stealing_pool  pool(3);
+    atomic<int>         count(0);
+
+    auto    fn = [&](ptrdiff_t i)
+    {
+        count.fetch_add(1);
+        if (i == 17) throw runtime_error("task failed");
+    };
+
+    EXPECT_THROW(pool.parallel_for(100, fn), runtime_error);
+    EXPECT_EQ(count.load(), 100);
+
+    //- The pool remains usable after a failed loop.
+    //
+    count = 0;
+    pool.parallel_for(50, [&](ptrdiff_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 50);
+}
+
+
+TEST(ThreadPool, Nested)
+{
+    work_stealing_pool  pool(4);
+    atomic<int>         count(0);
+
+    pool.parallel_for(8, [&](ptrdiff_t)
+    {
+        pool.parallel_for(8, [&](ptrdiff_t) { count.fetch_add(1); });
+    });
+    EXPECT_EQ(count.load(), 64);
+}
+
+
+TEST(ParallelMultiply, Deterministic)
+{
+    check_parallel_gemm<double>(300, 280, 150);
+    check_parallel_gemm<double>(97, 513, 64);
+    check_parallel_gemm<float>(250, 131, 200);
+    check_parallel_gemm<cx_double>(130, 70, 90);
+}
+
+
+TEST(ParallelMultiply, Traits)
+{
+    using par_mat = matrix<dr_matrix_engine<double>, matrix_parallel_operation_traits>;
+
+    par_mat             a(260, 190), b(190, 230);
+    dyn_matrix<double>  da(260, 190), db(190, 230);
+
+    fill_matrix(a, 3, 3);  fill_matrix(da, 3, 3);
+    fill_matrix(b, 4, 3);  fill_matrix(db, 4, 3);
+
+    auto    r1 = a * b;
+    EXPECT_TRUE((std::is_same_v<decltype(r1), par_mat>));
+    EXPECT_TRUE(r1 == da * db);
+
+    //- Small products, products of views, and mixed operands.
+    //
+    par_mat     c = a.submatrix(0, 5, 0, 7) * b.submatrix(0, 7, 0, 3);
+    EXPECT_TRUE(c == da.submatrix(0, 5, 0, 7) * db.submatrix(0, 7, 0, 3));
+
+    dyn_matrix<double>  r2 = a.t() * da;
+    EXPECT_TRUE(r2 == da.t() * da);
+
+    fs_matrix<double, 4, 4>     f1;
+    fill_matrix(f1, 5, 3);
+    EXPECT_TRUE((a.submatrix(0, 4, 0, 4) * f1) == (da.submatrix(0, 4, 0, 4) * f1));
+}
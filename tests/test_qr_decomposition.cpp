@@ -0,0 +1,258 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the Householder QR factorization, the extraction of its economy-size factors,
+//  and the least-squares solver.  Factorizations are checked by forming Q*R and Q^H*Q from the
+//  extracted factors, at sizes on both sides of the blocking parameter.
+//==================================================================================================
+//
+namespace {
+
+//- Returns the largest differences between A and Q*R, and between Q^H*Q and the identity.  R
+//  must also be upper trapezoidal.
+//
+template<class M1, class M2, class M3>
+std::pair<double, double>
+factor_error(M1 const& a, M2 const& q, M3 const& r)
+{
+    using elem_t = typename M1::element_type;
+
+    double  diff = 0.0;
+    double  orth = 0.0;
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            elem_t  e{};
+
+            for (ptrdiff_t k = 0;  k < r.rows();  ++k)
+            {
+                e = e + q(i, k) * r(k, j);
+            }
+            diff = std::max(diff, magnitude(e - a(i, j)));
+        }
+    }
+    for (ptrdiff_t i = 0;  i < q.columns();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < q.columns();  ++j)
+        {
+            elem_t  e = (i == j) ? elem_t{-1} : elem_t{};
+
+            for (ptrdiff_t k = 0;  k < q.rows();  ++k)
+            {
+                e = e + conj_of(q(k, i)) * q(k, j);
+            }
+            orth = std::max(orth, magnitude(e));
+        }
+    }
+    for (ptrdiff_t i = 0;  i < r.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < i;  ++j)
+        {
+            if (r(i, j) != elem_t{}) diff = 1.0;
+        }
+    }
+    return {diff, orth};
+}
+
+//- Returns the largest element of A^H*(A*X - B), which is zero at the least-squares solution.
+//
+template<class M1, class M2, class M3>
+double
+normal_error(M1 const& a, M2 const& x, M3 const& b)
+{
+    using elem_t = typename M1::element_type;
+
+    double  diff = 0.0;
+
+    for (ptrdiff_t c = 0;  c < x.columns();  ++c)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            elem_t  g{};
+
+            for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+            {
+                elem_t  ri = -b(i, c);
+
+                for (ptrdiff_t k = 0;  k < a.columns();  ++k)
+                {
+                    ri = ri + a(i, k) * x(k, c);
+                }
+                g = g + conj_of(a(i, j)) * ri;
+            }
+            diff = std::max(diff, magnitude(g));
+        }
+    }
+    return diff;
+}
+
+template<class MT>
+void
+check_factors(ptrdiff_t m, ptrdiff_t n, unsigned seed, double tol)
+{
+    MT  a(m, n);
+
+    fill_random(a, seed);
+
+    MT      qr  = a;
+    auto    tau = qr_factor(qr);
+    auto    q   = qr_q(qr, tau);
+    auto    r   = qr_r(qr);
+
+    ASSERT_EQ(tau.size(), std::min(m, n));
+    ASSERT_EQ(q.rows(), m);
+    ASSERT_EQ(q.columns(), std::min(m, n));
+    ASSERT_EQ(r.rows(), std::min(m, n));
+    ASSERT_EQ(r.columns(), n);
+
+    auto const  err = factor_error(a, q, r);
+
+    EXPECT_LE(err.first, tol);
+    EXPECT_LE(err.second, tol);
+}
+
+}   //- anonymous namespace
+
+
+TEST(QrDecomposition, Factor)
+{
+    check_factors<dyn_matrix<double>>(1, 1, 1, 1e-14);
+    check_factors<dyn_matrix<double>>(10, 6, 2, 1e-13);
+    check_factors<dyn_matrix<double>>(6, 10, 3, 1e-13);
+    check_factors<dyn_matrix<double>>(32, 32, 4, 1e-12);
+    check_factors<dyn_matrix<double>>(120, 90, 5, 1e-12);
+    check_factors<dyn_matrix<double>>(75, 140, 6, 1e-12);
+    check_factors<dyn_matrix<double, allocator<double>, column_major>>(110, 100, 7, 1e-12);
+    check_factors<dyn_matrix<float>>(70, 50, 8, 1e-4);
+    check_factors<dyn_matrix<cx_double>>(90, 70, 9, 1e-12);
+    check_factors<dyn_matrix<cx_float>>(40, 40, 10, 1e-4);
+
+    //- A column that is already zero below the diagonal gives the identity reflector.
+    //
+    dyn_matrix<double>  z{{2.0, 1.0}, {0.0, 3.0}, {0.0, 4.0}};
+    auto                zt = qr_factor(z);
+
+    EXPECT_EQ(zt(0), 0.0);
+    EXPECT_EQ(z(0, 0), 2.0);
+    EXPECT_NEAR(std::abs(z(1, 1)), 5.0, 1e-14);
+}
+
+TEST(QrDecomposition, FixedSizeAndViews)
+{
+    fs_matrix<double, 4, 3>     a;
+
+    fill_random(a, 20);
+
+    fs_matrix<double, 4, 3>     qr  = a;
+    auto                        tau = qr_factor(qr);
+    auto                        q   = qr_q(qr, tau);
+    auto                        r   = qr_r(qr);
+
+    EXPECT_TRUE((is_same_v<decltype(tau), fs_vector<double, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(q), fs_matrix<double, 4, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(r), fs_matrix<double, 3, 3>>));
+    EXPECT_LE(factor_error(a, q, r).first, 1e-14);
+    EXPECT_LE(factor_error(a, q, r).second, 1e-14);
+
+    fs_matrix<double, 50, 40>   b;
+
+    fill_random(b, 21);
+
+    fs_matrix<double, 50, 40>   bqr = b;
+    auto                        bt  = qr_factor(bqr);
+    auto const                  be  = factor_error(b, qr_q(bqr, bt), qr_r(bqr));
+
+    EXPECT_LE(be.first, 1e-12);
+    EXPECT_LE(be.second, 1e-12);
+
+    //- A submatrix view is factored in place, leaving the rest of its matrix unchanged.
+    //
+    dyn_matrix<double>  c(100, 90);
+
+    fill_random(c, 22);
+
+    dyn_matrix<double>  d = c;
+    auto                dt = qr_factor(d.submatrix(5, 80, 10, 60));
+    auto const          ce = factor_error(c.submatrix(5, 80, 10, 60),
+                                          qr_q(d.submatrix(5, 80, 10, 60), dt),
+                                          qr_r(d.submatrix(5, 80, 10, 60)));
+
+    EXPECT_LE(ce.first, 1e-12);
+    EXPECT_LE(ce.second, 1e-12);
+    EXPECT_EQ(d(4, 10), c(4, 10));
+    EXPECT_EQ(d(85, 10), c(85, 10));
+    EXPECT_EQ(d(5, 9), c(5, 9));
+    EXPECT_EQ(d(5, 70), c(5, 70));
+}
+
+TEST(QrDecomposition, LeastSquares)
+{
+    using dmat = dyn_matrix<double>;
+
+    dmat                a(150, 60);
+    dmat                b(150, 3);
+    dyn_vector<double>  v(150);
+
+    fill_random(a, 30);
+    fill_random(b, 31);
+    for (ptrdiff_t i = 0;  i < v.size();  ++i)
+    {
+        v(i) = b(i, 1);
+    }
+
+    auto    x = least_squares(a, b);
+    auto    y = least_squares(a, v);
+
+    EXPECT_EQ(x.rows(), 60);
+    EXPECT_EQ(x.columns(), 3);
+    EXPECT_EQ(y.size(), 60);
+    EXPECT_LE(normal_error(a, x, b), 1e-11);
+    for (ptrdiff_t i = 0;  i < y.size();  ++i)
+    {
+        EXPECT_NEAR(y(i), x(i, 1), 1e-12);
+    }
+
+    //- A consistent system is solved exactly.
+    //
+    dmat    xs(60, 3);
+
+    fill_random(xs, 32);
+    EXPECT_LE(max_difference(least_squares(a, a * xs), xs), 1e-11);
+
+    //- Complex elements.
+    //
+    using cmat = dyn_matrix<cx_double>;
+
+    cmat    ca(80, 45);
+    cmat    cb(80, 2);
+
+    fill_random(ca, 33);
+    fill_random(cb, 34);
+    EXPECT_LE(normal_error(ca, least_squares(ca, cb), cb), 1e-11);
+
+    //- Fixed-size operands give fixed-size results.
+    //
+    fs_matrix<double, 4, 2>     fa{{1.0, 0.0}, {1.0, 1.0}, {1.0, 2.0}, {1.0, 3.0}};
+    fs_vector<double, 4>        fb{1.0, 3.0, 5.0, 7.0};
+    fs_matrix<double, 4, 2>     fc{{1.0, 6.0}, {3.0, 5.0}, {5.0, 4.0}, {7.0, 3.0}};
+
+    auto    fx = least_squares(fa, fb);
+    auto    fy = least_squares(fa, fc);
+
+    EXPECT_TRUE((is_same_v<decltype(fx), fs_vector<double, 2>>));
+    EXPECT_TRUE((is_same_v<decltype(fy), fs_matrix<double, 2, 2>>));
+    EXPECT_NEAR(fx(0), 1.0, 1e-14);
+    EXPECT_NEAR(fx(1), 2.0, 1e-14);
+    EXPECT_NEAR(fy(0, 1), 6.0, 1e-14);
+    EXPECT_NEAR(fy(1, 1), -1.0, 1e-14);
+
+    //- Underdetermined and rank-deficient problems.
+    //
+    dmat    r{{1.0, 0.0}, {2.0, 0.0}, {3.0, 0.0}};
+
+    EXPECT_THROW(least_squares(dmat(3, 4), dmat(3, 1)), runtime_error);
+    EXPECT_THROW(least_squares(r, dmat(3, 1)), runtime_error);
+    EXPECT_THROW(least_squares(a, dmat(140, 1)), runtime_error);
+}
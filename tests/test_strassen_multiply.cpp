@@ -0,0 +1,141 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the Strassen-Winograd matrix product used by matrix_strassen_operation_traits.
+//  The recursion does not compute the same sequence of operations as the conventional product,
+//  so results are compared with a naive triple loop to within a tolerance that allows for the
+//  weaker error bound of the recursion.
+//==================================================================================================
+//
+namespace {
+
+//- The elements of the operands are at most 1 in magnitude; the tolerance allows for an error
+//  that grows with the inner dimension and with the depth of the recursion.
+//
+template<class T>
+double
+tolerance(ptrdiff_t inner)
+{
+    return 64.0 * static_cast<double>(std::numeric_limits<detail::simd_real_t<T>>::epsilon())
+                * static_cast<double>(inner);
+}
+
+//- Operation traits with a small crossover, so that the recursion is exercised at several
+//  levels by products of modest size.
+//
+template<ptrdiff_t N>
+struct small_strassen_traits : public matrix_strassen_operation_traits
+{
+    static constexpr ptrdiff_t  strassen_crossover = N;
+};
+
+template<class T, ptrdiff_t N = 16, class L1 = row_major, class L2 = row_major>
+void
+check_strassen(ptrdiff_t rows, ptrdiff_t cols, ptrdiff_t inner)
+{
+    using traits = small_strassen_traits<N>;
+    using mat_1  = matrix<dr_matrix_engine<T, std::allocator<T>, L1>, traits>;
+    using mat_2  = matrix<dr_matrix_engine<T, std::allocator<T>, L2>, traits>;
+
+    mat_1   m1(rows, inner);
+    mat_2   m2(inner, cols);
+
+    fill_matrix(m1, 1, 7);
+    fill_matrix(m2, 2, 7);
+
+    auto const  mr = m1 * m2;
+
+    check_close(mr, reference_product<cx_double>(m1, m2), tolerance<T>(inner));
+}
+
+}   //- anonymous namespace
+
+
+TEST(StrassenMultiply, Crossover)
+{
+    EXPECT_EQ(detail::strassen_crossover_v<matrix_strassen_operation_traits>, 1024);
+    EXPECT_EQ(detail::strassen_crossover_v<small_strassen_traits<64>>, 64);
+    EXPECT_EQ(detail::strassen_crossover_v<small_strassen_traits<0>>, detail::strassen_blocking::min_crossover);
+    EXPECT_EQ(detail::strassen_crossover_v<matrix_operation_traits>, detail::strassen_blocking::default_crossover);
+
+    EXPECT_TRUE(detail::use_strassen(1024, 1024, 1024, 1024));
+    EXPECT_FALSE(detail::use_strassen(1024, 1023, 1024, 1024));
+    EXPECT_EQ(detail::strassen_scratch_size(100, 100, 100, 128), 0);
+    EXPECT_EQ(detail::strassen_scratch_size(64, 64, 64, 32), 32*32 + 32*32 + 16*16 + 16*16);
+}
+
+
+TEST(StrassenMultiply, Accuracy)
+{
+    //- Powers of two, odd sizes at every level, and rectangular shapes.
+    //
+    check_strassen<double>(128, 128, 128);
+    check_strassen<double>(131, 131, 131);
+    check_strassen<double>(97, 45, 150);
+    check_strassen<double>(64, 200, 33);
+    check_strassen<double, 2>(37, 29, 41);
+    check_strassen<float>(120, 100, 90);
+    check_strassen<cx_double>(70, 66, 68);
+
+    //- Column-major operands and results.
+    //
+    check_strassen<double, 16, column_major, column_major>(99, 87, 93);
+    check_strassen<double, 16, row_major, column_major>(80, 81, 82);
+    check_strassen<double, 16, column_major, row_major>(65, 64, 63);
+}
+
+
+TEST(StrassenMultiply, Traits)
+{
+    using str_mat = matrix<dr_matrix_engine<double>, small_strassen_traits<32>>;
+
+    str_mat             a(150, 140), b(140, 130);
+    dyn_matrix<double>  da(150, 140), db(140, 130);
+
+    fill_matrix(a, 3, 7);  fill_matrix(da, 3, 7);
+    fill_matrix(b, 4, 7);  fill_matrix(db, 4, 7);
+
+    auto    r1 = a * b;
+    EXPECT_TRUE((std::is_same_v<decltype(r1), str_mat>));
+    check_close(r1, reference_product<cx_double>(da, db), tolerance<double>(140));
+
+    //- Products of views are computed through their spans.
+    //
+    str_mat     r2 = a.t() * a.submatrix(0, 150, 10, 100);
+    check_close(r2, reference_product<cx_double>(da.t(), da.submatrix(0, 150, 10, 100)),
+                tolerance<double>(150));
+
+    //- Products with any dimension below the crossover are computed as by the standard traits.
+    //
+    str_mat     c = a.submatrix(0, 31, 0, 140) * b;
+    EXPECT_TRUE(c == da.submatrix(0, 31, 0, 140) * db);
+
+    fs_matrix<double, 4, 4>     f1;
+    fill_matrix(f1, 5, 7);
+    EXPECT_TRUE((a.submatrix(0, 4, 0, 4) * f1) == (da.submatrix(0, 4, 0, 4) * f1));
+}
+
+
+TEST(StrassenMultiply, ScratchReuse)
+{
+    using str_mat = matrix<dr_matrix_engine<double, counting_allocator<double>>, small_strassen_traits<16>>;
+
+    str_mat     a(100, 100), b(100, 100);
+
+    fill_matrix(a, 6, 7);
+    fill_matrix(b, 7, 7);
+
+    auto const  r1 = a * b;
+
+    //- Once the arena has grown to fit a product, repeating it allocates only the result; a
+    //  grown arena would be allocated before the old one was released, and so have a new address.
+    //
+    double* const   p_buf  = detail::strassen_workspace<double>::local().buffer(0);
+    long const      before = allocation_count.load();
+    auto const      r2     = a * b;
+
+    EXPECT_NE(p_buf, nullptr);
+    EXPECT_EQ(allocation_count.load() - before, 1);
+    EXPECT_EQ(detail::strassen_workspace<double>::local().buffer(0), p_buf);
+    EXPECT_TRUE(r1 == r2);
+}
@@ -0,0 +1,284 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the singular value decomposition and the utilities built on it.  Operands are
+//  formed from pseudo-random elements; decompositions are checked by forming U*diag(S)*V^T - A,
+//  U^T*U - I, and V*V^T - I, for tall and wide operands, at sizes handled by one-sided Jacobi and
+//  by the blocked bidiagonalization.
+//==================================================================================================
+//
+namespace {
+
+//- Returns the largest elements of U*diag(S)*V^T - A, U^T*U - I, and V^T*V - I, where U and V^T
+//  may be thin or square.
+//
+template<class M1, class M2, class VT, class M3>
+std::tuple<double, double, double>
+svd_error(M1 const& a, M2 const& u, VT const& s, M3 const& vt)
+{
+    using elem_t = typename M1::element_type;
+
+    double  resid = 0.0;
+    double  uorth = 0.0;
+    double  vorth = 0.0;
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            elem_t  r = -a(i, j);
+
+            for (ptrdiff_t k = 0;  k < s.size();  ++k)
+            {
+                r += u(i, k) * s(k) * vt(k, j);
+            }
+            resid = std::max(resid, static_cast<double>(std::abs(r)));
+        }
+    }
+    for (ptrdiff_t i = 0;  i < u.columns();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < u.columns();  ++j)
+        {
+            elem_t  o = (i == j) ? elem_t{-1} : elem_t{};
+
+            for (ptrdiff_t k = 0;  k < u.rows();  ++k)
+            {
+                o += u(k, i) * u(k, j);
+            }
+            uorth = std::max(uorth, static_cast<double>(std::abs(o)));
+        }
+    }
+    for (ptrdiff_t i = 0;  i < vt.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < vt.rows();  ++j)
+        {
+            elem_t  o = (i == j) ? elem_t{-1} : elem_t{};
+
+            for (ptrdiff_t k = 0;  k < vt.columns();  ++k)
+            {
+                o += vt(i, k) * vt(j, k);
+            }
+            vorth = std::max(vorth, static_cast<double>(std::abs(o)));
+        }
+    }
+    return {resid, uorth, vorth};
+}
+
+template<class VT>
+bool
+is_descending(VT const& s)
+{
+    for (ptrdiff_t i = 1;  i < s.size();  ++i)
+    {
+        if (s(i - 1) < s(i)) return false;
+    }
+    return s.size() == 0  ||  s(s.size() - 1) >= 0;
+}
+
+template<class MT>
+void
+check_svd(ptrdiff_t m, ptrdiff_t n, unsigned seed, double tol)
+{
+    MT  a(m, n);
+
+    fill_random(a, seed);
+
+    auto    s0          = singular_values(a);
+    auto [u, s, vt]     = svd(a);
+    auto [uf, sf, vtf]  = svd_full(a);
+
+    ptrdiff_t const     k = std::min(m, n);
+
+    ASSERT_EQ(s0.size(), k);
+    ASSERT_EQ(u.rows(), m);
+    ASSERT_EQ(u.columns(), k);
+    ASSERT_EQ(vt.rows(), k);
+    ASSERT_EQ(vt.columns(), n);
+    ASSERT_EQ(uf.columns(), m);
+    ASSERT_EQ(vtf.rows(), n);
+    EXPECT_TRUE(is_descending(s0));
+    EXPECT_TRUE(is_descending(s));
+
+    for (ptrdiff_t i = 0;  i < k;  ++i)
+    {
+        EXPECT_NEAR(s0(i), s(i), tol);
+        EXPECT_NEAR(sf(i), s(i), tol);
+    }
+
+    auto const  e1 = svd_error(a, u, s, vt);
+    auto const  e2 = svd_error(a, uf, sf, vtf);
+
+    EXPECT_LE(std::get<0>(e1), tol);
+    EXPECT_LE(std::get<1>(e1), tol);
+    EXPECT_LE(std::get<2>(e1), tol);
+    EXPECT_LE(std::get<0>(e2), tol);
+    EXPECT_LE(std::get<1>(e2), tol);
+    EXPECT_LE(std::get<2>(e2), tol);
+}
+
+}   //- anonymous namespace
+
+
+TEST(SvdDecomposition, Decompose)
+{
+    check_svd<dyn_matrix<double>>(1, 1, 1, 1e-14);
+    check_svd<dyn_matrix<double>>(7, 4, 2, 1e-13);
+    check_svd<dyn_matrix<double>>(4, 7, 3, 1e-13);
+    check_svd<dyn_matrix<double>>(30, 30, 4, 1e-12);
+    check_svd<dyn_matrix<double>>(40, 33, 5, 1e-12);
+    check_svd<dyn_matrix<double>>(120, 90, 6, 1e-11);
+    check_svd<dyn_matrix<double>>(80, 150, 7, 1e-11);
+    check_svd<dyn_matrix<double, allocator<double>, column_major>>(100, 100, 8, 1e-11);
+    check_svd<dyn_matrix<float>>(70, 50, 9, 1e-3);
+
+    //- A view is decomposed without being modified.
+    //
+    dyn_matrix<double>  b(100, 90);
+
+    fill_random(b, 10);
+
+    auto [u, s, vt] = svd(b.submatrix(5, 80, 10, 50).t());
+    auto const      e = svd_error(b.submatrix(5, 80, 10, 50).t(), u, s, vt);
+
+    EXPECT_LE(std::get<0>(e), 1e-11);
+    EXPECT_LE(std::get<1>(e), 1e-11);
+    EXPECT_LE(std::get<2>(e), 1e-11);
+}
+
+TEST(SvdDecomposition, FixedSize)
+{
+    using fmat = fs_matrix<double, 5, 3>;
+
+    fmat    a;
+
+    fill_random(a, 20);
+
+    auto    s               = singular_values(a);
+    auto [u, sv, vt]        = svd(a);
+    auto [uf, sf, vtf]      = svd_full(a);
+    auto [wu, ws, wvt]      = svd(a.t());
+    auto    g               = singular_values(dyn_matrix<double>(a));
+
+    EXPECT_TRUE((is_same_v<decltype(s), fs_vector<double, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(u), fs_matrix<double, 5, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(vt), fs_matrix<double, 3, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(uf), fs_matrix<double, 5, 5>>));
+    EXPECT_TRUE((is_same_v<decltype(pinv(a)), fs_matrix<double, 3, 5>>));
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        EXPECT_NEAR(s(i), g(i), 1e-14);
+        EXPECT_NEAR(ws(i), g(i), 1e-14);
+    }
+    EXPECT_LE(std::get<0>(svd_error(a, u, sv, vt)), 1e-14);
+    EXPECT_LE(std::get<1>(svd_error(a, uf, sf, vtf)), 1e-14);
+    EXPECT_LE(std::get<0>(svd_error(a.t(), wu, ws, wvt)), 1e-14);
+
+    //- Fixed-size operands are always decomposed by one-sided Jacobi.
+    //
+    fs_matrix<double, 60, 45>   b;
+
+    fill_random(b, 21);
+
+    auto [bu, bs, bvt] = svd(b);
+    auto const          be = svd_error(b, bu, bs, bvt);
+
+    EXPECT_LE(std::get<0>(be), 1e-12);
+    EXPECT_LE(std::get<1>(be), 1e-12);
+    EXPECT_LE(std::get<2>(be), 1e-12);
+}
+
+TEST(SvdDecomposition, KnownValues)
+{
+    //- diag(3, -4, 0) in a 4x3 matrix has the singular values 4, 3, 0; the zero singular value
+    //  still has a unit left singular vector.
+    //
+    dyn_matrix<double>  a{{3.0, 0.0, 0.0}, {0.0, -4.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+
+    auto [u, s, vt] = svd(a);
+
+    EXPECT_EQ(s(0), 4.0);
+    EXPECT_EQ(s(1), 3.0);
+    EXPECT_EQ(s(2), 0.0);
+    EXPECT_LE(std::get<0>(svd_error(a, u, s, vt)), 1e-15);
+    EXPECT_LE(std::get<1>(svd_error(a, u, s, vt)), 1e-15);
+
+    //- The second-difference matrix tridiag(-1, 2, -1) of order n is symmetric positive
+    //  definite, so its singular values are its eigenvalues 2 - 2*cos(k*pi/(n+1)).
+    //
+    ptrdiff_t const     n  = 100;
+    double const        pi = 3.14159265358979323846;
+
+    dyn_matrix<double>  t(n, n);
+
+    for (ptrdiff_t i = 0;  i < n;  ++i)
+    {
+        t(i, i) = 2.0;
+        if (i > 0) t(i, i - 1) = t(i - 1, i) = -1.0;
+    }
+
+    auto    ts = singular_values(t);
+
+    for (ptrdiff_t k = 0;  k < n;  ++k)
+    {
+        EXPECT_NEAR(ts(k), 2.0 - 2.0*std::cos(static_cast<double>(n - k)*pi/static_cast<double>(n + 1)), 1e-13);
+    }
+
+    EXPECT_NEAR(condition_number(t), ts(0) / ts(n - 1), 1e-8);
+}
+
+TEST(SvdDecomposition, PseudoInverseRankCondition)
+{
+    using dmat = dyn_matrix<double>;
+
+    //- A rank-r operand is formed as the product of (m x r) and (r x n) factors.
+    //
+    dmat    f(90, 20);
+    dmat    g(20, 70);
+
+    fill_random(f, 30);
+    fill_random(g, 31);
+
+    dmat    a = f * g;
+    dmat    x = pinv(a);
+    dmat    c(8, 5);
+
+    fill_random(c, 32);
+
+    EXPECT_EQ(x.rows(), 70);
+    EXPECT_EQ(x.columns(), 90);
+    EXPECT_EQ(matrix_rank(a), 20);
+    EXPECT_EQ(matrix_rank(f), 20);
+    EXPECT_EQ(matrix_rank(a, 1e6), 0);
+    EXPECT_EQ(matrix_rank(dmat(4, 6)), 0);
+    EXPECT_GT(condition_number(a), 1e12);
+    EXPECT_EQ(condition_number(dmat{{1.0, 2.0}, {0.0, 0.0}}), std::numeric_limits<double>::infinity());
+
+    //- The Moore-Penrose conditions A*X*A = A and X*A*X = X, and for a full-rank operand,
+    //  X = (A^T*A)^-1*A^T, so that X*A = I.
+    //
+    dmat    axa = a * x * a;
+    dmat    xax = x * a * x;
+    dmat    xc  = pinv(c) * c;
+
+    for (ptrdiff_t i = 0;  i < a.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < a.columns();  ++j)
+        {
+            EXPECT_NEAR(axa(i, j), a(i, j), 1e-10);
+            EXPECT_NEAR(xax(j, i), x(j, i), 1e-10);
+        }
+    }
+    for (ptrdiff_t i = 0;  i < 5;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 5;  ++j)
+        {
+            EXPECT_NEAR(xc(i, j), (i == j) ? 1.0 : 0.0, 1e-13);
+        }
+    }
+
+    fs_matrix<double, 2, 2>     d{{1.0, 0.0}, {0.0, 1e-3}};
+
+    EXPECT_NEAR(condition_number(d), 1e3, 1e-9);
+    EXPECT_EQ(matrix_rank(d, 1e-2), 1);
+}
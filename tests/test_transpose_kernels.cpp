@@ -0,0 +1,179 @@
+#include "test_common.hpp"
+
+//==================================================================================================
+//  Unit tests for the blocked transpose kernel, which copies elements between span-backed
+//  engines of opposite storage order, such as when a transpose view is materialized.  Every
+//  element is copied without arithmetic, so results are compared for exact equality.
+//==================================================================================================
+//
+namespace {
+
+//- Unlike fill_matrix, gives every element a distinct value, so that an element moved to the
+//  wrong position cannot go unnoticed.
+//
+template<class MT>
+void
+fill_distinct(MT& m, int seed)
+{
+    using elem_t = typename MT::element_type;
+
+    for (typename MT::index_type i = 0;  i < m.rows();  ++i)
+    {
+        for (typename MT::index_type j = 0;  j < m.columns();  ++j)
+        {
+            if constexpr (detail::is_complex_v<elem_t>)
+                m(i, j) = elem_t(static_cast<double>(i*1000 + j), static_cast<double>(seed - j));
+            else
+                m(i, j) = static_cast<elem_t>(i*1000 + j + seed);
+        }
+    }
+}
+
+template<class M1, class M2>
+void
+check_transpose(M1 const& mt, M2 const& m)
+{
+    ASSERT_EQ(mt.rows(), m.columns());
+    ASSERT_EQ(mt.columns(), m.rows());
+
+    for (typename M1::index_type i = 0;  i < mt.rows();  ++i)
+    {
+        for (typename M1::index_type j = 0;  j < mt.columns();  ++j)
+        {
+            ASSERT_EQ(mt(i, j), static_cast<typename M1::element_type>(m(j, i))) << "(" << i << ", " << j << ")";
+        }
+    }
+}
+
+template<class T, class LT>
+void
+check_dyn_transpose(ptrdiff_t rows, ptrdiff_t cols)
+{
+    using mat_t = matrix<dr_matrix_engine<T, std::allocator<T>, LT>>;
+
+    mat_t   m(rows, cols);
+
+    fill_distinct(m, 1);
+
+    mat_t   mt = m.t();
+    check_transpose(mt, m);
+
+    mat_t   mc(2, 2);
+    mc = m.t();
+    check_transpose(mc, m);
+}
+
+}   //- anonymous namespace
+
+
+TEST(TransposeKernels, Tiles)
+{
+    using detail::transpose_tile;
+
+    //- Whatever the tile size, a tile of a column-contiguous source lands in the rows of the
+    //  destination.
+    //
+    if constexpr (transpose_tile<double>::size != 0)
+    {
+        constexpr ptrdiff_t     ts = transpose_tile<double>::size;
+
+        double  src[ts*ts + 3*ts];
+        double  dst[ts*ts + 5*ts] = {};
+
+        for (ptrdiff_t k = 0;  k < ts*ts + 3*ts;  ++k) src[k] = static_cast<double>(k);
+
+        transpose_tile<double>::transpose(src, ts + 3, dst, ts + 5);
+
+        for (ptrdiff_t i = 0;  i < ts;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < ts;  ++j)
+            {
+                EXPECT_EQ(dst[i*(ts + 5) + j], src[i + j*(ts + 3)]);
+            }
+        }
+    }
+
+    if constexpr (transpose_tile<float>::size != 0)
+    {
+        constexpr ptrdiff_t     ts = transpose_tile<float>::size;
+
+        float   src[ts*ts];
+        float   dst[ts*ts] = {};
+
+        for (ptrdiff_t k = 0;  k < ts*ts;  ++k) src[k] = static_cast<float>(k);
+
+        transpose_tile<float>::transpose(src, ts, dst, ts);
+
+        for (ptrdiff_t i = 0;  i < ts;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < ts;  ++j)
+            {
+                EXPECT_EQ(dst[i*ts + j], src[i + j*ts]);
+            }
+        }
+    }
+    EXPECT_EQ(transpose_tile<int>::size, 0);
+}
+
+
+TEST(TransposeKernels, Materialize)
+{
+    //- Sizes below, at, and well above the recursion's leaf size, with partial tiles.
+    //
+    check_dyn_transpose<double, row_major>(1, 1);
+    check_dyn_transpose<double, row_major>(3, 5);
+    check_dyn_transpose<double, row_major>(32, 32);
+    check_dyn_transpose<double, row_major>(257, 130);
+    check_dyn_transpose<double, column_major>(101, 333);
+    check_dyn_transpose<float, row_major>(67, 250);
+    check_dyn_transpose<float, column_major>(256, 9);
+    check_dyn_transpose<int, row_major>(45, 71);
+    check_dyn_transpose<complex<double>, row_major>(70, 39);
+}
+
+
+TEST(TransposeKernels, ViewsAndConversions)
+{
+    dyn_matrix<double>  m(90, 120);
+
+    fill_distinct(m, 2);
+
+    //- The transpose of a submatrix, whose rows are padded.
+    //
+    auto                s  = m.submatrix(5, 75, 11, 89);
+    dyn_matrix<double>  st = s.t();
+    check_transpose(st, s);
+
+    //- Assignment into a submatrix view of an engine of the same layout.
+    //
+    dyn_matrix<double>  d(150, 100);
+
+    fill_distinct(d, 3);
+    d.submatrix(10, 120, 4, 90) = m.t();
+    check_transpose(d.submatrix(10, 120, 4, 90), m);
+    EXPECT_EQ(d(9, 4), 9*1000 + 4 + 3);
+    EXPECT_EQ(d(10, 94), 10*1000 + 94 + 3);
+
+    //- Elements are converted as they are copied.
+    //
+    dyn_matrix<float>   f = m.t();
+    check_transpose(f, m);
+
+    //- Engines of opposite layout are copied without a transpose view.
+    //
+    using cm_matrix = matrix<dr_matrix_engine<double, std::allocator<double>, column_major>>;
+
+    cm_matrix   c = m;
+    EXPECT_TRUE(c == m);
+
+    dyn_matrix<double>  r = c;
+    EXPECT_TRUE(r == m);
+
+    //- Fixed-size engines.
+    //
+    fs_matrix<double, 9, 13>    fa;
+    fill_distinct(fa, 4);
+
+    fs_matrix<double, 13, 9>    fb = fa.t();
+    check_transpose(fb, fa);
+}